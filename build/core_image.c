@@ -0,0 +1,11027 @@
+#ifndef JANET_AMALG
+#include <janet.h>
+#endif
+static const unsigned char janet_core_image_bytes[] = {
+    0xD3, 0x81, 0x83, 0xCF, 0x07, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x3C, 0x3D, 0xD3, 0x02, 0xD0, 0x05, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x17, 0x06, 0x00, 0x00,
+    0x10, 0xCE, 0x07, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C, 0x3D,
+    0x37, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02,
+    0x0A, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00,
+    0x33, 0x04, 0x00, 0x05, 0x1B, 0x02, 0x03, 0x04, 0x1A, 0x02,
+    0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00,
+    0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0xD0, 0x03, 0x64, 0x6F, 0x63, 0xCE,
+    0x6C, 0x28, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C, 0x3D, 0x20,
+    0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x64, 0x65, 0x63, 0x72,
+    0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x63, 0x63,
+    0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20,
+    0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF,
+    0x02, 0x3C, 0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x09, 0x00, 0x1D, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x02, 0x3C,
+    0x3D, 0x37, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19,
+    0x02, 0x0A, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01,
+    0x00, 0x33, 0x04, 0x00, 0x05, 0x3F, 0x02, 0x03, 0x04, 0x1A,
+    0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04,
+    0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE, 0x51, 0x28,
+    0x3C, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6E, 0x75,
+    0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x6E, 0x6F, 0x6E, 0x2D, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E,
+    0xCF, 0x05, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0xD3, 0x02, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x1F, 0x06, 0x00, 0x00,
+    0x10, 0xCE, 0x05, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0x37, 0x01,
+    0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00,
+    0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04,
+    0x00, 0x05, 0x42, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00,
+    0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02,
+    0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0xDA, 0x06, 0xCE, 0x63, 0x28, 0x6E, 0x6F, 0x74,
+    0x3D, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69,
+    0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x65, 0x71, 0x75, 0x61,
+    0x6C, 0x20, 0x28, 0x33, 0x2E, 0x30, 0x20, 0x6E, 0x6F, 0x74,
+    0x3D, 0x3D, 0x20, 0x34, 0x29, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F,
+    0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x09, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65,
+    0x77, 0xDA, 0x06, 0xCE, 0x80, 0xA6, 0x28, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x63, 0x61, 0x70,
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
+    0x20, 0x70, 0x72, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0x6F, 0x63,
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+    0x69, 0x74, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73,
+    0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x28, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x29, 0x20, 0x62, 0x75, 0x74, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+    0x20, 0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61,
+    0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6B, 0x6E, 0x6F, 0x77,
+    0x6E, 0x2E, 0xCF, 0x07, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61,
+    0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07, 0x6D, 0x61, 0x72,
+    0x73, 0x68, 0x61, 0x6C, 0xDA, 0x06, 0xCE, 0x81, 0x7B, 0x28,
+    0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x78, 0x20,
+    0x5B, 0x2C, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x2D,
+    0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x5B, 0x2C, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x5D, 0x5D, 0x29, 0x0A, 0x0A,
+    0x4D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x61, 0x20,
+    0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x74, 0x65, 0x72, 0x20, 0x62, 0x65, 0x20, 0x75, 0x6E, 0x6D,
+    0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x6E, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69,
+    0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x2E, 0x20, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20, 0x6F, 0x6E, 0x65, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20,
+    0x61, 0x6C, 0x69, 0x61, 0x73, 0x65, 0x64, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x6E, 0x20, 0x61,
+    0x20, 0x66, 0x6F, 0x72, 0x77, 0x61, 0x72, 0x64, 0x6C, 0x6F,
+    0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x63, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72,
+    0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x77,
+    0x68, 0x65, 0x6E, 0x20, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73,
+    0x68, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x2E, 0xCF, 0x08,
+    0x72, 0x6F, 0x70, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x08, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x6E,
+    0x65, 0x77, 0xDA, 0x06, 0xCE, 0x81, 0x44, 0x28, 0x72, 0x6F,
+    0x70, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x69, 0x7A,
+    0x65, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x2C, 0x20, 0x65,
+    0x6D, 0x70, 0x74, 0x79, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x2E,
+    0x20, 0x41, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x62,
+    0x65, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x69,
+    0x74, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x73, 0x20, 0x69,
+    0x74, 0x73, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x61, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x2C,
+    0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x6E, 0x65, 0x76,
+    0x65, 0x72, 0x20, 0x6D, 0x6F, 0x76, 0x65, 0x73, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x77, 0x65, 0x72, 0x65, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61,
+    0x64, 0x79, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x2E,
+    0x20, 0x55, 0x73, 0x65, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20,
+    0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70,
+    0x75, 0x74, 0x73, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20,
+    0x62, 0x79, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x2E, 0x20,
+    0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x69, 0x7A, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7A,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x32, 0x35, 0x36, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x2E, 0xCF, 0x0A, 0x66, 0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0xD4, 0x02, 0xD3, 0x02, 0xD0, 0x08, 0x6E,
+    0x6F, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0xCB, 0xDA, 0x06,
+    0xCE, 0x67, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69,
+    0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x46, 0x69, 0x6E, 0x64, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x6F, 0x66, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x70, 0x72, 0x65, 0x64,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+    0x6C, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66,
+    0x6F, 0x75, 0x6E, 0x64, 0x2E, 0xD0, 0x0A, 0x73, 0x6F, 0x75,
+    0x72, 0x63, 0x65, 0x2D, 0x6D, 0x61, 0x70, 0xD2, 0x03, 0x00,
+    0xCE, 0x0A, 0x63, 0x6F, 0x72, 0x65, 0x2E, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0xCD, 0x00, 0x00, 0x62, 0xAC, 0xCD, 0x00, 0x00,
+    0x63, 0xDB, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x0A, 0x02, 0x00, 0x13, 0xCE, 0x0A, 0x66, 0x69, 0x6E, 0x64,
+    0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0xDA, 0x24, 0x37, 0x04,
+    0x01, 0x00, 0x25, 0x05, 0x00, 0x00, 0x23, 0x06, 0x00, 0x00,
+    0x3E, 0x08, 0x05, 0x04, 0x1A, 0x08, 0x03, 0x00, 0x17, 0x07,
+    0x06, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00,
+    0x1A, 0x07, 0x08, 0x00, 0x33, 0x09, 0x01, 0x05, 0x44, 0x08,
+    0x09, 0x00, 0x1A, 0x08, 0x03, 0x00, 0x24, 0x06, 0x00, 0x00,
+    0x18, 0xF6, 0xFF, 0xFF, 0x05, 0x05, 0x05, 0x01, 0x18, 0xF4,
+    0xFF, 0xFF, 0x1A, 0x06, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x03, 0x05, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x63, 0x34, 0x0B,
+    0x05, 0x08, 0x04, 0x0F, 0x0F, 0x08, 0xBF, 0xF4, 0x13, 0xBF,
+    0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xE6,
+    0x64, 0xBF, 0xC6, 0x0A, 0x0B, 0x0A, 0xBF, 0xF2, 0x28, 0xBF,
+    0xE8, 0x10, 0xBF, 0xE0, 0x28, 0xBF, 0xFA, 0x05, 0xBF, 0x9E,
+    0x64, 0x04, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xCF,
+    0x04, 0x6B, 0x65, 0x79, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x38, 0x28, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x80,
+    0xE7, 0xCD, 0x00, 0x00, 0x81, 0xAF, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x08, 0x01, 0x03, 0x13, 0xCE, 0x04,
+    0x6B, 0x65, 0x79, 0x73, 0xDA, 0x24, 0xDA, 0x14, 0xD8, 0x04,
+    0x6E, 0x65, 0x78, 0x74, 0xD8, 0x0A, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x37, 0x02, 0x00, 0x00,
+    0x2B, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x22, 0x04,
+    0x00, 0x00, 0x2C, 0x00, 0x04, 0x00, 0x43, 0x05, 0x01, 0x00,
+    0x22, 0x07, 0x00, 0x00, 0x1F, 0x06, 0x07, 0x05, 0x19, 0x06,
+    0x03, 0x00, 0x23, 0x06, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x24, 0x06, 0x00, 0x00, 0x1A, 0x06, 0x06, 0x00, 0x2C, 0x02,
+    0x05, 0x00, 0x43, 0x07, 0x02, 0x00, 0x2C, 0x00, 0x05, 0x00,
+    0x43, 0x05, 0x01, 0x00, 0x18, 0xF5, 0xFF, 0xFF, 0x03, 0x02,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x81, 0x41, 0x09, 0xBF, 0xEC,
+    0x15, 0xBF, 0xEB, 0x15, 0x0C, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF,
+    0xF5, 0x0B, 0x0C, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B,
+    0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF,
+    0xEE, 0x41, 0xBF, 0xD7, 0x11, 0xBF, 0xEF, 0x11, 0x0D, 0x09,
+    0xBF, 0xF7, 0x09, 0xBF, 0xC1, 0x41, 0xBF, 0x3F, 0x80, 0xC8,
+    0xCF, 0x07, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x07, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+    0x72, 0x64, 0xDA, 0x06, 0xCE, 0x80, 0xA7, 0x28, 0x6B, 0x65,
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x26, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x20, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74,
+    0x65, 0x6E, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74,
+    0x68, 0x65, 0x72, 0x2E, 0x20, 0x56, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x64,
+    0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6B, 0x65, 0x79, 0x77,
+    0x6F, 0x72, 0x64, 0x2E, 0xCF, 0x0C, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0xDA, 0x06, 0xCE, 0x81,
+    0x00, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x69, 0x6E,
+    0x73, 0x65, 0x72, 0x74, 0x20, 0x61, 0x72, 0x72, 0x20, 0x61,
+    0x74, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x49,
+    0x6E, 0x73, 0x65, 0x72, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x6F, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x61, 0x72, 0x72,
+    0x20, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x61, 0x74, 0x2E, 0x20, 0x61, 0x74, 0x20, 0x73, 0x68, 0x6F,
+    0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20,
+    0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x30, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65,
+    0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x41,
+    0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C,
+    0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x61, 0x74, 0x20, 0x2D, 0x31, 0x20, 0x61, 0x70, 0x70,
+    0x65, 0x6E, 0x64, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xCF, 0x11, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x2D,
+    0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x11, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E,
+    0x65, 0x77, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0xDA,
+    0x06, 0xCE, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x6E, 0x65, 0x77, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65,
+    0x64, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x5B, 0x2C,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x3D, 0x30, 0x5D, 0x29, 0x0A,
+    0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+    0x68, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x66, 0x69,
+    0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF,
+    0x10, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75,
+    0x73, 0x68, 0x2D, 0x77, 0x6F, 0x72, 0x64, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x10, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x70, 0x75, 0x73, 0x68, 0x2D, 0x77, 0x6F, 0x72, 0x64, 0xDA,
+    0x06, 0xCE, 0x80, 0xE1, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x77, 0x6F, 0x72,
+    0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x41, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20,
+    0x61, 0x20, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x20,
+    0x77, 0x6F, 0x72, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61,
+    0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x77, 0x6F, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x62, 0x69,
+    0x67, 0x20, 0x65, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x20, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x2C, 0x20, 0x75, 0x6E, 0x73, 0x69,
+    0x67, 0x6E, 0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20,
+    0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x73, 0x2E, 0xCF,
+    0x0B, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x6C,
+    0x69, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x6C, 0x69, 0x74, 0xDA,
+    0x06, 0xCE, 0x81, 0x16, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2F, 0x62, 0x6C, 0x69, 0x74, 0x20, 0x64, 0x65, 0x73,
+    0x74, 0x20, 0x73, 0x72, 0x63, 0x20, 0x5B, 0x2C, 0x20, 0x64,
+    0x65, 0x73, 0x74, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D,
+    0x30, 0x20, 0x5B, 0x2C, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x3D, 0x30, 0x20, 0x5B, 0x2C, 0x20,
+    0x73, 0x72, 0x63, 0x2D, 0x65, 0x6E, 0x64, 0x3D, 0x2D, 0x31,
+    0x5D, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x73,
+    0x72, 0x63, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65,
+    0x73, 0x74, 0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20, 0x6F, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x74,
+    0x61, 0x6B, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65,
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x64,
+    0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x77, 0x68, 0x69, 0x63,
+    0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66, 0x20,
+    0x73, 0x72, 0x63, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x70,
+    0x79, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x77, 0x68, 0x69,
+    0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66,
+    0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x20, 0x49, 0x6E, 0x64,
+    0x69, 0x63, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+    0x65, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+    0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x72, 0x63, 0x20,
+    0x6F, 0x72, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x64, 0x65, 0x73,
+    0x74, 0x2E, 0xCF, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0xDA, 0x06,
+    0xCE, 0x80, 0xD0, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x20, 0x5B, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x5D, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20, 0x57, 0x69,
+    0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x68, 0x72,
+    0x6F, 0x77, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x20, 0x53, 0x74, 0x61,
+    0x72, 0x74, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x79,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x2E, 0xCF, 0x0E, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75,
+    0x6E, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0E, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75,
+    0x6E, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xDA, 0x06, 0xCE,
+    0x47, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75, 0x6E,
+    0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20, 0x66, 0x75, 0x6E,
+    0x20, 0x5B, 0x2C, 0x70, 0x63, 0x3D, 0x30, 0x5D, 0x29, 0x0A,
+    0x0A, 0x55, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x61, 0x20, 0x62,
+    0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72, 0x65, 0x61,
+    0x6B, 0x2E, 0xCF, 0x0B, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0B, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61,
+    0x63, 0x6B, 0xDA, 0x06, 0xCE, 0x83, 0x2D, 0x28, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20,
+    0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73,
+    0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x61,
+    0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73,
+    0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x61, 0x69, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F,
+    0x75, 0x74, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x74, 0x6F, 0x70, 0x20, 0x6D, 0x6F, 0x73, 0x74,
+    0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x20,
+    0x6D, 0x6F, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68,
+    0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61,
+    0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E,
+    0x73, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77,
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+    0x75, 0x74, 0x65, 0x73, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x63,
+    0x20, 0x2D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x20, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x76, 0x6F, 0x63, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x0A, 0x09, 0x3A, 0x63, 0x6F, 0x6C, 0x75,
+    0x6D, 0x6E, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x6F, 0x75,
+    0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+    0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A,
+    0x09, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x72, 0x65, 0x70,
+    0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x73, 0x0A, 0x09, 0x3A,
+    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x73,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6C, 0x69, 0x6E, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+    0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A,
+    0x09, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x2D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x68, 0x75, 0x6D, 0x61, 0x6E, 0x20, 0x66,
+    0x72, 0x69, 0x65, 0x6E, 0x64, 0x6C, 0x79, 0x20, 0x6E, 0x61,
+    0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09,
+    0x3A, 0x70, 0x63, 0x20, 0x2D, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72,
+    0x61, 0x6D, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72,
+    0x0A, 0x09, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+    0x2D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x72,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x64, 0x65,
+    0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x0A, 0x09, 0x3A,
+    0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20, 0x2D, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x6C, 0x6F, 0x74,
+    0x0A, 0x09, 0x3A, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x2D, 0x20,
+    0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x20, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x63, 0x61, 0x6C, 0x6C,
+    0xCF, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61,
+    0x73, 0x63, 0x69, 0x69, 0x2D, 0x6C, 0x6F, 0x77, 0x65, 0x72,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x12, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2D, 0x6C,
+    0x6F, 0x77, 0x65, 0x72, 0xDA, 0x06, 0xCE, 0x80, 0xBE, 0x28,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63,
+    0x69, 0x69, 0x2D, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x73,
+    0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x68, 0x65, 0x72,
+    0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C,
+    0x61, 0x63, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x63,
+    0x61, 0x73, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F,
+    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x73,
+    0x65, 0x6C, 0x76, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x41,
+    0x53, 0x43, 0x49, 0x49, 0x2E, 0x20, 0x44, 0x6F, 0x65, 0x73,
+    0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65,
+    0x72, 0x79, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20,
+    0x63, 0x61, 0x73, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B,
+    0x2C, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x69, 0x6E, 0x67, 0x20,
+    0x6E, 0x6F, 0x20, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0xCF,
+    0x0A, 0x73, 0x65, 0x74, 0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x76,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x73, 0x65, 0x74,
+    0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0xDA, 0x06, 0xCE,
+    0x41, 0x28, 0x73, 0x65, 0x74, 0x2F, 0x72, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x26, 0x20, 0x78,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x65, 0x74, 0x2E, 0xCF, 0x0A, 0x77, 0x69,
+    0x74, 0x68, 0x2D, 0x69, 0x64, 0x65, 0x6D, 0x70, 0xD4, 0x02,
+    0xD3, 0x02, 0xD0, 0x05, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0xCB,
+    0xDA, 0x06, 0xCE, 0x81, 0x3C, 0x28, 0x77, 0x69, 0x74, 0x68,
+    0x2D, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6A, 0x61, 0x6E, 0x65,
+    0x74, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x62, 0x6F, 0x64,
+    0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x73,
+    0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x65, 0x70,
+    0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x74, 0x6F, 0x6D, 0x2E, 0x20, 0x49,
+    0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x69, 0x64, 0x65, 0x6D,
+    0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x28, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x2C,
+    0x20, 0x65, 0x74, 0x63, 0x2E, 0x29, 0x2C, 0x20, 0x6D, 0x61,
+    0x6B, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x69, 0x6E,
+    0x67, 0x20, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x6E, 0x63,
+    0x65, 0x2C, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66,
+    0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x61, 0x69, 0x6E, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69,
+    0x70, 0x6C, 0x65, 0x20, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x62, 0x6F, 0x64,
+    0x79, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65,
+    0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8F, 0x98,
+    0x91, 0xFC, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00,
+    0x10, 0x02, 0x09, 0x35, 0xCE, 0x0A, 0x77, 0x69, 0x74, 0x68,
+    0x2D, 0x69, 0x64, 0x65, 0x6D, 0x70, 0xDA, 0x24, 0xD8, 0x06,
+    0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0xCF, 0x03, 0x64, 0x65,
+    0x66, 0xCF, 0x0B, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74,
+    0x65, 0x6E, 0x74, 0x3F, 0xCF, 0x06, 0x67, 0x65, 0x6E, 0x73,
+    0x79, 0x6D, 0xCF, 0x02, 0x69, 0x66, 0xCF, 0x02, 0x64, 0x6F,
+    0xCF, 0x01, 0x3D, 0xCF, 0x05, 0x71, 0x75, 0x6F, 0x74, 0x65,
+    0xCF, 0x05, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x43, 0x05, 0x00,
+    0x00, 0x43, 0x07, 0x00, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2D,
+    0x09, 0x07, 0x01, 0x3D, 0x08, 0x00, 0x00, 0x26, 0x0A, 0x02,
+    0x00, 0x2C, 0x0A, 0x07, 0x00, 0x3D, 0x09, 0x00, 0x00, 0x26,
+    0x0B, 0x03, 0x00, 0x2B, 0x0B, 0x00, 0x00, 0x3D, 0x0A, 0x00,
+    0x00, 0x26, 0x0C, 0x04, 0x00, 0x2D, 0x0C, 0x09, 0x07, 0x2B,
+    0x0A, 0x00, 0x00, 0x3D, 0x0B, 0x00, 0x00, 0x26, 0x0A, 0x01,
+    0x00, 0x2D, 0x0A, 0x00, 0x0B, 0x3D, 0x09, 0x00, 0x00, 0x26,
+    0x0B, 0x05, 0x00, 0x2B, 0x0B, 0x00, 0x00, 0x2E, 0x02, 0x00,
+    0x00, 0x3D, 0x0A, 0x00, 0x00, 0x26, 0x0C, 0x01, 0x00, 0x2D,
+    0x0C, 0x05, 0x0A, 0x3D, 0x0B, 0x00, 0x00, 0x26, 0x0C, 0x06,
+    0x00, 0x2D, 0x0C, 0x07, 0x00, 0x3D, 0x0A, 0x00, 0x00, 0x26,
+    0x0D, 0x07, 0x00, 0x26, 0x0E, 0x05, 0x00, 0x2C, 0x0D, 0x0E,
+    0x00, 0x3D, 0x0C, 0x00, 0x00, 0x26, 0x0E, 0x07, 0x00, 0x26,
+    0x0F, 0x01, 0x00, 0x2C, 0x0E, 0x0F, 0x00, 0x3D, 0x0D, 0x00,
+    0x00, 0x26, 0x0F, 0x08, 0x00, 0x2D, 0x0F, 0x0D, 0x00, 0x2B,
+    0x07, 0x00, 0x00, 0x3D, 0x0E, 0x00, 0x00, 0x26, 0x0F, 0x08,
+    0x00, 0x2D, 0x0F, 0x0C, 0x0E, 0x2B, 0x05, 0x00, 0x00, 0x3D,
+    0x0D, 0x00, 0x00, 0x26, 0x0E, 0x04, 0x00, 0x2D, 0x0E, 0x0A,
+    0x05, 0x2B, 0x0D, 0x00, 0x00, 0x3D, 0x0C, 0x00, 0x00, 0x26,
+    0x0D, 0x05, 0x00, 0x2D, 0x0D, 0x08, 0x09, 0x2C, 0x0B, 0x0C,
+    0x00, 0x3D, 0x0A, 0x00, 0x00, 0x03, 0x0A, 0x00, 0x00, 0x90,
+    0xF7, 0x07, 0x10, 0x07, 0x05, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xCF, 0x05, 0x61,
+    0x73, 0x3F, 0x2D, 0x3E, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C,
+    0xCB, 0xDA, 0x06, 0xCE, 0x80, 0xDE, 0x28, 0x61, 0x73, 0x3F,
+    0x2D, 0x3E, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x26, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+    0x20, 0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2C,
+    0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x69, 0x6E, 0x67,
+    0x20, 0x61, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x76,
+    0x69, 0x6F, 0x75, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x79, 0x2C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69,
+    0x6C, 0x3B, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+    0x73, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x77, 0xAA,
+    0xCD, 0x00, 0x00, 0x79, 0x53, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0xBB, 0x00, 0x00, 0x09, 0x02, 0x03, 0x09, 0x02, 0xCE, 0x05,
+    0x61, 0x73, 0x3F, 0x2D, 0x3E, 0xDA, 0x24, 0xDA, 0x60, 0xD7,
+    0xCD, 0x00, 0xBE, 0x00, 0x00, 0x05, 0x02, 0x01, 0x06, 0x01,
+    0xCE, 0x08, 0x70, 0x6F, 0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B,
+    0xDA, 0x24, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0A, 0x02,
+    0x09, 0x1F, 0xCE, 0x04, 0x77, 0x61, 0x6C, 0x6B, 0xDA, 0x24,
+    0xD8, 0x04, 0x74, 0x79, 0x70, 0x65, 0xD0, 0x05, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0C,
+    0x02, 0x01, 0x15, 0xCE, 0x09, 0x77, 0x61, 0x6C, 0x6B, 0x2D,
+    0x64, 0x69, 0x63, 0x74, 0xDA, 0x24, 0xDA, 0x2E, 0x3C, 0x04,
+    0x00, 0x00, 0x17, 0x05, 0x01, 0x00, 0x22, 0x06, 0x00, 0x00,
+    0x2C, 0x05, 0x06, 0x00, 0x43, 0x07, 0x00, 0x00, 0x22, 0x08,
+    0x00, 0x00, 0x1F, 0x06, 0x08, 0x07, 0x19, 0x06, 0x03, 0x00,
+    0x23, 0x06, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x06,
+    0x00, 0x00, 0x1A, 0x06, 0x09, 0x00, 0x17, 0x08, 0x07, 0x00,
+    0x44, 0x09, 0x08, 0x00, 0x33, 0x0A, 0x01, 0x08, 0x44, 0x0B,
+    0x0A, 0x00, 0x34, 0x04, 0x09, 0x0B, 0x2C, 0x05, 0x07, 0x00,
+    0x43, 0x07, 0x00, 0x00, 0x18, 0xF2, 0xFF, 0xFF, 0x03, 0x04,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x73, 0x31, 0x0C, 0x04, 0x39,
+    0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF,
+    0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7,
+    0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39,
+    0xBF, 0xC7, 0x39, 0xBF, 0xE9, 0x04, 0x05, 0x0B, 0xBF, 0xF2,
+    0x0F, 0xBF, 0xE2, 0x1F, 0xBF, 0xC8, 0x39, 0xBF, 0xC7, 0x39,
+    0xBF, 0xC7, 0x39, 0xBF, 0x9C, 0x6B, 0xD0, 0x06, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0xD8, 0x0F, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0xD0, 0x05, 0x61, 0x72, 0x72, 0x61, 0x79, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x0E, 0x02, 0x02, 0x0F, 0xCE, 0x08,
+    0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x69, 0x6E, 0x64, 0xDA, 0x24,
+    0xDA, 0x14, 0xDA, 0x2F, 0x37, 0x04, 0x01, 0x00, 0x2B, 0x04,
+    0x00, 0x00, 0x43, 0x06, 0x00, 0x00, 0x17, 0x07, 0x01, 0x00,
+    0x37, 0x09, 0x07, 0x00, 0x25, 0x08, 0x00, 0x00, 0x3E, 0x0A,
+    0x08, 0x09, 0x1A, 0x0A, 0x07, 0x00, 0x33, 0x0C, 0x07, 0x08,
+    0x44, 0x0B, 0x0C, 0x00, 0x2C, 0x06, 0x0B, 0x00, 0x43, 0x0D,
+    0x01, 0x00, 0x05, 0x08, 0x08, 0x01, 0x18, 0xF9, 0xFF, 0xFF,
+    0x03, 0x06, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x72, 0xBC, 0x0C,
+    0x0E, 0x0E, 0xBF, 0xF2, 0x0E, 0x05, 0x23, 0xBF, 0xDD, 0x23,
+    0xBF, 0xDD, 0x23, 0xBF, 0xDD, 0x23, 0xBF, 0xDD, 0x23, 0xBF,
+    0xDD, 0x23, 0xBF, 0xFA, 0x04, 0xBF, 0xEC, 0x15, 0xBF, 0xEB,
+    0x15, 0xBF, 0xDE, 0x23, 0xBF, 0xDD, 0x23, 0xBF, 0x8D, 0x7A,
+    0xD0, 0x05, 0x74, 0x75, 0x70, 0x6C, 0x65, 0xD8, 0x0B, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+    0x2B, 0x01, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x1F, 0x03, 0x04, 0x05, 0x1A, 0x03, 0x04, 0x00,
+    0x2C, 0x00, 0x01, 0x00, 0x26, 0x05, 0x02, 0x00, 0x30, 0x05,
+    0x00, 0x00, 0x26, 0x06, 0x03, 0x00, 0x1F, 0x05, 0x04, 0x06,
+    0x1A, 0x05, 0x06, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x43, 0x06,
+    0x02, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x07, 0x04, 0x00,
+    0x30, 0x07, 0x00, 0x00, 0x26, 0x07, 0x05, 0x00, 0x1F, 0x06,
+    0x04, 0x07, 0x1A, 0x06, 0x04, 0x00, 0x2C, 0x00, 0x01, 0x00,
+    0x26, 0x07, 0x06, 0x00, 0x30, 0x07, 0x00, 0x00, 0x26, 0x08,
+    0x07, 0x00, 0x1F, 0x07, 0x04, 0x08, 0x1A, 0x07, 0x06, 0x00,
+    0x2C, 0x00, 0x01, 0x00, 0x43, 0x08, 0x06, 0x00, 0x2B, 0x08,
+    0x00, 0x00, 0x26, 0x09, 0x08, 0x00, 0x30, 0x09, 0x00, 0x00,
+    0x03, 0x01, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x74, 0x48, 0x0A,
+    0xBF, 0xF6, 0x0A, 0xBF, 0xF0, 0x80, 0xB1, 0xBF, 0x4F, 0x80,
+    0xB1, 0xBF, 0x4F, 0x80, 0xB1, 0xBF, 0x6C, 0x11, 0xBF, 0xEF,
+    0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xD2, 0x80, 0xB1, 0xBF, 0x4F,
+    0x80, 0xB1, 0xBF, 0x4F, 0x80, 0xB1, 0xBF, 0x9C, 0x11, 0xBF,
+    0xEF, 0x11, 0xBF, 0xDE, 0x23, 0xBF, 0xDD, 0x23, 0xBF, 0xDD,
+    0x23, 0xBF, 0xA1, 0x80, 0xB1, 0xBF, 0x4F, 0x80, 0xB1, 0xBF,
+    0x4F, 0x80, 0xB1, 0xBF, 0xBB, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0x84, 0x80, 0xB1, 0xBF, 0x4F, 0x80, 0xB1,
+    0xBF, 0x4F, 0x80, 0xB1, 0xBF, 0xE5, 0x10, 0xBF, 0xF0, 0x10,
+    0xBF, 0xE3, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF,
+    0x59, 0x80, 0xB1, 0x28, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x00,
+    0x00, 0x2C, 0x03, 0x01, 0x00, 0x43, 0x04, 0x00, 0x00, 0x2B,
+    0x04, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xCD, 0x00, 0xD4,
+    0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x01, 0xDA, 0x24, 0x27,
+    0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00,
+    0x02, 0x30, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00,
+    0x75, 0xB0, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF,
+    0xF3, 0x0D, 0xCD, 0x00, 0x00, 0x75, 0x2B, 0x80, 0x9B, 0xBF,
+    0xE2, 0x16, 0xBF, 0xE4, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDB,
+    0x26, 0xBF, 0xDA, 0x26, 0xCF, 0x06, 0x69, 0x66, 0x2D, 0x6C,
+    0x65, 0x74, 0x28, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00,
+    0x17, 0x05, 0x02, 0x00, 0x37, 0x06, 0x05, 0x00, 0x17, 0x07,
+    0x06, 0x00, 0x25, 0x06, 0x00, 0x00, 0x2A, 0x08, 0x01, 0x00,
+    0x2F, 0x08, 0x08, 0x00, 0x03, 0x04, 0x00, 0x00, 0xCD, 0x00,
+    0xD4, 0x00, 0x00, 0x03, 0x01, 0x00, 0x06, 0x01, 0xDA, 0x24,
+    0x27, 0x02, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x02, 0x1A, 0x01,
+    0x03, 0x00, 0x27, 0x02, 0x00, 0x0B, 0x03, 0x02, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x79,
+    0x03, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF5, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xCD, 0x00, 0xFA,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x1B, 0x01, 0x01, 0xCE, 0x06,
+    0x5F, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xDA, 0x24, 0xDA, 0x60,
+    0xDA, 0x7E, 0xDA, 0x7F, 0x27, 0x01, 0x00, 0x06, 0x27, 0x02,
+    0x00, 0x07, 0x3E, 0x00, 0x01, 0x02, 0x19, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x05, 0x27, 0x03,
+    0x00, 0x06, 0x33, 0x01, 0x02, 0x03, 0x17, 0x02, 0x01, 0x00,
+    0x43, 0x01, 0x00, 0x00, 0x17, 0x03, 0x01, 0x00, 0x2A, 0x01,
+    0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x43, 0x04, 0x01, 0x00,
+    0x17, 0x01, 0x04, 0x00, 0x27, 0x05, 0x00, 0x04, 0x2C, 0x03,
+    0x05, 0x00, 0x3D, 0x04, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00,
+    0x2D, 0x06, 0x04, 0x01, 0x3D, 0x05, 0x00, 0x00, 0x29, 0x05,
+    0x00, 0x04, 0x27, 0x04, 0x00, 0x06, 0x05, 0x01, 0x04, 0x01,
+    0x29, 0x01, 0x00, 0x06, 0x28, 0x04, 0x00, 0x00, 0x30, 0x04,
+    0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0xD4, 0x00, 0x00, 0x03,
+    0x01, 0x00, 0x06, 0x02, 0xDA, 0x24, 0x27, 0x02, 0x00, 0x01,
+    0x1F, 0x01, 0x00, 0x02, 0x1A, 0x01, 0x03, 0x00, 0x27, 0x02,
+    0x01, 0x03, 0x03, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x79, 0x03, 0x07, 0xBF,
+    0xF9, 0x07, 0xBF, 0xF5, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEE, 0x12, 0xCD, 0x00, 0x00, 0x78, 0xAC, 0x80,
+    0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF,
+    0x61, 0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF, 0x61, 0x80,
+    0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF,
+    0x61, 0x80, 0x9F, 0xBF, 0x85, 0x07, 0xBF, 0xF0, 0x11, 0x1F,
+    0x1B, 0xBF, 0xDB, 0x2B, 0xBF, 0xD5, 0x2B, 0xBF, 0xC6, 0x3B,
+    0x10, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0,
+    0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20,
+    0xBF, 0x63, 0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF, 0x61,
+    0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F,
+    0xCD, 0x00, 0x00, 0x77, 0xAA, 0x81, 0xA9, 0xBF, 0x4A, 0x0B,
+    0x04, 0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF, 0x61, 0x80,
+    0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF, 0x61, 0x80, 0x9F, 0xBF,
+    0x61, 0x80, 0x9F, 0xBE, 0x5F, 0x81, 0xA9, 0xCF, 0x05, 0x70,
+    0x61, 0x69, 0x72, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x3B, 0x28, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x82, 0x89, 0xCD, 0x00, 0x00, 0x83, 0x66, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x09, 0x01, 0x04, 0x16,
+    0xCE, 0x05, 0x70, 0x61, 0x69, 0x72, 0x73, 0xDA, 0x24, 0xDA,
+    0x14, 0xDA, 0x2E, 0xD8, 0x05, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0xDA, 0x2F, 0x37, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00,
+    0x43, 0x02, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x2C, 0x00,
+    0x04, 0x00, 0x43, 0x05, 0x01, 0x00, 0x22, 0x07, 0x00, 0x00,
+    0x1F, 0x06, 0x07, 0x05, 0x19, 0x06, 0x03, 0x00, 0x23, 0x06,
+    0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
+    0x1A, 0x06, 0x09, 0x00, 0x33, 0x07, 0x00, 0x05, 0x2C, 0x05,
+    0x07, 0x00, 0x43, 0x08, 0x02, 0x00, 0x2C, 0x02, 0x08, 0x00,
+    0x43, 0x07, 0x03, 0x00, 0x2C, 0x00, 0x05, 0x00, 0x43, 0x05,
+    0x01, 0x00, 0x18, 0xF2, 0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x82, 0xE6, 0x09, 0xBF, 0xEC, 0x15, 0xBF,
+    0xEB, 0x15, 0x0C, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B,
+    0x0C, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5,
+    0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xEE, 0x53,
+    0xBF, 0xDE, 0x08, 0xBF, 0xEF, 0x12, 0xBF, 0xEE, 0x12, 0xBF,
+    0xDE, 0x23, 0xBF, 0xDD, 0x23, 0x0D, 0x09, 0xBF, 0xF7, 0x09,
+    0xBF, 0xAF, 0x53, 0xBF, 0x2A, 0x80, 0xDD, 0xCF, 0x04, 0x6D,
+    0x65, 0x74, 0x61, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB,
+    0xDA, 0x06, 0xCE, 0x37, 0x28, 0x6D, 0x65, 0x74, 0x61, 0x20,
+    0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x41,
+    0x64, 0x64, 0x20, 0x6D, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76,
+    0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xD6,
+    0x6E, 0xCD, 0x00, 0x00, 0xD7, 0x00, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x99, 0x00, 0x00, 0x0A, 0x00, 0x03, 0x15, 0xCE, 0x04,
+    0x6D, 0x65, 0x74, 0x61, 0xDA, 0x24, 0xD8, 0x05, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0xDA, 0x2E, 0xD1, 0x01, 0xDA, 0x00, 0x2E,
+    0x00, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x22, 0x05, 0x00,
+    0x00, 0x2C, 0x04, 0x05, 0x00, 0x43, 0x06, 0x01, 0x00, 0x22,
+    0x07, 0x00, 0x00, 0x1F, 0x05, 0x07, 0x06, 0x19, 0x05, 0x03,
+    0x00, 0x23, 0x05, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24,
+    0x05, 0x00, 0x00, 0x1A, 0x05, 0x09, 0x00, 0x17, 0x07, 0x06,
+    0x00, 0x33, 0x09, 0x04, 0x06, 0x26, 0x08, 0x02, 0x00, 0x35,
+    0x08, 0x08, 0x00, 0x34, 0x08, 0x07, 0x09, 0x2C, 0x04, 0x06,
+    0x00, 0x43, 0x06, 0x01, 0x00, 0x18, 0xF2, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0xD6, 0xC1, 0x0C, 0xBF,
+    0xF4, 0x0C, 0x05, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D,
+    0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF,
+    0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3,
+    0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xF1, 0x0E,
+    0xBF, 0xF2, 0x0E, 0xBF, 0xF2, 0x0E, 0xBF, 0xD4, 0x2D, 0xBF,
+    0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xCF, 0x01,
+    0x2D, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00,
+    0x0A, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x01, 0x2D, 0x37, 0x01,
+    0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00,
+    0x25, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02,
+    0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x00, 0x00,
+    0x35, 0x04, 0x00, 0x00, 0x07, 0x03, 0x03, 0x04, 0x03, 0x03,
+    0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00,
+    0x33, 0x04, 0x00, 0x05, 0x07, 0x03, 0x03, 0x04, 0x05, 0x05,
+    0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF,
+    0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE, 0x80, 0xDB, 0x28,
+    0x2D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x49,
+    0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D,
+    0x70, 0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x30, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78,
+    0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+    0x73, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x6D, 0x69, 0x6E, 0x75,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73,
+    0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0xCF, 0x06,
+    0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x06, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0xDA, 0x06,
+    0xCE, 0x18, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E,
+    0x64, 0x61, 0x72, 0x64, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x0A, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x31, 0x30, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C,
+    0x6F, 0x67, 0x31, 0x30, 0xDA, 0x06, 0xCE, 0x29, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x31, 0x30, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x6C, 0x6F, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65,
+    0x20, 0x31, 0x30, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+    0x0E, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x62, 0x72, 0x61,
+    0x63, 0x6B, 0x65, 0x74, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0E, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x62, 0x72, 0x61,
+    0x63, 0x6B, 0x65, 0x74, 0x73, 0xDA, 0x06, 0xCE, 0x50, 0x28,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x62, 0x72, 0x61, 0x63,
+    0x6B, 0x65, 0x74, 0x73, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x72, 0x61, 0x63,
+    0x6B, 0x65, 0x74, 0x65, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x78, 0x73, 0x2E, 0xCF,
+    0x07, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x07, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+    0x65, 0xDA, 0x06, 0xCE, 0x81, 0x04, 0x28, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x73, 0x74, 0x20, 0x65,
+    0x6E, 0x76, 0x20, 0x5B, 0x2C, 0x20, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x5D, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x41, 0x62,
+    0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x53, 0x79, 0x6E,
+    0x74, 0x61, 0x78, 0x20, 0x54, 0x72, 0x65, 0x65, 0x20, 0x28,
+    0x61, 0x73, 0x74, 0x29, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+    0x61, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x50, 0x61,
+    0x69, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x74, 0x79,
+    0x20, 0x74, 0x6F, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64,
+    0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x79, 0x20, 0x61, 0x73, 0x74, 0x2E, 0x20,
+    0x54, 0x68, 0x72, 0x6F, 0x77, 0x73, 0x20, 0x61, 0x6E, 0x20,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x61, 0x73, 0x74, 0x20, 0x63, 0x61, 0x6E,
+    0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x65, 0x64, 0x2E, 0xCF, 0x0F, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0x2D,
+    0x61, 0x6C, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0F, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64,
+    0x2D, 0x61, 0x6C, 0x6C, 0xDA, 0x06, 0xCE, 0x81, 0x4E, 0x28,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E,
+    0x64, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x73, 0x74, 0x72,
+    0x29, 0x0A, 0x0A, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65,
+    0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63,
+    0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x75, 0x6E,
+    0x64, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x73,
+    0x2E, 0x20, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x70,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E,
+    0x63, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x75,
+    0x6E, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x6D, 0x65, 0x61, 0x6E,
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+    0x65, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x6D, 0x6F, 0x73, 0x74,
+    0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61,
+    0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x6E, 0x6F, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6E, 0x63, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+    0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0xCF, 0x03, 0x61, 0x73, 0x6D, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x03, 0x61, 0x73, 0x6D, 0xDA, 0x06, 0xCE,
+    0x80, 0xB8, 0x28, 0x61, 0x73, 0x6D, 0x20, 0x61, 0x73, 0x73,
+    0x65, 0x6D, 0x62, 0x6C, 0x79, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+    0x64, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x73, 0x65,
+    0x6D, 0x62, 0x6C, 0x79, 0x2E, 0x0A, 0x54, 0x68, 0x65, 0x20,
+    0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x73, 0x65, 0x6D,
+    0x62, 0x6C, 0x79, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+    0x77, 0x69, 0x6B, 0x69, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C,
+    0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x0A,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x69,
+    0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x61, 0x73, 0x73,
+    0x65, 0x6D, 0x62, 0x6C, 0x79, 0x2E, 0xCF, 0x05, 0x7A, 0x65,
+    0x72, 0x6F, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x1E, 0x28, 0x7A, 0x65, 0x72, 0x6F, 0x3F, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x7A, 0x65, 0x72, 0x6F,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x87, 0xCD,
+    0x87, 0xFB, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x04, 0x01, 0x00, 0x03, 0xCE, 0x05, 0x7A, 0x65, 0x72, 0x6F,
+    0x3F, 0xDA, 0x24, 0x25, 0x03, 0x00, 0x00, 0x42, 0x02, 0x00,
+    0x03, 0x03, 0x02, 0x00, 0x00, 0x87, 0xF3, 0x07, 0xBF, 0xF9,
+    0x07, 0xBF, 0xF9, 0x07, 0xCF, 0x05, 0x74, 0x72, 0x75, 0x65,
+    0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x1E, 0x28,
+    0x74, 0x72, 0x75, 0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8D, 0x9A, 0x8D, 0xCA,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x03, 0xCE, 0x05, 0x74, 0x72, 0x75, 0x65, 0x3F, 0xDA,
+    0x24, 0x23, 0x03, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x03, 0x03,
+    0x02, 0x00, 0x00, 0x8D, 0xC0, 0x09, 0xBF, 0xF7, 0x09, 0xBF,
+    0xF7, 0x09, 0xDA, 0x62, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x4E, 0x28, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74,
+    0x65, 0x6E, 0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x76, 0x61, 0x6C,
+    0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x69,
+    0x74, 0x73, 0x65, 0x6C, 0x66, 0x20, 0x77, 0x68, 0x65, 0x6E,
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8E, 0x6D, 0x8F,
+    0x95, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xDC, 0x00, 0x00, 0x05,
+    0x01, 0x02, 0x07, 0x01, 0xCE, 0x0B, 0x69, 0x64, 0x65, 0x6D,
+    0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x3F, 0xDA, 0x24, 0xDA,
+    0x72, 0xD8, 0x03, 0x6E, 0x6F, 0x74, 0x2B, 0x00, 0x00, 0x00,
+    0x43, 0x02, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x33, 0x03,
+    0x04, 0x02, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00,
+    0x30, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0x8F, 0x89, 0x07, 0xBF,
+    0xF9, 0x07, 0xBF, 0xE3, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xDD,
+    0x24, 0xBF, 0xDC, 0x24, 0xBF, 0xDC, 0x24, 0x00, 0x04, 0xD5,
+    0x05, 0xDA, 0x7B, 0xCB, 0xDA, 0x76, 0xCB, 0xDA, 0x78, 0xCB,
+    0xDA, 0x73, 0xCB, 0xD0, 0x06, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0xCB, 0xDA, 0x80, 0xC4, 0xDA, 0x80, 0xBE, 0xDA, 0x03,
+    0xCF, 0x03, 0x64, 0x6F, 0x63, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+    0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x34, 0x28, 0x64, 0x6F, 0x63,
+    0x20, 0x73, 0x79, 0x6D, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F,
+    0x77, 0x73, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x9E, 0x3D,
+    0xCD, 0x00, 0x00, 0x9E, 0x97, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x9C, 0x00, 0x00, 0x06, 0x01, 0x03, 0x08, 0xCE, 0x03, 0x64,
+    0x6F, 0x63, 0xDA, 0x24, 0xDA, 0x67, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x11, 0x02, 0x16, 0x55, 0xCE, 0x04, 0x64, 0x6F,
+    0x63, 0x2A, 0xDA, 0x24, 0xDA, 0x80, 0xC3, 0xCE, 0x07, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0xCE, 0x0B, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0xD8,
+    0x05, 0x70, 0x72, 0x69, 0x6E, 0x74, 0xD0, 0x03, 0x72, 0x65,
+    0x66, 0xDA, 0x72, 0xD0, 0x03, 0x76, 0x61, 0x72, 0xCE, 0x02,
+    0x20, 0x28, 0xCE, 0x01, 0x29, 0xD8, 0x06, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0xDA, 0x5C, 0xDA, 0x03, 0xCE, 0x04, 0x20,
+    0x20, 0x20, 0x20, 0xCE, 0x01, 0x0A, 0xDA, 0x23, 0xDA, 0x06,
+    0xCE, 0x00, 0xCE, 0x01, 0x3A, 0xCE, 0x02, 0x29, 0x0A, 0xD7,
+    0xCD, 0x00, 0xBE, 0x00, 0x00, 0x14, 0x01, 0x07, 0x43, 0x01,
+    0xCE, 0x0A, 0x64, 0x6F, 0x63, 0x2D, 0x66, 0x6F, 0x72, 0x6D,
+    0x61, 0x74, 0xDA, 0x24, 0xD1, 0x01, 0x50, 0xDA, 0x80, 0xD6,
+    0xDA, 0x80, 0xD8, 0xCE, 0x02, 0x20, 0x20, 0xD8, 0x12, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68,
+    0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xD8, 0x10, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68,
+    0x2D, 0x62, 0x79, 0x74, 0x65, 0xCE, 0x05, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x28, 0x01, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x35, 0x03, 0x03, 0x00, 0x05, 0x02, 0x03, 0xF8, 0x17, 0x03,
+    0x02, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2B, 0x04, 0x00, 0x00,
+    0x39, 0x04, 0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x26, 0x06,
+    0x02, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 0x00,
+    0x17, 0x07, 0x06, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2A, 0x09,
+    0x00, 0x00, 0x17, 0x0A, 0x09, 0x00, 0x17, 0x0B, 0x00, 0x00,
+    0x37, 0x0C, 0x0B, 0x00, 0x17, 0x0D, 0x0C, 0x00, 0x25, 0x0C,
+    0x00, 0x00, 0x3E, 0x0E, 0x0C, 0x0D, 0x1A, 0x0E, 0x2C, 0x00,
+    0x33, 0x0F, 0x0B, 0x0C, 0x17, 0x10, 0x0F, 0x00, 0x25, 0x12,
+    0x0A, 0x00, 0x1F, 0x11, 0x10, 0x12, 0x19, 0x11, 0x03, 0x00,
+    0x23, 0x11, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x11,
+    0x00, 0x00, 0x1A, 0x11, 0x09, 0x00, 0x25, 0x13, 0x20, 0x00,
+    0x1F, 0x12, 0x10, 0x13, 0x19, 0x12, 0x03, 0x00, 0x23, 0x12,
+    0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x12, 0x00, 0x00,
+    0x17, 0x0F, 0x12, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x0F,
+    0x00, 0x00, 0x1A, 0x0F, 0x0B, 0x00, 0x25, 0x12, 0x09, 0x00,
+    0x1F, 0x11, 0x10, 0x12, 0x1A, 0x11, 0x05, 0x00, 0x26, 0x12,
+    0x03, 0x00, 0x2C, 0x07, 0x12, 0x00, 0x43, 0x12, 0x04, 0x00,
+    0x18, 0x10, 0x00, 0x00, 0x2C, 0x07, 0x10, 0x00, 0x43, 0x12,
+    0x05, 0x00, 0x18, 0x0D, 0x00, 0x00, 0x37, 0x11, 0x07, 0x00,
+    0x25, 0x13, 0x00, 0x00, 0x40, 0x12, 0x11, 0x13, 0x1A, 0x12,
+    0x02, 0x00, 0x2F, 0x11, 0x0A, 0x00, 0x25, 0x12, 0x0A, 0x00,
+    0x1F, 0x11, 0x10, 0x12, 0x1A, 0x11, 0x05, 0x00, 0x26, 0x12,
+    0x06, 0x00, 0x2C, 0x05, 0x12, 0x00, 0x43, 0x12, 0x04, 0x00,
+    0x25, 0x08, 0x00, 0x00, 0x05, 0x0C, 0x0C, 0x01, 0x18, 0xD4,
+    0xFF, 0xFF, 0x2F, 0x0B, 0x0A, 0x00, 0x03, 0x05, 0x00, 0x00,
+    0xCD, 0x00, 0xDC, 0x00, 0x00, 0x07, 0x00, 0x04, 0x25, 0x01,
+    0xCE, 0x08, 0x70, 0x75, 0x73, 0x68, 0x77, 0x6F, 0x72, 0x64,
+    0xDA, 0x24, 0xDA, 0x80, 0xE0, 0xCE, 0x01, 0x20, 0xDA, 0x80,
+    0xDE, 0xD8, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x63, 0x6C, 0x65, 0x61, 0x72, 0x27, 0x01, 0x00, 0x08, 0x27,
+    0x04, 0x00, 0x07, 0x37, 0x03, 0x04, 0x00, 0x27, 0x05, 0x00,
+    0x08, 0x06, 0x04, 0x05, 0x03, 0x05, 0x04, 0x04, 0x01, 0x27,
+    0x05, 0x00, 0x03, 0x4A, 0x03, 0x05, 0x04, 0x1A, 0x03, 0x05,
+    0x00, 0x25, 0x04, 0x00, 0x00, 0x29, 0x04, 0x00, 0x08, 0x26,
+    0x02, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x27, 0x05, 0x00,
+    0x08, 0x05, 0x04, 0x05, 0x01, 0x29, 0x04, 0x00, 0x08, 0x26,
+    0x02, 0x01, 0x00, 0x17, 0x03, 0x02, 0x00, 0x27, 0x05, 0x00,
+    0x07, 0x37, 0x04, 0x05, 0x00, 0x27, 0x06, 0x00, 0x08, 0x06,
+    0x05, 0x06, 0x04, 0x29, 0x05, 0x00, 0x08, 0x25, 0x06, 0x00,
+    0x00, 0x40, 0x04, 0x01, 0x06, 0x1A, 0x04, 0x04, 0x00, 0x27,
+    0x06, 0x00, 0x05, 0x2C, 0x06, 0x03, 0x00, 0x43, 0x06, 0x02,
+    0x00, 0x27, 0x04, 0x00, 0x05, 0x27, 0x06, 0x00, 0x07, 0x2C,
+    0x04, 0x06, 0x00, 0x43, 0x04, 0x02, 0x00, 0x27, 0x06, 0x00,
+    0x07, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x06, 0x03, 0x00, 0x30,
+    0x06, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x98, 0xCC,
+    0x13, 0x32, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xE9, 0x1A, 0xBF,
+    0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xDB, 0x26, 0xBF, 0xDA,
+    0x26, 0xBF, 0xD6, 0x6F, 0xBF, 0xC9, 0x0E, 0xBF, 0xF2, 0x0E,
+    0xBF, 0xBA, 0x6F, 0xBF, 0x91, 0x6F, 0xBF, 0xEF, 0x0B, 0xBF,
+    0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0x97, 0x6F, 0xBF, 0x7F,
+    0x80, 0x82, 0x12, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xE8, 0x19,
+    0xBF, 0xE7, 0x19, 0xBF, 0xE7, 0x19, 0x0A, 0x0B, 0xBF, 0xF5,
+    0x0B, 0xBF, 0xF1, 0x36, 0xBF, 0xE1, 0x1E, 0xBF, 0xE2, 0x1E,
+    0xBF, 0xE2, 0x1E, 0x07, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4,
+    0x1C, 0xBF, 0xE4, 0x1C, 0x06, 0x12, 0xBF, 0xEE, 0x12, 0xBF,
+    0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xCD, 0x00, 0x00, 0x98, 0x11,
+    0x83, 0x4F, 0xBD, 0x05, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0,
+    0x10, 0xBF, 0xE4, 0x1D, 0x04, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xF0, 0x10, 0x04, 0x0D, 0xBF, 0xF3, 0x0D,
+    0xBF, 0xF3, 0x0D, 0xBF, 0xF3, 0x0D, 0x04, 0x0E, 0x05, 0x81,
+    0x4B, 0xBE, 0xB5, 0x81, 0x4B, 0x05, 0x81, 0x3A, 0xBE, 0xC6,
+    0x81, 0x3A, 0xBE, 0xC6, 0x81, 0x3A, 0xBE, 0xC6, 0x81, 0x3A,
+    0xBE, 0xC6, 0x81, 0x3A, 0xBE, 0xC6, 0x81, 0x3A, 0xBE, 0xC6,
+    0x81, 0x3A, 0xBE, 0xC6, 0x81, 0x3A, 0xBE, 0xE6, 0x0A, 0xBF,
+    0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF6,
+    0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF1, 0x1C, 0xBF, 0xF5, 0x0A,
+    0xBF, 0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF,
+    0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xE5, 0x1C, 0xBF, 0xE4,
+    0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE0, 0x81, 0x22, 0xBF, 0x0C,
+    0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xF6, 0x58, 0xBF, 0xBE, 0x1D,
+    0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xCD, 0x58, 0xBF,
+    0xE7, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0x7F, 0x81, 0x22, 0xBF,
+    0x7F, 0x0C, 0xBF, 0xF1, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEA,
+    0x22, 0xBF, 0xF6, 0x09, 0x13, 0x07, 0xBF, 0xF9, 0x07, 0xBF,
+    0xF3, 0x58, 0xBF, 0xC3, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0,
+    0x20, 0x0E, 0x0E, 0xBE, 0xCA, 0x81, 0x3A, 0xBE, 0xC6, 0x81,
+    0x3A, 0x13, 0x09, 0xBC, 0xB9, 0x83, 0x4F, 0xCE, 0x17, 0x6E,
+    0x6F, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x75, 0x6E,
+    0x64, 0x2E, 0xCE, 0x02, 0x0A, 0x0A, 0x33, 0x04, 0x00, 0x01,
+    0x2B, 0x04, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00, 0x1A, 0x05,
+    0x06, 0x00, 0x26, 0x06, 0x01, 0x00, 0x26, 0x07, 0x02, 0x00,
+    0x2D, 0x06, 0x01, 0x07, 0x26, 0x06, 0x03, 0x00, 0x30, 0x06,
+    0x00, 0x00, 0x26, 0x08, 0x04, 0x00, 0x44, 0x07, 0x08, 0x04,
+    0x1A, 0x07, 0x0E, 0x00, 0x26, 0x09, 0x04, 0x00, 0x44, 0x08,
+    0x09, 0x04, 0x25, 0x0A, 0x00, 0x00, 0x33, 0x09, 0x08, 0x0A,
+    0x2B, 0x09, 0x00, 0x00, 0x43, 0x08, 0x05, 0x00, 0x26, 0x09,
+    0x06, 0x00, 0x26, 0x0A, 0x07, 0x00, 0x2D, 0x09, 0x0A, 0x08,
+    0x26, 0x09, 0x08, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x43, 0x06,
+    0x09, 0x00, 0x18, 0x0B, 0x00, 0x00, 0x26, 0x0A, 0x0A, 0x00,
+    0x44, 0x09, 0x0A, 0x04, 0x1A, 0x09, 0x03, 0x00, 0x26, 0x08,
+    0x0A, 0x00, 0x18, 0x05, 0x00, 0x00, 0x26, 0x0B, 0x0B, 0x00,
+    0x44, 0x0A, 0x0B, 0x04, 0x2B, 0x0A, 0x00, 0x00, 0x43, 0x08,
+    0x05, 0x00, 0x17, 0x06, 0x08, 0x00, 0x26, 0x07, 0x0C, 0x00,
+    0x26, 0x08, 0x0D, 0x00, 0x2D, 0x07, 0x06, 0x08, 0x43, 0x06,
+    0x09, 0x00, 0x26, 0x08, 0x0E, 0x00, 0x44, 0x08, 0x08, 0x04,
+    0x26, 0x09, 0x0F, 0x00, 0x44, 0x09, 0x09, 0x04, 0x1A, 0x09,
+    0x03, 0x00, 0x17, 0x07, 0x06, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x26, 0x07, 0x10, 0x00, 0x17, 0x0A, 0x08, 0x00, 0x1A, 0x0A,
+    0x0D, 0x00, 0x35, 0x0D, 0x0A, 0x00, 0x35, 0x0E, 0x0A, 0x01,
+    0x35, 0x0F, 0x0A, 0x02, 0x26, 0x0C, 0x0C, 0x00, 0x26, 0x10,
+    0x07, 0x00, 0x2D, 0x0C, 0x0D, 0x10, 0x26, 0x0C, 0x11, 0x00,
+    0x2D, 0x0E, 0x0C, 0x0F, 0x26, 0x0C, 0x12, 0x00, 0x2B, 0x0C,
+    0x00, 0x00, 0x43, 0x0B, 0x09, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x26, 0x0B, 0x10, 0x00, 0x1A, 0x09, 0x03, 0x00, 0x17, 0x0C,
+    0x09, 0x00, 0x18, 0x06, 0x00, 0x00, 0x1A, 0x08, 0x03, 0x00,
+    0x17, 0x0D, 0x08, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x0D,
+    0x00, 0x00, 0x17, 0x0C, 0x0D, 0x00, 0x1A, 0x0C, 0x03, 0x00,
+    0x26, 0x0A, 0x0D, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x0A,
+    0x10, 0x00, 0x1A, 0x09, 0x04, 0x00, 0x2B, 0x09, 0x00, 0x00,
+    0x43, 0x0C, 0x13, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x0C,
+    0x14, 0x00, 0x26, 0x0D, 0x15, 0x00, 0x2D, 0x0D, 0x07, 0x0B,
+    0x26, 0x0D, 0x15, 0x00, 0x2D, 0x0A, 0x0C, 0x0D, 0x26, 0x0D,
+    0x03, 0x00, 0x30, 0x0D, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x9B,
+    0xC2, 0x0C, 0x09, 0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xF6, 0x82,
+    0x66, 0xBD, 0xAA, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE, 0x22,
+    0xBF, 0xDE, 0x22, 0xBF, 0xDE, 0x22, 0x5E, 0x07, 0xBF, 0xF9,
+    0x07, 0xBF, 0xE1, 0x80, 0x97, 0xBF, 0xA7, 0x07, 0xBF, 0xF9,
+    0x07, 0xBF, 0xF4, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xEB, 0x16,
+    0xBF, 0xEA, 0x16, 0xBF, 0xD8, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF,
+    0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3,
+    0x2D, 0xBF, 0xB2, 0x80, 0x97, 0xBF, 0xCB, 0x09, 0xBF, 0xF7,
+    0x09, 0xBF, 0x95, 0x80, 0x97, 0xBF, 0x69, 0x80, 0x97, 0xBF,
+    0x69, 0x80, 0x97, 0xBF, 0xF5, 0x09, 0xBF, 0xF7, 0x09, 0xBF,
+    0xF1, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0x6A, 0x80, 0x97, 0xBF,
+    0x4A, 0x80, 0xCC, 0xBF, 0x34, 0x80, 0xCC, 0xBF, 0x34, 0x80,
+    0xCC, 0xBF, 0x34, 0x80, 0xCC, 0x11, 0x0E, 0xBF, 0xF2, 0x0E,
+    0x10, 0x07, 0xBF, 0xF9, 0x07, 0x24, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x0F, 0x4E, 0xBF, 0xB2,
+    0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E,
+    0xBF, 0xD0, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF,
+    0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4,
+    0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xB6, 0x4E, 0xBF, 0xB2, 0x4E,
+    0x13, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF8,
+    0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF8, 0x08,
+    0xBF, 0xF8, 0x08, 0xBF, 0xF4, 0x15, 0xBF, 0xEB, 0x15, 0xBF,
+    0xEB, 0x15, 0xBF, 0xEB, 0x15, 0x0F, 0x2E, 0xBF, 0xD8, 0x0D,
+    0xBF, 0xF3, 0x0D, 0xBF, 0xED, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF,
+    0x15, 0x81, 0x00, 0xBF, 0x00, 0x81, 0x00, 0xBF, 0x00, 0x81,
+    0x00, 0xBF, 0x00, 0x81, 0x00, 0xBF, 0x00, 0x81, 0x00, 0xBF,
+    0x00, 0x81, 0x00, 0xCF, 0x05, 0x2A, 0x65, 0x6E, 0x76, 0x2A,
+    0x26, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x3D, 0x02,
+    0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x26, 0x05, 0x02, 0x00,
+    0x2D, 0x04, 0x05, 0x02, 0x3D, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x9E, 0x83, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF,
+    0x05, 0x6D, 0x61, 0x63, 0x65, 0x78, 0xD4, 0x02, 0xD3, 0x01,
+    0xDA, 0x06, 0xCE, 0x24, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x45, 0x78, 0x70, 0x61, 0x6E,
+    0x64, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x6C, 0x79, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00,
+    0xAC, 0x2A, 0xCD, 0x00, 0x00, 0xAD, 0x51, 0xDA, 0x03, 0xD7,
+    0xCD, 0x00, 0x9C, 0x00, 0x00, 0x09, 0x01, 0x03, 0x12, 0xCE,
+    0x05, 0x6D, 0x61, 0x63, 0x65, 0x78, 0xDA, 0x24, 0xD7, 0xCD,
+    0x00, 0xBE, 0x00, 0x00, 0x1C, 0x01, 0x14, 0x53, 0x07, 0xCE,
+    0x06, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0xDA, 0x24, 0xCF,
+    0x03, 0x76, 0x61, 0x72, 0xCF, 0x03, 0x73, 0x65, 0x74, 0xCF,
+    0x02, 0x66, 0x6E, 0xDA, 0x61, 0xCF, 0x0A, 0x71, 0x75, 0x61,
+    0x73, 0x69, 0x71, 0x75, 0x6F, 0x74, 0x65, 0xDA, 0x64, 0xDA,
+    0x65, 0xCF, 0x05, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xDA, 0x67,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01,
+    0xCE, 0x08, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79,
+    0xDA, 0x24, 0x03, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x4E,
+    0xB5, 0x48, 0xDA, 0x72, 0xDA, 0x7B, 0xD8, 0x0A, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x2F, 0x74, 0x79, 0x70, 0x65, 0xD0, 0x08,
+    0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73, 0xD7, 0xCD,
+    0x00, 0x99, 0x00, 0x00, 0x1C, 0x01, 0x02, 0x70, 0xCE, 0x03,
+    0x6D, 0x61, 0x70, 0xDA, 0x24, 0xCE, 0x26, 0x65, 0x78, 0x70,
+    0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x6C,
+    0x65, 0x61, 0x73, 0x74, 0x20, 0x31, 0x20, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0xDA, 0x14, 0x37, 0x04, 0x01,
+    0x00, 0x25, 0x06, 0x00, 0x00, 0x1F, 0x05, 0x06, 0x04, 0x1A,
+    0x05, 0x03, 0x00, 0x26, 0x06, 0x00, 0x00, 0x01, 0x06, 0x00,
+    0x00, 0x25, 0x06, 0x00, 0x00, 0x33, 0x05, 0x01, 0x06, 0x37,
+    0x05, 0x05, 0x00, 0x25, 0x07, 0x00, 0x00, 0x17, 0x08, 0x04,
+    0x00, 0x3E, 0x09, 0x07, 0x08, 0x1A, 0x09, 0x09, 0x00, 0x17,
+    0x0A, 0x07, 0x00, 0x33, 0x0B, 0x01, 0x0A, 0x37, 0x0B, 0x0B,
+    0x00, 0x3E, 0x0C, 0x0B, 0x05, 0x1A, 0x0C, 0x02, 0x00, 0x17,
+    0x05, 0x0B, 0x00, 0x05, 0x07, 0x07, 0x01, 0x18, 0xF7, 0xFF,
+    0xFF, 0x35, 0x08, 0x01, 0x00, 0x35, 0x09, 0x01, 0x01, 0x35,
+    0x0A, 0x01, 0x02, 0x35, 0x0B, 0x01, 0x03, 0x2B, 0x05, 0x00,
+    0x00, 0x43, 0x0C, 0x01, 0x00, 0x25, 0x0E, 0x01, 0x00, 0x1F,
+    0x0D, 0x04, 0x0E, 0x1A, 0x0D, 0x0B, 0x00, 0x25, 0x0E, 0x00,
+    0x00, 0x17, 0x0F, 0x05, 0x00, 0x3E, 0x10, 0x0E, 0x0F, 0x1A,
+    0x10, 0x4E, 0x00, 0x17, 0x11, 0x0E, 0x00, 0x33, 0x12, 0x08,
+    0x11, 0x44, 0x13, 0x12, 0x00, 0x34, 0x0C, 0x11, 0x13, 0x05,
+    0x0E, 0x0E, 0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x25, 0x0F, 0x02,
+    0x00, 0x1F, 0x0E, 0x04, 0x0F, 0x1A, 0x0E, 0x0D, 0x00, 0x25,
+    0x0F, 0x00, 0x00, 0x17, 0x10, 0x05, 0x00, 0x3E, 0x11, 0x0F,
+    0x10, 0x1A, 0x11, 0x41, 0x00, 0x17, 0x12, 0x0F, 0x00, 0x33,
+    0x13, 0x08, 0x12, 0x33, 0x14, 0x09, 0x12, 0x2C, 0x13, 0x14,
+    0x00, 0x2F, 0x15, 0x00, 0x00, 0x34, 0x0C, 0x12, 0x15, 0x05,
+    0x0F, 0x0F, 0x01, 0x18, 0xF7, 0xFF, 0xFF, 0x25, 0x10, 0x03,
+    0x00, 0x1F, 0x0F, 0x04, 0x10, 0x1A, 0x0F, 0x0E, 0x00, 0x25,
+    0x10, 0x00, 0x00, 0x17, 0x11, 0x05, 0x00, 0x3E, 0x12, 0x10,
+    0x11, 0x1A, 0x12, 0x32, 0x00, 0x17, 0x13, 0x10, 0x00, 0x33,
+    0x14, 0x08, 0x13, 0x33, 0x15, 0x09, 0x13, 0x33, 0x16, 0x0A,
+    0x13, 0x2D, 0x14, 0x15, 0x16, 0x2F, 0x17, 0x00, 0x00, 0x34,
+    0x0C, 0x13, 0x17, 0x05, 0x10, 0x10, 0x01, 0x18, 0xF6, 0xFF,
+    0xFF, 0x25, 0x11, 0x04, 0x00, 0x1F, 0x10, 0x04, 0x11, 0x1A,
+    0x10, 0x10, 0x00, 0x25, 0x11, 0x00, 0x00, 0x17, 0x12, 0x05,
+    0x00, 0x3E, 0x13, 0x11, 0x12, 0x1A, 0x13, 0x22, 0x00, 0x17,
+    0x14, 0x11, 0x00, 0x33, 0x15, 0x08, 0x14, 0x33, 0x16, 0x09,
+    0x14, 0x33, 0x17, 0x0A, 0x14, 0x33, 0x18, 0x0B, 0x14, 0x2D,
+    0x15, 0x16, 0x17, 0x2B, 0x18, 0x00, 0x00, 0x2F, 0x19, 0x00,
+    0x00, 0x34, 0x0C, 0x14, 0x19, 0x05, 0x11, 0x11, 0x01, 0x18,
+    0xF4, 0xFF, 0xFF, 0x25, 0x11, 0x00, 0x00, 0x17, 0x12, 0x05,
+    0x00, 0x3E, 0x13, 0x11, 0x12, 0x1A, 0x13, 0x13, 0x00, 0x17,
+    0x14, 0x11, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x43, 0x16, 0x01,
+    0x00, 0x25, 0x15, 0x00, 0x00, 0x17, 0x17, 0x04, 0x00, 0x3E,
+    0x18, 0x15, 0x17, 0x1A, 0x18, 0x07, 0x00, 0x17, 0x19, 0x15,
+    0x00, 0x33, 0x1A, 0x01, 0x19, 0x33, 0x1B, 0x1A, 0x14, 0x34,
+    0x16, 0x19, 0x1B, 0x05, 0x15, 0x15, 0x01, 0x18, 0xF9, 0xFF,
+    0xFF, 0x2E, 0x16, 0x00, 0x00, 0x2F, 0x15, 0x00, 0x00, 0x34,
+    0x0C, 0x14, 0x15, 0x05, 0x11, 0x11, 0x01, 0x18, 0xED, 0xFF,
+    0xFF, 0x03, 0x0C, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x58, 0x61,
+    0x0C, 0x09, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF2, 0x40, 0xBF,
+    0xD0, 0x2F, 0xBF, 0xD1, 0x2F, 0x18, 0x0B, 0xBF, 0xF5, 0x0B,
+    0xBF, 0xED, 0x14, 0x05, 0x5F, 0xBF, 0xA1, 0x5F, 0xBF, 0xA1,
+    0x5F, 0xBF, 0xA1, 0x5F, 0xBF, 0xA1, 0x5F, 0xBF, 0xCF, 0x0B,
+    0xBF, 0xED, 0x14, 0x0B, 0x0A, 0xBF, 0xF2, 0x1D, 0xBF, 0xF3,
+    0x0C, 0xBF, 0xA3, 0x5F, 0xBF, 0xA1, 0x5F, 0x04, 0x17, 0xBF,
+    0xE9, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9, 0x17, 0x0D, 0x10,
+    0xBF, 0xF0, 0x10, 0x05, 0x81, 0xF0, 0xBE, 0x10, 0x81, 0xF0,
+    0xBE, 0x10, 0x81, 0xF0, 0xBE, 0x22, 0x37, 0xBF, 0xC9, 0x37,
+    0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF,
+    0xF4, 0x09, 0xBF, 0xF4, 0x0D, 0xBF, 0xE6, 0x1B, 0xBF, 0xCA,
+    0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xB7, 0x81, 0xF0, 0xBE, 0x10,
+    0x81, 0xF0, 0xBE, 0x10, 0x81, 0xF0, 0xBE, 0x61, 0x42, 0xBF,
+    0xBE, 0x42, 0xBF, 0xBE, 0x42, 0xBF, 0xBE, 0x42, 0xBF, 0xBE,
+    0x42, 0xBF, 0xE9, 0x09, 0x02, 0x09, 0xBF, 0xE9, 0x18, 0xBF,
+    0xE8, 0x18, 0xBF, 0xDB, 0x26, 0xBF, 0xBF, 0x42, 0xBF, 0xBE,
+    0x42, 0xBF, 0x6D, 0x81, 0xF0, 0xBE, 0x10, 0x81, 0xF0, 0xBE,
+    0x10, 0x81, 0xF0, 0xBE, 0xAB, 0x4D, 0xBF, 0xB3, 0x4D, 0xBF,
+    0xB3, 0x4D, 0xBF, 0xB3, 0x4D, 0xBF, 0xB3, 0x4D, 0xBF, 0xDE,
+    0x09, 0x02, 0x09, 0x02, 0x09, 0xBF, 0xDE, 0x23, 0xBF, 0xDD,
+    0x23, 0xBF, 0xD0, 0x31, 0xBF, 0xB4, 0x4D, 0xBF, 0xB3, 0x4D,
+    0xBF, 0x18, 0x81, 0xF0, 0xBE, 0x10, 0x81, 0xF0, 0xBE, 0x10,
+    0x81, 0xF0, 0xBF, 0x00, 0x58, 0xBF, 0xA8, 0x58, 0xBF, 0xA8,
+    0x58, 0xBF, 0xA8, 0x58, 0xBF, 0xA8, 0x58, 0xBF, 0xD3, 0x09,
+    0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0xBF, 0xD3, 0x2E, 0xBF,
+    0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xC5, 0x3C, 0xBF, 0xA9,
+    0x58, 0xBF, 0xA8, 0x58, 0x06, 0x80, 0xA1, 0xBF, 0x5F, 0x80,
+    0xA1, 0xBF, 0x5F, 0x80, 0xA1, 0xBF, 0x5F, 0x80, 0xA1, 0xBF,
+    0x5F, 0x80, 0xA1, 0xBF, 0x8A, 0x10, 0xBF, 0xF0, 0x10, 0x09,
+    0x3E, 0xBF, 0xC2, 0x3E, 0xBF, 0xC2, 0x3E, 0xBF, 0xC2, 0x3E,
+    0xBF, 0xC2, 0x3E, 0xBF, 0xF0, 0x0B, 0xBF, 0xF0, 0x13, 0xBF,
+    0xDF, 0x22, 0xBF, 0xC3, 0x3E, 0xBF, 0xC2, 0x3E, 0x15, 0x08,
+    0xBF, 0xF8, 0x08, 0xBF, 0xEB, 0x16, 0xBF, 0x60, 0x80, 0xA1,
+    0xBF, 0x5F, 0x80, 0xA1, 0xBC, 0x65, 0x83, 0xA3, 0xDA, 0x80,
+    0xA2, 0xDA, 0x78, 0xDA, 0x76, 0xDA, 0x77, 0xDA, 0x73, 0x28,
+    0x01, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x17, 0x03, 0x02,
+    0x00, 0x2A, 0x04, 0x01, 0x00, 0x17, 0x05, 0x04, 0x00, 0x2A,
+    0x06, 0x02, 0x00, 0x17, 0x07, 0x06, 0x00, 0x2A, 0x08, 0x03,
+    0x00, 0x17, 0x09, 0x08, 0x00, 0x2A, 0x0A, 0x04, 0x00, 0x17,
+    0x0B, 0x0A, 0x00, 0x2A, 0x0C, 0x05, 0x00, 0x17, 0x0D, 0x0C,
+    0x00, 0x26, 0x0E, 0x00, 0x00, 0x26, 0x0F, 0x01, 0x00, 0x2D,
+    0x0E, 0x07, 0x0F, 0x26, 0x0E, 0x02, 0x00, 0x2D, 0x07, 0x0E,
+    0x0B, 0x26, 0x0E, 0x03, 0x00, 0x26, 0x0F, 0x04, 0x00, 0x2D,
+    0x0E, 0x07, 0x0F, 0x26, 0x0E, 0x05, 0x00, 0x2D, 0x0D, 0x0E,
+    0x09, 0x26, 0x0E, 0x06, 0x00, 0x26, 0x0F, 0x07, 0x00, 0x2D,
+    0x0E, 0x09, 0x0F, 0x26, 0x0E, 0x08, 0x00, 0x26, 0x0F, 0x09,
+    0x00, 0x2D, 0x09, 0x0E, 0x0F, 0x3B, 0x0E, 0x00, 0x00, 0x17,
+    0x0F, 0x0E, 0x00, 0x2A, 0x10, 0x06, 0x00, 0x17, 0x11, 0x10,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x12, 0x0A, 0x00, 0x17,
+    0x13, 0x12, 0x00, 0x26, 0x15, 0x0B, 0x00, 0x1F, 0x14, 0x13,
+    0x15, 0x1A, 0x14, 0x10, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x16, 0x0C, 0x00, 0x26, 0x18, 0x0D, 0x00, 0x1F, 0x17, 0x16,
+    0x18, 0x1A, 0x17, 0x07, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x43,
+    0x16, 0x0E, 0x00, 0x2E, 0x16, 0x00, 0x00, 0x43, 0x18, 0x0F,
+    0x00, 0x17, 0x15, 0x18, 0x00, 0x18, 0x03, 0x00, 0x00, 0x44,
+    0x16, 0x00, 0x11, 0x17, 0x15, 0x16, 0x00, 0x17, 0x12, 0x15,
+    0x00, 0x18, 0x1C, 0x00, 0x00, 0x26, 0x17, 0x10, 0x00, 0x1F,
+    0x16, 0x13, 0x17, 0x1A, 0x16, 0x05, 0x00, 0x2C, 0x01, 0x00,
+    0x00, 0x43, 0x17, 0x0E, 0x00, 0x17, 0x15, 0x17, 0x00, 0x18,
+    0x14, 0x00, 0x00, 0x26, 0x19, 0x11, 0x00, 0x1F, 0x18, 0x13,
+    0x19, 0x1A, 0x18, 0x07, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x2F,
+    0x19, 0x03, 0x00, 0x2B, 0x19, 0x00, 0x00, 0x43, 0x1A, 0x12,
+    0x00, 0x17, 0x17, 0x1A, 0x00, 0x18, 0x0A, 0x00, 0x00, 0x26,
+    0x1B, 0x13, 0x00, 0x1F, 0x1A, 0x13, 0x1B, 0x1A, 0x1A, 0x05,
+    0x00, 0x2C, 0x00, 0x01, 0x00, 0x2F, 0x1B, 0x03, 0x00, 0x17,
+    0x19, 0x1B, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x19, 0x00,
+    0x00, 0x17, 0x17, 0x19, 0x00, 0x17, 0x15, 0x17, 0x00, 0x17,
+    0x12, 0x15, 0x00, 0x17, 0x13, 0x12, 0x00, 0x03, 0x13, 0x00,
+    0x00, 0xCD, 0x00, 0xDC, 0x00, 0x00, 0x0B, 0x02, 0x01, 0x14,
+    0x01, 0xCE, 0x07, 0x64, 0x6F, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0xDA, 0x24, 0xDA, 0x2E, 0x3C, 0x04, 0x00, 0x00, 0x22, 0x05,
+    0x00, 0x00, 0x2C, 0x00, 0x05, 0x00, 0x43, 0x06, 0x00, 0x00,
+    0x22, 0x08, 0x00, 0x00, 0x1F, 0x07, 0x08, 0x06, 0x19, 0x07,
+    0x03, 0x00, 0x23, 0x07, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x24, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x09, 0x00, 0x27, 0x09,
+    0x00, 0x01, 0x44, 0x08, 0x06, 0x09, 0x33, 0x09, 0x00, 0x06,
+    0x44, 0x0A, 0x09, 0x01, 0x34, 0x04, 0x08, 0x0A, 0x2C, 0x00,
+    0x06, 0x00, 0x43, 0x06, 0x00, 0x00, 0x18, 0xF2, 0xFF, 0xFF,
+    0x03, 0x04, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x9F,
+    0x37, 0x0D, 0x0F, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B,
+    0x0E, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF3,
+    0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xEC, 0x67,
+    0xBF, 0xBF, 0x0B, 0xBF, 0xF5, 0x0B, 0x0C, 0x0A, 0xBF, 0xEC,
+    0x15, 0xBF, 0xD4, 0x2D, 0x11, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF,
+    0x9B, 0x67, 0xBF, 0x4C, 0x80, 0xBE, 0xCD, 0x00, 0xDC, 0x00,
+    0x00, 0x09, 0x01, 0x08, 0x23, 0x01, 0xCE, 0x0F, 0x65, 0x78,
+    0x70, 0x61, 0x6E, 0x64, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x73, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x78, 0xDA,
+    0x80, 0xFC, 0xDA, 0x7B, 0xDA, 0x7C, 0xDA, 0x73, 0xDA, 0x76,
+    0xDA, 0x77, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00,
+    0x43, 0x03, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x02,
+    0x03, 0x04, 0x1A, 0x02, 0x04, 0x00, 0x2C, 0x01, 0x00, 0x00,
+    0x26, 0x04, 0x02, 0x00, 0x30, 0x04, 0x00, 0x00, 0x26, 0x05,
+    0x03, 0x00, 0x1F, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x06, 0x00,
+    0x2C, 0x01, 0x00, 0x00, 0x43, 0x05, 0x02, 0x00, 0x2B, 0x05,
+    0x00, 0x00, 0x26, 0x06, 0x04, 0x00, 0x30, 0x06, 0x00, 0x00,
+    0x26, 0x06, 0x05, 0x00, 0x1F, 0x05, 0x03, 0x06, 0x1A, 0x05,
+    0x04, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x27, 0x06, 0x00, 0x03,
+    0x30, 0x06, 0x00, 0x00, 0x26, 0x07, 0x06, 0x00, 0x1F, 0x06,
+    0x03, 0x07, 0x1A, 0x06, 0x07, 0x00, 0x2C, 0x00, 0x01, 0x00,
+    0x27, 0x08, 0x00, 0x03, 0x2F, 0x07, 0x08, 0x00, 0x2B, 0x07,
+    0x00, 0x00, 0x26, 0x08, 0x07, 0x00, 0x30, 0x08, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x27, 0x07, 0x00, 0x01, 0x30, 0x07,
+    0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x9F, 0xDB, 0x80,
+    0xFB, 0xBF, 0x29, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF3, 0x80,
+    0xDC, 0xBF, 0x24, 0x80, 0xDC, 0xBF, 0x24, 0x80, 0xDC, 0xBF,
+    0x40, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xCE,
+    0x80, 0xDC, 0xBF, 0x24, 0x80, 0xDC, 0xBF, 0x24, 0x80, 0xDC,
+    0xBF, 0x72, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xDD, 0x24, 0xBF,
+    0xDC, 0x24, 0xBF, 0xDC, 0x24, 0xBF, 0x9B, 0x80, 0xDC, 0xBF,
+    0x24, 0x80, 0xDC, 0xBF, 0x24, 0x80, 0xDC, 0xBF, 0x98, 0x1A,
+    0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0x72, 0x80, 0xDC,
+    0xBF, 0x24, 0x80, 0xDC, 0xBF, 0x24, 0x80, 0xDC, 0xBF, 0xD3,
+    0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xD5, 0x2C,
+    0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0x08, 0x09, 0xBF, 0xF7,
+    0x09, 0xBF, 0xF7, 0x09, 0xCD, 0x00, 0xDC, 0x00, 0x00, 0x0A,
+    0x01, 0x02, 0x18, 0x01, 0xCE, 0x09, 0x65, 0x78, 0x70, 0x61,
+    0x6E, 0x64, 0x64, 0x65, 0x66, 0xDA, 0x24, 0xDA, 0x7C, 0xD8,
+    0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E,
+    0x63, 0x61, 0x74, 0x37, 0x02, 0x00, 0x00, 0x05, 0x03, 0x02,
+    0xFF, 0x33, 0x03, 0x00, 0x03, 0x25, 0x05, 0x01, 0x00, 0x33,
+    0x05, 0x00, 0x05, 0x25, 0x07, 0x00, 0x00, 0x33, 0x06, 0x00,
+    0x07, 0x27, 0x08, 0x00, 0x05, 0x44, 0x07, 0x05, 0x08, 0x2C,
+    0x06, 0x07, 0x00, 0x38, 0x06, 0x00, 0x00, 0x25, 0x07, 0x02,
+    0x00, 0x25, 0x08, 0xFE, 0xFF, 0x2D, 0x00, 0x07, 0x08, 0x43,
+    0x07, 0x00, 0x00, 0x27, 0x09, 0x00, 0x01, 0x44, 0x08, 0x03,
+    0x09, 0x2B, 0x08, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x2D,
+    0x06, 0x07, 0x08, 0x43, 0x09, 0x01, 0x00, 0x2B, 0x09, 0x00,
+    0x00, 0x26, 0x06, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0xBF,
+    0xFF, 0xCD, 0x00, 0x00, 0xA1, 0x07, 0x09, 0xBF, 0xF4, 0x0F,
+    0xBF, 0xEA, 0x17, 0x12, 0x08, 0xBF, 0xF8, 0x08, 0x32, 0x08,
+    0xBF, 0xF8, 0x08, 0x02, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xC8,
+    0x70, 0xBF, 0x90, 0x70, 0xBF, 0xD3, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0x0C, 0x0C, 0xBF, 0xF4,
+    0x0C, 0xBF, 0x92, 0x70, 0xBF, 0x90, 0x70, 0xBF, 0x90, 0x70,
+    0xBF, 0x90, 0x70, 0xBF, 0x7D, 0x80, 0x84, 0xBF, 0x7C, 0x80,
+    0x84, 0xBF, 0x7C, 0x80, 0x84, 0xCD, 0x00, 0xDC, 0x00, 0x00,
+    0x06, 0x01, 0x03, 0x0C, 0x01, 0xCE, 0x09, 0x65, 0x78, 0x70,
+    0x61, 0x6E, 0x64, 0x61, 0x6C, 0x6C, 0xDA, 0x24, 0xDA, 0x7C,
+    0xDA, 0x80, 0xFC, 0xDA, 0x80, 0x88, 0x25, 0x02, 0x01, 0x00,
+    0x2C, 0x00, 0x02, 0x00, 0x43, 0x02, 0x00, 0x00, 0x27, 0x03,
+    0x00, 0x01, 0x2C, 0x03, 0x02, 0x00, 0x43, 0x02, 0x01, 0x00,
+    0x25, 0x05, 0x00, 0x00, 0x33, 0x04, 0x00, 0x05, 0x2B, 0x04,
+    0x00, 0x00, 0x2E, 0x02, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00,
+    0x30, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0xA1,
+    0xED, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xE4,
+    0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0x0E, 0x08, 0xBF,
+    0xF8, 0x08, 0xBF, 0xF1, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA,
+    0x16, 0xBF, 0xEA, 0x16, 0xCD, 0x00, 0xDC, 0x00, 0x00, 0x08,
+    0x01, 0x05, 0x1D, 0x01, 0xCE, 0x08, 0x65, 0x78, 0x70, 0x61,
+    0x6E, 0x64, 0x66, 0x6E, 0xDA, 0x24, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x05, 0x01, 0x02, 0x05, 0xCE, 0x07, 0x73, 0x79,
+    0x6D, 0x62, 0x6F, 0x6C, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xD0,
+    0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2B, 0x00, 0x00,
+    0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F,
+    0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x89, 0x91, 0x07,
+    0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x13, 0xBF, 0xED, 0x13, 0xBF,
+    0xED, 0x13, 0xDA, 0x7C, 0xDA, 0x80, 0xFC, 0xDA, 0x80, 0xF3,
+    0xDA, 0x80, 0x88, 0x25, 0x03, 0x01, 0x00, 0x33, 0x03, 0x00,
+    0x03, 0x2B, 0x03, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x1A,
+    0x04, 0x0E, 0x00, 0x25, 0x05, 0x03, 0x00, 0x2C, 0x00, 0x05,
+    0x00, 0x43, 0x05, 0x01, 0x00, 0x27, 0x06, 0x00, 0x01, 0x2C,
+    0x06, 0x05, 0x00, 0x43, 0x05, 0x02, 0x00, 0x25, 0x07, 0x02,
+    0x00, 0x33, 0x06, 0x00, 0x07, 0x26, 0x07, 0x03, 0x00, 0x2D,
+    0x07, 0x03, 0x06, 0x2E, 0x05, 0x00, 0x00, 0x26, 0x07, 0x04,
+    0x00, 0x30, 0x07, 0x00, 0x00, 0x25, 0x05, 0x02, 0x00, 0x2C,
+    0x00, 0x05, 0x00, 0x43, 0x05, 0x01, 0x00, 0x27, 0x06, 0x00,
+    0x01, 0x2C, 0x06, 0x05, 0x00, 0x43, 0x05, 0x02, 0x00, 0x26,
+    0x06, 0x03, 0x00, 0x2C, 0x06, 0x03, 0x00, 0x2E, 0x05, 0x00,
+    0x00, 0x26, 0x06, 0x04, 0x00, 0x30, 0x06, 0x00, 0x00, 0xBF,
+    0xFF, 0xCD, 0x00, 0x00, 0xA2, 0x40, 0x08, 0xBF, 0xF8, 0x08,
+    0x0B, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF1, 0x80, 0xCE, 0xBF,
+    0x6B, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xE4,
+    0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0x19, 0x08, 0xBF,
+    0xF8, 0x08, 0xBF, 0xEA, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3,
+    0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0x2B, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xE4, 0x1D, 0xBF, 0xE3,
+    0x1D, 0xBF, 0xE3, 0x1D, 0x0B, 0x13, 0xBF, 0xED, 0x13, 0xBF,
+    0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCD, 0x00,
+    0xFC, 0x00, 0x00, 0x07, 0x01, 0x01, 0x09, 0x01, 0x01, 0xCE,
+    0x08, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x71, 0x71, 0xDA,
+    0x24, 0xDA, 0x80, 0x88, 0x2A, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x00, 0x00, 0x33, 0x04, 0x00, 0x05, 0x25, 0x06, 0x01, 0x00,
+    0x33, 0x05, 0x00, 0x06, 0x44, 0x06, 0x05, 0x03, 0x2C, 0x04,
+    0x06, 0x00, 0x26, 0x05, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00,
+    0xBF, 0xFF, 0xCD, 0x00, 0xDC, 0x00, 0x00, 0x09, 0x01, 0x0D,
+    0x3C, 0x01, 0xCE, 0x02, 0x71, 0x71, 0xDA, 0x24, 0xDA, 0x72,
+    0xDA, 0x7B, 0xCF, 0x07, 0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74,
+    0x65, 0xCF, 0x10, 0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74, 0x65,
+    0x2D, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x69, 0x6E, 0x67, 0xDA,
+    0x80, 0x88, 0xDA, 0x80, 0xFC, 0xDA, 0x7C, 0xDA, 0x78, 0xDA,
+    0x73, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0A, 0x01, 0x03,
+    0x17, 0xCE, 0x03, 0x6B, 0x76, 0x73, 0xDA, 0x24, 0xDA, 0x14,
+    0xDA, 0x2E, 0xDA, 0x2F, 0x37, 0x02, 0x00, 0x00, 0x08, 0x03,
+    0x02, 0x02, 0x2B, 0x03, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00,
+    0x17, 0x04, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x2C, 0x04,
+    0x05, 0x00, 0x43, 0x06, 0x01, 0x00, 0x22, 0x07, 0x00, 0x00,
+    0x1F, 0x05, 0x07, 0x06, 0x19, 0x05, 0x03, 0x00, 0x23, 0x05,
+    0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00,
+    0x1A, 0x05, 0x08, 0x00, 0x17, 0x07, 0x06, 0x00, 0x33, 0x08,
+    0x00, 0x07, 0x2D, 0x03, 0x07, 0x08, 0x43, 0x09, 0x02, 0x00,
+    0x2C, 0x04, 0x06, 0x00, 0x43, 0x06, 0x01, 0x00, 0x18, 0xF3,
+    0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x89,
+    0x24, 0x0C, 0xBF, 0xEF, 0x12, 0xBF, 0xE3, 0x1E, 0xBF, 0xE2,
+    0x1E, 0x05, 0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xCC, 0x34, 0xBF,
+    0xCC, 0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xCC,
+    0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xCC, 0x34,
+    0xBF, 0xCC, 0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xF3, 0x0B, 0xBF,
+    0xE3, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xCD, 0x34, 0xBF, 0xCC,
+    0x34, 0xBF, 0xCC, 0x34, 0xBF, 0x1A, 0x80, 0xED, 0xDA, 0x80,
+    0x90, 0xDA, 0x76, 0xD8, 0x06, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x03, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x02, 0x03,
+    0x04, 0x1A, 0x02, 0x1C, 0x00, 0x25, 0x05, 0x00, 0x00, 0x33,
+    0x05, 0x00, 0x05, 0x26, 0x06, 0x02, 0x00, 0x1F, 0x06, 0x06,
+    0x05, 0x1A, 0x06, 0x03, 0x00, 0x17, 0x04, 0x06, 0x00, 0x18,
+    0x08, 0x00, 0x00, 0x26, 0x08, 0x03, 0x00, 0x1F, 0x08, 0x08,
+    0x05, 0x1A, 0x08, 0x03, 0x00, 0x17, 0x07, 0x08, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x17, 0x04, 0x07,
+    0x00, 0x1A, 0x04, 0x08, 0x00, 0x25, 0x07, 0x01, 0x00, 0x33,
+    0x06, 0x00, 0x07, 0x27, 0x08, 0x00, 0x01, 0x44, 0x07, 0x06,
+    0x08, 0x2C, 0x05, 0x07, 0x00, 0x26, 0x06, 0x04, 0x00, 0x30,
+    0x06, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x43, 0x06, 0x05,
+    0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x07, 0x06, 0x00, 0x30,
+    0x07, 0x00, 0x00, 0x26, 0x05, 0x07, 0x00, 0x1F, 0x04, 0x03,
+    0x05, 0x1A, 0x04, 0x04, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26,
+    0x05, 0x05, 0x00, 0x30, 0x05, 0x00, 0x00, 0x26, 0x06, 0x08,
+    0x00, 0x1F, 0x05, 0x03, 0x06, 0x1A, 0x05, 0x08, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x06, 0x09, 0x00, 0x2C, 0x01, 0x06,
+    0x00, 0x43, 0x07, 0x05, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26,
+    0x06, 0x0A, 0x00, 0x30, 0x06, 0x00, 0x00, 0x26, 0x07, 0x0B,
+    0x00, 0x1F, 0x06, 0x03, 0x07, 0x1A, 0x06, 0x08, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x07, 0x09, 0x00, 0x2C, 0x01, 0x07,
+    0x00, 0x43, 0x08, 0x05, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26,
+    0x07, 0x0C, 0x00, 0x30, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0xA3, 0x3A, 0x81, 0x71, 0xBE,
+    0xA8, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF3, 0x81, 0x5D, 0xBE,
+    0xA3, 0x81, 0x5D, 0xBE, 0xA3, 0x81, 0x5D, 0xBE, 0xDE, 0x08,
+    0xBF, 0xF8, 0x08, 0x1C, 0x0E, 0xBF, 0xF2, 0x0E, 0xBF, 0xEE,
+    0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xE8, 0x17,
+    0xBF, 0xE9, 0x17, 0xBF, 0xD5, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF,
+    0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD0,
+    0x80, 0x8E, 0xBF, 0xC9, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF0,
+    0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xE5, 0x1C, 0xBF, 0xE4, 0x1C,
+    0xBF, 0xE4, 0x1C, 0x22, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xEA,
+    0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0x1C, 0x81,
+    0x5D, 0xBE, 0xA3, 0x81, 0x5D, 0xBE, 0xA3, 0x81, 0x5D, 0xBF,
+    0x9A, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0x00,
+    0x81, 0x5D, 0xBE, 0xA3, 0x81, 0x5D, 0xBE, 0xA3, 0x81, 0x5D,
+    0xBF, 0xC3, 0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xF2, 0x0F, 0xBF,
+    0xF1, 0x0F, 0xBF, 0xEA, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9,
+    0x17, 0xBE, 0xD8, 0x81, 0x5D, 0xBE, 0xA3, 0x81, 0x5D, 0xBE,
+    0xA3, 0x81, 0x5D, 0xBF, 0xED, 0x06, 0xBF, 0xFA, 0x06, 0xBF,
+    0xF2, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xE9, 0x18, 0xBF, 0xE8,
+    0x18, 0xBF, 0xE8, 0x18, 0xBE, 0xAE, 0x81, 0x5D, 0xCD, 0x00,
+    0x00, 0xA3, 0x3A, 0x81, 0x71, 0x0D, 0x08, 0xBF, 0xF8, 0x08,
+    0x06, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF4, 0x0D, 0xBF, 0xE2,
+    0x1F, 0xBF, 0xE1, 0x1F, 0xBF, 0xE1, 0x1F, 0xCD, 0x00, 0xDC,
+    0x00, 0x00, 0x0E, 0x01, 0x06, 0x24, 0x01, 0xCE, 0x05, 0x64,
+    0x6F, 0x74, 0x75, 0x70, 0xDA, 0x24, 0xDA, 0x80, 0x91, 0xD5,
+    0x00, 0xDA, 0x03, 0xDA, 0x5C, 0xDA, 0x7C, 0xDA, 0x80, 0xFC,
+    0x25, 0x03, 0x00, 0x00, 0x33, 0x03, 0x00, 0x03, 0x27, 0x05,
+    0x00, 0x0F, 0x33, 0x05, 0x05, 0x03, 0x26, 0x07, 0x00, 0x00,
+    0x35, 0x07, 0x07, 0x00, 0x33, 0x07, 0x07, 0x03, 0x1A, 0x07,
+    0x03, 0x00, 0x17, 0x06, 0x07, 0x00, 0x18, 0x07, 0x00, 0x00,
+    0x26, 0x08, 0x01, 0x00, 0x1A, 0x08, 0x03, 0x00, 0x17, 0x09,
+    0x08, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x09, 0x00, 0x00,
+    0x17, 0x06, 0x09, 0x00, 0x17, 0x07, 0x06, 0x00, 0x26, 0x09,
+    0x02, 0x00, 0x44, 0x09, 0x09, 0x07, 0x26, 0x0B, 0x03, 0x00,
+    0x44, 0x0B, 0x0B, 0x07, 0x1A, 0x05, 0x03, 0x00, 0x2B, 0x00,
+    0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0x1A, 0x0B, 0x06, 0x00,
+    0x25, 0x0C, 0x01, 0x00, 0x2C, 0x00, 0x0C, 0x00, 0x43, 0x0C,
+    0x04, 0x00, 0x2E, 0x0C, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00,
+    0x27, 0x0C, 0x00, 0x01, 0x2C, 0x0C, 0x00, 0x00, 0x43, 0x0C,
+    0x05, 0x00, 0x2B, 0x0C, 0x00, 0x00, 0x26, 0x0D, 0x04, 0x00,
+    0x30, 0x0D, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0xA5,
+    0xBA, 0x08, 0xBF, 0xF8, 0x08, 0x0E, 0x0C, 0xBF, 0xF4, 0x0C,
+    0x16, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF0,
+    0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF,
+    0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xE1, 0x20, 0x0D, 0x0D,
+    0xBF, 0xF3, 0x0D, 0x0F, 0x0D, 0xBF, 0xF3, 0x0D, 0x07, 0x56,
+    0xBF, 0xB8, 0x04, 0xBF, 0xFC, 0x04, 0xBF, 0xEE, 0x56, 0xBF,
+    0xCA, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEC,
+    0x15, 0xBF, 0xEB, 0x15, 0x15, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF,
+    0xF3, 0x0D, 0xBF, 0xE6, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5,
+    0x1B, 0xCD, 0x00, 0x00, 0x9E, 0xBF, 0x88, 0xEF, 0xB7, 0x6A,
+    0x80, 0xBE, 0xBF, 0x42, 0x80, 0xBE, 0x05, 0x80, 0xFB, 0xBF,
+    0x05, 0x80, 0xFB, 0x05, 0x80, 0xDF, 0xBF, 0x21, 0x80, 0xDF,
+    0x05, 0x5D, 0xBF, 0xA3, 0x5D, 0x05, 0x80, 0xFD, 0xBF, 0x03,
+    0x80, 0xFD, 0x05, 0x81, 0xAE, 0xBE, 0x52, 0x81, 0xAE, 0x05,
+    0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4,
+    0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C,
+    0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4,
+    0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C,
+    0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4,
+    0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C,
+    0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4, 0xBF, 0x3C, 0x80, 0xC4,
+    0x05, 0x80, 0xF8, 0xBF, 0x08, 0x80, 0xF8, 0x18, 0x07, 0xBF,
+    0xF9, 0x07, 0xBF, 0xF3, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD,
+    0xBF, 0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF, 0x26,
+    0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF0, 0x1B, 0xBF, 0xE5, 0x1B,
+    0xBF, 0xE1, 0x69, 0xBF, 0xD7, 0x0E, 0xBF, 0xF2, 0x0E, 0xBF,
+    0xE2, 0x1F, 0xBF, 0xE1, 0x1F, 0xBF, 0xB1, 0x69, 0xBF, 0x97,
+    0x69, 0xBF, 0xF7, 0x08, 0xBF, 0x98, 0x69, 0xBF, 0x7B, 0x80,
+    0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF,
+    0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF, 0x97, 0x0D,
+    0xBF, 0xF3, 0x0D, 0xBF, 0x5F, 0x80, 0xFD, 0xBF, 0x03, 0x80,
+    0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF,
+    0x03, 0x80, 0xFD, 0xBF, 0xC5, 0x11, 0xBF, 0xEF, 0x11, 0xBF,
+    0xDE, 0x23, 0xBF, 0xDD, 0x23, 0xBF, 0x2C, 0x80, 0xFD, 0xBF,
+    0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80,
+    0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF, 0xE6, 0x11, 0xBF, 0xEF,
+    0x11, 0xBF, 0x0C, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF,
+    0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBF, 0x03, 0x80,
+    0xFD, 0xBF, 0x03, 0x80, 0xFD, 0xBE, 0xF6, 0x81, 0x0B, 0xB7,
+    0x18, 0x88, 0xEF, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x13,
+    0x02, 0x0C, 0x71, 0xCE, 0x09, 0x64, 0x65, 0x65, 0x70, 0x2D,
+    0x6E, 0x6F, 0x74, 0x3D, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x7B,
+    0xDA, 0x80, 0xFC, 0xDA, 0x80, 0xF7, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x0B, 0x02, 0x01, 0x12, 0xCE, 0x04, 0x73, 0x6F,
+    0x6D, 0x65, 0xDA, 0x24, 0xDA, 0x80, 0xC3, 0x22, 0x03, 0x00,
+    0x00, 0x17, 0x04, 0x01, 0x00, 0x37, 0x06, 0x04, 0x00, 0x25,
+    0x05, 0x00, 0x00, 0x3E, 0x08, 0x05, 0x06, 0x1A, 0x08, 0x04,
+    0x00, 0x2B, 0x03, 0x00, 0x00, 0x43, 0x07, 0x00, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x07,
+    0x00, 0x33, 0x09, 0x04, 0x05, 0x44, 0x0A, 0x09, 0x00, 0x1A,
+    0x0A, 0x02, 0x00, 0x17, 0x03, 0x0A, 0x00, 0x05, 0x05, 0x05,
+    0x01, 0x18, 0xF4, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xCD,
+    0x00, 0x00, 0xA8, 0xE4, 0x0C, 0x04, 0x43, 0xBF, 0xBD, 0x43,
+    0xBF, 0xBD, 0x43, 0xBF, 0xBD, 0x43, 0xBF, 0xBD, 0x43, 0xBF,
+    0xD4, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xE1, 0x43, 0xBF, 0xBD,
+    0x43, 0xBF, 0xBD, 0x43, 0xBF, 0xBD, 0x43, 0xBF, 0xEA, 0x07,
+    0xBF, 0xEE, 0x20, 0xBF, 0xF5, 0x0A, 0xBF, 0xBF, 0x43, 0xBF,
+    0xBD, 0x43, 0xBF, 0x34, 0x80, 0xD3, 0xDA, 0x78, 0xDA, 0x76,
+    0xDA, 0x80, 0x89, 0xDA, 0x73, 0xDA, 0x77, 0xDA, 0x80, 0xC5,
+    0xDA, 0x80, 0xD5, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x43, 0x04, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x43,
+    0x05, 0x00, 0x00, 0x1F, 0x06, 0x04, 0x05, 0x19, 0x06, 0x03,
+    0x00, 0x23, 0x06, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24,
+    0x06, 0x00, 0x00, 0x17, 0x05, 0x06, 0x00, 0x1A, 0x05, 0x02,
+    0x00, 0x03, 0x05, 0x00, 0x00, 0x26, 0x08, 0x01, 0x00, 0x1F,
+    0x07, 0x04, 0x08, 0x1A, 0x07, 0x18, 0x00, 0x37, 0x08, 0x00,
+    0x00, 0x37, 0x09, 0x01, 0x00, 0x1F, 0x0A, 0x08, 0x09, 0x19,
+    0x0A, 0x03, 0x00, 0x23, 0x0A, 0x00, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x24, 0x0A, 0x00, 0x00, 0x17, 0x08, 0x0A, 0x00, 0x1A,
+    0x08, 0x03, 0x00, 0x17, 0x09, 0x08, 0x00, 0x18, 0x0B, 0x00,
+    0x00, 0x2D, 0x02, 0x00, 0x01, 0x43, 0x0A, 0x02, 0x00, 0x26,
+    0x0B, 0x03, 0x00, 0x2C, 0x0B, 0x0A, 0x00, 0x43, 0x0A, 0x04,
+    0x00, 0x1A, 0x0A, 0x03, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x22, 0x0B, 0x00, 0x00, 0x17, 0x09, 0x0B,
+    0x00, 0x17, 0x06, 0x09, 0x00, 0x18, 0x47, 0x00, 0x00, 0x26,
+    0x0A, 0x05, 0x00, 0x1F, 0x09, 0x04, 0x0A, 0x1A, 0x09, 0x18,
+    0x00, 0x37, 0x0A, 0x00, 0x00, 0x37, 0x0B, 0x01, 0x00, 0x1F,
+    0x0C, 0x0A, 0x0B, 0x19, 0x0C, 0x03, 0x00, 0x23, 0x0C, 0x00,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x0C, 0x00, 0x00, 0x17,
+    0x0A, 0x0C, 0x00, 0x1A, 0x0A, 0x03, 0x00, 0x17, 0x0B, 0x0A,
+    0x00, 0x18, 0x0B, 0x00, 0x00, 0x2D, 0x02, 0x00, 0x01, 0x43,
+    0x0C, 0x02, 0x00, 0x26, 0x0D, 0x03, 0x00, 0x2C, 0x0D, 0x0C,
+    0x00, 0x43, 0x0C, 0x04, 0x00, 0x1A, 0x0C, 0x03, 0x00, 0x17,
+    0x0D, 0x0C, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x0D, 0x00,
+    0x00, 0x17, 0x0B, 0x0D, 0x00, 0x17, 0x08, 0x0B, 0x00, 0x18,
+    0x2C, 0x00, 0x00, 0x26, 0x0C, 0x06, 0x00, 0x1F, 0x0B, 0x04,
+    0x0C, 0x1A, 0x0B, 0x08, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x0C, 0x07, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x43, 0x0D, 0x07,
+    0x00, 0x2C, 0x0C, 0x0D, 0x00, 0x2F, 0x0A, 0x02, 0x00, 0x18,
+    0x21, 0x00, 0x00, 0x26, 0x0E, 0x08, 0x00, 0x1F, 0x0D, 0x04,
+    0x0E, 0x1A, 0x0D, 0x08, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x0E, 0x09, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x43, 0x0F, 0x09,
+    0x00, 0x2C, 0x0E, 0x0F, 0x00, 0x2F, 0x0C, 0x02, 0x00, 0x18,
+    0x16, 0x00, 0x00, 0x26, 0x10, 0x0A, 0x00, 0x1F, 0x0F, 0x04,
+    0x10, 0x1A, 0x0F, 0x0C, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x10, 0x0B, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x43, 0x11, 0x0B,
+    0x00, 0x1F, 0x12, 0x10, 0x11, 0x19, 0x12, 0x03, 0x00, 0x23,
+    0x12, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x12, 0x00,
+    0x00, 0x17, 0x0E, 0x12, 0x00, 0x18, 0x07, 0x00, 0x00, 0x1F,
+    0x10, 0x00, 0x01, 0x19, 0x10, 0x03, 0x00, 0x23, 0x10, 0x00,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x17,
+    0x0E, 0x10, 0x00, 0x17, 0x0C, 0x0E, 0x00, 0x17, 0x0A, 0x0C,
+    0x00, 0x17, 0x08, 0x0A, 0x00, 0x17, 0x06, 0x08, 0x00, 0x17,
+    0x07, 0x06, 0x00, 0x1A, 0x07, 0x02, 0x00, 0x03, 0x07, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0xA9, 0x41,
+    0x82, 0x33, 0xBE, 0x7A, 0x07, 0xBF, 0xF9, 0x07, 0x16, 0x07,
+    0xBF, 0xF9, 0x07, 0xBF, 0xF0, 0x11, 0xBF, 0xEF, 0x11, 0xBF,
+    0xEF, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xE7,
+    0x81, 0x79, 0xBE, 0x87, 0x81, 0x79, 0xBE, 0x87, 0x81, 0x79,
+    0xBE, 0xA6, 0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7,
+    0x81, 0x59, 0xBE, 0xC7, 0x09, 0x02, 0x09, 0xBF, 0xE6, 0x1B,
+    0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF,
+    0xE5, 0x1B, 0xBF, 0xE1, 0x44, 0xBF, 0xBC, 0x44, 0xBF, 0xBC,
+    0x44, 0xBF, 0xBC, 0x44, 0xBF, 0xEC, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xDF, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE, 0x22, 0xBF,
+    0xBD, 0x44, 0xBF, 0xBC, 0x44, 0xBF, 0xBC, 0x44, 0xBF, 0xBC,
+    0x44, 0xBF, 0xBC, 0x44, 0xBF, 0xA6, 0x81, 0x59, 0xBE, 0xA7,
+    0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59,
+    0xBE, 0xA7, 0x81, 0x59, 0xBF, 0x1A, 0x09, 0x02, 0x09, 0xBF,
+    0xE6, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5,
+    0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE1, 0x44, 0xBF, 0xBC, 0x44,
+    0xBF, 0xBC, 0x44, 0xBF, 0xBC, 0x44, 0xBF, 0xEC, 0x12, 0xBF,
+    0xEE, 0x12, 0xBF, 0xDF, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE,
+    0x22, 0xBF, 0xBD, 0x44, 0xBF, 0xBC, 0x44, 0xBF, 0xBC, 0x44,
+    0xBF, 0xBC, 0x44, 0xBF, 0xBC, 0x44, 0xBF, 0x53, 0x81, 0x59,
+    0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7,
+    0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBF, 0x6F, 0x08, 0xBF,
+    0xF8, 0x08, 0x02, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xE3, 0x1E,
+    0xBF, 0xE2, 0x1E, 0xBF, 0x25, 0x81, 0x59, 0xBE, 0xA7, 0x81,
+    0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBF,
+    0x9C, 0x12, 0xBF, 0xEE, 0x12, 0x02, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xCF, 0x32, 0xBF, 0xCE, 0x32, 0xBE, 0xE4, 0x81, 0x59,
+    0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7,
+    0x81, 0x59, 0xBF, 0xD9, 0x09, 0xBF, 0xF7, 0x09, 0x02, 0x09,
+    0xBF, 0xF7, 0x09, 0xBF, 0xE6, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF,
+    0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBE, 0xB9,
+    0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBF, 0xF6, 0x09, 0xBF,
+    0xF7, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF7,
+    0x09, 0xBE, 0xA8, 0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBE,
+    0xA7, 0x81, 0x59, 0xBE, 0xA7, 0x81, 0x59, 0xBE, 0xA7, 0x81,
+    0x59, 0xBE, 0x88, 0x81, 0x79, 0xBE, 0x87, 0x81, 0x79, 0xBE,
+    0x87, 0x81, 0x79, 0xBE, 0x87, 0x81, 0x79, 0xCE, 0x1A, 0x6D,
+    0x61, 0x63, 0x72, 0x6F, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E,
+    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6E,
+    0x65, 0x73, 0x74, 0x65, 0x64, 0x17, 0x02, 0x00, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x25, 0x05, 0x00,
+    0x00, 0x2C, 0x04, 0x02, 0x00, 0x43, 0x06, 0x01, 0x00, 0x1A,
+    0x06, 0x0B, 0x00, 0x05, 0x05, 0x05, 0x01, 0x25, 0x08, 0xC8,
+    0x00, 0x40, 0x07, 0x05, 0x08, 0x1A, 0x07, 0x03, 0x00, 0x26,
+    0x08, 0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x17, 0x02, 0x04,
+    0x00, 0x2B, 0x04, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x18,
+    0xF4, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0xAC, 0x5C, 0x0F, 0x11, 0x09, 0xBF, 0xF7, 0x09, 0x05, 0x0E,
+    0x0B, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xDE, 0x80, 0xAA, 0xBF,
+    0x85, 0x0B, 0xBF, 0xF2, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xE9,
+    0x43, 0xBF, 0xDC, 0x23, 0xBF, 0xDD, 0x23, 0x07, 0x15, 0x13,
+    0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0x58, 0x80, 0xAA, 0xBE, 0xE4,
+    0x81, 0x27, 0xCF, 0x07, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74,
+    0x2A, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0xA5,
+    0x28, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x2A, 0x20, 0x65,
+    0x6E, 0x76, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x20,
+    0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x49, 0x6D, 0x70,
+    0x6F, 0x72, 0x74, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69,
+    0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x28, 0x69, 0x6D,
+    0x70, 0x6F, 0x72, 0x74, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63,
+    0x74, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x70,
+    0x6C, 0x69, 0x63, 0x69, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69,
+    0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0xCF, 0xE9, 0xCD, 0x00, 0x00,
+    0xD1, 0xCB, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00,
+    0x13, 0x02, 0x0B, 0x3F, 0xCE, 0x07, 0x69, 0x6D, 0x70, 0x6F,
+    0x72, 0x74, 0x2A, 0xDA, 0x24, 0xDA, 0x80, 0x90, 0xD0, 0x02,
+    0x61, 0x73, 0xD0, 0x06, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+    0xD7, 0xCD, 0x00, 0xBB, 0x00, 0x00, 0x11, 0x01, 0x13, 0x50,
+    0x02, 0xCE, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+    0xDA, 0x24, 0xDA, 0x80, 0x90, 0xD0, 0x04, 0x65, 0x78, 0x69,
+    0x74, 0xD3, 0x00, 0xD7, 0xCD, 0x00, 0xBE, 0x00, 0x00, 0x13,
+    0x01, 0x0E, 0x2D, 0x02, 0xCE, 0x0B, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0xDA, 0x24, 0xCE,
+    0x01, 0x2F, 0xD8, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74, 0xD8, 0x08, 0x6F, 0x73,
+    0x2F, 0x77, 0x68, 0x69, 0x63, 0x68, 0xD0, 0x07, 0x77, 0x69,
+    0x6E, 0x64, 0x6F, 0x77, 0x73, 0xCE, 0x03, 0x64, 0x6C, 0x6C,
+    0xCE, 0x02, 0x73, 0x6F, 0xD1, 0x0D, 0xD2, 0x02, 0x00, 0xCE,
+    0x0D, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0xD0, 0x06, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0xD2, 0x02, 0x00, 0xCE, 0x12, 0x2E, 0x2F, 0x3A,
+    0x61, 0x6C, 0x6C, 0x3A, 0x2F, 0x69, 0x6E, 0x69, 0x74, 0x2E,
+    0x6A, 0x61, 0x6E, 0x65, 0x74, 0xDA, 0x81, 0x2A, 0xD2, 0x02,
+    0x00, 0xCE, 0x11, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A,
+    0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0xDA, 0x81, 0x2A, 0xD2, 0x02, 0x00, 0xCE, 0x16, 0x3A, 0x73,
+    0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2F,
+    0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0xDA, 0x81, 0x2A, 0xD2, 0x02, 0x00, 0xCE, 0x10, 0x2E, 0x2F,
+    0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x3A, 0x6E, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x3A, 0xD0, 0x06, 0x6E, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0xD2, 0x02, 0x00, 0xCE, 0x17, 0x2E, 0x2F, 0x3A,
+    0x61, 0x6C, 0x6C, 0x3A, 0x2F, 0x3A, 0x6E, 0x61, 0x6D, 0x65,
+    0x3A, 0x2E, 0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3A,
+    0xDA, 0x81, 0x33, 0xD2, 0x02, 0x00, 0xCE, 0x14, 0x3A, 0x73,
+    0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E,
+    0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3A, 0xDA, 0x81,
+    0x33, 0xD2, 0x02, 0x00, 0xCE, 0x1B, 0x3A, 0x73, 0x79, 0x73,
+    0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2F, 0x3A, 0x6E,
+    0x61, 0x6D, 0x65, 0x3A, 0x2E, 0x3A, 0x6E, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x3A, 0xDA, 0x81, 0x33, 0xD2, 0x02, 0x00, 0xCE,
+    0x0E, 0x2E, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A,
+    0x69, 0x6D, 0x61, 0x67, 0x65, 0xD0, 0x05, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0xD2, 0x02, 0x00, 0xCE, 0x15, 0x2E, 0x2F, 0x3A,
+    0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x3A, 0x6E, 0x61, 0x6D, 0x65,
+    0x3A, 0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA, 0x81,
+    0x3C, 0xD2, 0x02, 0x00, 0xCE, 0x12, 0x3A, 0x73, 0x79, 0x73,
+    0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A, 0x69,
+    0x6D, 0x61, 0x67, 0x65, 0xDA, 0x81, 0x3C, 0xD2, 0x02, 0x00,
+    0xCE, 0x19, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61,
+    0x6C, 0x6C, 0x3A, 0x2F, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A,
+    0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA, 0x81, 0x3C,
+    0xD2, 0x02, 0x00, 0xCE, 0x05, 0x3A, 0x61, 0x6C, 0x6C, 0x3A,
+    0xDA, 0x81, 0x2A, 0xDA, 0x80, 0xFC, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x07, 0x02, 0x01, 0x08, 0xCE, 0x04, 0x66, 0x69,
+    0x6E, 0x64, 0xDA, 0x24, 0xDA, 0x27, 0x2C, 0x00, 0x01, 0x00,
+    0x43, 0x04, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x1F, 0x05,
+    0x04, 0x06, 0x1A, 0x05, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x33, 0x06, 0x01, 0x04, 0x03, 0x06, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x64, 0xF7, 0x14, 0xBF, 0xEC, 0x14, 0x09, 0x08, 0xBF,
+    0xF8, 0x08, 0xBF, 0xF4, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xF5,
+    0x0A, 0xBF, 0xF6, 0x0A, 0xDA, 0x80, 0xE0, 0xD7, 0xCD, 0x00,
+    0x9C, 0x00, 0x00, 0x0B, 0x02, 0x02, 0x15, 0xCE, 0x09, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x70, 0x6F, 0x73, 0x65, 0xDA, 0x24,
+    0xDA, 0x14, 0xDA, 0x2F, 0x37, 0x04, 0x01, 0x00, 0x08, 0x05,
+    0x04, 0x02, 0x05, 0x06, 0x05, 0xFF, 0x2B, 0x06, 0x00, 0x00,
+    0x43, 0x06, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00, 0x4B, 0x07,
+    0x04, 0x08, 0x1A, 0x07, 0x05, 0x00, 0x25, 0x09, 0x00, 0x00,
+    0x33, 0x08, 0x01, 0x09, 0x25, 0x09, 0x00, 0x00, 0x34, 0x06,
+    0x09, 0x08, 0x25, 0x07, 0x01, 0x00, 0x3E, 0x08, 0x07, 0x04,
+    0x1A, 0x08, 0x06, 0x00, 0x33, 0x09, 0x01, 0x07, 0x2D, 0x06,
+    0x00, 0x09, 0x43, 0x0A, 0x01, 0x00, 0x05, 0x07, 0x07, 0x01,
+    0x18, 0xFA, 0xFF, 0xFF, 0x03, 0x06, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x89, 0xF3, 0x0B, 0x1C, 0x08, 0xBF, 0xF5, 0x0E, 0xBF,
+    0xE7, 0x1A, 0xBF, 0xE6, 0x1A, 0x09, 0x08, 0xBF, 0xF8, 0x08,
+    0xBF, 0xF4, 0x25, 0xBF, 0xF4, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF,
+    0xEB, 0x16, 0xBF, 0xEA, 0x16, 0x05, 0x08, 0x0B, 0x08, 0xBF,
+    0xF1, 0x40, 0xBF, 0xE9, 0x0A, 0xBF, 0xE2, 0x1F, 0xBF, 0xE1,
+    0x1F, 0x06, 0x05, 0xBF, 0xC1, 0x40, 0xBE, 0xD5, 0x81, 0x32,
+    0xCE, 0x16, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x6D, 0x6F, 0x64,
+    0x75, 0x6C, 0x65, 0x20, 0xCE, 0x06, 0x3A, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0xDA, 0x80, 0xD5, 0x28, 0x01, 0x00, 0x00, 0x26,
+    0x02, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x43, 0x02, 0x01,
+    0x00, 0x17, 0x03, 0x02, 0x00, 0x37, 0x04, 0x03, 0x00, 0x05,
+    0x05, 0x04, 0xFF, 0x33, 0x04, 0x03, 0x05, 0x17, 0x05, 0x04,
+    0x00, 0x43, 0x07, 0x02, 0x00, 0x26, 0x09, 0x03, 0x00, 0x1F,
+    0x08, 0x09, 0x07, 0x1A, 0x08, 0x03, 0x00, 0x26, 0x06, 0x04,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x06, 0x05, 0x00, 0x17,
+    0x07, 0x06, 0x00, 0x2A, 0x08, 0x00, 0x00, 0x17, 0x09, 0x08,
+    0x00, 0x2A, 0x0A, 0x01, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x26,
+    0x0C, 0x06, 0x00, 0x2C, 0x09, 0x0C, 0x00, 0x43, 0x0C, 0x07,
+    0x00, 0x17, 0x0D, 0x0C, 0x00, 0x2C, 0x0B, 0x0D, 0x00, 0x43,
+    0x0E, 0x08, 0x00, 0x17, 0x0F, 0x0E, 0x00, 0x1A, 0x0F, 0x02,
+    0x00, 0x03, 0x0F, 0x00, 0x00, 0x25, 0x10, 0x00, 0x00, 0x2C,
+    0x10, 0x0D, 0x00, 0x43, 0x10, 0x07, 0x00, 0x26, 0x11, 0x09,
+    0x00, 0x2C, 0x11, 0x10, 0x00, 0x43, 0x11, 0x0A, 0x00, 0x26,
+    0x10, 0x0B, 0x00, 0x26, 0x12, 0x0C, 0x00, 0x2D, 0x10, 0x00,
+    0x12, 0x2E, 0x11, 0x00, 0x00, 0x43, 0x10, 0x0D, 0x00, 0x22,
+    0x11, 0x00, 0x00, 0x2C, 0x11, 0x10, 0x00, 0x3D, 0x10, 0x00,
+    0x00, 0x03, 0x10, 0x00, 0x00, 0xCD, 0x00, 0xDC, 0x00, 0x00,
+    0x07, 0x01, 0x06, 0x16, 0x01, 0xCE, 0x09, 0x6D, 0x61, 0x6B,
+    0x65, 0x2D, 0x66, 0x75, 0x6C, 0x6C, 0xDA, 0x24, 0xCE, 0x06,
+    0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0xD8, 0x0E, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61,
+    0x63, 0x65, 0xCE, 0x05, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0xD1,
+    0x01, 0xCE, 0x14, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C, 0x6F,
+    0x63, 0x61, 0x6C, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0xCE, 0x08, 0x3A, 0x6E, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x3A, 0xDA, 0x81, 0x44, 0x35, 0x02, 0x00, 0x00,
+    0x35, 0x03, 0x00, 0x01, 0x26, 0x04, 0x00, 0x00, 0x27, 0x05,
+    0x00, 0x05, 0x2D, 0x04, 0x05, 0x02, 0x43, 0x04, 0x01, 0x00,
+    0x26, 0x05, 0x02, 0x00, 0x26, 0x06, 0x03, 0x00, 0x35, 0x06,
+    0x06, 0x00, 0x2D, 0x05, 0x06, 0x04, 0x43, 0x05, 0x01, 0x00,
+    0x26, 0x04, 0x04, 0x00, 0x27, 0x06, 0x00, 0x07, 0x2D, 0x04,
+    0x06, 0x05, 0x43, 0x04, 0x01, 0x00, 0x26, 0x05, 0x05, 0x00,
+    0x27, 0x06, 0x00, 0x00, 0x2D, 0x05, 0x06, 0x04, 0x43, 0x04,
+    0x01, 0x00, 0x2C, 0x04, 0x03, 0x00, 0x3D, 0x06, 0x00, 0x00,
+    0x03, 0x06, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0xC6,
+    0xCC, 0x81, 0x39, 0xBE, 0xC7, 0x81, 0x39, 0xBE, 0xFC, 0x80,
+    0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF,
+    0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80,
+    0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF,
+    0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80,
+    0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF,
+    0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF, 0x16, 0x80,
+    0xEA, 0xBF, 0x16, 0x80, 0xEA, 0x07, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xEE, 0x12, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x07, 0xCE, 0x0A, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x2D,
+    0x70, 0x61, 0x74, 0x68, 0xDA, 0x24, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x05, 0x01, 0x02, 0x07, 0xCE, 0x07, 0x66, 0x65,
+    0x78, 0x69, 0x73, 0x74, 0x73, 0xDA, 0x24, 0xD8, 0x09, 0x66,
+    0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0xD8, 0x0A,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65,
+    0x2B, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x1A, 0x03,
+    0x04, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x43, 0x04, 0x01, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0xC4, 0xFC, 0x0F, 0xBF, 0xF1, 0x0F, 0x05, 0x1E, 0xBF,
+    0xEC, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xEF, 0x17, 0xBF, 0xE3,
+    0x1E, 0x25, 0x03, 0x00, 0x00, 0x44, 0x02, 0x03, 0x00, 0x2B,
+    0x02, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x02,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xCD,
+    0x00, 0x00, 0xC8, 0x2B, 0x04, 0xBF, 0xFC, 0x04, 0xBF, 0xF3,
+    0x0E, 0xBF, 0xF2, 0x0E, 0xBF, 0xEE, 0x15, 0xBF, 0xEB, 0x15,
+    0xBF, 0xEB, 0x15, 0xCD, 0x00, 0x00, 0xC5, 0x32, 0x84, 0x13,
+    0xBD, 0x09, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF,
+    0xDF, 0x22, 0x1C, 0x0D, 0xBF, 0xF0, 0x13, 0xBF, 0xE2, 0x1F,
+    0xBF, 0xD7, 0x2A, 0x1E, 0x09, 0xBF, 0xEB, 0x16, 0xBF, 0xEA,
+    0x16, 0xBF, 0xE6, 0x26, 0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26,
+    0xBF, 0xDA, 0x26, 0xBF, 0xD0, 0x31, 0x04, 0x81, 0x39, 0xBE,
+    0xC7, 0x81, 0x39, 0x04, 0x2B, 0xBF, 0xD5, 0x2B, 0x0F, 0x1B,
+    0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xDA, 0x27, 0x0D,
+    0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xE1, 0x20, 0x04, 0x80, 0xBD,
+    0xBF, 0x43, 0x80, 0xBD, 0xBF, 0xF0, 0x0C, 0xBF, 0xF4, 0x0C,
+    0xBF, 0xF4, 0x0C, 0xBF, 0xDF, 0x22, 0xBF, 0xDE, 0x22, 0xBF,
+    0xDE, 0x22, 0xBF, 0x57, 0x80, 0xAA, 0xBF, 0x56, 0x80, 0xAA,
+    0xBF, 0x56, 0x80, 0xAA, 0xBF, 0x56, 0x80, 0xAA, 0xBF, 0x56,
+    0x80, 0xAA, 0xBF, 0x51, 0x80, 0xB0, 0xBF, 0x50, 0x80, 0xB0,
+    0xBF, 0x50, 0x80, 0xB0, 0xBF, 0x50, 0x80, 0xB0, 0xDA, 0x81,
+    0x2A, 0xDA, 0x81, 0x55, 0xD7, 0xCD, 0x00, 0x98, 0x00, 0x00,
+    0x06, 0x01, 0x02, 0x09, 0xCE, 0x08, 0x6D, 0x61, 0x6B, 0x65,
+    0x2D, 0x65, 0x6E, 0x76, 0xDA, 0x24, 0xDA, 0x00, 0xD8, 0x0E,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x70,
+    0x72, 0x6F, 0x74, 0x6F, 0x1A, 0x00, 0x03, 0x00, 0x17, 0x02,
+    0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+    0x17, 0x03, 0x02, 0x00, 0x3C, 0x04, 0x00, 0x00, 0x2C, 0x04,
+    0x03, 0x00, 0x43, 0x04, 0x01, 0x00, 0x03, 0x04, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0xAE, 0xA9, 0x16, 0xBF, 0xEA, 0x16, 0xBF,
+    0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xDE, 0x23, 0x10, 0x1A,
+    0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBE, 0xEC, 0x81, 0x1F,
+    0xD3, 0x00, 0xD0, 0x03, 0x65, 0x6E, 0x76, 0xD0, 0x09, 0x6F,
+    0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0xD0, 0x06,
+    0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0xD7, 0xCD, 0x00, 0xBE,
+    0x00, 0x00, 0x23, 0x01, 0x15, 0x7F, 0x01, 0xCE, 0x0B, 0x72,
+    0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74,
+    0xDA, 0x24, 0xDA, 0x81, 0x5D, 0xD0, 0x0E, 0x6F, 0x6E, 0x2D,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0xDA, 0x81, 0x5E, 0xDA, 0x81, 0x5F, 0xDA, 0x81, 0x2A,
+    0xD0, 0x10, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+    0x6C, 0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xDA, 0x80,
+    0x91, 0xD7, 0xCD, 0x00, 0x98, 0x00, 0x00, 0x07, 0x02, 0x06,
+    0x12, 0xCE, 0x07, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65,
+    0xDA, 0x24, 0xDA, 0x80, 0xD8, 0xD8, 0x06, 0x73, 0x74, 0x64,
+    0x6F, 0x75, 0x74, 0xD8, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F,
+    0x77, 0x72, 0x69, 0x74, 0x65, 0xD8, 0x05, 0x73, 0x74, 0x64,
+    0x69, 0x6E, 0xD0, 0x04, 0x6C, 0x69, 0x6E, 0x65, 0xD8, 0x09,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0x22,
+    0x05, 0x00, 0x00, 0x1F, 0x04, 0x05, 0x00, 0x1A, 0x04, 0x05,
+    0x00, 0x26, 0x05, 0x00, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x39,
+    0x03, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x03, 0x00,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x1A, 0x01, 0x04, 0x00, 0x26,
+    0x05, 0x01, 0x00, 0x2C, 0x05, 0x01, 0x00, 0x43, 0x05, 0x02,
+    0x00, 0x26, 0x05, 0x03, 0x00, 0x26, 0x06, 0x04, 0x00, 0x2D,
+    0x05, 0x06, 0x04, 0x43, 0x05, 0x05, 0x00, 0x03, 0x04, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0xB1, 0x1F, 0x10, 0xBF, 0xF0, 0x10,
+    0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0,
+    0x10, 0x04, 0x1D, 0xBF, 0xEB, 0x14, 0xBF, 0xEC, 0x14, 0xBF,
+    0xEC, 0x14, 0x05, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A,
+    0xBF, 0xE6, 0x1A, 0xBF, 0x6B, 0x80, 0x9C, 0xD8, 0x10, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x74, 0x72, 0x61, 0x63, 0x65, 0xD7, 0xCD, 0x00, 0x9C, 0x00,
+    0x00, 0x06, 0x03, 0x06, 0x0C, 0xCE, 0x0B, 0x62, 0x61, 0x64,
+    0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xDA, 0x24,
+    0xDA, 0x80, 0x9A, 0xCE, 0x0F, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+    0x6C, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20,
+    0xCE, 0x11, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0xDA,
+    0x80, 0xD7, 0xDA, 0x81, 0x65, 0xDA, 0x81, 0x6A, 0x26, 0x04,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x04, 0x05, 0x00,
+    0x26, 0x04, 0x02, 0x00, 0x26, 0x05, 0x03, 0x00, 0x2D, 0x04,
+    0x02, 0x05, 0x43, 0x04, 0x04, 0x00, 0x1A, 0x01, 0x04, 0x00,
+    0x2B, 0x01, 0x00, 0x00, 0x26, 0x05, 0x05, 0x00, 0x30, 0x05,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0xB0,
+    0x64, 0x47, 0xBF, 0xB9, 0x47, 0xBF, 0xB9, 0x47, 0xBF, 0xB9,
+    0x47, 0xBF, 0xB9, 0x47, 0xBF, 0xB9, 0x47, 0xBF, 0xB9, 0x47,
+    0x04, 0x26, 0xBF, 0xE7, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8,
+    0x18, 0xBF, 0xDB, 0x26, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x07, 0x02, 0x09, 0x10, 0xCE, 0x09, 0x62, 0x61, 0x64, 0x2D,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0xDA, 0x24, 0xD8, 0x0C, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x77, 0x68, 0x65, 0x72,
+    0x65, 0xDA, 0x80, 0xD5, 0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xDA, 0x80,
+    0x9A, 0xCE, 0x0F, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x20, 0xCE, 0x0D,
+    0x20, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x20, 0xCE, 0x02, 0x3A, 0x20, 0xDA, 0x80, 0xD7,
+    0xDA, 0x81, 0x65, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00,
+    0x00, 0x2B, 0x03, 0x00, 0x00, 0x43, 0x04, 0x01, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x03, 0x02, 0x00, 0x26, 0x05, 0x03,
+    0x00, 0x26, 0x06, 0x04, 0x00, 0x2D, 0x05, 0x06, 0x01, 0x26,
+    0x05, 0x05, 0x00, 0x26, 0x06, 0x06, 0x00, 0x2D, 0x05, 0x04,
+    0x06, 0x26, 0x05, 0x07, 0x00, 0x2C, 0x03, 0x05, 0x00, 0x26,
+    0x05, 0x08, 0x00, 0x30, 0x05, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0xAF, 0xB8, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xE9, 0x18, 0xBF,
+    0xE8, 0x18, 0x23, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0x43, 0x80,
+    0xD1, 0xBF, 0x2F, 0x80, 0xD1, 0xBF, 0x2F, 0x80, 0xD1, 0xBF,
+    0x2F, 0x80, 0xD1, 0xBF, 0x2F, 0x80, 0xD1, 0xBF, 0x2F, 0x80,
+    0xD1, 0xBF, 0x2F, 0x80, 0xD1, 0xBF, 0x2F, 0x80, 0xD1, 0xBF,
+    0x2F, 0x80, 0xD1, 0xBF, 0x2F, 0x80, 0xD1, 0xCE, 0x0B, 0x3C,
+    0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x3E,
+    0xD8, 0x0A, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x6E,
+    0x65, 0x77, 0xDA, 0x80, 0xD8, 0xDA, 0x80, 0xE3, 0xD8, 0x0A,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x65, 0x6F, 0x66,
+    0xDA, 0x47, 0xD8, 0x0F, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x68, 0x61, 0x73, 0x2D, 0x6D, 0x6F, 0x72, 0x65, 0xD8,
+    0x0E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x70, 0x72,
+    0x6F, 0x64, 0x75, 0x63, 0x65, 0xD8, 0x0D, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0xD0, 0x05, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x01, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x33, 0x02, 0x00, 0x03, 0x17,
+    0x03, 0x02, 0x00, 0x26, 0x04, 0x01, 0x00, 0x33, 0x02, 0x00,
+    0x04, 0x17, 0x04, 0x02, 0x00, 0x26, 0x05, 0x02, 0x00, 0x33,
+    0x02, 0x00, 0x05, 0x17, 0x05, 0x02, 0x00, 0x26, 0x06, 0x03,
+    0x00, 0x33, 0x02, 0x00, 0x06, 0x17, 0x06, 0x02, 0x00, 0x26,
+    0x07, 0x04, 0x00, 0x33, 0x02, 0x00, 0x07, 0x17, 0x07, 0x02,
+    0x00, 0x26, 0x08, 0x05, 0x00, 0x33, 0x02, 0x00, 0x08, 0x17,
+    0x08, 0x02, 0x00, 0x22, 0x0A, 0x00, 0x00, 0x1F, 0x09, 0x0A,
+    0x03, 0x1A, 0x09, 0x04, 0x00, 0x26, 0x02, 0x06, 0x00, 0x35,
+    0x02, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x02, 0x03,
+    0x00, 0x17, 0x09, 0x02, 0x00, 0x22, 0x0C, 0x00, 0x00, 0x1F,
+    0x0B, 0x0C, 0x06, 0x1A, 0x0B, 0x03, 0x00, 0x26, 0x0A, 0x07,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x0A, 0x06, 0x00, 0x17,
+    0x0B, 0x0A, 0x00, 0x22, 0x0E, 0x00, 0x00, 0x1F, 0x0D, 0x0E,
+    0x05, 0x1A, 0x0D, 0x03, 0x00, 0x26, 0x0C, 0x08, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x17, 0x0C, 0x05, 0x00, 0x17, 0x0D, 0x0C,
+    0x00, 0x22, 0x10, 0x00, 0x00, 0x1F, 0x0F, 0x10, 0x08, 0x1A,
+    0x0F, 0x03, 0x00, 0x26, 0x0E, 0x09, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x17, 0x0E, 0x08, 0x00, 0x17, 0x0F, 0x0E, 0x00, 0x22,
+    0x12, 0x00, 0x00, 0x1F, 0x11, 0x12, 0x04, 0x1A, 0x11, 0x03,
+    0x00, 0x26, 0x10, 0x0A, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17,
+    0x10, 0x04, 0x00, 0x17, 0x11, 0x10, 0x00, 0x22, 0x14, 0x00,
+    0x00, 0x1F, 0x13, 0x14, 0x07, 0x1A, 0x13, 0x03, 0x00, 0x26,
+    0x12, 0x0B, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x12, 0x07,
+    0x00, 0x17, 0x13, 0x12, 0x00, 0x23, 0x14, 0x00, 0x00, 0x43,
+    0x15, 0x0C, 0x00, 0x17, 0x16, 0x15, 0x00, 0x2A, 0x17, 0x00,
+    0x00, 0x17, 0x18, 0x17, 0x00, 0x26, 0x19, 0x06, 0x00, 0x35,
+    0x19, 0x19, 0x00, 0x26, 0x1A, 0x06, 0x00, 0x36, 0x1A, 0x09,
+    0x00, 0x26, 0x1A, 0x0D, 0x00, 0x2B, 0x1A, 0x00, 0x00, 0x39,
+    0x1A, 0x00, 0x00, 0x17, 0x1B, 0x1A, 0x00, 0x1A, 0x14, 0x23,
+    0x00, 0x2B, 0x1B, 0x00, 0x00, 0x43, 0x1C, 0x0E, 0x00, 0x2C,
+    0x1B, 0x16, 0x00, 0x2F, 0x1C, 0x0B, 0x00, 0x25, 0x1C, 0x00,
+    0x00, 0x22, 0x1D, 0x00, 0x00, 0x37, 0x1E, 0x1B, 0x00, 0x17,
+    0x1F, 0x1E, 0x00, 0x25, 0x20, 0x00, 0x00, 0x1F, 0x1E, 0x1F,
+    0x20, 0x1A, 0x1E, 0x04, 0x00, 0x2B, 0x16, 0x00, 0x00, 0x43,
+    0x20, 0x0F, 0x00, 0x24, 0x14, 0x00, 0x00, 0x40, 0x1E, 0x1F,
+    0x1C, 0x1A, 0x1E, 0xF0, 0xFF, 0x2D, 0x16, 0x1B, 0x1C, 0x43,
+    0x20, 0x10, 0x00, 0x06, 0x1C, 0x1C, 0x20, 0x2B, 0x16, 0x00,
+    0x00, 0x43, 0x20, 0x11, 0x00, 0x1A, 0x20, 0x05, 0x00, 0x2B,
+    0x16, 0x00, 0x00, 0x43, 0x21, 0x12, 0x00, 0x44, 0x22, 0x21,
+    0x18, 0x18, 0xFA, 0xFF, 0xFF, 0x2B, 0x16, 0x00, 0x00, 0x43,
+    0x20, 0x13, 0x00, 0x26, 0x22, 0x14, 0x00, 0x1F, 0x21, 0x20,
+    0x22, 0x1A, 0x21, 0xF0, 0xFF, 0x2C, 0x16, 0x13, 0x00, 0x2F,
+    0x20, 0x11, 0x00, 0x18, 0xED, 0xFF, 0xFF, 0x2B, 0x16, 0x00,
+    0x00, 0x43, 0x1C, 0x11, 0x00, 0x1A, 0x1C, 0x05, 0x00, 0x2B,
+    0x16, 0x00, 0x00, 0x43, 0x1D, 0x12, 0x00, 0x44, 0x1E, 0x1D,
+    0x18, 0x18, 0xFA, 0xFF, 0xFF, 0x2B, 0x16, 0x00, 0x00, 0x43,
+    0x1C, 0x13, 0x00, 0x26, 0x1E, 0x14, 0x00, 0x1F, 0x1D, 0x1C,
+    0x1E, 0x1A, 0x1D, 0x03, 0x00, 0x2C, 0x16, 0x13, 0x00, 0x2F,
+    0x1C, 0x11, 0x00, 0x26, 0x1C, 0x06, 0x00, 0x36, 0x1C, 0x19,
+    0x00, 0x03, 0x09, 0x00, 0x00, 0xCD, 0x00, 0xFE, 0x00, 0x00,
+    0x08, 0x01, 0x02, 0x12, 0x01, 0x01, 0xCE, 0x05, 0x65, 0x76,
+    0x61, 0x6C, 0x31, 0xDA, 0x24, 0xD0, 0x01, 0x61, 0xD8, 0x09,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x28,
+    0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2C, 0x03, 0x04, 0x00, 0x43,
+    0x04, 0x01, 0x00, 0x17, 0x03, 0x04, 0x00, 0x22, 0x06, 0x00,
+    0x00, 0x31, 0x05, 0x03, 0x06, 0x17, 0x06, 0x05, 0x00, 0x1A,
+    0x02, 0x07, 0x00, 0x27, 0x07, 0x00, 0x14, 0x1A, 0x07, 0x04,
+    0x00, 0x2C, 0x03, 0x06, 0x00, 0x27, 0x07, 0x00, 0x0D, 0x30,
+    0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xCD, 0x00, 0xD4, 0x00, 0x00, 0x0B, 0x00,
+    0x0B, 0x25, 0x02, 0xDA, 0x24, 0xDA, 0x80, 0xA6, 0xDA, 0x72,
+    0xD0, 0x08, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0xD0, 0x05, 0x73, 0x74, 0x61, 0x72, 0x74, 0xD0, 0x03, 0x65,
+    0x6E, 0x64, 0xD0, 0x05, 0x66, 0x69, 0x62, 0x65, 0x72, 0xDA,
+    0x81, 0x7C, 0xCE, 0x05, 0x20, 0x61, 0x74, 0x20, 0x28, 0xDA,
+    0x80, 0xD9, 0xDA, 0x80, 0xD4, 0xDA, 0x80, 0xD5, 0x27, 0x00,
+    0x00, 0x00, 0x27, 0x01, 0x01, 0x09, 0x27, 0x02, 0x01, 0x13,
+    0x2D, 0x00, 0x01, 0x02, 0x43, 0x01, 0x00, 0x00, 0x2B, 0x01,
+    0x00, 0x00, 0x43, 0x02, 0x01, 0x00, 0x26, 0x04, 0x02, 0x00,
+    0x1F, 0x03, 0x02, 0x04, 0x1A, 0x03, 0x02, 0x00, 0x30, 0x01,
+    0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x02,
+    0x26, 0x04, 0x03, 0x00, 0x33, 0x04, 0x01, 0x04, 0x26, 0x05,
+    0x04, 0x00, 0x33, 0x05, 0x01, 0x05, 0x26, 0x06, 0x05, 0x00,
+    0x33, 0x06, 0x01, 0x06, 0x26, 0x07, 0x06, 0x00, 0x33, 0x07,
+    0x01, 0x07, 0x25, 0x09, 0x00, 0x00, 0x3F, 0x08, 0x09, 0x04,
+    0x1A, 0x08, 0x08, 0x00, 0x26, 0x09, 0x07, 0x00, 0x2D, 0x07,
+    0x09, 0x04, 0x26, 0x09, 0x08, 0x00, 0x26, 0x0A, 0x09, 0x00,
+    0x2D, 0x09, 0x05, 0x0A, 0x43, 0x02, 0x0A, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x17, 0x02, 0x07, 0x00, 0x17, 0x08, 0x02, 0x00,
+    0x27, 0x02, 0x01, 0x13, 0x2D, 0x08, 0x06, 0x02, 0x27, 0x02,
+    0x01, 0x0F, 0x30, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0xCD,
+    0x00, 0x00, 0xB6, 0x86, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE7,
+    0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE7, 0x19, 0x14, 0x09, 0xBF,
+    0xF7, 0x09, 0xBF, 0xF4, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE5,
+    0x81, 0x5E, 0xBE, 0xCB, 0x04, 0x20, 0x0F, 0xBF, 0xF1, 0x0F,
+    0x10, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9,
+    0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37,
+    0xBF, 0xC9, 0x37, 0x2D, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF1,
+    0x5F, 0xBF, 0xC4, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25,
+    0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF,
+    0xB8, 0x5F, 0xBF, 0xA1, 0x5F, 0xBF, 0x88, 0x79, 0x10, 0x20,
+    0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xCD,
+    0x00, 0x00, 0xB6, 0x1F, 0x82, 0x43, 0xBD, 0xD6, 0x0E, 0x26,
+    0x81, 0x9F, 0xBE, 0x4E, 0x81, 0xBE, 0xBE, 0x42, 0x81, 0xBE,
+    0xBE, 0x42, 0x81, 0xBE, 0xBE, 0x35, 0x81, 0xCC, 0x0F, 0x0D,
+    0xBF, 0xF3, 0x0D, 0xBF, 0xEA, 0x17, 0x06, 0x26, 0xBF, 0xE5,
+    0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xF0, 0x0F, 0xBF, 0xF1, 0x0F,
+    0xBF, 0xF1, 0x0F, 0xBF, 0xE7, 0x1A, 0xBF, 0xDB, 0x26, 0xCD,
+    0x00, 0x00, 0xB1, 0x78, 0x89, 0x88, 0xB9, 0x34, 0x80, 0xAF,
+    0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51,
+    0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF,
+    0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51,
+    0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF,
+    0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51,
+    0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF,
+    0xBF, 0x51, 0x80, 0xAF, 0xBF, 0x51, 0x80, 0xAF, 0x04, 0x12,
+    0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF,
+    0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE,
+    0x12, 0x04, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9, 0x17, 0xBF,
+    0xE9, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9,
+    0x17, 0x04, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE, 0x22, 0xBF,
+    0xDE, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE,
+    0x22, 0x04, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF,
+    0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB,
+    0x25, 0x04, 0x21, 0xBF, 0xDF, 0x21, 0xBF, 0xDF, 0x21, 0xBF,
+    0xDF, 0x21, 0xBF, 0xDF, 0x21, 0xBF, 0xDF, 0x21, 0xBF, 0xDF,
+    0x21, 0x04, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF,
+    0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4,
+    0x1C, 0x1A, 0x0F, 0x22, 0x0B, 0xBF, 0xEE, 0x13, 0x20, 0x82,
+    0x43, 0xBD, 0xBD, 0x82, 0x43, 0x05, 0x11, 0xBF, 0xEF, 0x11,
+    0x04, 0x0E, 0xBF, 0xF2, 0x0E, 0x12, 0x0C, 0xBF, 0xF4, 0x0C,
+    0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0x04, 0x81, 0x98, 0xBE,
+    0x79, 0x11, 0xBF, 0xEF, 0x11, 0x06, 0x0D, 0xBF, 0xF3, 0x0D,
+    0x06, 0x0D, 0x06, 0x10, 0x0F, 0x0B, 0xBF, 0xEC, 0x15, 0x0C,
+    0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF2, 0x3D, 0xBF, 0xDA, 0x0D,
+    0xBF, 0xF3, 0x0D, 0x08, 0x10, 0x0E, 0x0D, 0xBF, 0xEC, 0x80,
+    0xD5, 0xBF, 0x52, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xD9, 0x28,
+    0x0F, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xE7, 0x3D, 0xBF, 0xED,
+    0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xE8, 0x19, 0xBF, 0xC4, 0x3D,
+    0x11, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xED, 0x1B, 0xBF, 0xE5,
+    0x1B, 0xBF, 0xDF, 0x43, 0xBF, 0xE8, 0x17, 0xBF, 0xE9, 0x17,
+    0xBF, 0xBE, 0x43, 0x2B, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xE7,
+    0x39, 0xBF, 0xED, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xE8, 0x19,
+    0xBF, 0xC8, 0x39, 0x0D, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xED,
+    0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xDF, 0x3F, 0xBF, 0xE8, 0x17,
+    0xBF, 0xE9, 0x17, 0x06, 0x11, 0xBF, 0xEF, 0x11, 0xB6, 0x80,
+    0x89, 0x88, 0xDA, 0x81, 0x56, 0xDA, 0x81, 0x5A, 0xDA, 0x81,
+    0x33, 0xD8, 0x06, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0xDA,
+    0x81, 0x3C, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x07, 0x01,
+    0x07, 0x0F, 0xCE, 0x05, 0x73, 0x6C, 0x75, 0x72, 0x70, 0xDA,
+    0x24, 0xD0, 0x01, 0x72, 0xDA, 0x81, 0x55, 0xCE, 0x14, 0x63,
+    0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6F,
+    0x70, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xDA,
+    0x80, 0xD5, 0xD0, 0x03, 0x61, 0x6C, 0x6C, 0xDA, 0x81, 0x68,
+    0xDA, 0x81, 0x56, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x00, 0x02,
+    0x00, 0x43, 0x03, 0x01, 0x00, 0x1A, 0x03, 0x02, 0x00, 0x18,
+    0x05, 0x00, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2C, 0x04, 0x00,
+    0x00, 0x43, 0x04, 0x03, 0x00, 0x01, 0x04, 0x00, 0x00, 0x26,
+    0x04, 0x04, 0x00, 0x2C, 0x03, 0x04, 0x00, 0x43, 0x05, 0x05,
+    0x00, 0x2B, 0x03, 0x00, 0x00, 0x43, 0x06, 0x06, 0x00, 0x03,
+    0x05, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x8C, 0xAD, 0x12, 0xBF,
+    0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x05, 0x36, 0xBF, 0xCA, 0x36,
+    0xBF, 0xDB, 0x23, 0xBF, 0xDD, 0x23, 0xBF, 0xDD, 0x23, 0xBF,
+    0xD6, 0x2B, 0x13, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11,
+    0x05, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0x18, 0x80, 0xF4, 0xD7,
+    0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01, 0x03, 0x06, 0xCE,
+    0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67,
+    0x65, 0xDA, 0x24, 0xDA, 0x00, 0xD8, 0x0A, 0x65, 0x6E, 0x76,
+    0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0xD8, 0x09, 0x75,
+    0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x26, 0x02,
+    0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x43, 0x02, 0x01, 0x00,
+    0x2C, 0x00, 0x02, 0x00, 0x26, 0x03, 0x02, 0x00, 0x30, 0x03,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0xC0, 0x10, 0x10, 0xBF, 0xF0,
+    0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xDF, 0x22, 0xBF, 0xDE, 0x22,
+    0xBF, 0xDE, 0x22, 0x28, 0x02, 0x00, 0x00, 0x2E, 0x01, 0x00,
+    0x00, 0x43, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x33,
+    0x04, 0x03, 0x05, 0x17, 0x05, 0x04, 0x00, 0x26, 0x06, 0x02,
+    0x00, 0x33, 0x04, 0x06, 0x00, 0x17, 0x06, 0x04, 0x00, 0x1A,
+    0x06, 0x02, 0x00, 0x03, 0x06, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x43, 0x04, 0x03, 0x00, 0x35, 0x07, 0x04, 0x00, 0x17,
+    0x08, 0x07, 0x00, 0x35, 0x07, 0x04, 0x01, 0x17, 0x09, 0x07,
+    0x00, 0x1A, 0x08, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x01,
+    0x09, 0x00, 0x00, 0x26, 0x0A, 0x04, 0x00, 0x1F, 0x07, 0x09,
+    0x0A, 0x1A, 0x07, 0x20, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x43,
+    0x0A, 0x05, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x43, 0x0A, 0x06,
+    0x00, 0x17, 0x0C, 0x0A, 0x00, 0x26, 0x0A, 0x07, 0x00, 0x23,
+    0x0D, 0x00, 0x00, 0x34, 0x0A, 0x08, 0x0D, 0x2A, 0x0A, 0x00,
+    0x00, 0x17, 0x0D, 0x0A, 0x00, 0x2A, 0x0A, 0x01, 0x00, 0x26,
+    0x0E, 0x08, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2D, 0x0E, 0x0C,
+    0x0F, 0x26, 0x0E, 0x0A, 0x00, 0x2D, 0x0A, 0x0E, 0x0D, 0x26,
+    0x0E, 0x04, 0x00, 0x2C, 0x0E, 0x08, 0x00, 0x3B, 0x0A, 0x00,
+    0x00, 0x2B, 0x0A, 0x00, 0x00, 0x43, 0x0E, 0x0B, 0x00, 0x2B,
+    0x0B, 0x00, 0x00, 0x43, 0x0A, 0x0C, 0x00, 0x26, 0x0A, 0x07,
+    0x00, 0x22, 0x0E, 0x00, 0x00, 0x34, 0x0A, 0x08, 0x0E, 0x22,
+    0x0A, 0x00, 0x00, 0x2C, 0x0C, 0x0A, 0x00, 0x43, 0x0A, 0x0D,
+    0x00, 0x17, 0x04, 0x0A, 0x00, 0x18, 0x15, 0x00, 0x00, 0x26,
+    0x0D, 0x0E, 0x00, 0x1F, 0x0C, 0x09, 0x0D, 0x1A, 0x0C, 0x06,
+    0x00, 0x43, 0x0D, 0x06, 0x00, 0x2C, 0x08, 0x0D, 0x00, 0x43,
+    0x0E, 0x0F, 0x00, 0x17, 0x0A, 0x0E, 0x00, 0x18, 0x0C, 0x00,
+    0x00, 0x26, 0x0F, 0x10, 0x00, 0x1F, 0x0E, 0x09, 0x0F, 0x1A,
+    0x0E, 0x07, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x43, 0x0F, 0x11,
+    0x00, 0x2B, 0x0F, 0x00, 0x00, 0x43, 0x10, 0x12, 0x00, 0x17,
+    0x0D, 0x10, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x0D, 0x00,
+    0x00, 0x17, 0x0A, 0x0D, 0x00, 0x17, 0x04, 0x0A, 0x00, 0x17,
+    0x07, 0x04, 0x00, 0x26, 0x04, 0x02, 0x00, 0x34, 0x04, 0x08,
+    0x07, 0x26, 0x04, 0x02, 0x00, 0x34, 0x04, 0x00, 0x07, 0x03,
+    0x07, 0x00, 0x00, 0xCD, 0x00, 0xDC, 0x00, 0x00, 0x05, 0x02,
+    0x01, 0x05, 0x01, 0xCE, 0x06, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+    0x73, 0xDA, 0x24, 0xDA, 0x81, 0x68, 0x27, 0x03, 0x00, 0x0B,
+    0x25, 0x04, 0x00, 0x08, 0x2D, 0x03, 0x04, 0x00, 0x26, 0x03,
+    0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00,
+    0x00, 0xCC, 0xF1, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15,
+    0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xCD, 0x00, 0xD4, 0x00,
+    0x00, 0x05, 0x02, 0x04, 0x13, 0x01, 0xDA, 0x24, 0xD8, 0x0C,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0xD0, 0x04, 0x64, 0x65, 0x61, 0x64, 0xDA, 0x81,
+    0x6A, 0xD8, 0x07, 0x6F, 0x73, 0x2F, 0x65, 0x78, 0x69, 0x74,
+    0x2B, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x19, 0x03, 0x03, 0x00,
+    0x23, 0x03, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x03,
+    0x00, 0x00, 0x1A, 0x03, 0x0A, 0x00, 0x2C, 0x00, 0x01, 0x00,
+    0x43, 0x02, 0x02, 0x00, 0x27, 0x02, 0x00, 0x05, 0x1A, 0x02,
+    0x05, 0x00, 0x25, 0x02, 0x01, 0x00, 0x2B, 0x02, 0x00, 0x00,
+    0x26, 0x02, 0x03, 0x00, 0x30, 0x02, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00,
+    0x00, 0xCD, 0xD2, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xEB, 0x1C,
+    0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF,
+    0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xDE, 0x80, 0xB7, 0xBF,
+    0x9C, 0x15, 0xBF, 0xEB, 0x15, 0x31, 0x1D, 0xBF, 0xE3, 0x1D,
+    0xBF, 0xF5, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF,
+    0xF6, 0x0A, 0xBF, 0xE4, 0x1D, 0xBF, 0x4A, 0x80, 0xB7, 0xCD,
+    0x00, 0x00, 0xCA, 0x38, 0x85, 0xAE, 0xBB, 0x55, 0x0C, 0xBF,
+    0xF4, 0x0C, 0xBF, 0xD9, 0x28, 0xBF, 0xD8, 0x28, 0xBF, 0xD8,
+    0x28, 0x13, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xDB, 0x84, 0x99,
+    0xBB, 0x67, 0x84, 0x99, 0xBB, 0x67, 0x84, 0x99, 0xBB, 0xC0,
+    0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xD6, 0x2B, 0xBF, 0xD5, 0x2B,
+    0xBF, 0xD5, 0x2B, 0xBF, 0xD5, 0x2B, 0x08, 0x21, 0xBF, 0xDF,
+    0x21, 0xBF, 0xF0, 0x0F, 0x12, 0x83, 0x9F, 0xBC, 0x61, 0x83,
+    0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBC, 0xC5, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xE6, 0x1B, 0x20, 0x09, 0xBF, 0xEB, 0x16, 0x14,
+    0x21, 0xBF, 0xDF, 0x21, 0xBF, 0xDF, 0x21, 0x14, 0x2B, 0xBF,
+    0xD5, 0x2B, 0x80, 0x88, 0x80, 0xEF, 0xBE, 0x9D, 0x81, 0x96,
+    0xBE, 0x6A, 0x81, 0x96, 0xBE, 0x6A, 0x81, 0x96, 0xBE, 0x6A,
+    0x81, 0x96, 0xBE, 0x6A, 0x81, 0x96, 0xBE, 0x6A, 0x81, 0x96,
+    0xBE, 0x6A, 0x81, 0x96, 0xBE, 0x6A, 0x81, 0x96, 0xBE, 0x6A,
+    0x81, 0x96, 0xBE, 0x6A, 0x81, 0x96, 0x14, 0x0D, 0xBF, 0xF3,
+    0x0D, 0x14, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0x14,
+    0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBC, 0xBD, 0x83,
+    0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBC,
+    0x61, 0x83, 0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBF, 0xC8, 0x09,
+    0xBF, 0xE6, 0x1B, 0xBF, 0xE5, 0x1B, 0xBC, 0x8F, 0x83, 0x9F,
+    0xBC, 0x61, 0x83, 0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBC, 0x61,
+    0x83, 0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBF, 0xEF, 0x0F, 0xBF,
+    0xF1, 0x0F, 0xBF, 0xE5, 0x1C, 0xBF, 0xE4, 0x1C, 0xBC, 0x62,
+    0x83, 0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBC, 0x61, 0x83, 0x9F,
+    0xBC, 0x61, 0x83, 0x9F, 0xBC, 0x61, 0x83, 0x9F, 0xBC, 0x58,
+    0x83, 0xA9, 0x08, 0x1E, 0xBF, 0xE2, 0x1E, 0x08, 0x1A, 0xBF,
+    0xE6, 0x1A, 0xBB, 0xA9, 0x84, 0x62, 0xDA, 0x81, 0x22, 0xDA,
+    0x80, 0xD5, 0xDA, 0x2E, 0xD0, 0x07, 0x70, 0x72, 0x69, 0x76,
+    0x61, 0x74, 0x65, 0xDA, 0x80, 0xC3, 0xDA, 0x81, 0x5A, 0xD8,
+    0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x02, 0x00,
+    0x00, 0x43, 0x04, 0x00, 0x00, 0x26, 0x06, 0x01, 0x00, 0x33,
+    0x06, 0x04, 0x06, 0x26, 0x07, 0x02, 0x00, 0x33, 0x07, 0x04,
+    0x07, 0x2B, 0x01, 0x00, 0x00, 0x2E, 0x02, 0x00, 0x00, 0x43,
+    0x08, 0x03, 0x00, 0x1A, 0x06, 0x05, 0x00, 0x26, 0x0A, 0x04,
+    0x00, 0x2C, 0x06, 0x0A, 0x00, 0x43, 0x09, 0x05, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x22, 0x09, 0x00, 0x00, 0x17, 0x0A, 0x09,
+    0x00, 0x1A, 0x0A, 0x03, 0x00, 0x17, 0x09, 0x0A, 0x00, 0x18,
+    0x0D, 0x00, 0x00, 0x1A, 0x07, 0x03, 0x00, 0x17, 0x0B, 0x07,
+    0x00, 0x18, 0x09, 0x00, 0x00, 0x26, 0x0C, 0x04, 0x00, 0x2C,
+    0x01, 0x0C, 0x00, 0x43, 0x0D, 0x05, 0x00, 0x1A, 0x0D, 0x03,
+    0x00, 0x17, 0x0C, 0x0D, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+    0x0C, 0x00, 0x00, 0x17, 0x0B, 0x0C, 0x00, 0x17, 0x09, 0x0B,
+    0x00, 0x17, 0x0A, 0x09, 0x00, 0x17, 0x0B, 0x08, 0x00, 0x22,
+    0x0C, 0x00, 0x00, 0x2C, 0x0B, 0x0C, 0x00, 0x43, 0x0D, 0x06,
+    0x00, 0x22, 0x0E, 0x00, 0x00, 0x1F, 0x0C, 0x0E, 0x0D, 0x19,
+    0x0C, 0x03, 0x00, 0x23, 0x0C, 0x00, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x24, 0x0C, 0x00, 0x00, 0x1A, 0x0C, 0x14, 0x00, 0x17,
+    0x0E, 0x0D, 0x00, 0x33, 0x10, 0x0B, 0x0D, 0x26, 0x11, 0x07,
+    0x00, 0x44, 0x0F, 0x11, 0x10, 0x2B, 0x0F, 0x00, 0x00, 0x43,
+    0x11, 0x08, 0x00, 0x1A, 0x11, 0x0A, 0x00, 0x26, 0x0F, 0x07,
+    0x00, 0x23, 0x12, 0x00, 0x00, 0x2C, 0x0F, 0x12, 0x00, 0x3C,
+    0x0F, 0x00, 0x00, 0x2C, 0x0F, 0x10, 0x00, 0x43, 0x0F, 0x09,
+    0x00, 0x2C, 0x0A, 0x0E, 0x00, 0x43, 0x12, 0x0A, 0x00, 0x34,
+    0x00, 0x12, 0x0F, 0x2C, 0x0B, 0x0D, 0x00, 0x43, 0x0D, 0x06,
+    0x00, 0x18, 0xE7, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xCD,
+    0x00, 0x00, 0xD0, 0xC3, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xCF,
+    0x32, 0xBF, 0xCE, 0x32, 0xBF, 0xCE, 0x32, 0xBF, 0xCE, 0x32,
+    0x10, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0x15, 0x17,
+    0xBF, 0xF1, 0x0E, 0xBF, 0xF2, 0x0E, 0xBF, 0xF2, 0x0E, 0xBF,
+    0xEA, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE5, 0x35, 0xBF, 0xCB,
+    0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35,
+    0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xEF, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xCC, 0x35, 0xBF, 0xCB,
+    0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35,
+    0xBF, 0xCB, 0x35, 0xBF, 0xBF, 0x42, 0x04, 0x80, 0x8C, 0xBF,
+    0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80,
+    0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF,
+    0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80,
+    0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF,
+    0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF, 0x9A, 0x0B,
+    0xBF, 0xF5, 0x0B, 0xBF, 0xF0, 0x11, 0xBF, 0xEF, 0x11, 0xBF,
+    0xCE, 0x80, 0x8C, 0xBF, 0xB7, 0x22, 0xBF, 0xDE, 0x22, 0xBF,
+    0xDE, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE,
+    0x22, 0x10, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xE7, 0x1F, 0xBF,
+    0x75, 0x80, 0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xBF, 0x74, 0x80,
+    0x8C, 0xBF, 0x74, 0x80, 0x8C, 0xCF, 0x06, 0x6E, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x86,
+    0xDA, 0x06, 0xCE, 0x81, 0x26, 0x28, 0x6E, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x5B, 0x2C,
+    0x65, 0x6E, 0x76, 0x5D, 0x29, 0x0A, 0x0A, 0x4C, 0x6F, 0x61,
+    0x64, 0x20, 0x61, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76,
+    0x65, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6D, 0x75,
+    0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61,
+    0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x79, 0x73,
+    0x74, 0x65, 0x6D, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69,
+    0x73, 0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x61, 0x20, 0x2E, 0x73, 0x6F, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x20, 0x6F, 0x6E, 0x20, 0x55, 0x6E, 0x69, 0x78, 0x20, 0x73,
+    0x79, 0x73, 0x74, 0x65, 0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x20, 0x2E, 0x64, 0x6C, 0x6C, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x57, 0x69, 0x6E,
+    0x64, 0x6F, 0x77, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76,
+    0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0xCF,
+    0x06, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0xD3, 0x02, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x0C, 0x00, 0x08, 0x01, 0x01, 0x00,
+    0x02, 0xCE, 0x06, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x37,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x06, 0xCE,
+    0x80, 0xB1, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20,
+    0x64, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x6E,
+    0x67, 0x74, 0x68, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x75,
+    0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+    0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20,
+    0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x2E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x6B, 0x65, 0x79, 0x2D, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xCF,
+    0x01, 0x2B, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09,
+    0x00, 0x09, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x01, 0x2B, 0x37,
+    0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03,
+    0x00, 0x25, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20,
+    0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x00,
+    0x00, 0x35, 0x04, 0x00, 0x00, 0x06, 0x03, 0x03, 0x04, 0x03,
+    0x03, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01,
+    0x00, 0x33, 0x04, 0x00, 0x05, 0x06, 0x03, 0x03, 0x04, 0x05,
+    0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC,
+    0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE, 0x68, 0x28,
+    0x2B, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x78, 0x73, 0x20, 0x6D,
+    0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x72,
+    0x65, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x2E, 0x20, 0x49, 0x66,
+    0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70,
+    0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x30, 0x2E, 0xCF, 0x0D, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0x2F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0xD3, 0x02,
+    0xDA, 0x03, 0xCE, 0x05, 0x30, 0x2E, 0x34, 0x2E, 0x30, 0xDA,
+    0x06, 0xCE, 0x30, 0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72,
+    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D,
+    0x2E, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x62,
+    0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x61, 0x62, 0x73, 0xDA, 0x06, 0xCE, 0x2D, 0x28,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x62, 0x73, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75,
+    0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x78, 0x2E, 0xCF, 0x0A, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x2F, 0xDA, 0x06, 0xCE, 0x66, 0x28, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20, 0x61, 0x72,
+    0x72, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x4D, 0x6F,
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x2E, 0xCF, 0x0F,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x74, 0x6F, 0x2D, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x77, 0xDA, 0x06, 0xCE, 0x80, 0x84, 0x28, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x20, 0x74, 0x61, 0x62, 0x29, 0x0A, 0x0A, 0x43,
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x61, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x20,
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x75, 0x6E, 0x74,
+    0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2E, 0xCF, 0x03,
+    0x69, 0x6E, 0x63, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x17, 0x28, 0x69, 0x6E, 0x63, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x78, 0x20,
+    0x2B, 0x20, 0x31, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x92, 0x47, 0x92, 0x6D, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x9C, 0x00, 0x00, 0x03, 0x01, 0x00, 0x02, 0xCE, 0x03, 0x69,
+    0x6E, 0x63, 0xDA, 0x24, 0x05, 0x02, 0x00, 0x01, 0x03, 0x02,
+    0x00, 0x00, 0x92, 0x66, 0x06, 0xBF, 0xFA, 0x06, 0xCF, 0x07,
+    0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x43, 0x28, 0x70, 0x72, 0x6F, 0x64,
+    0x75, 0x63, 0x74, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78,
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79,
+    0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x31, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x47, 0xD9, 0xCD, 0x00, 0x00, 0x48, 0x60, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x09, 0x01, 0x00,
+    0x0B, 0xCE, 0x07, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74,
+    0xDA, 0x24, 0x25, 0x02, 0x01, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x37, 0x05, 0x03, 0x00, 0x25, 0x04, 0x00, 0x00, 0x3E, 0x06,
+    0x04, 0x05, 0x1A, 0x06, 0x05, 0x00, 0x33, 0x08, 0x03, 0x04,
+    0x09, 0x02, 0x02, 0x08, 0x05, 0x04, 0x04, 0x01, 0x18, 0xFB,
+    0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x48,
+    0x2A, 0x0C, 0x04, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D,
+    0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF,
+    0xF4, 0x0B, 0xBF, 0xE4, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0x82,
+    0x80, 0x87, 0xCF, 0x05, 0x6D, 0x65, 0x72, 0x67, 0x65, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0xA9, 0x28, 0x6D,
+    0x65, 0x72, 0x67, 0x65, 0x20, 0x26, 0x20, 0x63, 0x6F, 0x6C,
+    0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x4D, 0x65, 0x72, 0x67, 0x65,
+    0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2F, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6F,
+    0x6E, 0x65, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x20, 0x63,
+    0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65,
+    0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72,
+    0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x79,
+    0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20,
+    0x6F, 0x6E, 0x65, 0x73, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x7F, 0xBA, 0xCD,
+    0x00, 0x00, 0x80, 0xE4, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99,
+    0x00, 0x00, 0x0E, 0x00, 0x01, 0x1B, 0xCE, 0x05, 0x6D, 0x65,
+    0x72, 0x67, 0x65, 0xDA, 0x24, 0xDA, 0x2E, 0x3C, 0x03, 0x00,
+    0x00, 0x17, 0x04, 0x00, 0x00, 0x37, 0x06, 0x04, 0x00, 0x25,
+    0x05, 0x00, 0x00, 0x3E, 0x07, 0x05, 0x06, 0x1A, 0x07, 0x15,
+    0x00, 0x33, 0x09, 0x04, 0x05, 0x17, 0x08, 0x09, 0x00, 0x22,
+    0x0A, 0x00, 0x00, 0x2C, 0x08, 0x0A, 0x00, 0x43, 0x0B, 0x00,
+    0x00, 0x22, 0x0C, 0x00, 0x00, 0x1F, 0x0A, 0x0C, 0x0B, 0x19,
+    0x0A, 0x03, 0x00, 0x23, 0x0A, 0x00, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x24, 0x0A, 0x00, 0x00, 0x1A, 0x0A, 0x07, 0x00, 0x17,
+    0x0C, 0x0B, 0x00, 0x33, 0x0D, 0x09, 0x0C, 0x34, 0x03, 0x0C,
+    0x0D, 0x2C, 0x08, 0x0B, 0x00, 0x43, 0x0B, 0x00, 0x00, 0x18,
+    0xF4, 0xFF, 0xFF, 0x05, 0x05, 0x05, 0x01, 0x18, 0xEB, 0xFF,
+    0xFF, 0x03, 0x03, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x80, 0x73,
+    0x12, 0x04, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF,
+    0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2,
+    0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E,
+    0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF,
+    0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2,
+    0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xF4, 0x0A, 0xBF, 0xE1, 0x20,
+    0xBF, 0xB3, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF,
+    0xB2, 0x4E, 0xBF, 0xB2, 0x4E, 0xBE, 0xE3, 0x81, 0x2A, 0xCF,
+    0x10, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x73,
+    0x79, 0x73, 0x70, 0x61, 0x74, 0x68, 0x2A, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x80, 0xAB, 0x54, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20,
+    0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65,
+    0x64, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73,
+    0x65, 0x74, 0x20, 0x61, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6C,
+    0x64, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x69, 0x73, 0x20, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C,
+    0x6F, 0x63, 0x61, 0x6C, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x6C, 0x69,
+    0x6E, 0x75, 0x78, 0x2F, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x20, 0x6F, 0x6E, 0x20, 0x57,
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x20, 0x69, 0x73, 0x20,
+    0x43, 0x3A, 0x2F, 0x4A, 0x61, 0x6E, 0x65, 0x74, 0x2F, 0x4C,
+    0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2E, 0xDA, 0x80, 0xD1,
+    0xDA, 0x81, 0x50, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0xCD, 0x00, 0x00, 0xC3, 0xF0, 0xCD, 0x00, 0x00, 0xC4, 0xDA,
+    0xCF, 0x06, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x81, 0x16,
+    0x28, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x70, 0x61,
+    0x74, 0x68, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29,
+    0x0A, 0x0A, 0x49, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x61,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0x20, 0x46,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x75, 0x6C, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x74, 0x68, 0x65, 0x6E, 0x20, 0x6D, 0x65, 0x72, 0x67, 0x65,
+    0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x20, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+    0x65, 0x6E, 0x74, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x70, 0x65,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x67, 0x69,
+    0x76, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+    0x20, 0x61, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64,
+    0x2E, 0x20, 0x20, 0x28, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x3A, 0x61, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x3A,
+    0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6F, 0x70, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x74,
+    0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x29,
+    0x2E, 0x20, 0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x70, 0x72,
+    0x65, 0x66, 0x69, 0x78, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x20, 0x75,
+    0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x6D,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61,
+    0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xD1, 0xCE,
+    0xCD, 0x00, 0x00, 0xD3, 0xB1, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0xB9, 0x00, 0x00, 0x08, 0x01, 0x05, 0x0B, 0x01, 0xCE, 0x06,
+    0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0xDA, 0x24, 0xDA, 0x80,
+    0xFC, 0xDA, 0x80, 0xD5, 0xDA, 0x81, 0x97, 0xDA, 0x80, 0xE8,
+    0xDA, 0x80, 0x88, 0x2A, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x01,
+    0x00, 0x43, 0x03, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x05, 0x01, 0x00, 0x26, 0x06, 0x02, 0x00, 0x26, 0x07, 0x03,
+    0x00, 0x2D, 0x06, 0x07, 0x05, 0x2E, 0x03, 0x00, 0x00, 0x26,
+    0x06, 0x04, 0x00, 0x30, 0x06, 0x00, 0x00, 0xCD, 0x00, 0x94,
+    0x00, 0x00, 0x03, 0x01, 0x02, 0x07, 0xDA, 0x24, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x05, 0x01, 0x02, 0x05, 0xCE, 0x08,
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x3F, 0xDA, 0x24,
+    0xDA, 0x72, 0xD0, 0x07, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72,
+    0x64, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00,
+    0x00, 0x89, 0xD5, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xDA, 0x80, 0xD5, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x1A, 0x01, 0x02,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26,
+    0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0xD3, 0x27, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF1, 0x47, 0xBF,
+    0xB9, 0x47, 0xBF, 0xF6, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF7,
+    0x09, 0xCD, 0x00, 0x00, 0xD3, 0x08, 0x63, 0xBF, 0x98, 0x7F,
+    0xBF, 0x81, 0x7F, 0x1B, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xDE,
+    0x29, 0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29,
+    0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29, 0xCF, 0x09, 0x70, 0x72,
+    0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x0C, 0x00, 0x20, 0x02, 0x02, 0x00,
+    0x02, 0xCE, 0x09, 0x70, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61,
+    0x74, 0x65, 0x4E, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00,
+    0xDA, 0x06, 0xCE, 0x81, 0x17, 0x28, 0x70, 0x72, 0x6F, 0x70,
+    0x61, 0x67, 0x61, 0x74, 0x65, 0x20, 0x78, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x61, 0x69, 0x73,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+    0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20, 0x6F, 0x66,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2C, 0x20, 0x73, 0x75,
+    0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x20,
+    0x79, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x2E, 0x20, 0x53, 0x74,
+    0x61, 0x63, 0x6B, 0x20, 0x74, 0x72, 0x61, 0x63, 0x65, 0x73,
+    0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65,
+    0x64, 0x2C, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x70, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x65,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x77,
+    0x68, 0x61, 0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6F, 0x72,
+    0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x6E,
+    0x65, 0x78, 0x74, 0x2E, 0xCF, 0x06, 0x69, 0x66, 0x2D, 0x6E,
+    0x6F, 0x74, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA,
+    0x06, 0xCE, 0x3D, 0x28, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74,
+    0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x65, 0x78, 0x70, 0x2D, 0x31, 0x20, 0x65, 0x78, 0x70,
+    0x2D, 0x32, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F,
+    0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20,
+    0x2E, 0x2E, 0x2E, 0x20, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x95, 0x77, 0x95, 0xE4, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x98, 0x00, 0x00, 0x06, 0x03, 0x01, 0x05, 0xCE, 0x06, 0x69,
+    0x66, 0x2D, 0x6E, 0x6F, 0x74, 0xDA, 0x24, 0xDA, 0x64, 0x26,
+    0x05, 0x00, 0x00, 0x2D, 0x05, 0x00, 0x02, 0x2B, 0x01, 0x00,
+    0x00, 0x3D, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x95,
+    0xC6, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3,
+    0x1D, 0xBF, 0xE3, 0x1D, 0xCF, 0x03, 0x74, 0x72, 0x79, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x81,
+    0x3C, 0x28, 0x74, 0x72, 0x79, 0x20, 0x62, 0x6F, 0x64, 0x79,
+    0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x29, 0x0A, 0x0A, 0x54,
+    0x72, 0x79, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x74,
+    0x63, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E,
+    0x20, 0x42, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x73, 0x68, 0x6F, 0x75,
+    0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x20, 0x73, 0x68, 0x6F,
+    0x75, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
+    0x6E, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6E, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x20, 0x77, 0x72, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x66,
+    0x20, 0x6E, 0x6F, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2C,
+    0x20, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x63,
+    0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0x9D, 0x39, 0x9F, 0x95, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0E, 0x02, 0x0D, 0x32,
+    0xCE, 0x03, 0x74, 0x72, 0x79, 0xDA, 0x24, 0xDA, 0x60, 0xDA,
+    0x80, 0xF3, 0xDA, 0x81, 0x7F, 0xD0, 0x01, 0x65, 0xCF, 0x06,
+    0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0xDA, 0x81, 0x91, 0xDA,
+    0x66, 0xDA, 0x81, 0x7C, 0xDA, 0x61, 0xDA, 0x7C, 0xDA, 0x65,
+    0xDA, 0x64, 0xCF, 0x03, 0x6C, 0x65, 0x74, 0x35, 0x03, 0x01,
+    0x00, 0x35, 0x05, 0x03, 0x00, 0x35, 0x06, 0x03, 0x01, 0x43,
+    0x04, 0x00, 0x00, 0x43, 0x07, 0x00, 0x00, 0x3D, 0x03, 0x00,
+    0x00, 0x26, 0x09, 0x01, 0x00, 0x2D, 0x09, 0x03, 0x00, 0x3D,
+    0x08, 0x00, 0x00, 0x26, 0x09, 0x02, 0x00, 0x26, 0x0A, 0x03,
+    0x00, 0x2D, 0x09, 0x08, 0x0A, 0x3D, 0x03, 0x00, 0x00, 0x26,
+    0x09, 0x04, 0x00, 0x2C, 0x09, 0x04, 0x00, 0x3D, 0x08, 0x00,
+    0x00, 0x2D, 0x04, 0x03, 0x07, 0x2B, 0x08, 0x00, 0x00, 0x3D,
+    0x09, 0x00, 0x00, 0x26, 0x08, 0x05, 0x00, 0x2C, 0x08, 0x04,
+    0x00, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x0A, 0x06, 0x00, 0x26,
+    0x0B, 0x07, 0x00, 0x2D, 0x0A, 0x03, 0x0B, 0x3D, 0x08, 0x00,
+    0x00, 0x26, 0x0A, 0x08, 0x00, 0x2D, 0x0A, 0x05, 0x07, 0x3D,
+    0x03, 0x00, 0x00, 0x1A, 0x06, 0x05, 0x00, 0x26, 0x0C, 0x08,
+    0x00, 0x2D, 0x0C, 0x06, 0x04, 0x3D, 0x0A, 0x00, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x22, 0x0A, 0x00, 0x00, 0x25, 0x0B, 0x01,
+    0x00, 0x2C, 0x01, 0x0B, 0x00, 0x43, 0x0B, 0x09, 0x00, 0x26,
+    0x0D, 0x0A, 0x00, 0x2D, 0x0D, 0x03, 0x0A, 0x2E, 0x0B, 0x00,
+    0x00, 0x3D, 0x0C, 0x00, 0x00, 0x26, 0x0A, 0x0B, 0x00, 0x2D,
+    0x0A, 0x08, 0x0C, 0x2B, 0x07, 0x00, 0x00, 0x3D, 0x03, 0x00,
+    0x00, 0x26, 0x0A, 0x0C, 0x00, 0x2D, 0x0A, 0x09, 0x03, 0x3D,
+    0x08, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x9E, 0x8B, 0x81,
+    0x09, 0xBE, 0xF7, 0x81, 0x09, 0xBE, 0xF7, 0x81, 0x09, 0xBF,
+    0x19, 0x07, 0x0C, 0x07, 0x07, 0x80, 0xC5, 0xBF, 0x3B, 0x80,
+    0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF,
+    0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80,
+    0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF,
+    0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80,
+    0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF,
+    0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80,
+    0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF,
+    0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80,
+    0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF,
+    0x3B, 0x80, 0xC5, 0xBF, 0xCB, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF,
+    0xF3, 0x0D, 0xBF, 0x63, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5,
+    0xBF, 0xDC, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xBF,
+    0x4A, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80,
+    0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF,
+    0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80,
+    0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xBF,
+    0x3B, 0x80, 0xC5, 0xBF, 0x3B, 0x80, 0xC5, 0xCF, 0x0A, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x6C, 0x65, 0x61, 0x76, 0x65, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x5F, 0x28, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20, 0x26,
+    0x20, 0x63, 0x6F, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6F, 0x6C, 0x2C, 0x20,
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x2C, 0x20, 0x65, 0x74,
+    0x63, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x84, 0x3F, 0xCD, 0x00, 0x00, 0x85, 0x81, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x12, 0x00, 0x04,
+    0x1D, 0xCE, 0x0A, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6C, 0x65,
+    0x61, 0x76, 0x65, 0xDA, 0x24, 0xDA, 0x81, 0x9E, 0xDA, 0x80,
+    0xFC, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x03, 0x00, 0x02,
+    0x04, 0xCE, 0x03, 0x6D, 0x69, 0x6E, 0xDA, 0x24, 0xD7, 0xCD,
+    0x00, 0x09, 0x00, 0x1B, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x01,
+    0x3C, 0x37, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19,
+    0x02, 0x0A, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01,
+    0x00, 0x33, 0x04, 0x00, 0x05, 0x3E, 0x02, 0x03, 0x04, 0x1A,
+    0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04,
+    0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0xD7, 0xCD, 0x00, 0x9C, 0x00,
+    0x00, 0x0D, 0x02, 0x00, 0x13, 0xCE, 0x07, 0x65, 0x78, 0x74,
+    0x72, 0x65, 0x6D, 0x65, 0xDA, 0x24, 0x37, 0x04, 0x01, 0x00,
+    0x25, 0x06, 0x00, 0x00, 0x40, 0x05, 0x04, 0x06, 0x1A, 0x05,
+    0x0F, 0x00, 0x35, 0x07, 0x01, 0x00, 0x25, 0x06, 0x00, 0x00,
+    0x17, 0x08, 0x04, 0x00, 0x3E, 0x09, 0x06, 0x08, 0x1A, 0x09,
+    0x09, 0x00, 0x17, 0x0A, 0x06, 0x00, 0x33, 0x0C, 0x01, 0x0A,
+    0x2C, 0x0C, 0x07, 0x00, 0x2F, 0x0B, 0x00, 0x00, 0x1A, 0x0B,
+    0x02, 0x00, 0x17, 0x07, 0x0C, 0x00, 0x05, 0x06, 0x06, 0x01,
+    0x18, 0xF7, 0xFF, 0xFF, 0x03, 0x07, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x50, 0x47, 0x0C, 0x0B, 0x09,
+    0xBF, 0xF7, 0x09, 0xBF, 0xF1, 0x80, 0x8B, 0xBF, 0x8A, 0x0F,
+    0x06, 0x58, 0xBF, 0xA8, 0x58, 0xBF, 0xA8, 0x58, 0xBF, 0xA8,
+    0x58, 0xBF, 0xA8, 0x58, 0xBF, 0xCE, 0x0B, 0x0D, 0x0C, 0xBF,
+    0xF4, 0x0C, 0xBF, 0xF0, 0x1D, 0xBF, 0xF5, 0x0A, 0xBF, 0xAA,
+    0x58, 0xBF, 0xA8, 0x58, 0xBF, 0x7E, 0x80, 0x8B, 0xBF, 0x75,
+    0x80, 0x8B, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00,
+    0x26, 0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x51, 0x88, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F,
+    0xBF, 0xF1, 0x0F, 0xDA, 0x2F, 0x38, 0x03, 0x00, 0x00, 0x37,
+    0x05, 0x00, 0x00, 0x25, 0x07, 0x00, 0x00, 0x40, 0x06, 0x05,
+    0x07, 0x1A, 0x06, 0x18, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2C,
+    0x07, 0x00, 0x00, 0x43, 0x07, 0x01, 0x00, 0x2E, 0x07, 0x00,
+    0x00, 0x43, 0x07, 0x02, 0x00, 0x25, 0x08, 0x00, 0x00, 0x17,
+    0x09, 0x07, 0x00, 0x3E, 0x0A, 0x08, 0x09, 0x1A, 0x0A, 0x0F,
+    0x00, 0x17, 0x0B, 0x08, 0x00, 0x25, 0x0C, 0x00, 0x00, 0x17,
+    0x0D, 0x05, 0x00, 0x3E, 0x0E, 0x0C, 0x0D, 0x1A, 0x0E, 0x08,
+    0x00, 0x17, 0x0F, 0x0C, 0x00, 0x33, 0x10, 0x00, 0x0F, 0x33,
+    0x11, 0x10, 0x0B, 0x2C, 0x03, 0x11, 0x00, 0x43, 0x10, 0x03,
+    0x00, 0x05, 0x0C, 0x0C, 0x01, 0x18, 0xF8, 0xFF, 0xFF, 0x05,
+    0x08, 0x08, 0x01, 0x18, 0xF1, 0xFF, 0xFF, 0x03, 0x03, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0x84, 0xAD, 0x0C, 0x0E, 0x0C, 0x0B,
+    0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF1, 0x80, 0xA2, 0xBF, 0x81,
+    0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEA, 0x17,
+    0xBF, 0xE9, 0x17, 0x07, 0x65, 0xBF, 0x9B, 0x65, 0xBF, 0x9B,
+    0x65, 0xBF, 0x9B, 0x65, 0xBF, 0x9B, 0x65, 0xBF, 0x9B, 0x65,
+    0xBF, 0x9B, 0x65, 0xBF, 0x9B, 0x65, 0xBF, 0x9B, 0x65, 0xBF,
+    0x9B, 0x65, 0xBF, 0xEF, 0x0C, 0xBF, 0xEF, 0x14, 0xBF, 0xDC,
+    0x25, 0xBF, 0xDB, 0x25, 0xBF, 0x9C, 0x65, 0xBF, 0x9B, 0x65,
+    0xBF, 0x9B, 0x65, 0xBF, 0x9B, 0x65, 0xBE, 0xC6, 0x81, 0x42,
+    0xCF, 0x03, 0x6B, 0x76, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x77, 0x28, 0x6B, 0x76, 0x73, 0x20, 0x64, 0x69,
+    0x63, 0x74, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73,
+    0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F,
+    0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20,
+    0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x40, 0x5B, 0x6B, 0x20,
+    0x76, 0x20, 0x6B, 0x20, 0x76, 0x20, 0x2E, 0x2E, 0x2E, 0x5D,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x88, 0x85, 0xCD, 0x00, 0x00, 0x89, 0x72, 0xDA,
+    0x03, 0xDA, 0x81, 0x0B, 0xCF, 0x05, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06,
+    0xCE, 0x82, 0x83, 0x28, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20,
+    0x78, 0x20, 0x26, 0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x29,
+    0x0A, 0x0A, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20,
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x20,
+    0x4D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x78, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20,
+    0x20, 0x61, 0x6E, 0x79, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x61, 0x73, 0x65, 0x73,
+    0x2E, 0x20, 0x45, 0x61, 0x73, 0x79, 0x20, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74,
+    0x74, 0x65, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73,
+    0x74, 0x2C, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x65,
+    0x64, 0x20, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x6F, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x2E, 0x20,
+    0x41, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x20, 0x61,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61,
+    0x6E, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x78, 0x27, 0x73,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x69,
+    0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x69,
+    0x74, 0x27, 0x73, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x73, 0x70,
+    0x6F, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x20,
+    0x78, 0x2E, 0x20, 0x41, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x2E, 0x20, 0x41,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x74,
+    0x74, 0x65, 0x72, 0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x69,
+    0x74, 0x27, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x65, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F,
+    0x77, 0x69, 0x6E, 0x67, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+    0x72, 0x75, 0x65, 0x2E, 0x20, 0x41, 0x6E, 0x79, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x20,
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x69,
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C,
+    0x20, 0x74, 0x6F, 0x20, 0x78, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x93, 0x59, 0xCD, 0x00,
+    0x00, 0x97, 0x74, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBB, 0x00,
+    0x00, 0x0A, 0x01, 0x05, 0x1C, 0x01, 0xCE, 0x05, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0xDA, 0x24, 0xDA, 0x80, 0xC4, 0xDA, 0x60,
+    0xDA, 0x61, 0xDA, 0x80, 0x88, 0xDA, 0x65, 0x28, 0x02, 0x00,
+    0x00, 0x17, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x43,
+    0x05, 0x00, 0x00, 0x1A, 0x05, 0x03, 0x00, 0x17, 0x04, 0x03,
+    0x00, 0x18, 0x03, 0x00, 0x00, 0x43, 0x06, 0x01, 0x00, 0x17,
+    0x04, 0x06, 0x00, 0x17, 0x05, 0x04, 0x00, 0x37, 0x04, 0x01,
+    0x00, 0x17, 0x06, 0x04, 0x00, 0x05, 0x04, 0x06, 0xFF, 0x17,
+    0x07, 0x04, 0x00, 0x2A, 0x04, 0x00, 0x00, 0x25, 0x09, 0x00,
+    0x00, 0x44, 0x08, 0x09, 0x04, 0x17, 0x04, 0x08, 0x00, 0x1F,
+    0x06, 0x03, 0x05, 0x1A, 0x06, 0x02, 0x00, 0x03, 0x04, 0x00,
+    0x00, 0x26, 0x08, 0x02, 0x00, 0x2D, 0x08, 0x05, 0x03, 0x43,
+    0x08, 0x03, 0x00, 0x26, 0x09, 0x04, 0x00, 0x2D, 0x09, 0x08,
+    0x04, 0x26, 0x09, 0x03, 0x00, 0x30, 0x09, 0x00, 0x00, 0xCD,
+    0x00, 0xFE, 0x00, 0x00, 0x09, 0x01, 0x06, 0x23, 0x01, 0x01,
+    0xCE, 0x03, 0x61, 0x75, 0x78, 0xDA, 0x24, 0xDA, 0x60, 0xD7,
+    0xCD, 0x00, 0xBE, 0x00, 0x00, 0x13, 0x04, 0x0E, 0x79, 0x03,
+    0xCE, 0x07, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x2D, 0x31, 0xDA,
+    0x24, 0xDA, 0x81, 0x05, 0xDA, 0x66, 0xDA, 0x64, 0xD2, 0x02,
+    0x00, 0xDA, 0x67, 0xCF, 0x07, 0x5F, 0x30, 0x30, 0x30, 0x30,
+    0x31, 0x79, 0xDA, 0x61, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x05, 0x01, 0x02, 0x05, 0xCE, 0x06, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x7B, 0x2B, 0x00,
+    0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x8B, 0xB7,
+    0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xEE, 0x12, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05,
+    0x01, 0x02, 0x05, 0xCE, 0x06, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x78, 0x2B, 0x00, 0x00,
+    0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F,
+    0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x8B, 0x78, 0x07,
+    0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x12, 0xBF, 0xEE, 0x12, 0xBF,
+    0xEE, 0x12, 0xDA, 0x80, 0xC4, 0xDA, 0x60, 0xCF, 0x08, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0xDA, 0x80, 0x88,
+    0xDA, 0x65, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x07, 0x01,
+    0x03, 0x0A, 0xCE, 0x0B, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x72, 0x79, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA,
+    0x73, 0xDA, 0x76, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00,
+    0x00, 0x26, 0x05, 0x01, 0x00, 0x1F, 0x04, 0x03, 0x05, 0x1A,
+    0x04, 0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x03, 0x05, 0x00,
+    0x00, 0x26, 0x06, 0x02, 0x00, 0x1F, 0x05, 0x03, 0x06, 0x03,
+    0x05, 0x00, 0x00, 0x8C, 0xF8, 0x07, 0xBF, 0xF9, 0x07, 0x09,
+    0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF1, 0x23, 0xBF, 0xDD, 0x23,
+    0xBF, 0xDD, 0x23, 0xBF, 0xF3, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF,
+    0xF4, 0x0C, 0xCF, 0x0B, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x72, 0x79, 0x3F, 0x28, 0x04, 0x00, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00, 0x1A, 0x05, 0x1D,
+    0x00, 0x33, 0x06, 0x03, 0x00, 0x1A, 0x06, 0x0B, 0x00, 0x26,
+    0x08, 0x01, 0x00, 0x2D, 0x08, 0x00, 0x01, 0x3D, 0x07, 0x00,
+    0x00, 0x2F, 0x08, 0x02, 0x00, 0x26, 0x0A, 0x02, 0x00, 0x2D,
+    0x0A, 0x07, 0x08, 0x26, 0x0A, 0x03, 0x00, 0x2B, 0x0A, 0x00,
+    0x00, 0x3D, 0x09, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x23,
+    0x07, 0x00, 0x00, 0x34, 0x03, 0x00, 0x07, 0x26, 0x08, 0x04,
+    0x00, 0x2D, 0x08, 0x00, 0x01, 0x3D, 0x07, 0x00, 0x00, 0x26,
+    0x09, 0x01, 0x00, 0x22, 0x0A, 0x00, 0x00, 0x2D, 0x09, 0x0A,
+    0x07, 0x3D, 0x08, 0x00, 0x00, 0x2F, 0x07, 0x02, 0x00, 0x26,
+    0x0A, 0x02, 0x00, 0x26, 0x0B, 0x03, 0x00, 0x2D, 0x0A, 0x08,
+    0x0B, 0x2B, 0x07, 0x00, 0x00, 0x3D, 0x09, 0x00, 0x00, 0x03,
+    0x09, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x06, 0x05,
+    0x00, 0x1A, 0x06, 0x07, 0x00, 0x25, 0x08, 0x00, 0x00, 0x33,
+    0x07, 0x00, 0x08, 0x2A, 0x08, 0x00, 0x00, 0x2D, 0x07, 0x01,
+    0x08, 0x2B, 0x03, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x07, 0x06, 0x00, 0x1A, 0x07, 0x22,
+    0x00, 0x37, 0x08, 0x00, 0x00, 0x17, 0x09, 0x08, 0x00, 0x25,
+    0x08, 0xFF, 0xFF, 0x17, 0x0A, 0x01, 0x00, 0x2B, 0x0A, 0x00,
+    0x00, 0x43, 0x0C, 0x07, 0x00, 0x1A, 0x0C, 0x03, 0x00, 0x17,
+    0x0B, 0x0A, 0x00, 0x18, 0x03, 0x00, 0x00, 0x43, 0x0D, 0x08,
+    0x00, 0x17, 0x0B, 0x0D, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x26,
+    0x0D, 0x09, 0x00, 0x2C, 0x0D, 0x0C, 0x00, 0x3D, 0x0B, 0x00,
+    0x00, 0x2A, 0x0D, 0x01, 0x00, 0x2F, 0x0E, 0x0D, 0x00, 0x26,
+    0x0F, 0x02, 0x00, 0x2D, 0x0F, 0x0B, 0x0E, 0x26, 0x0F, 0x03,
+    0x00, 0x2B, 0x0F, 0x00, 0x00, 0x3D, 0x0D, 0x00, 0x00, 0x17,
+    0x0B, 0x0D, 0x00, 0x1F, 0x0D, 0x0A, 0x0C, 0x1A, 0x0D, 0x02,
+    0x00, 0x03, 0x0B, 0x00, 0x00, 0x26, 0x0E, 0x04, 0x00, 0x2D,
+    0x0E, 0x0C, 0x0A, 0x43, 0x0E, 0x0A, 0x00, 0x26, 0x0F, 0x0B,
+    0x00, 0x2D, 0x0F, 0x0E, 0x0B, 0x26, 0x0F, 0x0A, 0x00, 0x30,
+    0x0F, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x0A, 0x0C,
+    0x00, 0x1A, 0x0A, 0x20, 0x00, 0x22, 0x0B, 0x00, 0x00, 0x17,
+    0x0D, 0x01, 0x00, 0x2B, 0x0D, 0x00, 0x00, 0x43, 0x0F, 0x07,
+    0x00, 0x1A, 0x0F, 0x03, 0x00, 0x17, 0x0E, 0x0D, 0x00, 0x18,
+    0x03, 0x00, 0x00, 0x43, 0x10, 0x08, 0x00, 0x17, 0x0E, 0x10,
+    0x00, 0x17, 0x0F, 0x0E, 0x00, 0x26, 0x10, 0x0D, 0x00, 0x2C,
+    0x10, 0x0F, 0x00, 0x3D, 0x0E, 0x00, 0x00, 0x2A, 0x10, 0x02,
+    0x00, 0x2F, 0x11, 0x10, 0x00, 0x26, 0x12, 0x02, 0x00, 0x2D,
+    0x12, 0x0E, 0x11, 0x26, 0x12, 0x03, 0x00, 0x2B, 0x12, 0x00,
+    0x00, 0x3D, 0x10, 0x00, 0x00, 0x17, 0x0E, 0x10, 0x00, 0x1F,
+    0x10, 0x0D, 0x0F, 0x1A, 0x10, 0x02, 0x00, 0x03, 0x0E, 0x00,
+    0x00, 0x26, 0x11, 0x04, 0x00, 0x2D, 0x11, 0x0F, 0x0D, 0x43,
+    0x11, 0x0A, 0x00, 0x26, 0x12, 0x0B, 0x00, 0x2D, 0x12, 0x11,
+    0x0E, 0x26, 0x12, 0x0A, 0x00, 0x30, 0x12, 0x00, 0x00, 0x26,
+    0x0E, 0x01, 0x00, 0x2D, 0x0E, 0x00, 0x01, 0x3D, 0x0D, 0x00,
+    0x00, 0x2F, 0x0E, 0x02, 0x00, 0x26, 0x11, 0x02, 0x00, 0x2D,
+    0x11, 0x0D, 0x0E, 0x26, 0x11, 0x03, 0x00, 0x2B, 0x11, 0x00,
+    0x00, 0x3D, 0x10, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0xCD,
+    0x00, 0xD4, 0x00, 0x00, 0x04, 0x00, 0x04, 0x10, 0x01, 0xDA,
+    0x24, 0xDA, 0x7C, 0xCF, 0x03, 0x61, 0x6E, 0x64, 0xDA, 0x64,
+    0xDA, 0x82, 0x08, 0x27, 0x00, 0x00, 0x00, 0x25, 0x01, 0x01,
+    0x00, 0x2C, 0x00, 0x01, 0x00, 0x43, 0x00, 0x00, 0x00, 0x26,
+    0x02, 0x01, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x2E, 0x00, 0x00,
+    0x00, 0x3D, 0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x02, 0x2F,
+    0x00, 0x02, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2D, 0x03, 0x01,
+    0x00, 0x26, 0x03, 0x03, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x3D,
+    0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0xCD,
+    0x00, 0x00, 0x90, 0x29, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9,
+    0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xDE, 0x39, 0xBF, 0xC7, 0x39,
+    0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF,
+    0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7,
+    0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39,
+    0xCD, 0x00, 0xDC, 0x00, 0x00, 0x07, 0x00, 0x02, 0x17, 0x01,
+    0xDA, 0x82, 0x05, 0xDA, 0x24, 0xD7, 0xCD, 0x00, 0x0C, 0x00,
+    0x06, 0x02, 0x02, 0x00, 0x02, 0xCE, 0x03, 0x67, 0x65, 0x74,
+    0x33, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x80,
+    0x88, 0x28, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x08, 0x05,
+    0x01, 0x02, 0x01, 0x29, 0x01, 0x00, 0x08, 0x27, 0x03, 0x00,
+    0x08, 0x27, 0x04, 0x00, 0x09, 0x1F, 0x02, 0x03, 0x04, 0x1A,
+    0x02, 0x03, 0x00, 0x27, 0x03, 0x00, 0x02, 0x30, 0x03, 0x00,
+    0x00, 0x27, 0x04, 0x00, 0x00, 0x27, 0x05, 0x00, 0x08, 0x33,
+    0x03, 0x04, 0x05, 0x26, 0x04, 0x00, 0x00, 0x27, 0x05, 0x00,
+    0x0C, 0x27, 0x06, 0x00, 0x08, 0x2D, 0x04, 0x05, 0x06, 0x43,
+    0x04, 0x01, 0x00, 0x2D, 0x03, 0x04, 0x00, 0x27, 0x05, 0x00,
+    0x03, 0x2B, 0x05, 0x00, 0x00, 0x27, 0x05, 0x00, 0x04, 0x30,
+    0x05, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x90, 0xFF,
+    0x80, 0xA0, 0xBF, 0x7A, 0x05, 0xBF, 0xFB, 0x05, 0xBF, 0xFB,
+    0x05, 0x15, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF8, 0x08, 0xBF,
+    0xF4, 0x6F, 0xBF, 0xB0, 0x08, 0xBF, 0xF8, 0x08, 0x1C, 0x0E,
+    0xBF, 0xF2, 0x0E, 0xBF, 0xF2, 0x0E, 0x02, 0x11, 0xBF, 0xEF,
+    0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11,
+    0xBF, 0xD6, 0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xCC, 0x34, 0xBF,
+    0xCC, 0x34, 0xBF, 0xCC, 0x34, 0xCD, 0x00, 0xDC, 0x00, 0x00,
+    0x07, 0x00, 0x03, 0x19, 0x01, 0xDA, 0x82, 0x05, 0xDA, 0x24,
+    0xDA, 0x2E, 0xDA, 0x82, 0x13, 0xDA, 0x80, 0x88, 0x28, 0x00,
+    0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x0B,
+    0x2C, 0x01, 0x02, 0x00, 0x43, 0x01, 0x00, 0x00, 0x29, 0x01,
+    0x00, 0x0B, 0x27, 0x03, 0x00, 0x0B, 0x22, 0x04, 0x00, 0x00,
+    0x1F, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x03, 0x00, 0x27, 0x03,
+    0x00, 0x02, 0x30, 0x03, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00,
+    0x27, 0x05, 0x00, 0x0B, 0x33, 0x03, 0x04, 0x05, 0x26, 0x04,
+    0x01, 0x00, 0x27, 0x05, 0x00, 0x0F, 0x27, 0x06, 0x00, 0x0B,
+    0x2D, 0x04, 0x05, 0x06, 0x43, 0x04, 0x02, 0x00, 0x2D, 0x03,
+    0x04, 0x00, 0x27, 0x05, 0x00, 0x03, 0x2B, 0x05, 0x00, 0x00,
+    0x27, 0x05, 0x00, 0x04, 0x30, 0x05, 0x00, 0x00, 0xBF, 0xFF,
+    0xCD, 0x00, 0x00, 0x92, 0x45, 0x80, 0xBD, 0xBF, 0x66, 0x11,
+    0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0xBF,
+    0xEF, 0x11, 0x16, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF6, 0x0A,
+    0xBF, 0xF2, 0x76, 0xBF, 0xAB, 0x08, 0xBF, 0xF8, 0x08, 0x1C,
+    0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0x02, 0x14, 0xBF,
+    0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC,
+    0x14, 0xBF, 0xD1, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39,
+    0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39, 0xCD, 0x00, 0x00, 0x8E,
+    0xC4, 0x84, 0x92, 0xBB, 0xA8, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xE5, 0x84, 0x62, 0xBB, 0xC3, 0x11, 0xBF, 0xEB, 0x80, 0xB5,
+    0xBF, 0x68, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF,
+    0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4,
+    0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C,
+    0x14, 0x16, 0xBF, 0xEA, 0x16, 0x0A, 0x36, 0xBF, 0xCA, 0x36,
+    0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36, 0xBF,
+    0xCA, 0x36, 0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36, 0xBF, 0xCA,
+    0x36, 0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36,
+    0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36, 0x09, 0x0F, 0xBF, 0xF1,
+    0x0F, 0xBF, 0x14, 0x84, 0x62, 0xBC, 0x9F, 0x0E, 0xBF, 0xF2,
+    0x0E, 0x0D, 0x49, 0xBF, 0x8D, 0x79, 0xBF, 0x87, 0x79, 0xBF,
+    0x87, 0x79, 0x07, 0x0F, 0xBF, 0xF1, 0x0F, 0xBE, 0x7F, 0x84,
+    0x62, 0xBD, 0x38, 0x0F, 0xBF, 0xE8, 0x19, 0x08, 0x09, 0x08,
+    0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01,
+    0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF,
+    0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01,
+    0xBE, 0xFF, 0x81, 0x01, 0xBF, 0x25, 0x80, 0xDA, 0xBF, 0x26,
+    0x80, 0xDA, 0xBF, 0x26, 0x80, 0xDA, 0xBF, 0x49, 0x80, 0xA0,
+    0xBF, 0x3D, 0x80, 0xDA, 0xBF, 0x26, 0x80, 0xDA, 0xBF, 0x26,
+    0x80, 0xDA, 0xBF, 0x26, 0x80, 0xDA, 0xBF, 0x26, 0x80, 0xDA,
+    0xBF, 0x26, 0x80, 0xDA, 0xBF, 0x00, 0x81, 0x01, 0xBE, 0xFF,
+    0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01,
+    0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF,
+    0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01,
+    0xBE, 0xFF, 0x81, 0x01, 0xBE, 0xFF, 0x81, 0x01, 0x08, 0x14,
+    0xBF, 0xEC, 0x14, 0xBD, 0x20, 0x84, 0x62, 0xBE, 0x8E, 0x0C,
+    0x08, 0x81, 0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81,
+    0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE,
+    0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81,
+    0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBF, 0x04, 0x80, 0xFB, 0xBF,
+    0x05, 0x80, 0xFB, 0xBF, 0x05, 0x80, 0xFB, 0xBF, 0x2C, 0x80,
+    0xBD, 0xBF, 0x1C, 0x80, 0xFB, 0xBF, 0x05, 0x80, 0xFB, 0xBF,
+    0x05, 0x80, 0xFB, 0xBF, 0x05, 0x80, 0xFB, 0xBF, 0x05, 0x80,
+    0xFB, 0xBF, 0x05, 0x80, 0xFB, 0xBE, 0xDE, 0x81, 0x23, 0xBE,
+    0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81,
+    0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE,
+    0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81,
+    0x23, 0xBE, 0xDD, 0x81, 0x23, 0xBE, 0xDD, 0x81, 0x23, 0x0E,
+    0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C,
+    0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF,
+    0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0xDA, 0x61,
+    0xDA, 0x66, 0xDA, 0x82, 0x08, 0xDA, 0x64, 0x28, 0x01, 0x00,
+    0x00, 0x27, 0x03, 0x00, 0x07, 0x1F, 0x02, 0x00, 0x03, 0x1A,
+    0x02, 0x04, 0x00, 0x27, 0x04, 0x00, 0x01, 0x33, 0x03, 0x04,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x27, 0x04, 0x00, 0x07, 0x3E,
+    0x03, 0x00, 0x04, 0x1A, 0x03, 0x19, 0x00, 0x43, 0x04, 0x00,
+    0x00, 0x17, 0x05, 0x04, 0x00, 0x27, 0x06, 0x00, 0x01, 0x33,
+    0x04, 0x06, 0x00, 0x2A, 0x06, 0x00, 0x00, 0x3C, 0x07, 0x00,
+    0x00, 0x27, 0x08, 0x00, 0x05, 0x2D, 0x04, 0x08, 0x06, 0x2B,
+    0x07, 0x00, 0x00, 0x43, 0x08, 0x01, 0x00, 0x26, 0x06, 0x02,
+    0x00, 0x2D, 0x06, 0x05, 0x08, 0x3D, 0x04, 0x00, 0x00, 0x26,
+    0x07, 0x03, 0x00, 0x26, 0x08, 0x04, 0x00, 0x2D, 0x07, 0x08,
+    0x04, 0x3D, 0x06, 0x00, 0x00, 0x05, 0x04, 0x00, 0x02, 0x44,
+    0x07, 0x04, 0x01, 0x26, 0x08, 0x05, 0x00, 0x2D, 0x08, 0x06,
+    0x07, 0x2B, 0x05, 0x00, 0x00, 0x3D, 0x04, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD,
+    0x00, 0xD4, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x02, 0xDA,
+    0x24, 0x27, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x01, 0x27,
+    0x02, 0x00, 0x01, 0x33, 0x00, 0x02, 0x01, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x97, 0x11, 0x06,
+    0xBF, 0xFA, 0x06, 0xBF, 0xEF, 0x12, 0xBF, 0xEE, 0x12, 0xBF,
+    0xEE, 0x12, 0xCD, 0x00, 0x00, 0x96, 0x49, 0x81, 0x26, 0xBE,
+    0xFE, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xE6, 0x81, 0x11, 0xBF,
+    0x0B, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0x0C, 0x0A,
+    0xBF, 0xF6, 0x0A, 0xBF, 0xC2, 0x81, 0x11, 0xBF, 0x2F, 0x80,
+    0xD0, 0xBF, 0x30, 0x80, 0xD0, 0xBF, 0x81, 0x0C, 0xBF, 0xF4,
+    0x0C, 0x05, 0x1A, 0xBF, 0xAE, 0x80, 0xA5, 0xBF, 0x5B, 0x80,
+    0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBF,
+    0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80,
+    0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBF,
+    0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80,
+    0xA5, 0xBF, 0xD7, 0x06, 0xBF, 0x7E, 0x80, 0xA5, 0xBF, 0x5B,
+    0x80, 0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80, 0xA5,
+    0xBF, 0x5B, 0x80, 0xA5, 0xBF, 0x5B, 0x80, 0xA5, 0xBE, 0xF1,
+    0x81, 0x11, 0xCD, 0x00, 0x00, 0x93, 0x59, 0x84, 0x1B, 0xBE,
+    0x82, 0x81, 0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81,
+    0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE,
+    0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81,
+    0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0xA3, 0x0D, 0xBF, 0xEA,
+    0x17, 0x13, 0x08, 0xBF, 0xED, 0x14, 0x09, 0x81, 0x26, 0xBE,
+    0xD9, 0x81, 0x2A, 0xBE, 0xD6, 0x81, 0x2A, 0xBE, 0x84, 0x81,
+    0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE,
+    0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81,
+    0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE,
+    0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81, 0x7D, 0xBE, 0x83, 0x81,
+    0x7D, 0xCF, 0x01, 0x2A, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x09, 0x00, 0x0B, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x01,
+    0x2A, 0x37, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A,
+    0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25,
+    0x03, 0x01, 0x00, 0x35, 0x04, 0x00, 0x00, 0x09, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25,
+    0x05, 0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x09, 0x03, 0x03,
+    0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A,
+    0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE,
+    0x4F, 0x28, 0x2A, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20,
+    0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x31, 0x2E,
+    0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x77, 0x72, 0x69,
+    0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x65, 0xDA,
+    0x06, 0xCE, 0x69, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x77,
+    0x72, 0x69, 0x74, 0x65, 0x20, 0x66, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x29, 0x0A, 0x0A, 0x57, 0x72, 0x69, 0x74, 0x65,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x2E, 0x20, 0x27, 0x62, 0x79, 0x74, 0x65, 0x73, 0x27,
+    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x09,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E, 0x68, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x73, 0x69, 0x6E, 0x68, 0xDA, 0x06, 0xCE, 0x2F, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E, 0x68, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x68, 0x79, 0x70, 0x65, 0x72, 0x62,
+    0x6F, 0x6C, 0x69, 0x63, 0x20, 0x73, 0x69, 0x6E, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x09, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x70, 0x6F, 0x70, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x6F,
+    0x70, 0xDA, 0x06, 0xCE, 0x80, 0x86, 0x28, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x70, 0x6F, 0x70, 0x20, 0x61, 0x72, 0x72,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x69, 0x74, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x69, 0x73,
+    0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x4D, 0x6F, 0x64, 0x69, 0x66,
+    0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E,
+    0x70, 0x75, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+    0xCF, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x63,
+    0x6C, 0x65, 0x61, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80,
+    0xE3, 0xDA, 0x06, 0xCE, 0x80, 0xA3, 0x28, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x53,
+    0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69,
+    0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x69, 0x65,
+    0x73, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x72, 0x65, 0x74,
+    0x61, 0x69, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6D,
+    0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x6F, 0x20, 0x69,
+    0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65,
+    0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74, 0x6C, 0x79,
+    0x20, 0x72, 0x65, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+    0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF,
+    0x09, 0x6F, 0x73, 0x2F, 0x73, 0x65, 0x74, 0x65, 0x6E, 0x76,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6F, 0x73, 0x2F, 0x73,
+    0x65, 0x74, 0x65, 0x6E, 0x76, 0xDA, 0x06, 0xCE, 0x38, 0x28,
+    0x6F, 0x73, 0x2F, 0x73, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x20,
+    0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+    0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69,
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x07, 0x6F, 0x73, 0x2F,
+    0x74, 0x69, 0x6D, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07,
+    0x6F, 0x73, 0x2F, 0x74, 0x69, 0x6D, 0x65, 0xDA, 0x06, 0xCE,
+    0x80, 0x80, 0x28, 0x6F, 0x73, 0x2F, 0x74, 0x69, 0x6D, 0x65,
+    0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x74,
+    0x69, 0x6D, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x73,
+    0x69, 0x6E, 0x63, 0x65, 0x20, 0x4A, 0x61, 0x6E, 0x75, 0x61,
+    0x72, 0x79, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x39, 0x37, 0x30,
+    0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6E, 0x69, 0x78,
+    0x20, 0x65, 0x70, 0x6F, 0x63, 0x68, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65,
+    0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E,
+    0xCF, 0x0B, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x62, 0x72,
+    0x65, 0x61, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x62, 0x72, 0x65, 0x61, 0x6B,
+    0xDA, 0x06, 0xCE, 0x81, 0x38, 0x28, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x2F, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20, 0x73, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2D,
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x0A, 0x0A, 0x53,
+    0x65, 0x74, 0x73, 0x20, 0x61, 0x20, 0x62, 0x72, 0x65, 0x61,
+    0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x61,
+    0x20, 0x6B, 0x65, 0x79, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20,
+    0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2E, 0x20, 0x41,
+    0x6E, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x30, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68,
+    0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74,
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x20, 0x46, 0x6F, 0x72,
+    0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x0A, 0x0A,
+    0x09, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x62, 0x72,
+    0x65, 0x61, 0x6B, 0x20, 0x22, 0x63, 0x6F, 0x72, 0x65, 0x2E,
+    0x6A, 0x61, 0x6E, 0x65, 0x74, 0x22, 0x20, 0x31, 0x30, 0x30,
+    0x30, 0x29, 0x0A, 0x0A, 0x77, 0x69, 0x6C, 0x20, 0x73, 0x65,
+    0x74, 0x20, 0x61, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70,
+    0x6F, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x31, 0x30, 0x30, 0x30, 0x74, 0x68, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x65,
+    0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x2E, 0xCF, 0x0B, 0x70,
+    0x65, 0x67, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x70, 0x65, 0x67, 0x2F,
+    0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xDA, 0x06, 0xCE,
+    0x80, 0x93, 0x28, 0x70, 0x65, 0x67, 0x2F, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x65, 0x20, 0x70, 0x65, 0x67, 0x29, 0x0A,
+    0x0A, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x70, 0x65, 0x67, 0x20, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x3C, 0x63, 0x6F, 0x72, 0x65,
+    0x2F, 0x70, 0x65, 0x67, 0x3E, 0x2E, 0x20, 0x54, 0x68, 0x69,
+    0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x73, 0x70, 0x65,
+    0x65, 0x64, 0x20, 0x75, 0x70, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x70, 0x65, 0x67,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x75,
+    0x73, 0x65, 0x64, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70,
+    0x6C, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x2E, 0xCF,
+    0x0C, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x66, 0x6C, 0x61, 0x74,
+    0x74, 0x65, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x72,
+    0x6F, 0x70, 0x65, 0x2F, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65,
+    0x6E, 0xDA, 0x06, 0xCE, 0x75, 0x28, 0x72, 0x6F, 0x70, 0x65,
+    0x2F, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x72,
+    0x6F, 0x70, 0x65, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x43, 0x6F,
+    0x70, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x6F, 0x70, 0x65,
+    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E,
+    0x64, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0xCF, 0x0A, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64,
+    0x2F, 0x6E, 0x65, 0x77, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A,
+    0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x6E, 0x65, 0x77,
+    0xDA, 0x06, 0xCE, 0x81, 0x62, 0x28, 0x73, 0x6F, 0x72, 0x74,
+    0x65, 0x64, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x26, 0x20, 0x6B,
+    0x76, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x6F,
+    0x72, 0x74, 0x65, 0x64, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65,
+    0x79, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x2E, 0x20, 0x41, 0x20, 0x73, 0x6F, 0x72,
+    0x74, 0x65, 0x64, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x69, 0x73,
+    0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6B,
+    0x65, 0x65, 0x70, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x6E, 0x65, 0x78,
+    0x74, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x76, 0x69, 0x73,
+    0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x74,
+    0x6F, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x74,
+    0x2E, 0x20, 0x4B, 0x65, 0x79, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x6C,
+    0x69, 0x6B, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x2E, 0x20, 0x47, 0x65,
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x70, 0x75, 0x74,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x6D, 0x6F, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20,
+    0x6B, 0x65, 0x79, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x4F,
+    0x28, 0x6C, 0x6F, 0x67, 0x20, 0x6E, 0x29, 0x20, 0x74, 0x69,
+    0x6D, 0x65, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x20, 0x70, 0x75,
+    0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x61, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x6D,
+    0x61, 0x70, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6F,
+    0x72, 0x74, 0x65, 0x64, 0x20, 0x73, 0x65, 0x74, 0x2E, 0xCF,
+    0x0C, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C,
+    0x69, 0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x74,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0xDA, 0x06, 0xCE, 0x81, 0x44, 0x28, 0x74, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20,
+    0x74, 0x61, 0x72, 0x72, 0x20, 0x5B, 0x2C, 0x20, 0x73, 0x74,
+    0x61, 0x72, 0x74, 0x3D, 0x30, 0x20, 0x5B, 0x2C, 0x20, 0x65,
+    0x6E, 0x64, 0x3D, 0x28, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x74,
+    0x61, 0x72, 0x72, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x54,
+    0x61, 0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69,
+    0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65,
+    0x6E, 0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C,
+    0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x49, 0x6E, 0x64,
+    0x65, 0x78, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61,
+    0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x64,
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+    0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+    0x74, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E,
+    0x64, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+    0xCF, 0x04, 0x6F, 0x6E, 0x65, 0x3F, 0xD4, 0x02, 0xD3, 0x01,
+    0xDA, 0x06, 0xCE, 0x23, 0x28, 0x6F, 0x6E, 0x65, 0x3F, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+    0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71,
+    0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x88, 0x6A, 0x88, 0x9D,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x03, 0xCE, 0x04, 0x6F, 0x6E, 0x65, 0x3F, 0xDA, 0x24,
+    0x25, 0x03, 0x01, 0x00, 0x42, 0x02, 0x00, 0x03, 0x03, 0x02,
+    0x00, 0x00, 0x88, 0x95, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF9,
+    0x07, 0xCF, 0x07, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x3F,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x21, 0x28, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8B, 0x0B,
+    0x8B, 0x48, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x05, 0x01, 0x02, 0x05, 0xCE, 0x07, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x76, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01,
+    0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x8B,
+    0x37, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xED, 0x13, 0xCF, 0x02, 0x2B, 0x3D, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x24, 0x28,
+    0x2B, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x49,
+    0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x20,
+    0x62, 0x79, 0x20, 0x6E, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0x93, 0x1F, 0x93, 0x63, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x06, 0x02, 0x02, 0x07, 0xCE, 0x02,
+    0x2B, 0x3D, 0xDA, 0x24, 0xDA, 0x81, 0xA3, 0xDA, 0x80, 0xF2,
+    0x26, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x01, 0x3D, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x03,
+    0x3D, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x93, 0x4F,
+    0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF,
+    0x04, 0x63, 0x61, 0x73, 0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+    0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x80, 0xBB, 0x28, 0x63, 0x61,
+    0x73, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x26, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x29,
+    0x0A, 0x0A, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74,
+    0x63, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20,
+    0x57, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73,
+    0x20, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F,
+    0x64, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x78,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x20,
+    0x20, 0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x6D, 0x61, 0x74,
+    0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E,
+    0x64, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x98, 0xE8, 0x9B, 0x47, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0xBB, 0x00, 0x00, 0x0C, 0x01, 0x05, 0x19, 0x01, 0xCE, 0x04,
+    0x63, 0x61, 0x73, 0x65, 0xDA, 0x24, 0xDA, 0x80, 0xC4, 0xDA,
+    0x60, 0xDA, 0x61, 0xDA, 0x80, 0x88, 0xDA, 0x65, 0x28, 0x02,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x17, 0x05,
+    0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x43, 0x06, 0x01, 0x00,
+    0x17, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05, 0x00, 0x2A, 0x07,
+    0x00, 0x00, 0x17, 0x08, 0x07, 0x00, 0x1A, 0x04, 0x04, 0x00,
+    0x25, 0x09, 0x00, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x30, 0x08,
+    0x00, 0x00, 0x26, 0x09, 0x02, 0x00, 0x2D, 0x09, 0x06, 0x00,
+    0x43, 0x09, 0x03, 0x00, 0x25, 0x0B, 0x00, 0x00, 0x44, 0x0A,
+    0x0B, 0x08, 0x26, 0x0B, 0x04, 0x00, 0x2D, 0x0B, 0x09, 0x0A,
+    0x26, 0x0B, 0x03, 0x00, 0x30, 0x0B, 0x00, 0x00, 0xCD, 0x00,
+    0xDC, 0x00, 0x00, 0x0A, 0x01, 0x03, 0x1E, 0x01, 0xDA, 0x82,
+    0x05, 0xDA, 0x24, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x18, 0x06,
+    0x00, 0x00, 0x10, 0xCE, 0x01, 0x3D, 0x37, 0x01, 0x00, 0x00,
+    0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x35, 0x03,
+    0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04, 0x00, 0x05,
+    0x1F, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05,
+    0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01,
+    0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0xDA, 0x80, 0x88, 0xDA, 0x64, 0x28, 0x01, 0x00, 0x00, 0x27,
+    0x03, 0x00, 0x01, 0x37, 0x02, 0x03, 0x00, 0x07, 0x02, 0x02,
+    0x00, 0x25, 0x05, 0x00, 0x00, 0x1F, 0x04, 0x02, 0x05, 0x1A,
+    0x04, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x25, 0x06, 0x01,
+    0x00, 0x1F, 0x05, 0x02, 0x06, 0x1A, 0x05, 0x04, 0x00, 0x27,
+    0x07, 0x00, 0x01, 0x33, 0x06, 0x07, 0x00, 0x03, 0x06, 0x00,
+    0x00, 0x27, 0x07, 0x00, 0x01, 0x33, 0x06, 0x07, 0x00, 0x26,
+    0x07, 0x00, 0x00, 0x27, 0x08, 0x00, 0x06, 0x2D, 0x07, 0x08,
+    0x06, 0x43, 0x07, 0x01, 0x00, 0x05, 0x06, 0x00, 0x01, 0x27,
+    0x09, 0x00, 0x01, 0x33, 0x08, 0x09, 0x06, 0x05, 0x06, 0x00,
+    0x02, 0x44, 0x09, 0x06, 0x01, 0x26, 0x06, 0x02, 0x00, 0x2D,
+    0x06, 0x07, 0x08, 0x2B, 0x09, 0x00, 0x00, 0x26, 0x06, 0x01,
+    0x00, 0x30, 0x06, 0x00, 0x00, 0xBF, 0xFF, 0x9A, 0x01, 0x80,
+    0xE6, 0xBF, 0x3C, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF0, 0x13,
+    0x0B, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF0, 0x80, 0xAC, 0xBF,
+    0x54, 0x80, 0xAC, 0xBF, 0x74, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF,
+    0xF0, 0x80, 0x8F, 0xBF, 0x83, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF,
+    0xF4, 0x0C, 0x22, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xE7, 0x1A,
+    0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0x1C,
+    0x06, 0xBF, 0xEF, 0x12, 0xBF, 0xEE, 0x12, 0x16, 0x06, 0xBF,
+    0xF5, 0x0C, 0xBF, 0x9B, 0x66, 0xBF, 0x9A, 0x66, 0xBF, 0x9A,
+    0x66, 0xBF, 0x9A, 0x66, 0xBF, 0x9A, 0x66, 0x98, 0xE8, 0x82,
+    0x5F, 0xBE, 0x79, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xE2, 0x1F,
+    0x0D, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xF8,
+    0x07, 0xBF, 0xE8, 0x19, 0xBF, 0xDE, 0x23, 0x04, 0x80, 0xE6,
+    0xBF, 0x1A, 0x80, 0xE6, 0x04, 0x5B, 0xBF, 0xB1, 0x06, 0xBF,
+    0xFA, 0x06, 0xBF, 0xFA, 0x06, 0x1C, 0x18, 0xBF, 0xE8, 0x18,
+    0xBF, 0xE8, 0x18, 0x0D, 0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xBF,
+    0x42, 0xBF, 0xBE, 0x42, 0xBF, 0xBE, 0x42, 0xBF, 0xBE, 0x42,
+    0xCF, 0x05, 0x61, 0x72, 0x72, 0x61, 0x79, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x05, 0x61, 0x72, 0x72, 0x61, 0x79, 0xDA, 0x06,
+    0xCE, 0x4F, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x26,
+    0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E,
+    0x73, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0xCF, 0x0D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x6C,
+    0x69, 0x6E, 0x65, 0x61, 0x67, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x6C, 0x69,
+    0x6E, 0x65, 0x61, 0x67, 0x65, 0xDA, 0x06, 0xCE, 0x81, 0x2E,
+    0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x6C, 0x69, 0x6E,
+    0x65, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x62, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x63, 0x68, 0x69, 0x6C, 0x64,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x73, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x61, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x69,
+    0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6C,
+    0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+    0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x6E,
+    0x63, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2E, 0x20, 0x55, 0x73, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x73, 0x65,
+    0x65, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61,
+    0x6C, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F,
+    0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x6C, 0x79, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69,
+    0x6E, 0x67, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65,
+    0x73, 0x2E, 0xCF, 0x08, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x70,
+    0x75, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x70, 0x6D,
+    0x61, 0x70, 0x2F, 0x70, 0x75, 0x74, 0xDA, 0x06, 0xCE, 0x80,
+    0xA4, 0x28, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x70, 0x75, 0x74,
+    0x20, 0x6D, 0x61, 0x70, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x26, 0x20, 0x6B, 0x76, 0x73,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x65, 0x72,
+    0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61,
+    0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E,
+    0x20, 0x41, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x72, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65,
+    0x79, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6F, 0x72, 0x69,
+    0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x70, 0x20,
+    0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x68, 0x61,
+    0x6E, 0x67, 0x65, 0x64, 0x2E, 0xCF, 0x07, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x24, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B,
+    0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0x89, 0x62, 0x89, 0xA2, 0xDA,
+    0x03, 0xDA, 0x81, 0x05, 0xCF, 0x02, 0x25, 0x3D, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x28, 0x28,
+    0x25, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x53,
+    0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x78, 0x20,
+    0x28, 0x25, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x29, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x94, 0x3F, 0x94, 0x87,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x06, 0x02,
+    0x02, 0x07, 0xCE, 0x02, 0x25, 0x3D, 0xDA, 0x24, 0xD8, 0x01,
+    0x25, 0xDA, 0x80, 0xF2, 0x26, 0x04, 0x00, 0x00, 0x2D, 0x04,
+    0x00, 0x01, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00,
+    0x2D, 0x05, 0x00, 0x03, 0x3D, 0x04, 0x00, 0x00, 0x03, 0x04,
+    0x00, 0x00, 0x94, 0x73, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xCF, 0x06, 0x69, 0x6E, 0x76, 0x65, 0x72,
+    0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0xB8,
+    0x28, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x64, 0x73,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x61,
+    0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6D, 0x75, 0x6C, 0x74,
+    0x69, 0x70, 0x6C, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20,
+    0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x61, 0x6D, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x69, 0x67, 0x6E, 0x6F,
+    0x72, 0x65, 0x64, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0xCD, 0x00, 0x00, 0x7B, 0x93, 0xCD, 0x00, 0x00, 0x7C,
+    0x9F, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x09,
+    0x01, 0x01, 0x13, 0xCE, 0x06, 0x69, 0x6E, 0x76, 0x65, 0x72,
+    0x74, 0xDA, 0x24, 0xDA, 0x2E, 0x3C, 0x03, 0x00, 0x00, 0x17,
+    0x04, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x2C, 0x04, 0x05,
+    0x00, 0x43, 0x06, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x1F,
+    0x05, 0x07, 0x06, 0x19, 0x05, 0x03, 0x00, 0x23, 0x05, 0x00,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x1A,
+    0x05, 0x07, 0x00, 0x17, 0x07, 0x06, 0x00, 0x33, 0x08, 0x00,
+    0x07, 0x34, 0x03, 0x08, 0x07, 0x2C, 0x04, 0x06, 0x00, 0x43,
+    0x06, 0x00, 0x00, 0x18, 0xF4, 0xFF, 0xFF, 0x03, 0x03, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0x7C, 0x5B, 0x0C, 0x04, 0x2D, 0xBF,
+    0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3,
+    0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D,
+    0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBF,
+    0xD3, 0x2D, 0xBF, 0xF3, 0x09, 0xBF, 0xEE, 0x15, 0xBF, 0xD4,
+    0x2D, 0xBF, 0xD3, 0x2D, 0xBF, 0xD3, 0x2D, 0xBE, 0xFB, 0x81,
+    0x0C, 0xCF, 0x07, 0x7A, 0x69, 0x70, 0x63, 0x6F, 0x6C, 0x6C,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x52, 0x28, 0x7A,
+    0x69, 0x70, 0x63, 0x6F, 0x6C, 0x6C, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x74, 0x77, 0x6F, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73,
+    0x2F, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00,
+    0x7C, 0xA2, 0xCD, 0x00, 0x00, 0x7D, 0xAD, 0xDA, 0x03, 0xD7,
+    0xCD, 0x00, 0x9C, 0x00, 0x00, 0x11, 0x02, 0x00, 0x14, 0xCE,
+    0x07, 0x7A, 0x69, 0x70, 0x63, 0x6F, 0x6C, 0x6C, 0xDA, 0x24,
+    0x3C, 0x04, 0x00, 0x00, 0x37, 0x06, 0x00, 0x00, 0x37, 0x08,
+    0x01, 0x00, 0x3E, 0x0A, 0x06, 0x08, 0x1A, 0x0A, 0x03, 0x00,
+    0x17, 0x09, 0x06, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x09,
+    0x08, 0x00, 0x17, 0x0A, 0x09, 0x00, 0x25, 0x0B, 0x00, 0x00,
+    0x17, 0x0C, 0x0A, 0x00, 0x3E, 0x0D, 0x0B, 0x0C, 0x1A, 0x0D,
+    0x07, 0x00, 0x17, 0x0E, 0x0B, 0x00, 0x33, 0x0F, 0x00, 0x0E,
+    0x33, 0x10, 0x01, 0x0E, 0x34, 0x04, 0x0F, 0x10, 0x05, 0x0B,
+    0x0B, 0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x7D, 0x03, 0x0C, 0x0C, 0x0C, 0x0D, 0x0C,
+    0x12, 0x08, 0xBF, 0xF4, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xED, 0x13, 0xBF, 0xE4, 0x1D, 0x04, 0x40, 0xBF,
+    0xC0, 0x40, 0xBF, 0xC0, 0x40, 0xBF, 0xC0, 0x40, 0xBF, 0xC0,
+    0x40, 0xBF, 0xE6, 0x0B, 0x02, 0x0B, 0xBF, 0xDF, 0x22, 0xBF,
+    0xC1, 0x40, 0xBF, 0xC0, 0x40, 0xBE, 0xFC, 0x81, 0x0B, 0xCF,
+    0x0A, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x69, 0x6D, 0x61, 0x67,
+    0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x71, 0x28,
+    0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65,
+    0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65,
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+    0x61, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0xBE, 0xF6, 0xCD, 0x00, 0x00, 0xBF, 0x9E, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01, 0x04,
+    0x08, 0xCE, 0x0A, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0xDA, 0x24, 0xDA, 0x00, 0xDA, 0x81, 0x8D,
+    0xDA, 0x82, 0x82, 0xDA, 0x18, 0x26, 0x02, 0x00, 0x00, 0x2B,
+    0x02, 0x00, 0x00, 0x43, 0x02, 0x01, 0x00, 0x2B, 0x02, 0x00,
+    0x00, 0x43, 0x03, 0x02, 0x00, 0x2C, 0x00, 0x03, 0x00, 0x26,
+    0x02, 0x03, 0x00, 0x30, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0xBF, 0x8B, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xE8, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xDA, 0x27, 0xBF, 0xD9,
+    0x27, 0xBF, 0xD9, 0x27, 0xCF, 0x06, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xC8, 0x69, 0x57, 0x14,
+    0x8B, 0x0A, 0xBF, 0x05, 0x40, 0xDA, 0x06, 0xCE, 0x1C, 0x54,
+    0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x74, 0x75, 0x72,
+    0x61, 0x6C, 0x20, 0x6C, 0x6F, 0x67, 0x2E, 0xCF, 0x05, 0x70,
+    0x72, 0x69, 0x6E, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80,
+    0xD0, 0xDA, 0x06, 0xCE, 0x80, 0xB9, 0x28, 0x70, 0x72, 0x69,
+    0x6E, 0x74, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x50, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x20, 0x28, 0x73,
+    0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x6F, 0x75,
+    0x74, 0x29, 0x2E, 0x20, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72,
+    0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x2E, 0x20,
+    0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x70, 0x72, 0x69, 0x6E,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x63, 0x68, 0x61,
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20,
+    0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x64, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C,
+    0x2E, 0xDA, 0x66, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82, 0x61,
+    0xDA, 0x06, 0xCE, 0x49, 0x28, 0x3D, 0x20, 0x26, 0x20, 0x78,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x2C,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2E, 0xCF, 0x01, 0x3C,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0xF5, 0xDA, 0x06, 0xCE,
+    0x4B, 0x28, 0x3C, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6E,
+    0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79,
+    0x20, 0x61, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F,
+    0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x0C, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x2F, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x70, 0xDA, 0x06, 0xCE,
+    0x81, 0x02, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F,
+    0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x27, 0x73,
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x20, 0x61,
+    0x73, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+    0x28, 0x6C, 0x69, 0x6E, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x6C,
+    0x75, 0x6D, 0x6E, 0x29, 0x2E, 0x20, 0x4C, 0x69, 0x6E, 0x65,
+    0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x75,
+    0x6D, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F,
+    0x75, 0x6E, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x31, 0x2C, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x31, 0x2C,
+    0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x20, 0x31, 0x29,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F,
+    0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x41,
+    0x53, 0x43, 0x49, 0x49, 0x20, 0x30, 0x78, 0x30, 0x41, 0x2E,
+    0xCF, 0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72,
+    0x65, 0x70, 0x65, 0x61, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65,
+    0x70, 0x65, 0x61, 0x74, 0xDA, 0x06, 0xCE, 0x51, 0x28, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x65,
+    0x61, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6E,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x20,
+    0x63, 0x6F, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x63,
+    0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x65, 0x64, 0x2E, 0xCF,
+    0x0C, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x73,
+    0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0xDA, 0x06, 0xCE, 0x49, 0x28, 0x73, 0x6F, 0x72, 0x74,
+    0x65, 0x64, 0x2F, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x6D,
+    0x61, 0x70, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x61,
+    0x73, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 0x6E, 0x20,
+    0x6D, 0x61, 0x70, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69,
+    0x6C, 0x20, 0x69, 0x66, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x69,
+    0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0xDA, 0x80,
+    0xE8, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x18, 0x54,
+    0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x2E, 0xDA, 0x80, 0xD1, 0xDA, 0x80, 0x91, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x6C, 0x80, 0x96, 0xCF,
+    0x06, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x3F, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x22, 0x28, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8B, 0x8A, 0x8B, 0xC7,
+    0xDA, 0x03, 0xDA, 0x82, 0x0A, 0xCF, 0x04, 0x65, 0x61, 0x63,
+    0x68, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06,
+    0xCE, 0x44, 0x28, 0x65, 0x61, 0x63, 0x68, 0x20, 0x62, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x64, 0x20,
+    0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x4C,
+    0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x65,
+    0x61, 0x63, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00,
+    0x46, 0x47, 0xCD, 0x00, 0x00, 0x46, 0xC6, 0xDA, 0x03, 0xD7,
+    0xCD, 0x00, 0x99, 0x00, 0x00, 0x06, 0x02, 0x03, 0x07, 0xCE,
+    0x04, 0x65, 0x61, 0x63, 0x68, 0xDA, 0x24, 0xD0, 0x02, 0x69,
+    0x6E, 0xDA, 0x80, 0x88, 0xD7, 0xCD, 0x00, 0xBB, 0x00, 0x00,
+    0x09, 0x01, 0x03, 0x14, 0x01, 0xCE, 0x04, 0x6C, 0x6F, 0x6F,
+    0x70, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x7B, 0xCE, 0x1C, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x20, 0x68, 0x65, 0x61, 0x64, 0x28, 0x02, 0x00,
+    0x00, 0x37, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00, 0x26, 0x07, 0x01,
+    0x00, 0x1F, 0x06, 0x07, 0x05, 0x19, 0x06, 0x03, 0x00, 0x23,
+    0x06, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x06, 0x00,
+    0x00, 0x1A, 0x06, 0x03, 0x00, 0x26, 0x05, 0x02, 0x00, 0x01,
+    0x05, 0x00, 0x00, 0x2A, 0x05, 0x00, 0x00, 0x17, 0x06, 0x05,
+    0x00, 0x25, 0x07, 0x00, 0x00, 0x22, 0x08, 0x00, 0x00, 0x2C,
+    0x07, 0x08, 0x00, 0x30, 0x06, 0x00, 0x00, 0xCD, 0x00, 0xD8,
+    0x00, 0x00, 0x1E, 0x02, 0x29, 0x81, 0xB7, 0x01, 0xCE, 0x05,
+    0x64, 0x6F, 0x6F, 0x6E, 0x65, 0xDA, 0x24, 0xDA, 0x82, 0x11,
+    0xDA, 0x65, 0xDA, 0x81, 0xD5, 0xD0, 0x05, 0x77, 0x68, 0x69,
+    0x6C, 0x65, 0xDA, 0x2F, 0xD0, 0x03, 0x6C, 0x65, 0x74, 0xDA,
+    0x81, 0xEB, 0xDA, 0x80, 0x88, 0xD0, 0x04, 0x77, 0x68, 0x65,
+    0x6E, 0xDA, 0x64, 0xD0, 0x06, 0x62, 0x65, 0x66, 0x6F, 0x72,
+    0x65, 0xD0, 0x05, 0x61, 0x66, 0x74, 0x65, 0x72, 0xD0, 0x06,
+    0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0xDA, 0x60, 0xDA, 0x81,
+    0xF5, 0xDA, 0x61, 0xDA, 0x80, 0xF1, 0xDA, 0x7C, 0xDA, 0x81,
+    0xA3, 0xDA, 0x80, 0xF2, 0xDA, 0x80, 0xF5, 0xCE, 0x1B, 0x75,
+    0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
+    0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x3A, 0x20, 0xDA, 0x80, 0xD5, 0xD0,
+    0x07, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0xD0, 0x05,
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0xD0, 0x04, 0x6B, 0x65, 0x79,
+    0x73, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x19, 0x06, 0x00, 0x00,
+    0x10, 0xCE, 0x04, 0x6E, 0x6F, 0x74, 0x3D, 0x37, 0x01, 0x00,
+    0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x35,
+    0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04, 0x00,
+    0x05, 0x1F, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05,
+    0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0xDA, 0x2E, 0xD0, 0x05, 0x70, 0x61, 0x69, 0x72, 0x73,
+    0xDA, 0x81, 0x05, 0xDA, 0x82, 0x13, 0xDA, 0x82, 0xB7, 0xDA,
+    0x81, 0x9E, 0xD0, 0x08, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+    0x74, 0x65, 0xDA, 0x81, 0x91, 0xDA, 0x82, 0x61, 0xD0, 0x07,
+    0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0xD0, 0x03, 0x6E,
+    0x65, 0x77, 0xCF, 0x02, 0x6F, 0x72, 0xD7, 0xCD, 0x00, 0x08,
+    0x00, 0x05, 0x02, 0x02, 0x00, 0x02, 0xCE, 0x06, 0x72, 0x65,
+    0x73, 0x75, 0x6D, 0x65, 0x31, 0x00, 0x00, 0x01, 0x03, 0x00,
+    0x00, 0x00, 0xCE, 0x16, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65,
+    0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+    0x76, 0x65, 0x72, 0x62, 0x3A, 0x20, 0x28, 0x02, 0x00, 0x00,
+    0x22, 0x05, 0x00, 0x00, 0x1F, 0x04, 0x05, 0x01, 0x1A, 0x04,
+    0x05, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x38, 0x03, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x03,
+    0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x27, 0x06, 0x00, 0x04,
+    0x41, 0x05, 0x00, 0x06, 0x1A, 0x05, 0x07, 0x00, 0x26, 0x06,
+    0x01, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x27, 0x06, 0x00, 0x01,
+    0x2E, 0x06, 0x00, 0x00, 0x3D, 0x06, 0x00, 0x00, 0x03, 0x06,
+    0x00, 0x00, 0x27, 0x07, 0x00, 0x00, 0x33, 0x07, 0x07, 0x00,
+    0x05, 0x08, 0x00, 0x01, 0x27, 0x09, 0x00, 0x00, 0x33, 0x09,
+    0x09, 0x08, 0x05, 0x0A, 0x00, 0x02, 0x27, 0x0B, 0x00, 0x00,
+    0x33, 0x0B, 0x0B, 0x0A, 0x2B, 0x07, 0x00, 0x00, 0x43, 0x06,
+    0x02, 0x00, 0x1A, 0x06, 0x5C, 0x00, 0x26, 0x0D, 0x03, 0x00,
+    0x1F, 0x0C, 0x07, 0x0D, 0x1A, 0x0C, 0x06, 0x00, 0x2C, 0x04,
+    0x09, 0x00, 0x43, 0x0D, 0x04, 0x00, 0x05, 0x0D, 0x00, 0x02,
+    0x2C, 0x0D, 0x04, 0x00, 0x30, 0x02, 0x00, 0x00, 0x26, 0x0E,
+    0x05, 0x00, 0x1F, 0x0D, 0x07, 0x0E, 0x1A, 0x0D, 0x08, 0x00,
+    0x05, 0x0E, 0x00, 0x02, 0x2C, 0x0E, 0x04, 0x00, 0x2F, 0x0F,
+    0x02, 0x00, 0x26, 0x0E, 0x06, 0x00, 0x2D, 0x0E, 0x09, 0x0F,
+    0x26, 0x0E, 0x07, 0x00, 0x30, 0x0E, 0x00, 0x00, 0x26, 0x0F,
+    0x08, 0x00, 0x1F, 0x0E, 0x07, 0x0F, 0x1A, 0x0E, 0x08, 0x00,
+    0x05, 0x0F, 0x00, 0x02, 0x2C, 0x0F, 0x04, 0x00, 0x2F, 0x10,
+    0x02, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2D, 0x0F, 0x09, 0x10,
+    0x26, 0x0F, 0x07, 0x00, 0x30, 0x0F, 0x00, 0x00, 0x26, 0x10,
+    0x0A, 0x00, 0x1F, 0x0F, 0x07, 0x10, 0x1A, 0x0F, 0x08, 0x00,
+    0x05, 0x10, 0x00, 0x02, 0x2C, 0x10, 0x04, 0x00, 0x2F, 0x11,
+    0x02, 0x00, 0x26, 0x10, 0x01, 0x00, 0x2D, 0x10, 0x09, 0x11,
+    0x26, 0x10, 0x07, 0x00, 0x30, 0x10, 0x00, 0x00, 0x26, 0x11,
+    0x0B, 0x00, 0x1F, 0x10, 0x07, 0x11, 0x1A, 0x10, 0x08, 0x00,
+    0x05, 0x11, 0x00, 0x02, 0x2C, 0x11, 0x04, 0x00, 0x2F, 0x12,
+    0x02, 0x00, 0x26, 0x11, 0x01, 0x00, 0x2D, 0x11, 0x12, 0x09,
+    0x26, 0x11, 0x07, 0x00, 0x30, 0x11, 0x00, 0x00, 0x26, 0x12,
+    0x0C, 0x00, 0x1F, 0x11, 0x07, 0x12, 0x1A, 0x11, 0x25, 0x00,
+    0x43, 0x13, 0x0D, 0x00, 0x43, 0x14, 0x0D, 0x00, 0x26, 0x12,
+    0x0E, 0x00, 0x2D, 0x12, 0x13, 0x14, 0x43, 0x12, 0x07, 0x00,
+    0x26, 0x15, 0x00, 0x00, 0x2C, 0x15, 0x12, 0x00, 0x38, 0x15,
+    0x00, 0x00, 0x05, 0x12, 0x00, 0x02, 0x2C, 0x12, 0x15, 0x00,
+    0x2F, 0x12, 0x02, 0x00, 0x26, 0x16, 0x0F, 0x00, 0x2D, 0x16,
+    0x14, 0x09, 0x43, 0x16, 0x07, 0x00, 0x26, 0x17, 0x10, 0x00,
+    0x25, 0x18, 0x00, 0x00, 0x2D, 0x17, 0x13, 0x18, 0x43, 0x17,
+    0x07, 0x00, 0x2B, 0x15, 0x00, 0x00, 0x43, 0x18, 0x11, 0x00,
+    0x26, 0x19, 0x12, 0x00, 0x25, 0x1A, 0x01, 0x00, 0x2D, 0x19,
+    0x1A, 0x13, 0x43, 0x19, 0x07, 0x00, 0x26, 0x1A, 0x13, 0x00,
+    0x2D, 0x1A, 0x13, 0x19, 0x43, 0x1A, 0x07, 0x00, 0x26, 0x19,
+    0x14, 0x00, 0x2D, 0x19, 0x18, 0x1A, 0x2B, 0x12, 0x00, 0x00,
+    0x43, 0x19, 0x07, 0x00, 0x26, 0x18, 0x01, 0x00, 0x2D, 0x18,
+    0x16, 0x17, 0x2B, 0x19, 0x00, 0x00, 0x26, 0x18, 0x07, 0x00,
+    0x30, 0x18, 0x00, 0x00, 0x26, 0x12, 0x15, 0x00, 0x2C, 0x12,
+    0x07, 0x00, 0x43, 0x12, 0x16, 0x00, 0x01, 0x12, 0x00, 0x00,
+    0x26, 0x0D, 0x17, 0x00, 0x1F, 0x0C, 0x09, 0x0D, 0x1A, 0x0C,
+    0x1C, 0x00, 0x43, 0x0E, 0x0D, 0x00, 0x26, 0x0D, 0x13, 0x00,
+    0x2D, 0x0D, 0x0E, 0x0B, 0x43, 0x0D, 0x07, 0x00, 0x26, 0x0F,
+    0x00, 0x00, 0x2C, 0x0F, 0x0D, 0x00, 0x38, 0x0F, 0x00, 0x00,
+    0x05, 0x0D, 0x00, 0x03, 0x2C, 0x0D, 0x0F, 0x00, 0x2F, 0x0D,
+    0x02, 0x00, 0x26, 0x10, 0x10, 0x00, 0x22, 0x11, 0x00, 0x00,
+    0x2D, 0x10, 0x0E, 0x11, 0x43, 0x10, 0x07, 0x00, 0x2B, 0x0F,
+    0x00, 0x00, 0x43, 0x11, 0x11, 0x00, 0x26, 0x12, 0x0F, 0x00,
+    0x2D, 0x12, 0x07, 0x0E, 0x43, 0x12, 0x07, 0x00, 0x26, 0x13,
+    0x14, 0x00, 0x2D, 0x13, 0x11, 0x12, 0x2B, 0x0D, 0x00, 0x00,
+    0x43, 0x13, 0x07, 0x00, 0x26, 0x11, 0x01, 0x00, 0x2D, 0x11,
+    0x10, 0x13, 0x26, 0x11, 0x07, 0x00, 0x30, 0x11, 0x00, 0x00,
+    0x26, 0x0E, 0x18, 0x00, 0x1F, 0x0D, 0x09, 0x0E, 0x1A, 0x0D,
+    0x2E, 0x00, 0x35, 0x0F, 0x0B, 0x00, 0x35, 0x10, 0x0B, 0x01,
+    0x35, 0x11, 0x0B, 0x02, 0x1A, 0x11, 0x03, 0x00, 0x17, 0x0E,
+    0x11, 0x00, 0x18, 0x02, 0x00, 0x00, 0x25, 0x0E, 0x01, 0x00,
+    0x17, 0x12, 0x0E, 0x00, 0x43, 0x13, 0x0D, 0x00, 0x43, 0x14,
+    0x0D, 0x00, 0x26, 0x0E, 0x0E, 0x00, 0x2D, 0x0E, 0x14, 0x13,
+    0x43, 0x0E, 0x07, 0x00, 0x26, 0x15, 0x00, 0x00, 0x2C, 0x15,
+    0x0E, 0x00, 0x38, 0x15, 0x00, 0x00, 0x05, 0x0E, 0x00, 0x03,
+    0x2C, 0x0E, 0x15, 0x00, 0x2F, 0x0E, 0x02, 0x00, 0x26, 0x16,
+    0x10, 0x00, 0x2D, 0x16, 0x14, 0x0F, 0x43, 0x16, 0x07, 0x00,
+    0x26, 0x17, 0x0F, 0x00, 0x2D, 0x17, 0x13, 0x10, 0x43, 0x17,
+    0x07, 0x00, 0x2B, 0x15, 0x00, 0x00, 0x43, 0x18, 0x11, 0x00,
+    0x26, 0x19, 0x0F, 0x00, 0x2D, 0x19, 0x07, 0x14, 0x43, 0x19,
+    0x07, 0x00, 0x26, 0x1A, 0x12, 0x00, 0x2D, 0x1A, 0x14, 0x12,
+    0x43, 0x1A, 0x07, 0x00, 0x26, 0x1B, 0x13, 0x00, 0x2D, 0x1B,
+    0x14, 0x1A, 0x43, 0x1B, 0x07, 0x00, 0x26, 0x1A, 0x14, 0x00,
+    0x2D, 0x1A, 0x18, 0x19, 0x2C, 0x0E, 0x1B, 0x00, 0x43, 0x1A,
+    0x07, 0x00, 0x26, 0x18, 0x01, 0x00, 0x2D, 0x18, 0x16, 0x17,
+    0x2B, 0x1A, 0x00, 0x00, 0x26, 0x18, 0x07, 0x00, 0x30, 0x18,
+    0x00, 0x00, 0x26, 0x0F, 0x19, 0x00, 0x1F, 0x0E, 0x09, 0x0F,
+    0x1A, 0x0E, 0x2B, 0x00, 0x43, 0x10, 0x0D, 0x00, 0x43, 0x11,
+    0x0D, 0x00, 0x26, 0x0F, 0x1A, 0x00, 0x22, 0x12, 0x00, 0x00,
+    0x2D, 0x0F, 0x12, 0x11, 0x43, 0x0F, 0x07, 0x00, 0x26, 0x12,
+    0x00, 0x00, 0x2C, 0x12, 0x0F, 0x00, 0x38, 0x12, 0x00, 0x00,
+    0x05, 0x0F, 0x00, 0x03, 0x2C, 0x0F, 0x12, 0x00, 0x2F, 0x0F,
+    0x02, 0x00, 0x26, 0x13, 0x0F, 0x00, 0x2D, 0x13, 0x10, 0x0B,
+    0x43, 0x13, 0x07, 0x00, 0x26, 0x14, 0x1B, 0x00, 0x22, 0x15,
+    0x00, 0x00, 0x2D, 0x14, 0x10, 0x15, 0x43, 0x14, 0x07, 0x00,
+    0x26, 0x15, 0x10, 0x00, 0x2D, 0x15, 0x11, 0x14, 0x43, 0x15,
+    0x07, 0x00, 0x2B, 0x12, 0x00, 0x00, 0x43, 0x14, 0x11, 0x00,
+    0x26, 0x16, 0x0F, 0x00, 0x2D, 0x16, 0x07, 0x11, 0x43, 0x16,
+    0x07, 0x00, 0x26, 0x17, 0x1B, 0x00, 0x2D, 0x17, 0x10, 0x11,
+    0x43, 0x17, 0x07, 0x00, 0x26, 0x18, 0x13, 0x00, 0x2D, 0x18,
+    0x11, 0x17, 0x43, 0x18, 0x07, 0x00, 0x26, 0x17, 0x14, 0x00,
+    0x2D, 0x17, 0x14, 0x16, 0x2C, 0x0F, 0x18, 0x00, 0x43, 0x17,
+    0x07, 0x00, 0x26, 0x14, 0x01, 0x00, 0x2D, 0x14, 0x13, 0x15,
+    0x2B, 0x17, 0x00, 0x00, 0x26, 0x14, 0x07, 0x00, 0x30, 0x14,
+    0x00, 0x00, 0x26, 0x10, 0x1C, 0x00, 0x1F, 0x0F, 0x09, 0x10,
+    0x1A, 0x0F, 0x4A, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x43, 0x11,
+    0x1D, 0x00, 0x43, 0x12, 0x0D, 0x00, 0x43, 0x13, 0x0D, 0x00,
+    0x26, 0x10, 0x1A, 0x00, 0x22, 0x14, 0x00, 0x00, 0x2D, 0x10,
+    0x14, 0x13, 0x43, 0x10, 0x07, 0x00, 0x26, 0x14, 0x00, 0x00,
+    0x2C, 0x14, 0x10, 0x00, 0x38, 0x14, 0x00, 0x00, 0x05, 0x10,
+    0x00, 0x03, 0x2C, 0x10, 0x14, 0x00, 0x2F, 0x10, 0x02, 0x00,
+    0x26, 0x15, 0x0F, 0x00, 0x2D, 0x15, 0x12, 0x0B, 0x43, 0x15,
+    0x07, 0x00, 0x26, 0x16, 0x1B, 0x00, 0x22, 0x17, 0x00, 0x00,
+    0x2D, 0x16, 0x12, 0x17, 0x43, 0x16, 0x07, 0x00, 0x26, 0x17,
+    0x10, 0x00, 0x2D, 0x17, 0x13, 0x16, 0x43, 0x17, 0x07, 0x00,
+    0x2B, 0x14, 0x00, 0x00, 0x43, 0x16, 0x11, 0x00, 0x1A, 0x11,
+    0x0B, 0x00, 0x26, 0x19, 0x1E, 0x00, 0x2D, 0x19, 0x12, 0x13,
+    0x43, 0x19, 0x07, 0x00, 0x26, 0x1A, 0x07, 0x00, 0x2D, 0x1A,
+    0x13, 0x19, 0x43, 0x1A, 0x07, 0x00, 0x26, 0x19, 0x0F, 0x00,
+    0x2D, 0x19, 0x07, 0x1A, 0x43, 0x18, 0x07, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x22, 0x18, 0x00, 0x00, 0x1A, 0x11, 0x03, 0x00,
+    0x22, 0x19, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x25, 0x1B,
+    0x00, 0x00, 0x33, 0x1A, 0x07, 0x1B, 0x26, 0x1B, 0x0F, 0x00,
+    0x2D, 0x1B, 0x1A, 0x13, 0x43, 0x19, 0x07, 0x00, 0x1A, 0x11,
+    0x03, 0x00, 0x22, 0x1A, 0x00, 0x00, 0x18, 0x09, 0x00, 0x00,
+    0x25, 0x1C, 0x01, 0x00, 0x33, 0x1B, 0x07, 0x1C, 0x26, 0x1C,
+    0x1E, 0x00, 0x2D, 0x1C, 0x12, 0x13, 0x43, 0x1C, 0x07, 0x00,
+    0x26, 0x1D, 0x0F, 0x00, 0x2D, 0x1D, 0x1B, 0x1C, 0x43, 0x1A,
+    0x07, 0x00, 0x26, 0x1B, 0x1B, 0x00, 0x2D, 0x1B, 0x12, 0x13,
+    0x43, 0x1B, 0x07, 0x00, 0x26, 0x1C, 0x13, 0x00, 0x2D, 0x1C,
+    0x13, 0x1B, 0x43, 0x1C, 0x07, 0x00, 0x26, 0x1B, 0x14, 0x00,
+    0x2D, 0x1B, 0x16, 0x18, 0x2D, 0x19, 0x1A, 0x10, 0x2B, 0x1C,
+    0x00, 0x00, 0x43, 0x1B, 0x07, 0x00, 0x26, 0x16, 0x01, 0x00,
+    0x2D, 0x16, 0x15, 0x17, 0x2B, 0x1B, 0x00, 0x00, 0x26, 0x16,
+    0x07, 0x00, 0x30, 0x16, 0x00, 0x00, 0x26, 0x11, 0x1F, 0x00,
+    0x1F, 0x10, 0x09, 0x11, 0x1A, 0x10, 0x33, 0x00, 0x43, 0x12,
+    0x0D, 0x00, 0x43, 0x13, 0x0D, 0x00, 0x43, 0x14, 0x0D, 0x00,
+    0x26, 0x11, 0x0E, 0x00, 0x2D, 0x11, 0x13, 0x12, 0x43, 0x11,
+    0x07, 0x00, 0x26, 0x15, 0x00, 0x00, 0x2C, 0x15, 0x11, 0x00,
+    0x38, 0x15, 0x00, 0x00, 0x05, 0x11, 0x00, 0x03, 0x2C, 0x11,
+    0x15, 0x00, 0x2F, 0x11, 0x02, 0x00, 0x26, 0x16, 0x0F, 0x00,
+    0x2D, 0x16, 0x14, 0x0B, 0x43, 0x16, 0x07, 0x00, 0x26, 0x17,
+    0x20, 0x00, 0x2C, 0x17, 0x14, 0x00, 0x43, 0x17, 0x07, 0x00,
+    0x26, 0x18, 0x0F, 0x00, 0x2D, 0x18, 0x12, 0x17, 0x43, 0x18,
+    0x07, 0x00, 0x26, 0x17, 0x10, 0x00, 0x25, 0x19, 0x00, 0x00,
+    0x2D, 0x17, 0x13, 0x19, 0x43, 0x17, 0x07, 0x00, 0x25, 0x19,
+    0x00, 0x00, 0x2C, 0x15, 0x19, 0x00, 0x43, 0x19, 0x11, 0x00,
+    0x26, 0x1A, 0x1E, 0x00, 0x2D, 0x1A, 0x14, 0x13, 0x43, 0x1A,
+    0x07, 0x00, 0x26, 0x1B, 0x0F, 0x00, 0x2D, 0x1B, 0x07, 0x1A,
+    0x43, 0x1B, 0x07, 0x00, 0x26, 0x1A, 0x12, 0x00, 0x25, 0x1C,
+    0x01, 0x00, 0x2D, 0x1A, 0x1C, 0x13, 0x43, 0x1A, 0x07, 0x00,
+    0x26, 0x1C, 0x13, 0x00, 0x2D, 0x1C, 0x13, 0x1A, 0x43, 0x1C,
+    0x07, 0x00, 0x26, 0x1A, 0x14, 0x00, 0x2D, 0x1A, 0x19, 0x1B,
+    0x2C, 0x11, 0x1C, 0x00, 0x43, 0x1A, 0x07, 0x00, 0x26, 0x19,
+    0x01, 0x00, 0x2D, 0x19, 0x16, 0x18, 0x2C, 0x17, 0x1A, 0x00,
+    0x26, 0x19, 0x07, 0x00, 0x30, 0x19, 0x00, 0x00, 0x26, 0x12,
+    0x21, 0x00, 0x1F, 0x11, 0x09, 0x12, 0x1A, 0x11, 0x3C, 0x00,
+    0x43, 0x13, 0x0D, 0x00, 0x43, 0x14, 0x0D, 0x00, 0x43, 0x15,
+    0x0D, 0x00, 0x26, 0x12, 0x22, 0x00, 0x2C, 0x12, 0x13, 0x00,
+    0x43, 0x12, 0x07, 0x00, 0x26, 0x16, 0x0F, 0x00, 0x2D, 0x16,
+    0x15, 0x12, 0x43, 0x16, 0x07, 0x00, 0x26, 0x12, 0x23, 0x00,
+    0x26, 0x17, 0x24, 0x00, 0x2D, 0x12, 0x15, 0x17, 0x43, 0x12,
+    0x07, 0x00, 0x26, 0x17, 0x23, 0x00, 0x26, 0x18, 0x25, 0x00,
+    0x2D, 0x17, 0x15, 0x18, 0x43, 0x17, 0x07, 0x00, 0x26, 0x18,
+    0x26, 0x00, 0x2D, 0x18, 0x12, 0x17, 0x43, 0x18, 0x07, 0x00,
+    0x26, 0x12, 0x01, 0x00, 0x2D, 0x12, 0x16, 0x18, 0x43, 0x12,
+    0x07, 0x00, 0x26, 0x15, 0x00, 0x00, 0x2C, 0x15, 0x12, 0x00,
+    0x38, 0x15, 0x00, 0x00, 0x05, 0x12, 0x00, 0x03, 0x2C, 0x12,
+    0x15, 0x00, 0x2F, 0x12, 0x02, 0x00, 0x26, 0x16, 0x0F, 0x00,
+    0x2D, 0x16, 0x13, 0x0B, 0x43, 0x16, 0x07, 0x00, 0x26, 0x17,
+    0x27, 0x00, 0x2C, 0x17, 0x13, 0x00, 0x43, 0x17, 0x07, 0x00,
+    0x26, 0x18, 0x10, 0x00, 0x2D, 0x18, 0x14, 0x17, 0x43, 0x18,
+    0x07, 0x00, 0x25, 0x17, 0x00, 0x00, 0x2C, 0x15, 0x17, 0x00,
+    0x43, 0x17, 0x11, 0x00, 0x26, 0x19, 0x0F, 0x00, 0x2D, 0x19,
+    0x07, 0x14, 0x43, 0x19, 0x07, 0x00, 0x26, 0x1A, 0x27, 0x00,
+    0x2C, 0x1A, 0x13, 0x00, 0x43, 0x1A, 0x07, 0x00, 0x26, 0x1B,
+    0x13, 0x00, 0x2D, 0x1B, 0x14, 0x1A, 0x43, 0x1B, 0x07, 0x00,
+    0x26, 0x1A, 0x14, 0x00, 0x2D, 0x1A, 0x17, 0x19, 0x2C, 0x12,
+    0x1B, 0x00, 0x43, 0x1A, 0x07, 0x00, 0x26, 0x17, 0x01, 0x00,
+    0x2D, 0x17, 0x16, 0x18, 0x2B, 0x1A, 0x00, 0x00, 0x26, 0x17,
+    0x07, 0x00, 0x30, 0x17, 0x00, 0x00, 0x26, 0x12, 0x28, 0x00,
+    0x2C, 0x12, 0x09, 0x00, 0x43, 0x12, 0x16, 0x00, 0x01, 0x12,
+    0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x2D, 0x69, 0x96,
+    0x44, 0xA9, 0xDC, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16,
+    0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF,
+    0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0x0A, 0x09,
+    0xBF, 0xF7, 0x09, 0xBF, 0xF3, 0x96, 0x07, 0xAA, 0x0E, 0x0A,
+    0xBF, 0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF,
+    0xF6, 0x0A, 0xBF, 0xF6, 0x0A, 0x14, 0x4E, 0xBF, 0xB2, 0x4E,
+    0xBF, 0xD1, 0x06, 0xBF, 0xDB, 0x4E, 0xBF, 0xB2, 0x4E, 0xBF,
+    0xEC, 0x06, 0xBF, 0xC0, 0x4E, 0xBF, 0xB2, 0x4E, 0x0E, 0x12,
+    0xBF, 0xEE, 0x12, 0xBF, 0xEA, 0x95, 0x7A, 0xAA, 0xA8, 0x83,
+    0xE6, 0xBC, 0x1A, 0x83, 0xE6, 0xBC, 0x1A, 0x83, 0xE6, 0xBC,
+    0x55, 0x16, 0xBF, 0xEA, 0x16, 0x1E, 0x06, 0xBF, 0xF3, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0x84, 0x83, 0xE6, 0xBC, 0x1A, 0x83,
+    0xE6, 0xBC, 0x1A, 0x83, 0xE6, 0xBC, 0xC2, 0x06, 0xBF, 0xF3,
+    0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xDB, 0x26, 0xBF, 0xDA, 0x26,
+    0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26, 0xBF, 0x4A, 0x83, 0xE6,
+    0xBC, 0x1A, 0x83, 0xE6, 0xBC, 0x1A, 0x83, 0xE6, 0xBC, 0xFB,
+    0x06, 0xBF, 0xF3, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xDC, 0x25,
+    0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF,
+    0x11, 0x83, 0xE6, 0xBC, 0x1A, 0x83, 0xE6, 0xBC, 0x1A, 0x83,
+    0xE6, 0xBD, 0x36, 0x06, 0xBF, 0xF3, 0x14, 0xBF, 0xEC, 0x14,
+    0xBF, 0xDC, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF,
+    0xDB, 0x25, 0xBE, 0xD6, 0x83, 0xE6, 0xBC, 0x1A, 0x83, 0xE6,
+    0xBC, 0x1A, 0x83, 0xE6, 0xBD, 0x6B, 0x06, 0xBF, 0xF3, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xE1, 0x25, 0xBF, 0xDB, 0x25, 0xBF,
+    0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBE, 0x9C, 0x83, 0xE6, 0xBC,
+    0x1A, 0x83, 0xE6, 0xBC, 0x1A, 0x83, 0xE6, 0xBD, 0xB9, 0x07,
+    0x21, 0x07, 0x2C, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11,
+    0xBF, 0xDC, 0x26, 0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26, 0x28,
+    0x06, 0xBF, 0xF3, 0x15, 0xBF, 0xEB, 0x15, 0x41, 0x13, 0xBF,
+    0xED, 0x13, 0xBF, 0xED, 0x13, 0x1F, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0x51, 0x13, 0xBF, 0xED,
+    0x13, 0x38, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xDE, 0x23, 0xBF, 0xDD, 0x23, 0xBF, 0xDD,
+    0x23, 0xBF, 0x72, 0x80, 0xB7, 0xBF, 0x49, 0x80, 0xB7, 0xBF,
+    0x49, 0x80, 0xB7, 0xBF, 0x49, 0x80, 0xB7, 0xBE, 0xBD, 0x81,
+    0x44, 0xBE, 0xBC, 0x81, 0x44, 0xBE, 0xBC, 0x81, 0x44, 0xBE,
+    0xBC, 0x81, 0x44, 0xBE, 0xBC, 0x81, 0x44, 0x16, 0x2E, 0xBF,
+    0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xCB, 0x36, 0x0D, 0x91,
+    0x65, 0xAE, 0x9B, 0x91, 0x65, 0xAE, 0x9B, 0x91, 0x65, 0xAE,
+    0xE1, 0x07, 0x2C, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18,
+    0xBF, 0xD6, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF, 0xD4, 0x2C, 0x2D,
+    0x06, 0xBF, 0xF3, 0x14, 0xBF, 0xEC, 0x14, 0x43, 0x15, 0xBF,
+    0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0x2E, 0x12,
+    0xBF, 0xEE, 0x12, 0x27, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6,
+    0x1A, 0xBF, 0x9F, 0x80, 0x8F, 0xBF, 0x71, 0x80, 0x8F, 0xBF,
+    0x71, 0x80, 0x8F, 0xBF, 0x71, 0x80, 0x8F, 0xBF, 0x13, 0x80,
+    0xEE, 0xBF, 0x12, 0x80, 0xEE, 0xBF, 0x12, 0x80, 0xEE, 0xBF,
+    0x12, 0x80, 0xEE, 0xBE, 0x2B, 0x91, 0x65, 0xAE, 0x9B, 0x91,
+    0x65, 0xAE, 0x9B, 0x91, 0x65, 0xB0, 0x9F, 0x1C, 0xBF, 0xE4,
+    0x1C, 0xBF, 0xE4, 0x1C, 0x20, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF,
+    0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xE8, 0x19, 0x23, 0x07,
+    0x23, 0x07, 0x2A, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15,
+    0xBF, 0xD9, 0x29, 0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29, 0x2B,
+    0x06, 0xBF, 0xF3, 0x14, 0xBF, 0xEC, 0x14, 0x3F, 0x17, 0xBF,
+    0xE9, 0x17, 0xBF, 0xE9, 0x17, 0x1E, 0x16, 0xBF, 0xEA, 0x16,
+    0xBF, 0xEA, 0x16, 0x2C, 0x12, 0xBF, 0xEE, 0x12, 0x25, 0x1A,
+    0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0x62, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xDC, 0x25, 0xBF, 0xDB, 0x25,
+    0xBF, 0xDB, 0x25, 0xBF, 0x2C, 0x80, 0xD5, 0xBF, 0x2B, 0x80,
+    0xD5, 0xBF, 0x2B, 0x80, 0xD5, 0xBF, 0x2B, 0x80, 0xD5, 0xBE,
+    0x9B, 0x81, 0x66, 0xBE, 0x9A, 0x81, 0x66, 0xBE, 0x9A, 0x81,
+    0x66, 0xBE, 0x9A, 0x81, 0x66, 0xBE, 0x9A, 0x81, 0x66, 0xBB,
+    0x65, 0x91, 0x65, 0xAE, 0x9B, 0x91, 0x65, 0xAE, 0x9B, 0x91,
+    0x65, 0xB3, 0x6E, 0x07, 0x22, 0x07, 0x29, 0x15, 0xBF, 0xEB,
+    0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xD9, 0x29,
+    0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29, 0x2A, 0x06, 0xBF, 0xF3,
+    0x14, 0xBF, 0xEC, 0x14, 0x3D, 0x18, 0xBF, 0xE8, 0x18, 0xBF,
+    0xE8, 0x18, 0x2F, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15,
+    0xBF, 0xEB, 0x15, 0xBF, 0xD9, 0x28, 0xBF, 0xD8, 0x28, 0xBF,
+    0xD8, 0x28, 0x2B, 0x12, 0xBF, 0xEE, 0x12, 0x24, 0x1A, 0xBF,
+    0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0x60, 0x17, 0xBF, 0xE9, 0x17,
+    0xBF, 0xE9, 0x17, 0xBF, 0xD7, 0x2A, 0xBF, 0xD6, 0x2A, 0xBF,
+    0xD6, 0x2A, 0xBF, 0x2A, 0x80, 0xD7, 0xBF, 0x29, 0x80, 0xD7,
+    0xBF, 0x29, 0x80, 0xD7, 0xBF, 0x29, 0x80, 0xD7, 0xBE, 0x89,
+    0x81, 0x78, 0xBE, 0x88, 0x81, 0x78, 0xBE, 0x88, 0x81, 0x78,
+    0xBE, 0x88, 0x81, 0x78, 0xBE, 0x88, 0x81, 0x78, 0xB8, 0xF7,
+    0x91, 0x65, 0xAE, 0x9B, 0x91, 0x65, 0xAE, 0x9B, 0x91, 0x65,
+    0xB5, 0xDD, 0x11, 0xBF, 0xEF, 0x11, 0x23, 0x07, 0x23, 0x07,
+    0x2A, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB,
+    0x15, 0xBF, 0xD9, 0x29, 0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29,
+    0x2B, 0x06, 0xBF, 0xF3, 0x14, 0xBF, 0xEC, 0x14, 0x3F, 0x18,
+    0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0x30, 0x15, 0xBF, 0xEB,
+    0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xD9, 0x28,
+    0xBF, 0xD8, 0x28, 0xBF, 0xD8, 0x28, 0x2C, 0x12, 0xBF, 0xEE,
+    0x12, 0x25, 0x6F, 0xBF, 0xE7, 0x16, 0xBF, 0xEA, 0x16, 0xBF,
+    0xEA, 0x16, 0xBF, 0xD7, 0x2A, 0xBF, 0xD6, 0x2A, 0xBF, 0xD6,
+    0x2A, 0xBF, 0xC1, 0x40, 0xBF, 0xC0, 0x40, 0xBF, 0xC0, 0x40,
+    0xBF, 0x92, 0x6F, 0xBF, 0x91, 0x6F, 0x25, 0x30, 0xBF, 0xD0,
+    0x30, 0xBF, 0xD0, 0x30, 0xBF, 0xE9, 0x0F, 0xBF, 0xF1, 0x0F,
+    0xBF, 0xE5, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xDE, 0x22, 0x26,
+    0x42, 0xBF, 0xBE, 0x42, 0xBF, 0xBE, 0x42, 0xBF, 0xD7, 0x0F,
+    0xBF, 0xF1, 0x0F, 0x02, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA,
+    0x16, 0xBF, 0xCD, 0x34, 0xBF, 0xCC, 0x34, 0xBF, 0xCC, 0x34,
+    0x63, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xD7,
+    0x2A, 0xBF, 0xD6, 0x2A, 0xBF, 0xD6, 0x2A, 0xBE, 0x16, 0x81,
+    0xEB, 0xBE, 0x15, 0x81, 0xEB, 0xBE, 0x15, 0x81, 0xEB, 0xBE,
+    0x15, 0x81, 0xEB, 0xBE, 0x15, 0x81, 0xEB, 0xBD, 0x72, 0x82,
+    0x8F, 0xBD, 0x71, 0x82, 0x8F, 0xBD, 0x71, 0x82, 0x8F, 0xBD,
+    0x71, 0x82, 0x8F, 0xBD, 0x71, 0x82, 0x8F, 0xB5, 0x39, 0x91,
+    0x65, 0xAE, 0x9B, 0x91, 0x65, 0xAE, 0x9B, 0x91, 0x65, 0xB9,
+    0x95, 0x07, 0x1D, 0x07, 0x23, 0x07, 0x27, 0x10, 0xBF, 0xF0,
+    0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xDE, 0x24, 0xBF, 0xDC, 0x24,
+    0xBF, 0xDC, 0x24, 0x28, 0x06, 0xBF, 0xF3, 0x14, 0xBF, 0xEC,
+    0x14, 0x39, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0x2C,
+    0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xD9, 0x28,
+    0xBF, 0xD8, 0x28, 0xBF, 0xD8, 0x28, 0x1B, 0x10, 0xBF, 0xF0,
+    0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0x29, 0x14, 0xBF,
+    0xEC, 0x14, 0xBF, 0xEC, 0x14, 0x37, 0x16, 0xBF, 0xEA, 0x16,
+    0xBF, 0xEA, 0x16, 0xBF, 0xD5, 0x2C, 0xBF, 0xD4, 0x2C, 0xBF,
+    0xD4, 0x2C, 0x59, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF3, 0x0D,
+    0xBF, 0xF3, 0x0D, 0xBF, 0xE4, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF,
+    0xE3, 0x1D, 0xBF, 0x29, 0x80, 0xD8, 0xBF, 0x28, 0x80, 0xD8,
+    0xBF, 0x28, 0x80, 0xD8, 0xBF, 0x28, 0x80, 0xD8, 0xBE, 0x60,
+    0x81, 0xA1, 0xBE, 0x5F, 0x81, 0xA1, 0xBE, 0x5F, 0x81, 0xA1,
+    0xBE, 0x5F, 0x81, 0xA1, 0xBE, 0x5F, 0x81, 0xA1, 0xB2, 0x8D,
+    0x91, 0x65, 0xAE, 0x9B, 0x91, 0x65, 0xAE, 0x9B, 0x91, 0x65,
+    0xBC, 0x4C, 0x07, 0x27, 0x07, 0x7B, 0x07, 0x6B, 0x1A, 0xBF,
+    0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xD8, 0x29, 0xBF, 0xD7,
+    0x29, 0xBF, 0xD7, 0x29, 0x38, 0x13, 0xBF, 0xED, 0x13, 0xBF,
+    0xED, 0x13, 0xBF, 0xED, 0x13, 0x02, 0x0F, 0xBF, 0xF1, 0x0F,
+    0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xD1, 0x30, 0xBF,
+    0xD0, 0x30, 0xBF, 0xD0, 0x30, 0xBF, 0x44, 0x80, 0xBD, 0xBF,
+    0x43, 0x80, 0xBD, 0xBF, 0x43, 0x80, 0xBD, 0xBE, 0xB2, 0x81,
+    0x51, 0xBE, 0xAF, 0x81, 0x51, 0xBE, 0xAF, 0x81, 0x51, 0x2B,
+    0x06, 0xBF, 0xF3, 0x14, 0xBF, 0xEC, 0x14, 0x3F, 0x19, 0xBF,
+    0xE7, 0x19, 0xBF, 0xE7, 0x19, 0x34, 0x14, 0xBF, 0xEC, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xD6, 0x2B, 0xBF, 0xD5, 0x2B, 0xBF,
+    0xD5, 0x2B, 0x2C, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14,
+    0x25, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xE2, 0x1E, 0x66, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xD6, 0x2B, 0xBF,
+    0xD5, 0x2B, 0xBF, 0xD5, 0x2B, 0xBF, 0x20, 0x80, 0xE1, 0xBF,
+    0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80, 0xE1, 0xBF, 0x1F, 0x80,
+    0xE1, 0xBE, 0x78, 0x81, 0x89, 0xBE, 0x77, 0x81, 0x89, 0xBE,
+    0x77, 0x81, 0x89, 0xBE, 0x77, 0x81, 0x89, 0xBE, 0x77, 0x81,
+    0x89, 0x16, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF,
+    0xD4, 0x2D, 0xCD, 0x00, 0x00, 0x25, 0x9D, 0x9E, 0x21, 0xA9,
+    0x4E, 0x0C, 0xBF, 0xEB, 0x16, 0x15, 0x0A, 0xBF, 0xF6, 0x0A,
+    0xBF, 0xE9, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0xBF,
+    0xE8, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE4,
+    0x48, 0xBF, 0xDA, 0x25, 0xBF, 0xDB, 0x25, 0x05, 0x96, 0x44,
+    0xA9, 0xBC, 0x96, 0x44, 0x04, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF,
+    0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0x26, 0x04, 0x00, 0x00, 0x2D,
+    0x00, 0x04, 0x01, 0x43, 0x04, 0x01, 0x00, 0x2B, 0x04, 0x00,
+    0x00, 0x2E, 0x02, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x30,
+    0x05, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x46, 0xA9, 0x16, 0xBF,
+    0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xDE, 0x28, 0xBF, 0xD8,
+    0x28, 0xBF, 0xD8, 0x28, 0xBF, 0xD8, 0x28, 0xDA, 0x7F, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x80,
+    0xC4, 0x28, 0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x74, 0x72,
+    0x75, 0x20, 0x66, 0x61, 0x6C, 0x20, 0x26, 0x29, 0x0A, 0x0A,
+    0x4D, 0x61, 0x6B, 0x65, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69,
+    0x70, 0x6C, 0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x66,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+    0x72, 0x75, 0x74, 0x68, 0x79, 0x2C, 0x20, 0x20, 0x65, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x74, 0x72, 0x75, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x65, 0x76, 0x61, 0x6C,
+    0x75, 0x61, 0x74, 0x65, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x61, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20,
+    0x42, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x68,
+    0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+    0x6D, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x20,
+    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x74,
+    0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x48, 0x63, 0xCD,
+    0x00, 0x00, 0x4C, 0x56, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBA,
+    0x00, 0x00, 0x09, 0x03, 0x03, 0x12, 0x01, 0xCE, 0x06, 0x69,
+    0x66, 0x2D, 0x6C, 0x65, 0x74, 0xDA, 0x24, 0xCE, 0x1B, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74,
+    0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x31, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x05, 0x01, 0x01, 0x0A, 0xCE, 0x04, 0x6F, 0x64,
+    0x64, 0x3F, 0xDA, 0x24, 0xDA, 0x82, 0x7A, 0x25, 0x02, 0x02,
+    0x00, 0x2C, 0x00, 0x02, 0x00, 0x43, 0x02, 0x00, 0x00, 0x25,
+    0x04, 0x00, 0x00, 0x1F, 0x03, 0x04, 0x02, 0x19, 0x03, 0x03,
+    0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x87, 0xC3, 0x06,
+    0xBF, 0xFA, 0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xF2, 0x0F, 0xBF,
+    0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1,
+    0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xCE, 0x23, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x73, 0x28, 0x03, 0x00, 0x00, 0x37, 0x04,
+    0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x25, 0x07, 0x00, 0x00,
+    0x42, 0x06, 0x05, 0x07, 0x1A, 0x06, 0x03, 0x00, 0x26, 0x07,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x43, 0x06, 0x01, 0x00, 0x1A, 0x06, 0x03, 0x00, 0x26, 0x07,
+    0x02, 0x00, 0x01, 0x07, 0x00, 0x00, 0x2A, 0x06, 0x00, 0x00,
+    0x17, 0x07, 0x06, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2B, 0x08,
+    0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0xCD, 0x00, 0xDC, 0x00,
+    0x00, 0x0D, 0x01, 0x06, 0x35, 0x01, 0xDA, 0x82, 0x05, 0xDA,
+    0x24, 0xDA, 0x80, 0xC4, 0xDA, 0x60, 0xDA, 0x61, 0xDA, 0x80,
+    0x88, 0xDA, 0x64, 0xDA, 0x65, 0x28, 0x01, 0x00, 0x00, 0x27,
+    0x03, 0x00, 0x00, 0x33, 0x03, 0x03, 0x00, 0x05, 0x04, 0x00,
+    0x01, 0x27, 0x06, 0x00, 0x00, 0x33, 0x04, 0x06, 0x04, 0x27,
+    0x07, 0x00, 0x05, 0x41, 0x06, 0x00, 0x07, 0x1A, 0x06, 0x03,
+    0x00, 0x27, 0x07, 0x00, 0x01, 0x03, 0x07, 0x00, 0x00, 0x2B,
+    0x03, 0x00, 0x00, 0x43, 0x08, 0x00, 0x00, 0x1A, 0x08, 0x03,
+    0x00, 0x17, 0x07, 0x03, 0x00, 0x18, 0x02, 0x00, 0x00, 0x43,
+    0x07, 0x01, 0x00, 0x17, 0x09, 0x07, 0x00, 0x1A, 0x08, 0x0F,
+    0x00, 0x26, 0x07, 0x02, 0x00, 0x2D, 0x07, 0x09, 0x04, 0x43,
+    0x07, 0x03, 0x00, 0x05, 0x0A, 0x00, 0x02, 0x44, 0x0B, 0x0A,
+    0x01, 0x26, 0x0A, 0x04, 0x00, 0x2D, 0x0A, 0x09, 0x0B, 0x27,
+    0x0A, 0x00, 0x02, 0x2B, 0x0A, 0x00, 0x00, 0x43, 0x0A, 0x03,
+    0x00, 0x26, 0x0B, 0x05, 0x00, 0x2D, 0x0B, 0x07, 0x0A, 0x26,
+    0x0B, 0x03, 0x00, 0x30, 0x0B, 0x00, 0x00, 0x26, 0x07, 0x02,
+    0x00, 0x2D, 0x07, 0x09, 0x04, 0x43, 0x07, 0x03, 0x00, 0x26,
+    0x0A, 0x02, 0x00, 0x2D, 0x0A, 0x03, 0x09, 0x43, 0x0A, 0x03,
+    0x00, 0x05, 0x0B, 0x00, 0x02, 0x44, 0x0C, 0x0B, 0x01, 0x26,
+    0x0B, 0x05, 0x00, 0x2D, 0x0B, 0x0A, 0x0C, 0x43, 0x0B, 0x03,
+    0x00, 0x26, 0x0A, 0x04, 0x00, 0x2D, 0x0A, 0x09, 0x0B, 0x27,
+    0x0A, 0x00, 0x02, 0x2B, 0x0A, 0x00, 0x00, 0x43, 0x0A, 0x03,
+    0x00, 0x26, 0x0B, 0x05, 0x00, 0x2D, 0x0B, 0x07, 0x0A, 0x26,
+    0x0B, 0x03, 0x00, 0x30, 0x0B, 0x00, 0x00, 0xBF, 0xFF, 0xCD,
+    0x00, 0x00, 0x49, 0xD2, 0x82, 0x79, 0xBD, 0xA1, 0x0F, 0xBF,
+    0xF1, 0x0F, 0x1D, 0x06, 0xBF, 0xEC, 0x15, 0xBF, 0xEB, 0x15,
+    0x0B, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF3, 0x82, 0x24, 0xBD,
+    0xDC, 0x82, 0x24, 0xBD, 0xDC, 0x82, 0x24, 0xBE, 0x10, 0x0F,
+    0xBF, 0xF1, 0x0F, 0x14, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xF8, 0x07, 0xBF, 0xE5, 0x1D, 0x0A, 0x81, 0xAD,
+    0xBE, 0x9C, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x27,
+    0x06, 0xBF, 0xF5, 0x0C, 0xBF, 0xE5, 0x20, 0xBF, 0xE0, 0x20,
+    0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF,
+    0x9F, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E,
+    0x62, 0x49, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x64,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x26, 0x06, 0xBF,
+    0xF5, 0x0C, 0xBF, 0x97, 0x6A, 0xBF, 0x96, 0x6A, 0xBF, 0x96,
+    0x6A, 0xBF, 0x6F, 0x80, 0xAE, 0xBF, 0x52, 0x80, 0xAE, 0xBF,
+    0x52, 0x80, 0xAE, 0xBF, 0x52, 0x80, 0xAE, 0xBF, 0x52, 0x80,
+    0xAE, 0xBF, 0x11, 0x80, 0xF0, 0xBF, 0x10, 0x80, 0xF0, 0xBF,
+    0x10, 0x80, 0xF0, 0xBF, 0x10, 0x80, 0xF0, 0xCD, 0x00, 0x00,
+    0x48, 0x63, 0x83, 0xF3, 0xBC, 0xEE, 0x10, 0xBF, 0xE7, 0x1A,
+    0x08, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF2, 0x35, 0xBF, 0xDB,
+    0x24, 0xBF, 0xDC, 0x24, 0x09, 0x09, 0xBF, 0xF7, 0x09, 0xBF,
+    0xF3, 0x3C, 0xBF, 0xD3, 0x2C, 0xBF, 0xD4, 0x2C, 0x05, 0x82,
+    0x79, 0xBD, 0x87, 0x82, 0x79, 0x04, 0x06, 0xBF, 0xFA, 0x06,
+    0xBF, 0xFA, 0x06, 0xCF, 0x09, 0x77, 0x69, 0x74, 0x68, 0x2D,
+    0x73, 0x79, 0x6D, 0x73, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C,
+    0xCB, 0xDA, 0x06, 0xCE, 0x65, 0x28, 0x77, 0x69, 0x74, 0x68,
+    0x2D, 0x73, 0x79, 0x6D, 0x73, 0x20, 0x73, 0x79, 0x6D, 0x73,
+    0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A,
+    0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x79, 0x6D, 0x73, 0x20,
+    0x62, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64,
+    0x2C, 0x20, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x20, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x5C, 0x42, 0xCD, 0x00,
+    0x00, 0x5C, 0xF2, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xB9, 0x00,
+    0x00, 0x06, 0x01, 0x02, 0x08, 0x01, 0xCE, 0x09, 0x77, 0x69,
+    0x74, 0x68, 0x2D, 0x73, 0x79, 0x6D, 0x73, 0xDA, 0x24, 0xD7,
+    0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0C, 0x02, 0x01, 0x0D, 0xCE,
+    0x06, 0x6D, 0x61, 0x70, 0x63, 0x61, 0x74, 0xDA, 0x24, 0xDA,
+    0x81, 0x00, 0x38, 0x04, 0x00, 0x00, 0x17, 0x05, 0x01, 0x00,
+    0x37, 0x07, 0x05, 0x00, 0x25, 0x06, 0x00, 0x00, 0x3E, 0x08,
+    0x06, 0x07, 0x1A, 0x08, 0x07, 0x00, 0x33, 0x0A, 0x05, 0x06,
+    0x44, 0x09, 0x0A, 0x00, 0x2C, 0x04, 0x09, 0x00, 0x43, 0x0B,
+    0x00, 0x00, 0x05, 0x06, 0x06, 0x01, 0x18, 0xF9, 0xFF, 0xFF,
+    0x03, 0x04, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x5B, 0xFA, 0x0C,
+    0x04, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xD2,
+    0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xFA, 0x04,
+    0xBF, 0xEA, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xD3, 0x2E, 0xBF,
+    0xD2, 0x2E, 0xBF, 0x38, 0x80, 0xCF, 0xDA, 0x81, 0xEB, 0x2A,
+    0x03, 0x00, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x43, 0x04, 0x00,
+    0x00, 0x26, 0x05, 0x01, 0x00, 0x2C, 0x05, 0x04, 0x00, 0x2E,
+    0x01, 0x00, 0x00, 0x3D, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0xCD, 0x00, 0x94, 0x00, 0x00, 0x02, 0x01, 0x02, 0x06,
+    0xDA, 0x24, 0xDA, 0x60, 0xDA, 0x80, 0x88, 0x26, 0x01, 0x00,
+    0x00, 0x2B, 0x01, 0x00, 0x00, 0x43, 0x01, 0x01, 0x00, 0x2C,
+    0x00, 0x01, 0x00, 0x38, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0x5C, 0xD4, 0x0D, 0xBF, 0xF3, 0x0D,
+    0xBF, 0xF3, 0x0D, 0xBF, 0xE7, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF,
+    0xE5, 0x1B, 0xCD, 0x00, 0x00, 0x5C, 0xC8, 0x1B, 0xBF, 0xD6,
+    0x38, 0xBF, 0xC8, 0x38, 0xBF, 0xC8, 0x38, 0xBF, 0xC8, 0x38,
+    0xBF, 0xC8, 0x38, 0xBF, 0xC8, 0x38, 0xBF, 0xC8, 0x38, 0xCF,
+    0x04, 0x66, 0x69, 0x6E, 0x64, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+    0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x80, 0xF8, 0x28, 0x66, 0x69,
+    0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x64, 0x29, 0x0A, 0x0A, 0x46, 0x69, 0x6E, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x63,
+    0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x61, 0x74, 0x69, 0x73,
+    0x66, 0x69, 0x65, 0x73, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65,
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x20, 0x6E, 0x69, 0x6C,
+    0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F,
+    0x75, 0x6E, 0x64, 0x2E, 0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6E,
+    0x6F, 0x20, 0x77, 0x61, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x64,
+    0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x69, 0x61,
+    0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F,
+    0x75, 0x6E, 0x64, 0x2E, 0x20, 0x43, 0x6F, 0x6E, 0x73, 0x69,
+    0x64, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x2D, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x73, 0x73, 0x75, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x63, 0xDE, 0xCD, 0x00, 0x00,
+    0x65, 0x2E, 0xDA, 0x03, 0xDA, 0x81, 0x47, 0xCF, 0x03, 0x2D,
+    0x3F, 0x3E, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA,
+    0x06, 0xCE, 0x81, 0x2A, 0x28, 0x2D, 0x3F, 0x3E, 0x20, 0x78,
+    0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A,
+    0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x69, 0x72,
+    0x63, 0x75, 0x69, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+    0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20,
+    0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69,
+    0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+    0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x6D,
+    0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6D,
+    0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+    0x20, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69,
+    0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x6D, 0xDB, 0xCD, 0x00, 0x00, 0x70, 0x3C, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0xB9, 0x00, 0x00, 0x06, 0x01, 0x01,
+    0x04, 0x01, 0xCE, 0x03, 0x2D, 0x3F, 0x3E, 0xDA, 0x24, 0xD7,
+    0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0B, 0x03, 0x00, 0x0C, 0xCE,
+    0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0xDA, 0x24, 0x17,
+    0x04, 0x01, 0x00, 0x17, 0x05, 0x02, 0x00, 0x37, 0x07, 0x05,
+    0x00, 0x25, 0x06, 0x00, 0x00, 0x3E, 0x08, 0x06, 0x07, 0x1A,
+    0x08, 0x06, 0x00, 0x33, 0x0A, 0x05, 0x06, 0x2C, 0x04, 0x0A,
+    0x00, 0x2F, 0x04, 0x00, 0x00, 0x05, 0x06, 0x06, 0x01, 0x18,
+    0xFA, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x57, 0x86, 0x0D, 0x04, 0x29, 0xBF, 0xD7, 0x29, 0xBF, 0xD7,
+    0x29, 0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29, 0xBF, 0xD7, 0x29,
+    0xBF, 0xF6, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xD9, 0x29, 0xBF,
+    0xD7, 0x29, 0xBF, 0x18, 0x80, 0xEF, 0x2A, 0x04, 0x00, 0x00,
+    0x2D, 0x04, 0x00, 0x01, 0x26, 0x05, 0x00, 0x00, 0x30, 0x05,
+    0x00, 0x00, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0E, 0x02, 0x09,
+    0x23, 0xCE, 0x03, 0x66, 0x6F, 0x70, 0xDA, 0x24, 0xDA, 0x72,
+    0xDA, 0x7B, 0xD8, 0x0B, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0xDA, 0x80, 0x88, 0xDA, 0x60,
+    0xDA, 0x81, 0x00, 0xDA, 0x7C, 0xDA, 0x64, 0xDA, 0x81, 0xEB,
+    0x2B, 0x01, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x26, 0x06,
+    0x01, 0x00, 0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05, 0x09, 0x00,
+    0x25, 0x06, 0x00, 0x00, 0x33, 0x04, 0x01, 0x06, 0x25, 0x06,
+    0x01, 0x00, 0x2C, 0x01, 0x06, 0x00, 0x43, 0x06, 0x02, 0x00,
+    0x2C, 0x04, 0x06, 0x00, 0x43, 0x03, 0x03, 0x00, 0x18, 0x04,
+    0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x2C, 0x01, 0x04, 0x00,
+    0x43, 0x03, 0x03, 0x00, 0x35, 0x05, 0x03, 0x00, 0x35, 0x06,
+    0x03, 0x01, 0x43, 0x07, 0x04, 0x00, 0x2C, 0x05, 0x07, 0x00,
+    0x38, 0x08, 0x00, 0x00, 0x2C, 0x08, 0x06, 0x00, 0x43, 0x08,
+    0x05, 0x00, 0x2C, 0x07, 0x00, 0x00, 0x3D, 0x0A, 0x00, 0x00,
+    0x25, 0x0B, 0x00, 0x00, 0x2C, 0x08, 0x0B, 0x00, 0x43, 0x0B,
+    0x06, 0x00, 0x26, 0x0D, 0x07, 0x00, 0x2D, 0x0D, 0x07, 0x0B,
+    0x3D, 0x0C, 0x00, 0x00, 0x26, 0x0D, 0x08, 0x00, 0x2D, 0x0D,
+    0x0A, 0x0C, 0x3D, 0x0B, 0x00, 0x00, 0x03, 0x0B, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x6F, 0x4B, 0x07, 0xBF, 0xF9, 0x07, 0xBF,
+    0xEF, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEA, 0x6B, 0xBF, 0xC5,
+    0x08, 0xBF, 0xF8, 0x08, 0x02, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xDF, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xB5,
+    0x6B, 0xBF, 0xF3, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C,
+    0xBF, 0x8B, 0x77, 0xBF, 0x89, 0x77, 0x0F, 0x07, 0x12, 0x18,
+    0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0x07,
+    0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33,
+    0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF,
+    0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD,
+    0x33, 0xBF, 0xCD, 0x33, 0xCD, 0x00, 0x00, 0x6F, 0x1B, 0x81,
+    0x09, 0x04, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF,
+    0x05, 0x74, 0x61, 0x62, 0x6C, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x80, 0x90, 0xDA, 0x06, 0xCE, 0x80, 0xD1, 0x28, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x26, 0x20, 0x6B, 0x76, 0x73,
+    0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20,
+    0x76, 0x61, 0x72, 0x69, 0x61, 0x64, 0x69, 0x63, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x6B, 0x76, 0x73, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65,
+    0x6E, 0x63, 0x65, 0x20, 0x6B, 0x31, 0x2C, 0x20, 0x76, 0x31,
+    0x2C, 0x20, 0x6B, 0x32, 0x2C, 0x20, 0x76, 0x32, 0x2C, 0x20,
+    0x6B, 0x33, 0x2C, 0x20, 0x76, 0x33, 0x2C, 0x20, 0x2E, 0x2E,
+    0x2E, 0x20, 0x49, 0x66, 0x20, 0x6B, 0x76, 0x73, 0x20, 0x68,
+    0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64, 0x64, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20,
+    0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x74, 0x68, 0x72,
+    0x6F, 0x77, 0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x08, 0x62,
+    0x72, 0x75, 0x73, 0x68, 0x69, 0x66, 0x74, 0xD3, 0x02, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x12, 0x06, 0x00, 0x00,
+    0x13, 0xCE, 0x08, 0x62, 0x72, 0x75, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x37, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A,
+    0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25,
+    0x03, 0x01, 0x00, 0x35, 0x04, 0x00, 0x00, 0x14, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25,
+    0x05, 0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x14, 0x03, 0x03,
+    0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A,
+    0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE,
+    0x80, 0xF4, 0x28, 0x62, 0x72, 0x75, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x20, 0x78, 0x20, 0x26, 0x20, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20, 0x62, 0x69,
+    0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x65, 0x64, 0x20,
+    0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x73,
+    0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x61,
+    0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20,
+    0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x20, 0x6F,
+    0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64,
+    0x2C, 0x20, 0x73, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70,
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x20, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x61, 0x6C, 0x77,
+    0x61, 0x79, 0x73, 0x20, 0x62, 0x65, 0x20, 0x70, 0x6F, 0x73,
+    0x69, 0x74, 0x69, 0x76, 0x65, 0x2E, 0xCF, 0x05, 0x73, 0x74,
+    0x64, 0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x66,
+    0xDA, 0x06, 0xCE, 0x18, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74,
+    0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x69, 0x6E, 0x70,
+    0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x0D,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6E, 0x74, 0xDA, 0x06, 0xCE, 0x35, 0x28, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6E, 0x74, 0x6C, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69,
+    0x6E, 0x67, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0xCF,
+    0x08, 0x6F, 0x73, 0x2F, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6F, 0x73, 0x2F, 0x63, 0x6C,
+    0x6F, 0x63, 0x6B, 0xDA, 0x06, 0xCE, 0x80, 0x83, 0x28, 0x6F,
+    0x73, 0x2F, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x73,
+    0x69, 0x6E, 0x63, 0x65, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20,
+    0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x70, 0x6F, 0x69, 0x6E,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2E,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B,
+    0x20, 0x69, 0x73, 0x20, 0x67, 0x75, 0x61, 0x72, 0x61, 0x6E,
+    0x74, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65,
+    0x20, 0x6E, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x63, 0x72, 0x65,
+    0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x72,
+    0x65, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2E, 0xCF,
+    0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0xDA, 0x06, 0xCE, 0x81, 0x4B, 0x28, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x70, 0x72,
+    0x65, 0x73, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0x20, 0x45, 0x61,
+    0x63, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x73, 0x74, 0x65,
+    0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x46, 0x6F,
+    0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x2C,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x27, 0x28, 0x5B, 0x22, 0x27, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x69, 0x64,
+    0x64, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73, 0x69, 0x64, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
+    0x20, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73, 0x20,
+    0x69, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x65, 0x6E, 0x74, 0x68, 0x65, 0x73, 0x65, 0x73, 0x2E, 0x20,
+    0x43, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x75, 0x67, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x61, 0x20, 0x52, 0x45, 0x50, 0x4C, 0x20,
+    0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0x2E, 0xCF, 0x10, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x74, 0x72, 0x61, 0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x81, 0x6A, 0xDA, 0x06, 0xCE, 0x80, 0xD4, 0x28, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x74,
+    0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x20, 0x65, 0x72, 0x72, 0x29, 0x0A, 0x0A, 0x50, 0x72, 0x69,
+    0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x69, 0x63, 0x65,
+    0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+    0x20, 0x65, 0x72, 0x72, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20,
+    0x62, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20, 0x64, 0x6F, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74,
+    0x72, 0x61, 0x63, 0x6B, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61,
+    0x76, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x6E, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0xCF,
+    0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0xDA, 0x06, 0xCE, 0x58, 0x28, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x73,
+    0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67,
+    0x65, 0x72, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2E, 0xCF, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2D,
+    0x61, 0x6C, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x12, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C,
+    0x61, 0x63, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0xDA, 0x06, 0xCE,
+    0x80, 0xA4, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2D, 0x61, 0x6C,
+    0x6C, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x73, 0x75, 0x62,
+    0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x61, 0x6C, 0x6C,
+    0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x20, 0x57,
+    0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x66, 0x20, 0x70,
+    0x61, 0x74, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75,
+    0x6E, 0x64, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77,
+    0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x73, 0x74, 0x72, 0x2E, 0xCF, 0x10, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x63, 0x68, 0x65, 0x63, 0x6B,
+    0x2D, 0x73, 0x65, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x10,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x63, 0x68, 0x65,
+    0x63, 0x6B, 0x2D, 0x73, 0x65, 0x74, 0xDA, 0x06, 0xCE, 0x80,
+    0xAC, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x63,
+    0x68, 0x65, 0x63, 0x6B, 0x2D, 0x73, 0x65, 0x74, 0x20, 0x73,
+    0x65, 0x74, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x73, 0x20, 0x69, 0x66, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x73, 0x6F, 0x6D, 0x65,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x61, 0x70, 0x70,
+    0x65, 0x61, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x74, 0x72,
+    0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x6E, 0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+    0x64, 0x6F, 0x2E, 0xCF, 0x09, 0x70, 0x65, 0x67, 0x2F, 0x6D,
+    0x61, 0x74, 0x63, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09,
+    0x70, 0x65, 0x67, 0x2F, 0x6D, 0x61, 0x74, 0x63, 0x68, 0xDA,
+    0x06, 0xCE, 0x81, 0x19, 0x28, 0x70, 0x65, 0x67, 0x2F, 0x6D,
+    0x61, 0x74, 0x63, 0x68, 0x20, 0x70, 0x65, 0x67, 0x20, 0x74,
+    0x65, 0x78, 0x74, 0x20, 0x5B, 0x2C, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x3D, 0x30, 0x5D, 0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x74,
+    0x63, 0x68, 0x20, 0x61, 0x20, 0x50, 0x61, 0x72, 0x73, 0x69,
+    0x6E, 0x67, 0x20, 0x45, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6F, 0x6E, 0x20, 0x47, 0x72, 0x61, 0x6D, 0x6D, 0x61,
+    0x72, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x66, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x64,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x64,
+    0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x64, 0x65, 0x66,
+    0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x70, 0x65,
+    0x67, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6E,
+    0x74, 0x61, 0x78, 0x20, 0x6F, 0x66, 0x20, 0x50, 0x45, 0x47,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x79,
+    0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x64, 0x65,
+    0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x4C,
+    0x50, 0x65, 0x67, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x68,
+    0x61, 0x76, 0x65, 0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C, 0x61,
+    0x72, 0x20, 0x63, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6C, 0x69,
+    0x74, 0x69, 0x65, 0x73, 0x2E, 0xCF, 0x0B, 0x72, 0x6F, 0x70,
+    0x65, 0x2F, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0B, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x63,
+    0x68, 0x75, 0x6E, 0x6B, 0x73, 0xDA, 0x06, 0xCE, 0x80, 0x85,
+    0x28, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x63, 0x68, 0x75, 0x6E,
+    0x6B, 0x73, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x72,
+    0x6F, 0x70, 0x65, 0x2C, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x68, 0x6F, 0x6C, 0x64, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x6F,
+    0x70, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x2E, 0xCF, 0x11, 0x74, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69,
+    0x65, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x11, 0x74, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x72, 0x6F, 0x70, 0x65,
+    0x72, 0x74, 0x69, 0x65, 0x73, 0xDA, 0x06, 0xCE, 0x46, 0x28,
+    0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x72, 0x6F,
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x70,
+    0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0xCF,
+    0x11, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x77,
+    0x61, 0x70, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x11, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x73, 0x77, 0x61, 0x70, 0x2D, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0xDA, 0x06, 0xCE, 0x80, 0xA1, 0x28, 0x74, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x73, 0x77, 0x61, 0x70, 0x2D, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x20, 0x73, 0x72, 0x63, 0x20, 0x73,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x64, 0x73, 0x74, 0x20,
+    0x64, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x5B, 0x63, 0x6F,
+    0x75, 0x6E, 0x74, 0x3D, 0x31, 0x5D, 0x29, 0x0A, 0x0A, 0x53,
+    0x77, 0x61, 0x70, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x62,
+    0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x73, 0x72, 0x63,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x73, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64,
+    0x73, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x61,
+    0x74, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x64, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x6D, 0x65,
+    0x6D, 0x6F, 0x72, 0x79, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x2E, 0xCF, 0x05, 0x64,
+    0x65, 0x66, 0x6E, 0x2D, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C,
+    0xCB, 0xDA, 0x06, 0xCE, 0x49, 0x28, 0x64, 0x65, 0x66, 0x6E,
+    0x2D, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D,
+    0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69,
+    0x6E, 0x65, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61,
+    0x74, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65,
+    0x78, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0x85, 0x44, 0x85, 0xBE, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x04, 0x01, 0x02,
+    0x05, 0xCE, 0x05, 0x64, 0x65, 0x66, 0x6E, 0x2D, 0xDA, 0x24,
+    0xDA, 0x81, 0x95, 0xD7, 0xCD, 0x00, 0xBB, 0x00, 0x00, 0x17,
+    0x01, 0x0D, 0x30, 0x01, 0xCE, 0x04, 0x64, 0x65, 0x66, 0x6E,
+    0xDA, 0x24, 0xDA, 0x80, 0xD8, 0xCE, 0x01, 0x28, 0xD8, 0x06,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xDA, 0x80, 0xE2, 0xDA,
+    0x80, 0xDE, 0xCE, 0x02, 0x25, 0x70, 0xD8, 0x0D, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x61,
+    0x74, 0xCE, 0x03, 0x29, 0x0A, 0x0A, 0xDA, 0x80, 0xD5, 0xDA,
+    0x2F, 0xDA, 0x7C, 0xDA, 0x80, 0xF3, 0xDA, 0x61, 0x28, 0x02,
+    0x00, 0x00, 0x37, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00,
+    0x38, 0x05, 0x00, 0x00, 0x17, 0x06, 0x05, 0x00, 0x26, 0x07,
+    0x00, 0x00, 0x2A, 0x08, 0x00, 0x00, 0x17, 0x09, 0x08, 0x00,
+    0x25, 0x0B, 0x00, 0x00, 0x44, 0x0A, 0x0B, 0x09, 0x17, 0x0B,
+    0x0A, 0x00, 0x33, 0x0C, 0x01, 0x0B, 0x17, 0x0D, 0x0C, 0x00,
+    0x25, 0x0E, 0x00, 0x00, 0x37, 0x0F, 0x0D, 0x00, 0x17, 0x10,
+    0x0F, 0x00, 0x26, 0x11, 0x01, 0x00, 0x2C, 0x11, 0x00, 0x00,
+    0x43, 0x11, 0x02, 0x00, 0x17, 0x12, 0x11, 0x00, 0x3E, 0x13,
+    0x0E, 0x10, 0x1A, 0x13, 0x0A, 0x00, 0x26, 0x14, 0x03, 0x00,
+    0x2C, 0x12, 0x14, 0x00, 0x43, 0x14, 0x04, 0x00, 0x33, 0x14,
+    0x0D, 0x0E, 0x26, 0x15, 0x05, 0x00, 0x2D, 0x12, 0x15, 0x14,
+    0x43, 0x15, 0x06, 0x00, 0x05, 0x0E, 0x0E, 0x01, 0x18, 0xF6,
+    0xFF, 0xFF, 0x26, 0x13, 0x07, 0x00, 0x2D, 0x12, 0x13, 0x07,
+    0x43, 0x13, 0x08, 0x00, 0x2C, 0x06, 0x13, 0x00, 0x43, 0x14,
+    0x09, 0x00, 0x2C, 0x01, 0x0B, 0x00, 0x43, 0x13, 0x0A, 0x00,
+    0x26, 0x16, 0x0B, 0x00, 0x2C, 0x16, 0x00, 0x00, 0x2E, 0x13,
+    0x00, 0x00, 0x3D, 0x15, 0x00, 0x00, 0x26, 0x16, 0x0C, 0x00,
+    0x2C, 0x16, 0x00, 0x00, 0x2E, 0x06, 0x00, 0x00, 0x2B, 0x15,
+    0x00, 0x00, 0x3D, 0x13, 0x00, 0x00, 0x03, 0x13, 0x00, 0x00,
+    0xCD, 0x00, 0xDC, 0x00, 0x00, 0x08, 0x01, 0x04, 0x18, 0x01,
+    0xCE, 0x05, 0x72, 0x65, 0x63, 0x75, 0x72, 0xDA, 0x24, 0xDA,
+    0x72, 0xDA, 0x7B, 0xD0, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0xDA, 0x2F, 0x28, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00,
+    0x01, 0x33, 0x03, 0x03, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x43,
+    0x04, 0x00, 0x00, 0x26, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x04,
+    0x06, 0x1A, 0x05, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x26,
+    0x07, 0x02, 0x00, 0x1F, 0x06, 0x04, 0x07, 0x1A, 0x06, 0x03,
+    0x00, 0x29, 0x03, 0x00, 0x07, 0x18, 0x04, 0x00, 0x00, 0x27,
+    0x07, 0x00, 0x06, 0x2C, 0x07, 0x03, 0x00, 0x43, 0x07, 0x03,
+    0x00, 0x27, 0x07, 0x00, 0x04, 0x3E, 0x06, 0x00, 0x07, 0x1A,
+    0x06, 0x04, 0x00, 0x05, 0x07, 0x00, 0x01, 0x2B, 0x07, 0x00,
+    0x00, 0x30, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x81, 0x7C, 0x81, 0x0A, 0xBF, 0x0C, 0x11, 0xBF, 0xEF,
+    0x11, 0x11, 0x09, 0xBF, 0xF7, 0x09, 0x0F, 0x0B, 0xBF, 0xF5,
+    0x0B, 0xBF, 0xF1, 0x80, 0xBD, 0xBF, 0x43, 0x80, 0xBD, 0xBF,
+    0x7E, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF0, 0x59, 0xBF, 0xC7,
+    0x0F, 0xBF, 0xD1, 0x59, 0xBF, 0xE6, 0x19, 0xBF, 0xE7, 0x19,
+    0xBF, 0xE7, 0x19, 0x13, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF4,
+    0x1D, 0xBF, 0xF8, 0x06, 0xBF, 0xF3, 0x0E, 0xBF, 0xF2, 0x0E,
+    0xBF, 0xE4, 0x1D, 0x81, 0x07, 0x83, 0x58, 0xBC, 0xCC, 0x0C,
+    0xBF, 0xEB, 0x16, 0x06, 0x12, 0xBF, 0xEE, 0x12, 0x06, 0x0E,
+    0x18, 0x81, 0x0A, 0xBE, 0xE4, 0x81, 0x1D, 0x11, 0x09, 0xBF,
+    0xF7, 0x09, 0xBF, 0xEC, 0x15, 0x10, 0x0F, 0xBF, 0xE7, 0x1A,
+    0x30, 0x0C, 0x12, 0x0C, 0xBF, 0xE8, 0x19, 0x0F, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xE7, 0x1A, 0x0D, 0x0F,
+    0xBF, 0xEA, 0x80, 0x88, 0xBF, 0x96, 0x1B, 0xBF, 0xE5, 0x1B,
+    0xBF, 0xE5, 0x1B, 0x20, 0x0F, 0xBF, 0xD9, 0x28, 0xBF, 0xD8,
+    0x28, 0xBF, 0xD8, 0x28, 0x13, 0x0A, 0xBF, 0x7A, 0x80, 0x88,
+    0x1C, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xD0,
+    0x31, 0xBF, 0xCF, 0x31, 0x42, 0x18, 0xBF, 0xE8, 0x18, 0xBF,
+    0xC5, 0x3D, 0xBF, 0xC3, 0x3D, 0xBF, 0xC3, 0x3D, 0xBF, 0xC3,
+    0x3D, 0xBF, 0xC3, 0x3D, 0xBF, 0xC3, 0x3D, 0xBF, 0xC3, 0x3D,
+    0xBF, 0xC3, 0x3D, 0xBF, 0xC3, 0x3D, 0xBF, 0xC3, 0x3D, 0x26,
+    0x03, 0x00, 0x00, 0x2C, 0x00, 0x03, 0x00, 0x2E, 0x01, 0x00,
+    0x00, 0x26, 0x03, 0x01, 0x00, 0x30, 0x03, 0x00, 0x00, 0x85,
+    0x9F, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xE2,
+    0x1E, 0xBF, 0xE2, 0x1E, 0xCF, 0x04, 0x70, 0x6F, 0x73, 0x3F,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x27, 0x28, 0x70,
+    0x6F, 0x73, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+    0x73, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20,
+    0x74, 0x68, 0x61, 0x6E, 0x20, 0x30, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0x87, 0xFD, 0x88, 0x33, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01, 0x00, 0x03,
+    0xCE, 0x04, 0x70, 0x6F, 0x73, 0x3F, 0xDA, 0x24, 0x25, 0x03,
+    0x00, 0x00, 0x40, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00,
+    0x88, 0x2C, 0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xFA, 0x06, 0xCF,
+    0x08, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x08, 0x64, 0x65, 0x73, 0x63, 0x72,
+    0x69, 0x62, 0x65, 0xDA, 0x06, 0xCE, 0x51, 0x28, 0x64, 0x65,
+    0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x68, 0x75,
+    0x6D, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x2E, 0xCF, 0x07,
+    0x67, 0x63, 0x73, 0x74, 0x61, 0x74, 0x73, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x07, 0x67, 0x63, 0x73, 0x74, 0x61, 0x74, 0x73,
+    0xDA, 0x06, 0xCE, 0x83, 0x76, 0x28, 0x67, 0x63, 0x73, 0x74,
+    0x61, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73,
+    0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63,
+    0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x61,
+    0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x6C, 0x69,
+    0x76, 0x65, 0x2D, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x73,
+    0x20, 0x2D, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x69, 0x76, 0x65,
+    0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6D, 0x65, 0x6D,
+    0x6F, 0x72, 0x79, 0x20, 0x74, 0x79, 0x70, 0x65, 0x0A, 0x09,
+    0x3A, 0x6C, 0x69, 0x76, 0x65, 0x2D, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x20, 0x2D, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79,
+    0x20, 0x6C, 0x69, 0x76, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65,
+    0x63, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63,
+    0x68, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x0A, 0x09, 0x3A, 0x61, 0x6C, 0x6C, 0x6F,
+    0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x2D, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x65, 0x64, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x63,
+    0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A,
+    0x09, 0x3A, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x75,
+    0x73, 0x65, 0x73, 0x0A, 0x09, 0x3A, 0x66, 0x75, 0x6C, 0x6C,
+    0x2D, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C,
+    0x65, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20,
+    0x68, 0x65, 0x61, 0x70, 0x0A, 0x09, 0x3A, 0x70, 0x61, 0x75,
+    0x73, 0x65, 0x2D, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x2D, 0x20,
+    0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x20, 0x73, 0x70, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20,
+    0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x70, 0x61, 0x75, 0x73, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x0A, 0x09,
+    0x3A, 0x6C, 0x61, 0x73, 0x74, 0x2D, 0x70, 0x61, 0x75, 0x73,
+    0x65, 0x20, 0x2D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x73,
+    0x70, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6C,
+    0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61,
+    0x75, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x65, 0x63,
+    0x6F, 0x6E, 0x64, 0x73, 0x0A, 0x09, 0x3A, 0x6D, 0x61, 0x72,
+    0x6B, 0x2D, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x2D, 0x20, 0x74,
+    0x6F, 0x74, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20,
+    0x73, 0x70, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x72, 0x6B,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x65, 0x63,
+    0x6F, 0x6E, 0x64, 0x73, 0x0A, 0x09, 0x3A, 0x73, 0x77, 0x65,
+    0x65, 0x70, 0x2D, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x2D, 0x20,
+    0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x20, 0x73, 0x70, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x77, 0x65,
+    0x65, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x73,
+    0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x0A, 0x09, 0x3A, 0x72,
+    0x6F, 0x6F, 0x74, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x67, 0x63, 0x20,
+    0x72, 0x6F, 0x6F, 0x74, 0x73, 0x0A, 0x09, 0x3A, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x2D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+    0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C,
+    0x0A, 0x0A, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x6C, 0x69, 0x76, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65,
+    0x63, 0x74, 0x73, 0x20, 0x77, 0x61, 0x6C, 0x6B, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20,
+    0x68, 0x65, 0x61, 0x70, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74,
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x73, 0x6C, 0x6F, 0x77,
+    0x20, 0x6F, 0x6E, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20,
+    0x68, 0x65, 0x61, 0x70, 0x73, 0x2E, 0x20, 0x4F, 0x62, 0x6A,
+    0x65, 0x63, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x62, 0x65, 0x63, 0x61, 0x6D, 0x65, 0x20, 0x67, 0x61, 0x72,
+    0x62, 0x61, 0x67, 0x65, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20,
+    0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74,
+    0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x6C, 0x69, 0x76, 0x65,
+    0x2E, 0xCF, 0x03, 0x67, 0x65, 0x74, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x82, 0x13, 0xDA, 0x06, 0xCE, 0x81, 0xB5, 0x28, 0x67,
+    0x65, 0x74, 0x20, 0x64, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x61, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E,
+    0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x73, 0x2C, 0x20, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x73, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x73, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x73, 0x2C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x67, 0x65, 0x74, 0x2E, 0x20,
+    0x4F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2C, 0x20, 0x6E, 0x61,
+    0x6D, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x2C,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20, 0x6D,
+    0x75, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x69, 0x6E,
+    0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x73,
+    0x2E, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20,
+    0x61, 0x6E, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x61, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x65,
+    0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x65,
+    0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+    0x20, 0x42, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6E,
+    0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72,
+    0x65, 0x73, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x61, 0x73, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x67, 0x65, 0x74, 0x20,
+    0x63, 0x61, 0x6C, 0x6C, 0x2E, 0xCF, 0x0B, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0B, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72,
+    0x61, 0x6E, 0x64, 0x6F, 0x6D, 0xDA, 0x06, 0xCE, 0x4D, 0x28,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72, 0x61, 0x6E, 0x64, 0x6F,
+    0x6D, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72,
+    0x6D, 0x6C, 0x79, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69,
+    0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x72, 0x61, 0x6E, 0x64,
+    0x6F, 0x6D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x30, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x31, 0x2E, 0xCF, 0x0A, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x06, 0xCE, 0x6F, 0x28, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20,
+    0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A,
+    0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x2C, 0x20, 0x65, 0x6D, 0x70, 0x74,
+    0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68,
+    0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF,
+    0x0C, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72,
+    0x65, 0x61, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72, 0x65, 0x61,
+    0x6B, 0xDA, 0x06, 0xCE, 0x80, 0xD3, 0x28, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x2F, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20,
+    0x66, 0x75, 0x6E, 0x20, 0x5B, 0x2C, 0x70, 0x63, 0x3D, 0x30,
+    0x5D, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20, 0x61, 0x20,
+    0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65,
+    0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0x20, 0x70, 0x63, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E,
+    0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20,
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x77, 0x68,
+    0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69,
+    0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x2E, 0x20, 0x66, 0x75, 0x6E, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x57, 0x69,
+    0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61,
+    0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65,
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C,
+    0x61, 0x72, 0x67, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x65,
+    0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2E, 0xCF, 0x0B, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x6A, 0x6F, 0x69, 0x6E,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x6A, 0x6F, 0x69, 0x6E, 0xDA, 0x06, 0xCE,
+    0x76, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x6A,
+    0x6F, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20,
+    0x5B, 0x2C, 0x73, 0x65, 0x70, 0x5D, 0x29, 0x0A, 0x0A, 0x4A,
+    0x6F, 0x69, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2C, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x6C, 0x79, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x73, 0x65,
+    0x70, 0x61, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x65, 0x70, 0x2E, 0xCF,
+    0x08, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x6E, 0x65, 0x77, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x08, 0x70, 0x76, 0x65, 0x63, 0x2F,
+    0x6E, 0x65, 0x77, 0xDA, 0x06, 0xCE, 0x81, 0x79, 0x28, 0x70,
+    0x76, 0x65, 0x63, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x26, 0x20,
+    0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x65,
+    0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x76,
+    0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x2E, 0x20, 0x50, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74,
+    0x65, 0x6E, 0x74, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6D, 0x6D, 0x75,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x6B, 0x65,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x62,
+    0x75, 0x74, 0x20, 0x70, 0x75, 0x73, 0x68, 0x69, 0x6E, 0x67,
+    0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F,
+    0x6E, 0x74, 0x6F, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6D, 0x61,
+    0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x20,
+    0x61, 0x6D, 0x6F, 0x72, 0x74, 0x69, 0x7A, 0x65, 0x64, 0x20,
+    0x4F, 0x28, 0x31, 0x29, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67,
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x61, 0x6B, 0x69, 0x6E,
+    0x67, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20,
+    0x74, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x4F, 0x28, 0x6C, 0x6F,
+    0x67, 0x20, 0x6E, 0x29, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2E,
+    0x20, 0x4E, 0x65, 0x77, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F,
+    0x72, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x20, 0x6D,
+    0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x69, 0x72, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F,
+    0x6C, 0x64, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x2E,
+    0x20, 0x55, 0x73, 0x65, 0x20, 0x67, 0x65, 0x74, 0x2C, 0x20,
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x61,
+    0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E,
+    0x74, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6C,
+    0x69, 0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x2E, 0xCF, 0x0C, 0x73, 0x65, 0x74,
+    0x2F, 0x74, 0x6F, 0x2D, 0x61, 0x72, 0x72, 0x61, 0x79, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x73, 0x65, 0x74, 0x2F, 0x74,
+    0x6F, 0x2D, 0x61, 0x72, 0x72, 0x61, 0x79, 0xDA, 0x06, 0xCE,
+    0x57, 0x28, 0x73, 0x65, 0x74, 0x2F, 0x74, 0x6F, 0x2D, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x73, 0x65, 0x74, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x74, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x6E, 0x6F,
+    0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6C, 0x61,
+    0x72, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0xCF, 0x0B,
+    0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x6C, 0x61, 0x73,
+    0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73, 0x6F, 0x72,
+    0x74, 0x65, 0x64, 0x2F, 0x6C, 0x61, 0x73, 0x74, 0xDA, 0x06,
+    0xCE, 0x4B, 0x28, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F,
+    0x6C, 0x61, 0x73, 0x74, 0x20, 0x6D, 0x61, 0x70, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73,
+    0x74, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x6D,
+    0x61, 0x70, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C,
+    0x20, 0x69, 0x66, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x69, 0x73,
+    0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0xCF, 0x0A, 0x76,
+    0x69, 0x65, 0x77, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x76, 0x69, 0x65, 0x77, 0x2F,
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0xDA, 0x06, 0xCE, 0x81, 0xBA,
+    0x28, 0x76, 0x69, 0x65, 0x77, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0x20, 0x78, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x6F, 0x70,
+    0x79, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x78, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x2C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2C, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2C, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x69, 0x65, 0x77,
+    0x2E, 0x20, 0x49, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20,
+    0x77, 0x6F, 0x72, 0x6B, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0x2E, 0x20, 0x56, 0x69, 0x65,
+    0x77, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6C,
+    0x61, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x6F, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x63,
+    0x6F, 0x72, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x41, 0x20, 0x76, 0x69, 0x65,
+    0x77, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20, 0x61, 0x6C, 0x69,
+    0x76, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x65,
+    0x65, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x78, 0x20, 0x69, 0x66, 0x20, 0x78,
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x74,
+    0x6F, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x61, 0x20, 0x76,
+    0x69, 0x65, 0x77, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65,
+    0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x75, 0x73, 0x65, 0x20, 0x69, 0x74, 0x20, 0x61, 0x73, 0x20,
+    0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6B, 0x65,
+    0x79, 0x2E, 0xCF, 0x04, 0x64, 0x65, 0x66, 0x6E, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x54, 0x28,
+    0x64, 0x65, 0x66, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26,
+    0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65,
+    0x66, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x45, 0x71, 0x75,
+    0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F,
+    0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x61, 0x6D, 0x65,
+    0x20, 0x28, 0x66, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+    0x5B, 0x61, 0x72, 0x67, 0x73, 0x5D, 0x20, 0x2E, 0x2E, 0x2E,
+    0x29, 0x29, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0x80, 0x99, 0x84, 0x60, 0xDA, 0x03, 0xDA, 0x83, 0x38, 0xCF,
+    0x02, 0x2B, 0x2B, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB,
+    0xDA, 0x06, 0xCE, 0x22, 0x28, 0x2B, 0x2B, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x49, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72,
+    0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x31, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0x92, 0x97, 0x92, 0xD9, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05, 0x01, 0x02,
+    0x08, 0xCE, 0x02, 0x2B, 0x2B, 0xDA, 0x24, 0xDA, 0x81, 0xA3,
+    0xDA, 0x80, 0xF2, 0x26, 0x03, 0x00, 0x00, 0x25, 0x04, 0x01,
+    0x00, 0x2D, 0x03, 0x00, 0x04, 0x3D, 0x02, 0x00, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x2D, 0x04, 0x00, 0x02, 0x3D, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x92, 0xC5, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF,
+    0x02, 0x2D, 0x2D, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB,
+    0xDA, 0x06, 0xCE, 0x22, 0x28, 0x2D, 0x2D, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x44, 0x65, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72,
+    0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x31, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0x92, 0xDB, 0x93, 0x1D, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05, 0x01, 0x02,
+    0x08, 0xCE, 0x02, 0x2D, 0x2D, 0xDA, 0x24, 0xDA, 0x80, 0x96,
+    0xDA, 0x80, 0xF2, 0x26, 0x03, 0x00, 0x00, 0x25, 0x04, 0x01,
+    0x00, 0x2D, 0x03, 0x00, 0x04, 0x3D, 0x02, 0x00, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x2D, 0x04, 0x00, 0x02, 0x3D, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x93, 0x09, 0x13, 0xBF, 0xED,
+    0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xDA,
+    0x81, 0xEB, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA,
+    0x06, 0xCE, 0x80, 0xAA, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x26, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x73, 0x63, 0x6F, 0x70,
+    0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x69, 0x6E, 0x64,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x2E, 0x20,
+    0x45, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20,
+    0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x20, 0x61, 0x73, 0x73, 0x69,
+    0x67, 0x6E, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x69, 0x66,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x65, 0x66, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x6F, 0x64, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x9B, 0x4A, 0x9D, 0x36, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x99, 0x00, 0x00, 0x0E, 0x01, 0x08, 0x1D, 0xCE, 0x03, 0x6C,
+    0x65, 0x74, 0xDA, 0x24, 0xDA, 0x82, 0xD8, 0xCE, 0x27, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x65, 0x76,
+    0x65, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x65, 0x74, 0xDA, 0x65,
+    0xDA, 0x61, 0xDA, 0x80, 0x88, 0xDA, 0x2F, 0xDA, 0x81, 0x00,
+    0xDA, 0x7C, 0x37, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00,
+    0x43, 0x04, 0x00, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x26, 0x03,
+    0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x37, 0x04, 0x00, 0x00,
+    0x25, 0x05, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2B, 0x06,
+    0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x3E, 0x08, 0x05, 0x04,
+    0x1A, 0x08, 0x0B, 0x00, 0x33, 0x0A, 0x00, 0x05, 0x05, 0x0B,
+    0x05, 0x01, 0x33, 0x0C, 0x00, 0x0B, 0x26, 0x09, 0x03, 0x00,
+    0x2D, 0x09, 0x0A, 0x0C, 0x43, 0x09, 0x04, 0x00, 0x2C, 0x07,
+    0x09, 0x00, 0x43, 0x0D, 0x05, 0x00, 0x05, 0x05, 0x05, 0x02,
+    0x18, 0xF5, 0xFF, 0xFF, 0x2C, 0x07, 0x01, 0x00, 0x43, 0x08,
+    0x06, 0x00, 0x25, 0x09, 0x00, 0x00, 0x2C, 0x07, 0x09, 0x00,
+    0x26, 0x09, 0x07, 0x00, 0x30, 0x09, 0x00, 0x00, 0x9C, 0x12,
+    0x10, 0xBF, 0xEA, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE5, 0x4E,
+    0xBF, 0xCF, 0x30, 0xBF, 0xD0, 0x30, 0x0E, 0x10, 0x05, 0x08,
+    0x04, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0x0B, 0x08,
+    0xBF, 0xF1, 0x68, 0xBF, 0xAD, 0x1D, 0xBF, 0xED, 0x06, 0xBF,
+    0xF0, 0x1D, 0x18, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F,
+    0xBF, 0xDF, 0x22, 0xBF, 0xDE, 0x22, 0x06, 0x07, 0xBF, 0x99,
+    0x68, 0x04, 0x18, 0xBF, 0xE8, 0x18, 0x04, 0x14, 0xBF, 0xEC,
+    0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xCF, 0x04, 0x73,
+    0x6F, 0x72, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x53, 0x28, 0x73, 0x6F, 0x72, 0x74, 0x20, 0x78, 0x73, 0x20,
+    0x5B, 0x2C, 0x20, 0x62, 0x79, 0x5D, 0x29, 0x0A, 0x0A, 0x53,
+    0x6F, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x69, 0x6E, 0x2D, 0x70, 0x6C, 0x61, 0x63,
+    0x65, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x73, 0x20, 0x71, 0x75,
+    0x69, 0x63, 0x6B, 0x2D, 0x73, 0x6F, 0x72, 0x74, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x61, 0x20, 0x73, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73,
+    0x6F, 0x72, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0xCD, 0x00, 0x00, 0x53, 0x9E, 0xCD, 0x00, 0x00, 0x56,
+    0x5F, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xD8, 0x00, 0x00, 0x06,
+    0x02, 0x01, 0x0B, 0x01, 0xCE, 0x04, 0x73, 0x6F, 0x72, 0x74,
+    0xDA, 0x24, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x15, 0x06, 0x00,
+    0x00, 0x10, 0xCE, 0x06, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C,
+    0x37, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02,
+    0x0A, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00,
+    0x33, 0x04, 0x00, 0x05, 0x1D, 0x02, 0x03, 0x04, 0x1A, 0x02,
+    0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00,
+    0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0x05, 0x04,
+    0x03, 0xFF, 0x1A, 0x01, 0x03, 0x00, 0x17, 0x03, 0x01, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x00, 0x00, 0x2D, 0x00, 0x05, 0x04, 0x2B, 0x03, 0x00, 0x00,
+    0x27, 0x05, 0x00, 0x02, 0x30, 0x05, 0x00, 0x00, 0xBF, 0xFF,
+    0xCD, 0x00, 0x00, 0x56, 0x40, 0x09, 0xBF, 0xF4, 0x0F, 0x02,
+    0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF3, 0x0D,
+    0xBF, 0xD3, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF,
+    0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0x00, 0x05, 0xDA, 0x83, 0x8E,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x10, 0x04, 0x00, 0x15,
+    0xCE, 0x09, 0x70, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0xDA, 0x24, 0x33, 0x06, 0x00, 0x02, 0x17, 0x07, 0x01,
+    0x00, 0x17, 0x08, 0x01, 0x00, 0x17, 0x09, 0x02, 0x00, 0x3E,
+    0x0A, 0x08, 0x09, 0x1A, 0x0A, 0x0C, 0x00, 0x17, 0x0B, 0x08,
+    0x00, 0x33, 0x0D, 0x00, 0x0B, 0x2C, 0x0D, 0x06, 0x00, 0x2F,
+    0x0C, 0x03, 0x00, 0x1A, 0x0C, 0x05, 0x00, 0x33, 0x0F, 0x00,
+    0x07, 0x34, 0x00, 0x07, 0x0D, 0x34, 0x00, 0x0B, 0x0F, 0x05,
+    0x07, 0x07, 0x01, 0x05, 0x08, 0x08, 0x01, 0x18, 0xF4, 0xFF,
+    0xFF, 0x33, 0x08, 0x00, 0x07, 0x34, 0x00, 0x02, 0x08, 0x34,
+    0x00, 0x07, 0x06, 0x03, 0x07, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x54, 0x41, 0x09, 0x09, 0x09, 0x08, 0x80, 0xB0, 0xBF, 0x50,
+    0x80, 0xB0, 0xBF, 0x50, 0x80, 0xB0, 0xBF, 0x50, 0x80, 0xB0,
+    0xBF, 0x50, 0x80, 0xB0, 0xBF, 0x79, 0x08, 0x11, 0x0C, 0xBF,
+    0xF4, 0x0C, 0xBF, 0xEE, 0x73, 0xBF, 0xB3, 0x08, 0x0D, 0x0D,
+    0x0C, 0x0D, 0x0C, 0x05, 0xBF, 0x52, 0x80, 0xB0, 0xBF, 0x50,
+    0x80, 0xB0, 0x14, 0x08, 0xBF, 0xEC, 0x15, 0x08, 0x10, 0xBE,
+    0xC4, 0x81, 0x45, 0xD7, 0xCD, 0x00, 0xDC, 0x00, 0x00, 0x09,
+    0x04, 0x00, 0x11, 0x01, 0xCE, 0x09, 0x73, 0x6F, 0x72, 0x74,
+    0x2D, 0x68, 0x65, 0x6C, 0x70, 0xDA, 0x24, 0x28, 0x04, 0x00,
+    0x00, 0x40, 0x05, 0x02, 0x01, 0x1A, 0x05, 0x0E, 0x00, 0x2D,
+    0x00, 0x01, 0x02, 0x2B, 0x03, 0x00, 0x00, 0x27, 0x07, 0x00,
+    0x01, 0x2F, 0x07, 0x07, 0x00, 0x05, 0x06, 0x07, 0xFF, 0x2D,
+    0x00, 0x01, 0x06, 0x2B, 0x03, 0x00, 0x00, 0x2F, 0x08, 0x04,
+    0x00, 0x05, 0x06, 0x07, 0x01, 0x2D, 0x00, 0x06, 0x02, 0x2B,
+    0x03, 0x00, 0x00, 0x2F, 0x08, 0x04, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00,
+    0x55, 0x59, 0x80, 0xB6, 0xBF, 0x79, 0x08, 0xBF, 0xF2, 0x80,
+    0x84, 0xBF, 0x9D, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15,
+    0xBF, 0xEB, 0x15, 0x1B, 0x08, 0xBF, 0xE8, 0x1C, 0xBF, 0xE4,
+    0x1C, 0xBF, 0xE4, 0x1C, 0x17, 0x08, 0xBF, 0xEB, 0x1C, 0xBF,
+    0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0x7D, 0x80, 0x84, 0xBF,
+    0x53, 0x80, 0xB6, 0xDB, 0x01, 0xDA, 0x83, 0x87, 0xDA, 0x03,
+    0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E,
+    0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x74, 0x61, 0x6E, 0x68, 0xDA, 0x06, 0xCE, 0x32,
+    0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E, 0x68,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x79, 0x70, 0x65,
+    0x72, 0x62, 0x6F, 0x6C, 0x69, 0x63, 0x20, 0x74, 0x61, 0x6E,
+    0x67, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E,
+    0xCF, 0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66,
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x6F,
+    0x72, 0x6D, 0x61, 0x74, 0xDA, 0x06, 0xCE, 0x75, 0x28, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x6F, 0x72, 0x6D,
+    0x61, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20,
+    0x26, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A,
+    0x0A, 0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74,
+    0x6F, 0x20, 0x73, 0x6E, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66,
+    0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63,
+    0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6E,
+    0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2E, 0xCF, 0x0B, 0x70, 0x76, 0x65,
+    0x63, 0x2F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0B, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x63,
+    0x6F, 0x6E, 0x63, 0x61, 0x74, 0xDA, 0x06, 0xCE, 0x80, 0x9C,
+    0x28, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x63, 0x6F, 0x6E, 0x63,
+    0x61, 0x74, 0x20, 0x76, 0x65, 0x63, 0x20, 0x26, 0x20, 0x70,
+    0x61, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E,
+    0x74, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61,
+    0x63, 0x68, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+    0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x6F, 0x72, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69,
+    0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x65, 0x63, 0x74,
+    0x6F, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74,
+    0x73, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F,
+    0x66, 0x20, 0x76, 0x65, 0x63, 0x2E, 0xCF, 0x0D, 0x74, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+    0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x74, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+    0xDA, 0x06, 0xCE, 0x45, 0x28, 0x74, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x28,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x7C, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x29, 0x20, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x73, 0x69,
+    0x7A, 0x65, 0x2E, 0xCF, 0x09, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x3A, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x63,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8A, 0x2B, 0x8A,
+    0x85, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05,
+    0x01, 0x02, 0x05, 0xCE, 0x09, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x81,
+    0x80, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00,
+    0x00, 0x8A, 0x72, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x15,
+    0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xDA, 0x82, 0x0D, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x2E, 0x28, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0x8D, 0x2A, 0x8D, 0x98, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x07, 0x01, 0x03, 0x0A, 0xCE, 0x08, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0xDA, 0x24, 0xDA, 0x72,
+    0xDA, 0x78, 0xDA, 0x7B, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x1F, 0x04, 0x03, 0x05,
+    0x1A, 0x04, 0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x03, 0x05,
+    0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x1F, 0x05, 0x03, 0x06,
+    0x03, 0x05, 0x00, 0x00, 0x8D, 0x69, 0x07, 0xBF, 0xF9, 0x07,
+    0x09, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF1, 0x22, 0xBF, 0xDE,
+    0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xF4, 0x0B, 0xBF, 0xF5, 0x0B,
+    0xBF, 0xF5, 0x0B, 0xCF, 0x06, 0x65, 0x6D, 0x70, 0x74, 0x79,
+    0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x22, 0x28,
+    0x65, 0x6D, 0x70, 0x74, 0x79, 0x3F, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70,
+    0x74, 0x79, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0x8E, 0x30, 0x8E, 0x6B, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x05, 0x01, 0x00, 0x04, 0xCE, 0x06, 0x65, 0x6D,
+    0x70, 0x74, 0x79, 0x3F, 0xDA, 0x24, 0x37, 0x02, 0x00, 0x00,
+    0x25, 0x04, 0x00, 0x00, 0x1F, 0x03, 0x04, 0x02, 0x03, 0x03,
+    0x00, 0x00, 0x8E, 0x5F, 0x0A, 0xBF, 0xF1, 0x10, 0xBF, 0xF0,
+    0x10, 0xBF, 0xF0, 0x10, 0xCF, 0x02, 0x2D, 0x3D, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x24, 0x28,
+    0x2D, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x44,
+    0x65, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x20,
+    0x62, 0x79, 0x20, 0x6E, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0x93, 0x65, 0x93, 0xA9, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x06, 0x02, 0x02, 0x07, 0xCE, 0x02,
+    0x2D, 0x3D, 0xDA, 0x24, 0xDA, 0x80, 0x96, 0xDA, 0x80, 0xF2,
+    0x26, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x01, 0x3D, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x03,
+    0x3D, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x93, 0x95,
+    0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF,
+    0x06, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x3C, 0x28, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x73,
+    0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x81, 0xB2, 0xCD, 0x00, 0x00,
+    0x82, 0x86, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x09, 0x01, 0x03, 0x14, 0xCE, 0x06, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0xDA, 0x24, 0xDA, 0x14, 0xDA, 0x2E, 0xDA, 0x2F,
+    0x37, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x43, 0x02,
+    0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x2C, 0x00, 0x04, 0x00,
+    0x43, 0x05, 0x01, 0x00, 0x22, 0x07, 0x00, 0x00, 0x1F, 0x06,
+    0x07, 0x05, 0x19, 0x06, 0x03, 0x00, 0x23, 0x06, 0x00, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x1A, 0x06,
+    0x07, 0x00, 0x33, 0x07, 0x00, 0x05, 0x2C, 0x02, 0x07, 0x00,
+    0x43, 0x08, 0x02, 0x00, 0x2C, 0x00, 0x05, 0x00, 0x43, 0x05,
+    0x01, 0x00, 0x18, 0xF4, 0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x82, 0x10, 0x09, 0xBF, 0xEC, 0x15, 0xBF,
+    0xEB, 0x15, 0x0C, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B,
+    0x0C, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5,
+    0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xEE, 0x49,
+    0xBF, 0xDF, 0x08, 0xBF, 0xE8, 0x19, 0xBF, 0xE7, 0x19, 0x0D,
+    0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xB9, 0x49, 0xBF, 0x33, 0x80,
+    0xD4, 0xCF, 0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x50, 0x28, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x29, 0x0A,
+    0x0A, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72,
+    0x73, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x6B, 0x65,
+    0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0xBF, 0xA1, 0xCD, 0x00, 0x00, 0xC0, 0x22, 0xDA, 0x03,
+    0xDA, 0x81, 0x8F, 0xCF, 0x0C, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2F, 0x72, 0x61, 0x77, 0x67, 0x65, 0x74, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x72,
+    0x61, 0x77, 0x67, 0x65, 0x74, 0xDA, 0x06, 0xCE, 0x80, 0xE2,
+    0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x72, 0x61, 0x77,
+    0x67, 0x65, 0x74, 0x20, 0x74, 0x61, 0x62, 0x20, 0x6B, 0x65,
+    0x79, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x61,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x6C, 0x6F,
+    0x6F, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79,
+    0x70, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x74, 0x61, 0x62, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
+    0x6E, 0x20, 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+    0x6C, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E,
+    0x69, 0x6C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74,
+    0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74,
+    0x79, 0x70, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x07, 0x6F, 0x73,
+    0x2F, 0x65, 0x78, 0x69, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x81, 0x93, 0xDA, 0x06, 0xCE, 0x7C, 0x28, 0x6F, 0x73, 0x2F,
+    0x65, 0x78, 0x69, 0x74, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x45,
+    0x78, 0x69, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x61, 0x6E, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 0x63, 0x6F,
+    0x64, 0x65, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74,
+    0x6F, 0x20, 0x78, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x20,
+    0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6E, 0x20,
+    0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2C, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x68, 0x61, 0x73, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E,
+    0xCF, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73,
+    0x6C, 0x69, 0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x6C, 0x69,
+    0x63, 0x65, 0xDA, 0x06, 0xCE, 0x81, 0x12, 0x28, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x5B, 0x2C, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x3D, 0x30, 0x20, 0x5B, 0x2C, 0x65,
+    0x6E, 0x64, 0x3D, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+    0x20, 0x73, 0x74, 0x72, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C,
+    0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x65,
+    0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2E, 0x20,
+    0x41, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x30, 0x2E, 0x20, 0x27, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x27, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x27, 0x65, 0x6E, 0x64,
+    0x27, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F,
+    0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2E, 0xCF, 0x0A, 0x65, 0x6E, 0x76, 0x2D, 0x6C, 0x6F, 0x6F,
+    0x6B, 0x75, 0x70, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x8D,
+    0xDA, 0x06, 0xCE, 0x80, 0xC0, 0x28, 0x65, 0x6E, 0x76, 0x2D,
+    0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x65, 0x6E, 0x76,
+    0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x77, 0x61, 0x72, 0x64,
+    0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x6E,
+    0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x20, 0x54, 0x6F, 0x20, 0x63, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72,
+    0x73, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x75, 0x73, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72,
+    0x74, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x74, 0x6F, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x0E, 0x70,
+    0x6D, 0x61, 0x70, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x70,
+    0x6D, 0x61, 0x70, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0xDA, 0x06, 0xCE, 0x3F, 0x28, 0x70, 0x6D,
+    0x61, 0x70, 0x2F, 0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x20, 0x6D, 0x61, 0x70, 0x29, 0x0A, 0x0A, 0x43,
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x61, 0x20, 0x70,
+    0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20,
+    0x6D, 0x61, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E,
+    0xCF, 0x02, 0x2F, 0x3D, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C,
+    0xCB, 0xDA, 0x06, 0xCE, 0x28, 0x28, 0x2F, 0x3D, 0x20, 0x78,
+    0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74,
+    0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28,
+    0x73, 0x65, 0x74, 0x20, 0x78, 0x20, 0x28, 0x2F, 0x20, 0x78,
+    0x20, 0x6E, 0x29, 0x29, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0x93, 0xF5, 0x94, 0x3D, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x06, 0x02, 0x02, 0x07, 0xCE, 0x02,
+    0x2F, 0x3D, 0xDA, 0x24, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x0C,
+    0x06, 0x00, 0x00, 0x13, 0xDA, 0x81, 0x22, 0x37, 0x01, 0x00,
+    0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25,
+    0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01,
+    0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x01, 0x00, 0x35,
+    0x04, 0x00, 0x00, 0x0B, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00,
+    0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x33,
+    0x04, 0x00, 0x05, 0x0B, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05,
+    0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03,
+    0x03, 0x00, 0x00, 0xDA, 0x80, 0xF2, 0x26, 0x04, 0x00, 0x00,
+    0x2D, 0x04, 0x00, 0x01, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x2D, 0x05, 0x00, 0x03, 0x3D, 0x04, 0x00, 0x00,
+    0x03, 0x04, 0x00, 0x00, 0x94, 0x29, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF,
+    0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF, 0x05, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x41,
+    0x28, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x52, 0xAF, 0xCD, 0x00, 0x00,
+    0x53, 0x08, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x04, 0x01, 0x00, 0x03, 0xCE, 0x05, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0xDA, 0x24, 0x25, 0x03, 0x00, 0x00, 0x33, 0x02, 0x00,
+    0x03, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x52, 0xFE,
+    0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF7, 0x09, 0xCF, 0x0A, 0x64,
+    0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x42,
+    0x28, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C,
+    0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64,
+    0x29, 0x0A, 0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73,
+    0x20, 0x28, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74,
+    0x69, 0x6C, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65, 0x64, 0x29,
+    0x20, 0x69, 0x6E, 0x64, 0x29, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x67, 0x9E, 0xCD, 0x00,
+    0x00, 0x68, 0x1A, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00,
+    0x00, 0x05, 0x02, 0x02, 0x05, 0xCE, 0x0A, 0x64, 0x72, 0x6F,
+    0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xDA, 0x24, 0xD7,
+    0xCD, 0x00, 0xBE, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+    0xCE, 0x0A, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0xDA, 0x24, 0x28, 0x01, 0x00, 0x00, 0x2A, 0x02,
+    0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00, 0xD4, 0x00,
+    0x00, 0x03, 0x01, 0x01, 0x05, 0x01, 0xDA, 0x24, 0xDA, 0x80,
+    0xC3, 0x27, 0x02, 0x00, 0x00, 0x44, 0x01, 0x00, 0x02, 0x2B,
+    0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x30, 0x02, 0x00,
+    0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x4F, 0x65, 0x04, 0xBF,
+    0xFC, 0x04, 0xBF, 0xF7, 0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xF6,
+    0x0A, 0xCD, 0x00, 0x00, 0x4F, 0x00, 0x6C, 0xBF, 0xEC, 0x13,
+    0xBF, 0xED, 0x13, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x06,
+    0x02, 0x02, 0x05, 0xCE, 0x0A, 0x64, 0x72, 0x6F, 0x70, 0x2D,
+    0x75, 0x6E, 0x74, 0x69, 0x6C, 0xDA, 0x24, 0xDA, 0x27, 0xDA,
+    0x82, 0xF2, 0x2C, 0x00, 0x01, 0x00, 0x43, 0x04, 0x00, 0x00,
+    0x2C, 0x01, 0x04, 0x00, 0x26, 0x05, 0x01, 0x00, 0x30, 0x05,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x67, 0x6F, 0x14, 0xBF, 0xEC,
+    0x14, 0x05, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x2B,
+    0x00, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x01,
+    0x00, 0x26, 0x04, 0x01, 0x00, 0x30, 0x04, 0x00, 0x00, 0xCD,
+    0x00, 0x00, 0x68, 0x04, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xE4,
+    0x21, 0xBF, 0xDF, 0x21, 0xBF, 0xDF, 0x21, 0xCF, 0x08, 0x70,
+    0x6F, 0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x65, 0x28, 0x70, 0x6F, 0x73, 0x74,
+    0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x29, 0x0A, 0x0A, 0x44, 0x6F, 0x20, 0x61, 0x20, 0x70,
+    0x6F, 0x73, 0x74, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
+    0x74, 0x72, 0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x28,
+    0x66, 0x20, 0x78, 0x29, 0x20, 0x20, 0x6F, 0x6E, 0x20, 0x65,
+    0x76, 0x65, 0x72, 0x79, 0x20, 0x76, 0x69, 0x73, 0x69, 0x74,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x75, 0x2B, 0xCD, 0x00,
+    0x00, 0x75, 0xC6, 0xDA, 0x03, 0xDA, 0x7E, 0xCF, 0x04, 0x73,
+    0x6F, 0x6D, 0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x21, 0xCB,
+    0xDA, 0x06, 0xCE, 0x61, 0x28, 0x73, 0x6F, 0x6D, 0x65, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x66, 0x61,
+    0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C,
+    0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x61,
+    0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C,
+    0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+    0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0xA8, 0x6B, 0xCD, 0x00, 0x00, 0xA9, 0x3E, 0xDA, 0x03,
+    0xDA, 0x81, 0x12, 0xCF, 0x07, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x3E, 0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09,
+    0x00, 0x16, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x07, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x3E, 0x3D, 0x37, 0x01, 0x00, 0x00, 0x1E,
+    0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x35, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x1D,
+    0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05,
+    0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A,
+    0x02, 0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x06, 0xCE, 0x6C, 0x28, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E,
+    0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E,
+    0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20,
+    0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E,
+    0x2E, 0xCF, 0x0B, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x2F, 0x62,
+    0x75, 0x69, 0x6C, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xCE, 0x07,
+    0x61, 0x30, 0x36, 0x36, 0x39, 0x32, 0x66, 0xDA, 0x06, 0xCE,
+    0x32, 0x54, 0x68, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64,
+    0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D,
+    0x2E, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x70, 0x6F,
+    0x77, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x70, 0x6F, 0x77, 0xDA, 0x06, 0xCE, 0x2B, 0x28,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x70, 0x6F, 0x77, 0x20, 0x61,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+    0x78, 0x2E, 0xCF, 0x12, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80, 0xDE, 0xDA,
+    0x06, 0xCE, 0x80, 0xD6, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x50, 0x75, 0x73,
+    0x68, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x6F, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x4E, 0x6F, 0x6E,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x62, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65,
+    0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x75, 0x73,
+    0x68, 0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64,
+    0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74,
+    0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x76,
+    0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x73, 0x2E, 0xCF, 0x0A,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x77, 0xDA, 0x06, 0xCE,
+    0x80, 0x91, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F,
+    0x6E, 0x65, 0x77, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x6F,
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x20, 0x50, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73,
+    0x74, 0x61, 0x74, 0x65, 0x20, 0x6D, 0x61, 0x63, 0x68, 0x69,
+    0x6E, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x20,
+    0x6F, 0x66, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0xCF, 0x0B, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0xDA, 0x06, 0xCE,
+    0x80, 0xA8, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x66, 0x69, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20,
+    0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x61, 0x72,
+    0x63, 0x68, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x69,
+    0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x70,
+    0x61, 0x74, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20,
+    0x69, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x66,
+    0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+    0xCF, 0x0D, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x74, 0x6F, 0x2D,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0D, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x74, 0x6F, 0x2D, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0xDA, 0x06, 0xCE, 0x40, 0x28, 0x70,
+    0x76, 0x65, 0x63, 0x2F, 0x74, 0x6F, 0x2D, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x76, 0x65, 0x63, 0x29, 0x0A, 0x0A, 0x43,
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x61, 0x20, 0x70,
+    0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20,
+    0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x74, 0x6F, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0xCF, 0x0D, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64,
+    0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0D, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F,
+    0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0xDA, 0x06, 0xCE, 0x49,
+    0x28, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x72, 0x65,
+    0x6D, 0x6F, 0x76, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x6B,
+    0x65, 0x79, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76,
+    0x65, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x61, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x65,
+    0x64, 0x20, 0x6D, 0x61, 0x70, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x61, 0x70, 0x2E, 0xCF, 0x02, 0x2A, 0x3D, 0xD4, 0x02, 0xD3,
+    0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x28, 0x28, 0x2A,
+    0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x53, 0x68,
+    0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x78, 0x20, 0x28,
+    0x2A, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x29, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0x93, 0xAB, 0x93, 0xF3, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x06, 0x02, 0x02,
+    0x07, 0xCE, 0x02, 0x2A, 0x3D, 0xDA, 0x24, 0xDA, 0x82, 0x19,
+    0xDA, 0x80, 0xF2, 0x26, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x00,
+    0x01, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D,
+    0x05, 0x00, 0x03, 0x3D, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00,
+    0x00, 0x93, 0xDF, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xBF,
+    0xED, 0x13, 0xDA, 0x82, 0xCB, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+    0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x6F, 0x28, 0x6F, 0x72, 0x20,
+    0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A,
+    0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x72,
+    0x65, 0x63, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x20, 0x65,
+    0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x23, 0xEF, 0xCD,
+    0x00, 0x00, 0x25, 0x9A, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99,
+    0x00, 0x00, 0x0D, 0x00, 0x06, 0x1C, 0xCE, 0x02, 0x6F, 0x72,
+    0xDA, 0x24, 0xDA, 0x80, 0xC4, 0xDA, 0x64, 0xDA, 0x80, 0x88,
+    0xDA, 0x60, 0xDA, 0x61, 0xDA, 0x65, 0x22, 0x02, 0x00, 0x00,
+    0x37, 0x05, 0x00, 0x00, 0x25, 0x07, 0x00, 0x00, 0x40, 0x06,
+    0x05, 0x07, 0x1A, 0x06, 0x17, 0x00, 0x05, 0x05, 0x05, 0xFF,
+    0x33, 0x08, 0x00, 0x05, 0x2B, 0x08, 0x00, 0x00, 0x43, 0x07,
+    0x00, 0x00, 0x1A, 0x07, 0x06, 0x00, 0x26, 0x09, 0x01, 0x00,
+    0x2D, 0x09, 0x08, 0x08, 0x2B, 0x02, 0x00, 0x00, 0x43, 0x02,
+    0x02, 0x00, 0x18, 0xF4, 0xFF, 0xFF, 0x43, 0x0A, 0x03, 0x00,
+    0x26, 0x09, 0x04, 0x00, 0x2D, 0x09, 0x0A, 0x08, 0x43, 0x09,
+    0x02, 0x00, 0x26, 0x0B, 0x01, 0x00, 0x2D, 0x0B, 0x0A, 0x0A,
+    0x2B, 0x02, 0x00, 0x00, 0x43, 0x0B, 0x02, 0x00, 0x26, 0x0C,
+    0x05, 0x00, 0x2D, 0x0C, 0x09, 0x0B, 0x43, 0x02, 0x02, 0x00,
+    0x18, 0xE8, 0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x24, 0x71, 0x0C, 0x0D, 0x0D, 0x1A, 0x06, 0xBF, 0xFA,
+    0x06, 0xBF, 0xF3, 0x80, 0xE9, 0xBF, 0x2A, 0x05, 0x0E, 0x0C,
+    0x14, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xED, 0x80, 0xA5, 0xBF,
+    0x76, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC,
+    0x14, 0xBF, 0xD1, 0x80, 0xA5, 0xBF, 0xA7, 0x07, 0x16, 0x12,
+    0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x11, 0x16, 0xBF, 0xEA,
+    0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xBF, 0xBC, 0x45,
+    0xBF, 0xBB, 0x45, 0xBF, 0xBB, 0x45, 0xBF, 0x1B, 0x80, 0xE9,
+    0xBE, 0x5C, 0x81, 0xAB, 0xCF, 0x07, 0x65, 0x78, 0x74, 0x72,
+    0x65, 0x6D, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x80, 0xBF, 0x28, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x61, 0x72, 0x67,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x73, 0x74,
+    0x20, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72,
+    0x67, 0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6F,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x2E, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x73,
+    0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x74, 0x61, 0x6B, 0x65,
+    0x20, 0x74, 0x77, 0x6F, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x28, 0x61, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x69, 0x73, 0x6F, 0x6E,
+    0x29, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x61,
+    0x72, 0x67, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70,
+    0x74, 0x79, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0xCD, 0x00, 0x00, 0x4F, 0x6F, 0xCD, 0x00, 0x00, 0x50, 0xE4,
+    0xDA, 0x03, 0xDA, 0x81, 0xF7, 0xCF, 0x04, 0x6C, 0x61, 0x73,
+    0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x3F, 0x28,
+    0x6C, 0x61, 0x73, 0x74, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+    0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x53, 0x0B, 0xCD, 0x00, 0x00, 0x53, 0x72, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01, 0x00,
+    0x04, 0xCE, 0x04, 0x6C, 0x61, 0x73, 0x74, 0xDA, 0x24, 0x37,
+    0x02, 0x00, 0x00, 0x05, 0x03, 0x02, 0xFF, 0x33, 0x02, 0x00,
+    0x03, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x53, 0x63,
+    0x0A, 0xBF, 0xF3, 0x10, 0xBF, 0xE8, 0x19, 0xBF, 0xE7, 0x19,
+    0xCF, 0x09, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x6F, 0x73,
+    0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x66, 0x28,
+    0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x20,
+    0x73, 0x65, 0x70, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E,
+    0x64, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x20, 0x73, 0x65, 0x70, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x89, 0x75, 0xCD, 0x00, 0x00, 0x8A, 0xA7, 0xDA, 0x03,
+    0xDA, 0x81, 0x49, 0xCF, 0x04, 0x68, 0x61, 0x73, 0x68, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x04, 0x68, 0x61, 0x73, 0x68, 0xDA,
+    0x06, 0xCE, 0x80, 0xD2, 0x28, 0x68, 0x61, 0x73, 0x68, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+    0x74, 0x73, 0x20, 0x61, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x61, 0x6E, 0x79, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x63, 0x68, 0x65,
+    0x61, 0x70, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x73, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x65, 0x71, 0x75,
+    0x61, 0x6C, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x68,
+    0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+    0x6D, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2E, 0xCF, 0x0D, 0x67, 0x63, 0x61, 0x72,
+    0x65, 0x6E, 0x61, 0x2D, 0x62, 0x65, 0x67, 0x69, 0x6E, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x67, 0x63, 0x61, 0x72, 0x65,
+    0x6E, 0x61, 0x2D, 0x62, 0x65, 0x67, 0x69, 0x6E, 0xDA, 0x06,
+    0xCE, 0x80, 0xCF, 0x28, 0x67, 0x63, 0x61, 0x72, 0x65, 0x6E,
+    0x61, 0x2D, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x20, 0x26, 0x6F,
+    0x70, 0x74, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x29, 0x0A,
+    0x0A, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x61,
+    0x72, 0x65, 0x6E, 0x61, 0x20, 0x73, 0x63, 0x6F, 0x70, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x20, 0x61, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x63, 0x61, 0x72, 0x65,
+    0x6E, 0x61, 0x2D, 0x65, 0x6E, 0x64, 0x2E, 0x20, 0x57, 0x68,
+    0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63,
+    0x6F, 0x70, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x65,
+    0x6E, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+    0x72, 0x75, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x6D,
+    0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6C,
+    0x69, 0x6D, 0x69, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E,
+    0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64,
+    0x2E, 0x20, 0x50, 0x72, 0x65, 0x66, 0x65, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x61, 0x72,
+    0x65, 0x6E, 0x61, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E,
+    0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x73, 0x69,
+    0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x61, 0x73, 0x69, 0x6E, 0xDA, 0x06, 0xCE, 0x28,
+    0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x73, 0x69, 0x6E,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63,
+    0x73, 0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E,
+    0xCF, 0x0A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x65,
+    0x65, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x70, 0x65, 0x65, 0x6B, 0xDA, 0x06,
+    0xCE, 0x53, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70,
+    0x65, 0x65, 0x6B, 0x20, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x44,
+    0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0xCF, 0x0D, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83, 0x34, 0xDA, 0x06, 0xCE,
+    0x80, 0x82, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A,
+    0x53, 0x6E, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x6C,
+    0x69, 0x6B, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69,
+    0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0xCF, 0x0E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+    0x73, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x81, 0x5A, 0xDA, 0x06, 0xCE, 0x59, 0x28,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x70,
+    0x72, 0x6F, 0x74, 0x6F, 0x20, 0x74, 0x61, 0x62, 0x20, 0x70,
+    0x72, 0x6F, 0x74, 0x6F, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F,
+    0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x74, 0x61, 0x62, 0x2E, 0xCF, 0x0E,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61, 0x78, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61, 0x78, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0xDA, 0x06, 0xCE, 0x81, 0x08, 0x28,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61, 0x78, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x69, 0x62, 0x29, 0x0A,
+    0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74,
+    0x61, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69,
+    0x6E, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77,
+    0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x68, 0x69, 0x6C,
+    0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x27, 0x73, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C,
+    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x75, 0x70,
+    0x20, 0x66, 0x72, 0x6F, 0x6E, 0x74, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x6C,
+    0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6D, 0x6F, 0x72,
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x69,
+    0x73, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68,
+    0x72, 0x6F, 0x77, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x2D, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20,
+    0x6D, 0x6F, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72,
+    0x79, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65,
+    0x64, 0x2E, 0x20, 0xCF, 0x0F, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x68, 0x61, 0x73, 0x2D, 0x6D, 0x6F, 0x72, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x79, 0xDA, 0x06, 0xCE,
+    0x51, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x68,
+    0x61, 0x73, 0x2D, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73,
+    0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75,
+    0x65, 0x2E, 0xCF, 0x04, 0x64, 0x65, 0x66, 0x2D, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x45, 0x28,
+    0x64, 0x65, 0x66, 0x2D, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+    0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44,
+    0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x70, 0x72,
+    0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65,
+    0x78, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0x85, 0xC1, 0x86, 0x34, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x06, 0x01, 0x02,
+    0x06, 0xCE, 0x04, 0x64, 0x65, 0x66, 0x2D, 0xDA, 0x24, 0xDA,
+    0x61, 0xDA, 0x81, 0x95, 0x26, 0x04, 0x00, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x2D, 0x04, 0x00, 0x05, 0x2E, 0x01, 0x00, 0x00,
+    0x3D, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x86, 0x18,
+    0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B,
+    0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xCF, 0x07, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x24, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x89, 0x20, 0x89, 0x60,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05, 0x01,
+    0x02, 0x05, 0xCE, 0x07, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x83, 0x37, 0x2B, 0x00,
+    0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x89, 0x4F,
+    0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xCF, 0x04, 0x6C, 0x6F, 0x6F, 0x70, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x87,
+    0x11, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x68, 0x65, 0x61,
+    0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+    0x0A, 0x41, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+    0x20, 0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x6C,
+    0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E,
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61, 0x63, 0x72,
+    0x6F, 0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C,
+    0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x43, 0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x4C, 0x69, 0x73,
+    0x70, 0x20, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x2C, 0x20, 0x61, 0x6C, 0x74, 0x68, 0x6F,
+    0x75, 0x67, 0x68, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x74,
+    0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6D, 0x75,
+    0x63, 0x68, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x6F, 0x70, 0x65, 0x2E,
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x61, 0x69, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71,
+    0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x20,
+    0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x63,
+    0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x73, 0x2E, 0x20, 0x41, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65,
+    0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64,
+    0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x73, 0x6F, 0x6D, 0x65,
+    0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x6C,
+    0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x64, 0x20, 0x6C,
+    0x69, 0x6B, 0x65, 0x3A, 0x0A, 0x0A, 0x20, 0x20, 0x09, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x3A, 0x76, 0x65,
+    0x72, 0x62, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2F,
+    0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+    0x0A, 0x0A, 0x20, 0x20, 0x57, 0x68, 0x65, 0x72, 0x65, 0x20,
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x2C, 0x20, 0x3A,
+    0x76, 0x65, 0x72, 0x62, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72,
+    0x64, 0x73, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F,
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x65, 0x72, 0x62, 0x73,
+    0x20, 0x61, 0x72, 0x65, 0x3A, 0x0A, 0x0A, 0x20, 0x20, 0x09,
+    0x3A, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x2D,
+    0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65, 0x64, 0x6C,
+    0x79, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x68,
+    0x69, 0x6C, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0x0A, 0x20, 0x20,
+    0x09, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x2D, 0x20,
+    0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+    0x61, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20,
+    0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20,
+    0x74, 0x77, 0x6F, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x2C,
+    0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65,
+    0x6E, 0x64, 0x29, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x6B,
+    0x65, 0x79, 0x73, 0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72,
+    0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x0A, 0x20,
+    0x20, 0x09, 0x3A, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x2D,
+    0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65,
+    0x79, 0x73, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70,
+    0x61, 0x69, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A,
+    0x69, 0x6E, 0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61,
+    0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75,
+    0x65, 0x6E, 0x63, 0x65, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A,
+    0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x2D,
+    0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x65, 0x64, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+    0x70, 0x61, 0x69, 0x72, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6E, 0x65,
+    0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+    0x65, 0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65,
+    0x72, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E,
+    0x0A, 0x0A, 0x20, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x61,
+    0x6C, 0x73, 0x6F, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74,
+    0x73, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x6C, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65,
+    0x66, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x6F, 0x6F, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x75, 0x72,
+    0x74, 0x68, 0x65, 0x72, 0x2E, 0x20, 0x43, 0x6F, 0x6E, 0x64,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x0A, 0x0A, 0x20, 0x20,
+    0x09, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x0A,
+    0x0A, 0x20, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x3A,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65,
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72,
+    0x64, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E,
+    0x74, 0x2E, 0x20, 0x20, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+    0x69, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A, 0x0A,
+    0x20, 0x20, 0x09, 0x3A, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20,
+    0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+    0x20, 0x2D, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x73, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x6F, 0x6F, 0x70, 0x20, 0x69, 0x66, 0x20, 0x65, 0x78, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x79, 0x2E, 0x0A, 0x20,
+    0x20, 0x09, 0x3A, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x2D, 0x20, 0x64, 0x65,
+    0x66, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x62, 0x69, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x69, 0x64,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+    0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65,
+    0x74, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x0A, 0x20,
+    0x20, 0x09, 0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x2D, 0x20, 0x65, 0x76, 0x61,
+    0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20,
+    0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63,
+    0x74, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74,
+    0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20, 0x6C, 0x6F, 0x6F,
+    0x70, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x61, 0x66, 0x74,
+    0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x2D, 0x20,
+    0x73, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x3A, 0x62,
+    0x65, 0x66, 0x6F, 0x72, 0x65, 0x2C, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20,
+    0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x68, 0x61, 0x70,
+    0x70, 0x65, 0x6E, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20,
+    0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+    0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x72, 0x65, 0x70, 0x65,
+    0x61, 0x74, 0x20, 0x6E, 0x20, 0x2D, 0x20, 0x72, 0x65, 0x70,
+    0x65, 0x61, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x65, 0x78, 0x74, 0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20,
+    0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6E, 0x20, 0x74, 0x69, 0x6D,
+    0x65, 0x73, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x77, 0x68,
+    0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x2D, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+    0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x62,
+    0x6F, 0x64, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63,
+    0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
+    0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x0A, 0x0A, 0x20,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+    0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x61, 0x6C, 0x77, 0x61,
+    0x79, 0x73, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00,
+    0x25, 0x9D, 0xCD, 0x00, 0x00, 0x43, 0xBE, 0xDA, 0x03, 0xDA,
+    0x82, 0xCF, 0xCF, 0x08, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+    0x74, 0x65, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA,
+    0x06, 0xCE, 0x80, 0xA4, 0x28, 0x67, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x20, 0x26,
+    0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x67, 0x65, 0x6E,
+    0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x73,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x20, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x69, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x69, 0x6E, 0x20,
+    0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x53, 0x65, 0x65,
+    0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x64, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x73, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x44, 0xB4,
+    0xCD, 0x00, 0x00, 0x45, 0xA1, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x99, 0x00, 0x00, 0x07, 0x01, 0x06, 0x14, 0xCE, 0x08, 0x67,
+    0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0xDA, 0x24, 0xCF,
+    0x01, 0x26, 0xDA, 0x65, 0xCF, 0x05, 0x79, 0x69, 0x65, 0x6C,
+    0x64, 0xDA, 0x84, 0x68, 0xDA, 0x80, 0xF3, 0xCF, 0x09, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x26, 0x04,
+    0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x3D, 0x03, 0x00, 0x00,
+    0x26, 0x05, 0x01, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x2E, 0x01,
+    0x00, 0x00, 0x3D, 0x04, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00,
+    0x2C, 0x06, 0x04, 0x00, 0x3D, 0x05, 0x00, 0x00, 0x26, 0x06,
+    0x03, 0x00, 0x2D, 0x06, 0x00, 0x05, 0x3D, 0x04, 0x00, 0x00,
+    0x26, 0x06, 0x04, 0x00, 0x2D, 0x06, 0x03, 0x04, 0x3D, 0x05,
+    0x00, 0x00, 0x26, 0x04, 0x05, 0x00, 0x2C, 0x04, 0x05, 0x00,
+    0x3D, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x45, 0x6B, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35,
+    0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF,
+    0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB,
+    0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35,
+    0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF,
+    0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB, 0x35, 0xBF, 0xCB,
+    0x35, 0xCF, 0x0A, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x4A, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x66, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F,
+    0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x4F, 0x00, 0xCD, 0x00, 0x00,
+    0x4F, 0x6C, 0xDA, 0x03, 0xDA, 0x83, 0xF2, 0xCF, 0x03, 0x6D,
+    0x69, 0x6E, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x3B,
+    0x28, 0x6D, 0x69, 0x6E, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x65,
+    0x72, 0x69, 0x63, 0x20, 0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x75,
+    0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x51,
+    0x41, 0xCD, 0x00, 0x00, 0x51, 0x98, 0xDA, 0x03, 0xDA, 0x81,
+    0xF8, 0xCF, 0x02, 0x2D, 0x3E, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+    0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x80, 0xDD, 0x28, 0x2D, 0x3E,
+    0x20, 0x78, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+    0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20,
+    0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x78, 0x20,
+    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63,
+    0x6F, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69,
+    0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+    0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x6D,
+    0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20, 0x55, 0x73,
+    0x65, 0x66, 0x75, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20,
+    0x70, 0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x6A, 0x19,
+    0xCD, 0x00, 0x00, 0x6B, 0xF6, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0xB9, 0x00, 0x00, 0x06, 0x01, 0x01, 0x04, 0x01, 0xCE, 0x02,
+    0x2D, 0x3E, 0xDA, 0x24, 0xDA, 0x82, 0xF0, 0x2A, 0x04, 0x00,
+    0x00, 0x2D, 0x04, 0x00, 0x01, 0x26, 0x05, 0x00, 0x00, 0x30,
+    0x05, 0x00, 0x00, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x09, 0x02,
+    0x06, 0x1A, 0xDA, 0x82, 0xF1, 0xDA, 0x24, 0xDA, 0x72, 0xDA,
+    0x7B, 0xDA, 0x82, 0xF2, 0xDA, 0x80, 0x88, 0xDA, 0x81, 0x00,
+    0xDA, 0x7C, 0x2B, 0x01, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00,
+    0x26, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05,
+    0x09, 0x00, 0x25, 0x06, 0x00, 0x00, 0x33, 0x04, 0x01, 0x06,
+    0x25, 0x06, 0x01, 0x00, 0x2C, 0x01, 0x06, 0x00, 0x43, 0x06,
+    0x02, 0x00, 0x2C, 0x04, 0x06, 0x00, 0x43, 0x03, 0x03, 0x00,
+    0x18, 0x04, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x2C, 0x01,
+    0x04, 0x00, 0x43, 0x03, 0x03, 0x00, 0x35, 0x05, 0x03, 0x00,
+    0x35, 0x06, 0x03, 0x01, 0x2C, 0x05, 0x00, 0x00, 0x38, 0x04,
+    0x00, 0x00, 0x2C, 0x04, 0x06, 0x00, 0x43, 0x04, 0x04, 0x00,
+    0x25, 0x08, 0x00, 0x00, 0x2C, 0x04, 0x08, 0x00, 0x26, 0x08,
+    0x05, 0x00, 0x30, 0x08, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x6B,
+    0x3A, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xEF, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEA, 0x6B, 0xBF, 0xC5, 0x08, 0xBF, 0xF8, 0x08,
+    0x02, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xDF,
+    0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xB5, 0x6B, 0xBF, 0xF3, 0x0C,
+    0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0x8B, 0x77, 0xBF,
+    0x89, 0x77, 0x11, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE7, 0x19,
+    0xBF, 0xE7, 0x19, 0x07, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC,
+    0x14, 0xBF, 0xEC, 0x14, 0xCD, 0x00, 0x00, 0x6B, 0x0A, 0x80,
+    0xD4, 0x04, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF,
+    0x0A, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D, 0x69, 0x6E, 0x74,
+    0x6F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0xBF,
+    0x28, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D, 0x69, 0x6E, 0x74,
+    0x6F, 0x20, 0x74, 0x61, 0x62, 0x20, 0x26, 0x20, 0x63, 0x6F,
+    0x6C, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x4D, 0x65, 0x72, 0x67,
+    0x65, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C,
+    0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2F, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20,
+    0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6C,
+    0x61, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x72,
+    0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x6F, 0x6E, 0x65,
+    0x73, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72, 0x69, 0x67,
+    0x69, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x7E, 0x99, 0xCD, 0x00, 0x00, 0x7F, 0xB7, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x0D, 0x01, 0x01, 0x1A,
+    0xCE, 0x0A, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D, 0x69, 0x6E,
+    0x74, 0x6F, 0xDA, 0x24, 0xDA, 0x2E, 0x17, 0x03, 0x01, 0x00,
+    0x37, 0x05, 0x03, 0x00, 0x25, 0x04, 0x00, 0x00, 0x3E, 0x06,
+    0x04, 0x05, 0x1A, 0x06, 0x15, 0x00, 0x33, 0x08, 0x03, 0x04,
+    0x17, 0x07, 0x08, 0x00, 0x22, 0x09, 0x00, 0x00, 0x2C, 0x07,
+    0x09, 0x00, 0x43, 0x0A, 0x00, 0x00, 0x22, 0x0B, 0x00, 0x00,
+    0x1F, 0x09, 0x0B, 0x0A, 0x19, 0x09, 0x03, 0x00, 0x23, 0x09,
+    0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x09, 0x00, 0x00,
+    0x1A, 0x09, 0x07, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x33, 0x0C,
+    0x08, 0x0B, 0x34, 0x00, 0x0B, 0x0C, 0x2C, 0x07, 0x0A, 0x00,
+    0x43, 0x0A, 0x00, 0x00, 0x18, 0xF4, 0xFF, 0xFF, 0x05, 0x04,
+    0x04, 0x01, 0x18, 0xEB, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x7F, 0x68, 0x48, 0xBF, 0xB8, 0x48, 0xBF,
+    0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8,
+    0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48,
+    0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF,
+    0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8,
+    0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xF4, 0x0A,
+    0xBF, 0xE7, 0x1A, 0xBF, 0xB9, 0x48, 0xBF, 0xB8, 0x48, 0xBF,
+    0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBF, 0xB8, 0x48, 0xBE, 0xE9,
+    0x81, 0x1E, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C,
+    0x6F, 0x67, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0xDA, 0x06, 0xCE, 0x26,
+    0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x6C, 0x6F, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65,
+    0x20, 0x32, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x0C,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x65, 0x6E, 0x73, 0x75,
+    0x72, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x65, 0x6E, 0x73, 0x75, 0x72, 0x65,
+    0xDA, 0x06, 0xCE, 0x81, 0x26, 0x28, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74,
+    0x79, 0x29, 0x0A, 0x0A, 0x45, 0x6E, 0x73, 0x75, 0x72, 0x65,
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x62, 0x61,
+    0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x68, 0x61, 0x73, 0x20,
+    0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x6D, 0x65, 0x6D,
+    0x6F, 0x72, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x61,
+    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x69, 0x74, 0x65,
+    0x6D, 0x73, 0x2E, 0x20, 0x43, 0x61, 0x70, 0x61, 0x63, 0x69,
+    0x74, 0x79, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x61,
+    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x65, 0x6E,
+    0x6F, 0x75, 0x67, 0x68, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E,
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20,
+    0x6E, 0x6F, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x4F,
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x69, 0x6E,
+    0x67, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73,
+    0x6F, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E, 0x6F, 0x75,
+    0x67, 0x68, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2E, 0xCF,
+    0x0A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x74, 0x79, 0x70,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80, 0xF8, 0xDA, 0x06,
+    0xCE, 0x81, 0x1D, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x75, 0x70, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x20, 0x68, 0x6F,
+    0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x64, 0x2E, 0x20, 0x57,
+    0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+    0x72, 0x64, 0x20, 0x3A, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65,
+    0x74, 0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x3A, 0x70, 0x61, 0x72,
+    0x65, 0x6E, 0x73, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77,
+    0x69, 0x73, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x74,
+    0x77, 0x6F, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x68, 0x61, 0x76, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20,
+    0x6D, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x62, 0x75,
+    0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x70, 0x72, 0x69,
+    0x6E, 0x74, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65,
+    0x6E, 0x74, 0x6C, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62,
+    0x65, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20,
+    0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x6C,
+    0x79, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2E, 0xCF, 0x0E,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74,
+    0x2D, 0x73, 0x65, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74,
+    0x2D, 0x73, 0x65, 0x74, 0xDA, 0x06, 0xCE, 0x57, 0x28, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D,
+    0x73, 0x65, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x0A, 0x53,
+    0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69,
+    0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67,
+    0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x08, 0x6F, 0x73, 0x2F,
+    0x73, 0x68, 0x65, 0x6C, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x08, 0x6F, 0x73, 0x2F, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0xDA,
+    0x06, 0xCE, 0x47, 0x28, 0x6F, 0x73, 0x2F, 0x73, 0x68, 0x65,
+    0x6C, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x50,
+    0x61, 0x73, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D,
+    0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x73, 0x74, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
+    0x74, 0x6C, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x68,
+    0x65, 0x6C, 0x6C, 0x2E, 0xCF, 0x12, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x2F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x2D, 0x73, 0x61,
+    0x6D, 0x70, 0x6C, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x12,
+    0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x61, 0x6C, 0x6C, 0x6F,
+    0x63, 0x2D, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0xDA, 0x06,
+    0xCE, 0x80, 0xEC, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x2D, 0x73, 0x61, 0x6D, 0x70,
+    0x6C, 0x65, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x54, 0x75, 0x72,
+    0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x72, 0x2C, 0x20,
+    0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66,
+    0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6E, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67,
+    0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x65,
+    0x64, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2E, 0x20,
+    0x45, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72,
+    0x64, 0x65, 0x64, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F,
+    0x75, 0x6E, 0x74, 0x65, 0x64, 0x20, 0x6E, 0x20, 0x74, 0x69,
+    0x6D, 0x65, 0x73, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x6E, 0x20,
+    0x6F, 0x66, 0x20, 0x30, 0x20, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69,
+    0x6C, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x66, 0x20, 0x62, 0x75,
+    0x74, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x65, 0x64,
+    0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF,
+    0x0A, 0x76, 0x69, 0x65, 0x77, 0x2F, 0x73, 0x70, 0x6C, 0x69,
+    0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x76, 0x69, 0x65,
+    0x77, 0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74, 0xDA, 0x06, 0xCE,
+    0x80, 0xB8, 0x28, 0x76, 0x69, 0x65, 0x77, 0x2F, 0x73, 0x70,
+    0x6C, 0x69, 0x74, 0x20, 0x64, 0x65, 0x6C, 0x69, 0x6D, 0x20,
+    0x73, 0x74, 0x72, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74,
+    0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74,
+    0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x76, 0x69, 0x65, 0x77,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x20, 0x69,
+    0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x61,
+    0x72, 0x63, 0x68, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x73,
+    0x20, 0x61, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 0x6C, 0x69, 0x74,
+    0x73, 0x20, 0x73, 0x74, 0x72, 0x20, 0x61, 0x74, 0x20, 0x6D,
+    0x6F, 0x73, 0x74, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20,
+    0x74, 0x69, 0x6D, 0x65, 0x73, 0x2E, 0xCF, 0x09, 0x76, 0x61,
+    0x72, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x37, 0x28, 0x76, 0x61, 0x72, 0x67,
+    0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65,
+    0x20, 0x69, 0x6E, 0x69, 0x74, 0x29, 0x0A, 0x0A, 0x44, 0x79,
+    0x6E, 0x61, 0x6D, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x67,
+    0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x72, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x86, 0xC3, 0x87,
+    0x4B, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x07,
+    0x02, 0x03, 0x0B, 0xCE, 0x09, 0x76, 0x61, 0x72, 0x67, 0x6C,
+    0x6F, 0x62, 0x61, 0x6C, 0xDA, 0x24, 0xDA, 0x81, 0x96, 0xDA,
+    0x80, 0xD1, 0xDA, 0x80, 0x91, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x04, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x38, 0x05, 0x00,
+    0x00, 0x26, 0x06, 0x01, 0x00, 0x2C, 0x06, 0x05, 0x00, 0x3C,
+    0x05, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x35, 0x06, 0x06,
+    0x00, 0x34, 0x06, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x87,
+    0x13, 0x0C, 0xBF, 0xF4, 0x0C, 0x05, 0x20, 0xBF, 0xE0, 0x20,
+    0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF,
+    0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0x7F,
+    0x80, 0x88, 0xCF, 0x05, 0x65, 0x76, 0x65, 0x6E, 0x3F, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x1E, 0x28, 0x65, 0x76,
+    0x65, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+    0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0x87, 0x61, 0x87, 0x95, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05, 0x01, 0x01, 0x06,
+    0xCE, 0x05, 0x65, 0x76, 0x65, 0x6E, 0x3F, 0xDA, 0x24, 0xDA,
+    0x82, 0x7A, 0x25, 0x02, 0x02, 0x00, 0x2C, 0x00, 0x02, 0x00,
+    0x43, 0x02, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x42, 0x03,
+    0x04, 0x02, 0x03, 0x03, 0x00, 0x00, 0x87, 0x8D, 0x06, 0xBF,
+    0xFA, 0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xF4, 0x0D, 0xBF, 0xF3,
+    0x0D, 0xBF, 0xF3, 0x0D, 0xCF, 0x04, 0x77, 0x68, 0x65, 0x6E,
+    0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE,
+    0x5E, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E,
+    0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20, 0x62,
+    0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C,
+    0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75,
+    0x65, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+    0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0x95, 0xE7, 0x96, 0x73, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x99, 0x00, 0x00, 0x06, 0x01, 0x02, 0x08, 0xCE, 0x04,
+    0x77, 0x68, 0x65, 0x6E, 0xDA, 0x24, 0xDA, 0x65, 0xDA, 0x64,
+    0x26, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2E, 0x01,
+    0x00, 0x00, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00,
+    0x2D, 0x05, 0x00, 0x03, 0x3D, 0x04, 0x00, 0x00, 0x03, 0x04,
+    0x00, 0x00, 0x96, 0x57, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5,
+    0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B,
+    0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xCF, 0x09, 0x6D, 0x69,
+    0x6E, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x65, 0x28, 0x6D, 0x69, 0x6E, 0x2D,
+    0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x26, 0x20, 0x61, 0x72,
+    0x67, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x69, 0x6E,
+    0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74,
+    0x61, 0x6C, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
+    0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x52, 0x25, 0xCD, 0x00,
+    0x00, 0x52, 0xAC, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00,
+    0x00, 0x03, 0x00, 0x02, 0x04, 0xCE, 0x09, 0x6D, 0x69, 0x6E,
+    0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0xDA, 0x24, 0xDA, 0x83,
+    0x8D, 0xDA, 0x81, 0xF7, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x02,
+    0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x52, 0x97, 0x14, 0xBF, 0xEC, 0x14, 0xBF,
+    0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xCF, 0x03, 0x2D, 0x3E, 0x3E,
+    0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE,
+    0x80, 0xDC, 0x28, 0x2D, 0x3E, 0x3E, 0x20, 0x78, 0x20, 0x26,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54,
+    0x68, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D,
+    0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73,
+    0x65, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69,
+    0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+    0x63, 0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+    0x6D, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E,
+    0x2E, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C, 0x69,
+    0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x6B, 0xF9, 0xCD, 0x00, 0x00, 0x6D, 0xD8, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0xB9, 0x00, 0x00, 0x06, 0x01, 0x01,
+    0x04, 0x01, 0xCE, 0x03, 0x2D, 0x3E, 0x3E, 0xDA, 0x24, 0xDA,
+    0x82, 0xF0, 0x2A, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x01,
+    0x26, 0x05, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0xCD, 0x00,
+    0x9C, 0x00, 0x00, 0x09, 0x02, 0x06, 0x1C, 0xDA, 0x82, 0xF1,
+    0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x7B, 0xDA, 0x82, 0xF2, 0xDA,
+    0x80, 0x88, 0xDA, 0x81, 0x00, 0xDA, 0x7C, 0x2B, 0x01, 0x00,
+    0x00, 0x43, 0x04, 0x00, 0x00, 0x26, 0x06, 0x01, 0x00, 0x1F,
+    0x05, 0x06, 0x04, 0x1A, 0x05, 0x09, 0x00, 0x25, 0x06, 0x00,
+    0x00, 0x33, 0x04, 0x01, 0x06, 0x25, 0x06, 0x01, 0x00, 0x2C,
+    0x01, 0x06, 0x00, 0x43, 0x06, 0x02, 0x00, 0x2C, 0x04, 0x06,
+    0x00, 0x43, 0x03, 0x03, 0x00, 0x18, 0x04, 0x00, 0x00, 0x38,
+    0x04, 0x00, 0x00, 0x2C, 0x01, 0x04, 0x00, 0x43, 0x03, 0x03,
+    0x00, 0x35, 0x05, 0x03, 0x00, 0x35, 0x06, 0x03, 0x01, 0x2B,
+    0x05, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x38, 0x07, 0x00, 0x00, 0x2D, 0x04, 0x06, 0x07, 0x43,
+    0x04, 0x04, 0x00, 0x25, 0x07, 0x00, 0x00, 0x2C, 0x04, 0x07,
+    0x00, 0x26, 0x07, 0x05, 0x00, 0x30, 0x07, 0x00, 0x00, 0xCD,
+    0x00, 0x00, 0x6D, 0x19, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xEF,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEA, 0x6B, 0xBF, 0xC5, 0x08,
+    0xBF, 0xF8, 0x08, 0x02, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0,
+    0x10, 0xBF, 0xDF, 0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xB5, 0x6B,
+    0xBF, 0xF3, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF,
+    0x8B, 0x77, 0xBF, 0x89, 0x77, 0x11, 0x1C, 0xBF, 0xE4, 0x1C,
+    0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF,
+    0xE4, 0x1C, 0x07, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14,
+    0xBF, 0xEC, 0x14, 0xCD, 0x00, 0x00, 0x6C, 0xE9, 0x80, 0xD7,
+    0x04, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF, 0x08,
+    0x64, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x63, 0x74, 0xD4, 0x02,
+    0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0x8A, 0x28, 0x64, 0x69,
+    0x73, 0x74, 0x69, 0x6E, 0x63, 0x74, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x64, 0x75,
+    0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78,
+    0x73, 0x2E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x4E, 0x61, 0x4E, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20,
+    0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x73,
+    0x6F, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6F, 0x63,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x69, 0x73, 0x20,
+    0x6B, 0x65, 0x70, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x85, 0x84, 0xCD, 0x00, 0x00,
+    0x86, 0xDF, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x0F, 0x01, 0x03, 0x26, 0xCE, 0x08, 0x64, 0x69, 0x73, 0x74,
+    0x69, 0x6E, 0x63, 0x74, 0xDA, 0x24, 0xD8, 0x07, 0x73, 0x65,
+    0x74, 0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x2F, 0xD8, 0x07, 0x73,
+    0x65, 0x74, 0x2F, 0x61, 0x64, 0x64, 0x38, 0x03, 0x00, 0x00,
+    0x43, 0x05, 0x00, 0x00, 0x17, 0x06, 0x00, 0x00, 0x37, 0x08,
+    0x06, 0x00, 0x25, 0x07, 0x00, 0x00, 0x3E, 0x09, 0x07, 0x08,
+    0x1A, 0x09, 0x1F, 0x00, 0x33, 0x0B, 0x06, 0x07, 0x22, 0x0C,
+    0x00, 0x00, 0x1F, 0x0C, 0x0B, 0x0C, 0x1A, 0x0C, 0x03, 0x00,
+    0x17, 0x0A, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x1F, 0x0D,
+    0x0B, 0x0B, 0x19, 0x0D, 0x03, 0x00, 0x23, 0x0D, 0x00, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x24, 0x0D, 0x00, 0x00, 0x17, 0x0E,
+    0x0D, 0x00, 0x1A, 0x0E, 0x03, 0x00, 0x17, 0x0D, 0x0E, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x22, 0x0D, 0x00, 0x00, 0x17, 0x0A,
+    0x0D, 0x00, 0x1A, 0x0A, 0x04, 0x00, 0x2C, 0x03, 0x0B, 0x00,
+    0x43, 0x0C, 0x01, 0x00, 0x18, 0x08, 0x00, 0x00, 0x33, 0x0C,
+    0x05, 0x0B, 0x1A, 0x0C, 0x02, 0x00, 0x18, 0x05, 0x00, 0x00,
+    0x2C, 0x05, 0x0B, 0x00, 0x43, 0x0D, 0x02, 0x00, 0x2C, 0x03,
+    0x0B, 0x00, 0x43, 0x0D, 0x01, 0x00, 0x05, 0x07, 0x07, 0x01,
+    0x18, 0xE1, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x86, 0x1D, 0x0C, 0x0E, 0x08, 0x05, 0x80, 0x94, 0xBF,
+    0x6C, 0x80, 0x94, 0xBF, 0x6C, 0x80, 0x94, 0xBF, 0x6C, 0x80,
+    0x94, 0xBF, 0x6C, 0x80, 0x94, 0xBF, 0x6C, 0x80, 0x94, 0xBF,
+    0x91, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF4, 0x18, 0xBF, 0xE8,
+    0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xF6, 0x09, 0xBF, 0xF7, 0x09,
+    0xBF, 0xF7, 0x09, 0xBF, 0xF7, 0x09, 0xBF, 0xF7, 0x09, 0xBF,
+    0xE9, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8,
+    0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xDC, 0x7E,
+    0xBF, 0xA8, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xC9, 0x7E, 0xBF,
+    0xC1, 0x0B, 0xBF, 0xB6, 0x7E, 0xBF, 0x82, 0x7E, 0xBF, 0xDC,
+    0x0F, 0xBF, 0xF1, 0x0F, 0x02, 0x11, 0xBF, 0xEF, 0x11, 0xBF,
+    0x6F, 0x80, 0x94, 0xBF, 0x6C, 0x80, 0x94, 0xBE, 0xAC, 0x81,
+    0x5B, 0xCF, 0x09, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x37,
+    0x28, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x20, 0x70, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x29, 0x0A,
+    0x0A, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x68,
+    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0xAE, 0xF8, 0xCD, 0x00, 0x00,
+    0xB0, 0x0F, 0xDA, 0x03, 0xDA, 0x81, 0x75, 0xCF, 0x07, 0x72,
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0xD4, 0x02, 0xD3, 0x01,
+    0xDA, 0x06, 0xCE, 0x80, 0xD8, 0x28, 0x72, 0x65, 0x71, 0x75,
+    0x69, 0x72, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26,
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x61, 0x20, 0x6D, 0x6F,
+    0x64, 0x75, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+    0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C,
+    0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x61, 0x74, 0x68, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x20, 0x6D,
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68,
+    0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x61, 0x73, 0x20,
+    0x61, 0x20, 0x72, 0x61, 0x77, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E,
+    0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0xCA, 0x38, 0xCD, 0x00, 0x00, 0xCF, 0xE6, 0xDA, 0x03,
+    0xDA, 0x81, 0x94, 0xCF, 0x0B, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x82, 0xF2, 0xDA, 0x06, 0xCE, 0x81, 0x3A, 0x28, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+    0x20, 0x61, 0x72, 0x72, 0x74, 0x75, 0x70, 0x20, 0x5B, 0x2C,
+    0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D, 0x30, 0x20, 0x5B,
+    0x2C, 0x20, 0x65, 0x6E, 0x64, 0x3D, 0x28, 0x6C, 0x65, 0x6E,
+    0x67, 0x74, 0x68, 0x20, 0x61, 0x72, 0x72, 0x74, 0x75, 0x70,
+    0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74,
+    0x6F, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x2C,
+    0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65,
+    0x6E, 0x64, 0x29, 0x2E, 0x20, 0x49, 0x6E, 0x64, 0x65, 0x78,
+    0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73,
+    0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63,
+    0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x65, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0xCF, 0x09, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61,
+    0x63, 0x74, 0x3F, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x61,
+    0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3F, 0xDA, 0x06,
+    0xCE, 0x2E, 0x28, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63,
+    0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61,
+    0x63, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E, 0xCF, 0x10,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74,
+    0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x10, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62,
+    0x69, 0x74, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0xDA, 0x06,
+    0xCE, 0x5B, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x62, 0x69, 0x74, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x6C, 0x65, 0x61, 0x72,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x20,
+    0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76,
+    0x65, 0x6E, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2E, 0xCF, 0x09, 0x72, 0x6F, 0x70, 0x65, 0x2F,
+    0x70, 0x75, 0x73, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09,
+    0x72, 0x6F, 0x70, 0x65, 0x2F, 0x70, 0x75, 0x73, 0x68, 0xDA,
+    0x06, 0xCE, 0x79, 0x28, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x70,
+    0x75, 0x73, 0x68, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x50, 0x75, 0x73, 0x68,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x6F, 0x70,
+    0x65, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F,
+    0x66, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x72,
+    0x6F, 0x70, 0x65, 0x2E, 0xCF, 0x06, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x1F,
+    0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x78, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8A, 0xCF,
+    0x8B, 0x09, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x05, 0x01, 0x02, 0x05, 0xCE, 0x06, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x73, 0x2B, 0x00,
+    0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x8A, 0xF9,
+    0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xEE, 0x12, 0xCF, 0x06, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x23, 0x28,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x8B, 0x4A, 0x8B, 0x88, 0xDA, 0x03, 0xDA, 0x82, 0x0C,
+    0xCF, 0x03, 0x6D, 0x61, 0x70, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+    0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x73, 0x28, 0x6D, 0x61, 0x70,
+    0x20, 0x66, 0x20, 0x26, 0x20, 0x69, 0x6E, 0x64, 0x73, 0x29,
+    0x0A, 0x0A, 0x4D, 0x61, 0x70, 0x20, 0x61, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x76, 0x65,
+    0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x57, 0xCA, 0xCD, 0x00, 0x00, 0x5B, 0x6D, 0xDA, 0x03,
+    0xDA, 0x80, 0xFC, 0xCF, 0x06, 0x66, 0x69, 0x6C, 0x74, 0x65,
+    0x72, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x21, 0xCB, 0xDA, 0x06,
+    0xCE, 0x80, 0x89, 0x28, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72,
+    0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29,
+    0x0A, 0x0A, 0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C,
+    0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x20, 0x77, 0x68,
+    0x69, 0x63, 0x68, 0x20, 0x28, 0x70, 0x72, 0x65, 0x64, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x69,
+    0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00,
+    0x5C, 0xF5, 0xCD, 0x00, 0x00, 0x5D, 0xF3, 0xDA, 0x03, 0xD7,
+    0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0C, 0x02, 0x01, 0x0E, 0xCE,
+    0x06, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0xDA, 0x24, 0xDA,
+    0x2F, 0x38, 0x04, 0x00, 0x00, 0x17, 0x05, 0x01, 0x00, 0x37,
+    0x07, 0x05, 0x00, 0x25, 0x06, 0x00, 0x00, 0x3E, 0x08, 0x06,
+    0x07, 0x1A, 0x08, 0x08, 0x00, 0x33, 0x0A, 0x05, 0x06, 0x44,
+    0x09, 0x0A, 0x00, 0x1A, 0x09, 0x03, 0x00, 0x2C, 0x04, 0x0A,
+    0x00, 0x43, 0x0B, 0x00, 0x00, 0x05, 0x06, 0x06, 0x01, 0x18,
+    0xF8, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x5D, 0x97, 0x0C, 0x04, 0x45, 0xBF, 0xBB, 0x45, 0xBF, 0xBB,
+    0x45, 0xBF, 0xBB, 0x45, 0xBF, 0xBB, 0x45, 0xBF, 0xBB, 0x45,
+    0xBF, 0xD8, 0x0A, 0xBF, 0xF2, 0x2B, 0xBF, 0xEB, 0x14, 0xBF,
+    0xEC, 0x14, 0xBF, 0xBD, 0x45, 0xBF, 0xBB, 0x45, 0xBF, 0x09,
+    0x80, 0xFE, 0xCF, 0x05, 0x64, 0x65, 0x65, 0x70, 0x3D, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0x8C, 0x28, 0x64,
+    0x65, 0x65, 0x70, 0x3D, 0x20, 0x78, 0x20, 0x79, 0x29, 0x0A,
+    0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x3D, 0x2C, 0x20, 0x62,
+    0x75, 0x74, 0x20, 0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x28, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x73, 0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x73, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x73, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+    0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x20, 0x65,
+    0x71, 0x75, 0x61, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x69, 0x64,
+    0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x4D,
+    0x75, 0x63, 0x68, 0x20, 0x73, 0x6C, 0x6F, 0x77, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x3D, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xAB, 0x77,
+    0xCD, 0x00, 0x00, 0xAC, 0x27, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x9C, 0x00, 0x00, 0x05, 0x02, 0x02, 0x05, 0xCE, 0x05, 0x64,
+    0x65, 0x65, 0x70, 0x3D, 0xDA, 0x24, 0xDA, 0x81, 0x13, 0xDA,
+    0x80, 0xC3, 0x2C, 0x00, 0x01, 0x00, 0x43, 0x03, 0x00, 0x00,
+    0x2B, 0x03, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x30, 0x04,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0xAC, 0x17, 0x0E, 0xBF, 0xF2,
+    0x0E, 0xBF, 0xED, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14,
+    0xCF, 0x0C, 0x61, 0x6C, 0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x4B, 0x28, 0x61, 0x6C, 0x6C, 0x2D, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x65, 0x6E, 0x76, 0x20,
+    0x26, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20,
+    0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+    0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xD7, 0x03, 0xCD,
+    0x00, 0x00, 0xD8, 0x64, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x98,
+    0x00, 0x00, 0x13, 0x01, 0x07, 0x31, 0xCE, 0x0C, 0x61, 0x6C,
+    0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73,
+    0xDA, 0x24, 0xDA, 0x80, 0x91, 0xDA, 0x2F, 0xD8, 0x0E, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2F, 0x67, 0x65, 0x74, 0x70, 0x72,
+    0x6F, 0x74, 0x6F, 0xDA, 0x2E, 0xDA, 0x81, 0x05, 0xDA, 0x30,
+    0xDA, 0x83, 0x8E, 0x22, 0x04, 0x00, 0x00, 0x1F, 0x03, 0x04,
+    0x00, 0x1A, 0x03, 0x04, 0x00, 0x26, 0x02, 0x00, 0x00, 0x35,
+    0x02, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x02, 0x00,
+    0x00, 0x17, 0x03, 0x02, 0x00, 0x38, 0x05, 0x00, 0x00, 0x17,
+    0x06, 0x03, 0x00, 0x1A, 0x06, 0x06, 0x00, 0x2C, 0x05, 0x06,
+    0x00, 0x43, 0x07, 0x01, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x43,
+    0x06, 0x02, 0x00, 0x18, 0xFB, 0xFF, 0xFF, 0x3C, 0x07, 0x00,
+    0x00, 0x17, 0x08, 0x05, 0x00, 0x37, 0x0A, 0x08, 0x00, 0x25,
+    0x09, 0x00, 0x00, 0x3E, 0x0B, 0x09, 0x0A, 0x1A, 0x0B, 0x17,
+    0x00, 0x33, 0x0C, 0x08, 0x09, 0x22, 0x0E, 0x00, 0x00, 0x2C,
+    0x0C, 0x0E, 0x00, 0x43, 0x0F, 0x03, 0x00, 0x22, 0x10, 0x00,
+    0x00, 0x1F, 0x0E, 0x10, 0x0F, 0x19, 0x0E, 0x03, 0x00, 0x23,
+    0x0E, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x0E, 0x00,
+    0x00, 0x1A, 0x0E, 0x0A, 0x00, 0x17, 0x10, 0x0F, 0x00, 0x2B,
+    0x10, 0x00, 0x00, 0x43, 0x11, 0x04, 0x00, 0x1A, 0x11, 0x03,
+    0x00, 0x23, 0x12, 0x00, 0x00, 0x34, 0x07, 0x10, 0x12, 0x2C,
+    0x0C, 0x0F, 0x00, 0x43, 0x0F, 0x03, 0x00, 0x18, 0xF1, 0xFF,
+    0xFF, 0x05, 0x09, 0x09, 0x01, 0x18, 0xE9, 0xFF, 0xFF, 0x2B,
+    0x07, 0x00, 0x00, 0x43, 0x08, 0x05, 0x00, 0x2B, 0x08, 0x00,
+    0x00, 0x26, 0x09, 0x06, 0x00, 0x30, 0x09, 0x00, 0x00, 0xCD,
+    0x00, 0x00, 0xD7, 0x5C, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x04, 0x0D, 0x08, 0x0A,
+    0x02, 0x37, 0xBF, 0xD2, 0x12, 0xBF, 0xEE, 0x12, 0x09, 0x11,
+    0xBF, 0xEF, 0x11, 0xBF, 0xCB, 0x37, 0x05, 0x13, 0x04, 0x62,
+    0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF,
+    0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E,
+    0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62,
+    0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF,
+    0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0xD8,
+    0x0A, 0xBF, 0xF6, 0x0A, 0xBF, 0xBC, 0x62, 0xBF, 0xE9, 0x16,
+    0xBF, 0xEA, 0x16, 0xBF, 0x9F, 0x62, 0xBF, 0x9E, 0x62, 0xBF,
+    0x9E, 0x62, 0xBF, 0x9E, 0x62, 0xBF, 0x9E, 0x62, 0x0A, 0x10,
+    0xBF, 0xF0, 0x10, 0xBF, 0xEA, 0x17, 0xBF, 0xE9, 0x17, 0xBF,
+    0xE9, 0x17, 0xCF, 0x09, 0x67, 0x63, 0x73, 0x65, 0x74, 0x73,
+    0x74, 0x65, 0x70, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x67,
+    0x63, 0x73, 0x65, 0x74, 0x73, 0x74, 0x65, 0x70, 0xDA, 0x06,
+    0xCE, 0x80, 0xDF, 0x28, 0x67, 0x63, 0x73, 0x65, 0x74, 0x73,
+    0x74, 0x65, 0x70, 0x20, 0x73, 0x74, 0x65, 0x70, 0x29, 0x0A,
+    0x0A, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x77,
+    0x6F, 0x72, 0x6B, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62,
+    0x79, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x74, 0x65,
+    0x70, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+    0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x20,
+    0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0x20, 0x43, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20, 0x68, 0x65, 0x61,
+    0x70, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x70, 0x72, 0x65,
+    0x61, 0x64, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x6D, 0x61,
+    0x6E, 0x79, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x73,
+    0x74, 0x65, 0x70, 0x73, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65, 0x73, 0x20,
+    0x73, 0x74, 0x61, 0x79, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74,
+    0x2E, 0x20, 0x41, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x6F,
+    0x66, 0x20, 0x30, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xCF, 0x09, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x63, 0x65, 0x69, 0x6C, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x65,
+    0x69, 0x6C, 0xDA, 0x06, 0xCE, 0x51, 0x28, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x63, 0x65, 0x69, 0x6C, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x73,
+    0x74, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20,
+    0x74, 0x68, 0x61, 0x6E, 0x20, 0x78, 0x2E, 0xCF, 0x0D, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x7B, 0xDA,
+    0x06, 0xCE, 0x80, 0xFD, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x20, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x2E,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A, 0x0A, 0x09,
+    0x3A, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x2D,
+    0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x64, 0x2E, 0x0A, 0x09, 0x3A, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x61, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x6F,
+    0x75, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x0A, 0x09,
+    0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x2D, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20,
+    0x72, 0x65, 0x61, 0x64, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20,
+    0x73, 0x61, 0x66, 0x65, 0x6C, 0x79, 0x20, 0x74, 0x65, 0x72,
+    0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x2E, 0xCF, 0x11, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x72, 0x6F, 0x6D,
+    0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x11, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66,
+    0x72, 0x6F, 0x6D, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0xDA,
+    0x06, 0xCE, 0x80, 0x97, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x66, 0x72, 0x6F, 0x6D, 0x2D, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2D, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20,
+    0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x41, 0x6C, 0x6C,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6F,
+    0x65, 0x72, 0x63, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x31, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x30,
+    0x2D, 0x32, 0x35, 0x35, 0x2E, 0xCF, 0x0E, 0x73, 0x65, 0x74,
+    0x2F, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x73, 0x65, 0x74,
+    0x2F, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63,
+    0x65, 0xDA, 0x06, 0xCE, 0x80, 0x8D, 0x28, 0x73, 0x65, 0x74,
+    0x2F, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63,
+    0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x26, 0x20, 0x73, 0x65,
+    0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x6E, 0x6F, 0x6E, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x74, 0x73, 0x2E, 0x20,
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x69, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x73, 0x65, 0x74, 0x73, 0x2E, 0xCF, 0x11, 0x74,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x70, 0x79,
+    0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x11, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63,
+    0x6F, 0x70, 0x79, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0xDA,
+    0x06, 0xCE, 0x80, 0x9B, 0x28, 0x74, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x63, 0x6F, 0x70, 0x79, 0x2D, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x73, 0x72, 0x63, 0x20, 0x73, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x64, 0x73, 0x74, 0x20, 0x64, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x5B, 0x63, 0x6F, 0x75, 0x6E,
+    0x74, 0x3D, 0x31, 0x5D, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x70,
+    0x79, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x73, 0x72, 0x63, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x20, 0x73, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x74, 0x6F,
+    0x20, 0x64, 0x73, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x20, 0x61, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x64, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x63, 0x61, 0x6E,
+    0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x2E, 0xCF,
+    0x04, 0x6F, 0x64, 0x64, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x1C, 0x28, 0x6F, 0x64, 0x64, 0x3F, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+    0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x64, 0x64,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x87, 0x97,
+    0x87, 0xCB, 0xDA, 0x03, 0xDA, 0x82, 0xD8, 0xCF, 0x06, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x22, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x3F,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B,
+    0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0x88, 0xE1, 0x89, 0x1E, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05, 0x01, 0x02, 0x05,
+    0xCE, 0x06, 0x66, 0x69, 0x62, 0x65, 0x72, 0x3F, 0xDA, 0x24,
+    0xDA, 0x72, 0xDA, 0x81, 0x83, 0x2B, 0x00, 0x00, 0x00, 0x43,
+    0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x89, 0x0E, 0x07, 0xBF, 0xF9,
+    0x07, 0xBF, 0xF6, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12,
+    0xCF, 0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x80, 0x95,
+    0x28, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x66, 0x20,
+    0x69, 0x6E, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x64, 0x75, 0x63, 0x65, 0x2C, 0x20, 0x61,
+    0x6C, 0x73, 0x6F, 0x20, 0x6B, 0x6E, 0x6F, 0x77, 0x20, 0x61,
+    0x73, 0x20, 0x66, 0x6F, 0x6C, 0x64, 0x2D, 0x6C, 0x65, 0x66,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20,
+    0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x73, 0x2C,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D,
+    0x73, 0x20, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x28,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65,
+    0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x56,
+    0xD8, 0xCD, 0x00, 0x00, 0x57, 0xC7, 0xDA, 0x03, 0xDA, 0x82,
+    0xF0, 0xCF, 0x05, 0x72, 0x61, 0x6E, 0x67, 0x65, 0xD4, 0x02,
+    0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0xDE, 0x28, 0x72, 0x61,
+    0x6E, 0x67, 0x65, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73,
+    0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x66, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x5B,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65, 0x6E, 0x64,
+    0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x67,
+    0x69, 0x76, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x65, 0x70, 0x2E,
+    0x20, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x65,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x2C, 0x20,
+    0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x57, 0x69, 0x74, 0x68,
+    0x20, 0x74, 0x77, 0x6F, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E,
+    0x67, 0x65, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C,
+    0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x57, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x72,
+    0x61, 0x6E, 0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x73,
+    0x74, 0x65, 0x70, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x5F,
+    0xDD, 0xCD, 0x00, 0x00, 0x62, 0xA9, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x99, 0x00, 0x00, 0x0F, 0x00, 0x04, 0x38, 0xCE, 0x05,
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0xDA, 0x24, 0xDA, 0x14, 0xDA,
+    0x85, 0x1C, 0xDA, 0x2F, 0xCE, 0x22, 0x65, 0x78, 0x70, 0x65,
+    0x63, 0x74, 0x65, 0x64, 0x20, 0x31, 0x20, 0x74, 0x6F, 0x20,
+    0x33, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x37, 0x03, 0x00, 0x00, 0x25, 0x04, 0x01, 0x00, 0x1F, 0x02,
+    0x03, 0x04, 0x1A, 0x02, 0x0D, 0x00, 0x35, 0x05, 0x00, 0x00,
+    0x2B, 0x05, 0x00, 0x00, 0x43, 0x06, 0x00, 0x00, 0x25, 0x04,
+    0x00, 0x00, 0x17, 0x07, 0x05, 0x00, 0x3E, 0x08, 0x04, 0x07,
+    0x1A, 0x08, 0x05, 0x00, 0x17, 0x09, 0x04, 0x00, 0x34, 0x06,
+    0x09, 0x09, 0x05, 0x04, 0x04, 0x01, 0x18, 0xFB, 0xFF, 0xFF,
+    0x03, 0x06, 0x00, 0x00, 0x25, 0x05, 0x02, 0x00, 0x1F, 0x04,
+    0x03, 0x05, 0x1A, 0x04, 0x0F, 0x00, 0x35, 0x06, 0x00, 0x00,
+    0x35, 0x07, 0x00, 0x01, 0x2B, 0x06, 0x00, 0x00, 0x43, 0x08,
+    0x00, 0x00, 0x17, 0x05, 0x06, 0x00, 0x17, 0x09, 0x07, 0x00,
+    0x3E, 0x0A, 0x05, 0x09, 0x1A, 0x0A, 0x06, 0x00, 0x17, 0x0B,
+    0x05, 0x00, 0x07, 0x0C, 0x0B, 0x06, 0x34, 0x08, 0x0C, 0x0B,
+    0x05, 0x05, 0x05, 0x01, 0x18, 0xFA, 0xFF, 0xFF, 0x03, 0x08,
+    0x00, 0x00, 0x25, 0x06, 0x03, 0x00, 0x1F, 0x05, 0x03, 0x06,
+    0x1A, 0x05, 0x13, 0x00, 0x35, 0x07, 0x00, 0x00, 0x35, 0x08,
+    0x00, 0x01, 0x35, 0x09, 0x00, 0x02, 0x0B, 0x06, 0x07, 0x09,
+    0x2B, 0x06, 0x00, 0x00, 0x43, 0x0A, 0x01, 0x00, 0x2B, 0x0A,
+    0x00, 0x00, 0x43, 0x0A, 0x00, 0x00, 0x17, 0x06, 0x07, 0x00,
+    0x17, 0x0B, 0x08, 0x00, 0x3E, 0x0C, 0x06, 0x0B, 0x1A, 0x0C,
+    0x06, 0x00, 0x17, 0x0D, 0x06, 0x00, 0x2C, 0x0A, 0x0D, 0x00,
+    0x43, 0x0E, 0x02, 0x00, 0x45, 0x06, 0x06, 0x09, 0x18, 0xFA,
+    0xFF, 0xFF, 0x03, 0x0A, 0x00, 0x00, 0x26, 0x06, 0x03, 0x00,
+    0x01, 0x06, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x60, 0xD1, 0x0C,
+    0xBF, 0xEE, 0x81, 0xDD, 0xBE, 0x23, 0x81, 0xDD, 0xBE, 0x23,
+    0x81, 0xDD, 0xBE, 0x49, 0x0D, 0x13, 0x0C, 0xBF, 0xF4, 0x0C,
+    0x0B, 0x24, 0xBF, 0xDC, 0x24, 0xBF, 0xDC, 0x24, 0xBF, 0xDC,
+    0x24, 0xBF, 0xDC, 0x24, 0xBF, 0xF3, 0x0C, 0xBF, 0xDD, 0x24,
+    0xBF, 0xDC, 0x24, 0xBF, 0x99, 0x74, 0xBF, 0x72, 0x81, 0xDD,
+    0xBE, 0x23, 0x81, 0xDD, 0xBE, 0x23, 0x81, 0xDD, 0xBE, 0xC5,
+    0x0F, 0xBF, 0xF1, 0x0F, 0x13, 0x0C, 0xBF, 0xF4, 0x0C, 0x0B,
+    0x2A, 0xBF, 0xD6, 0x2A, 0xBF, 0xD6, 0x2A, 0xBF, 0xD6, 0x2A,
+    0xBF, 0xD6, 0x2A, 0xBF, 0xF6, 0x06, 0xBF, 0xF1, 0x12, 0xBF,
+    0xD7, 0x2A, 0xBF, 0xD6, 0x2A, 0xBF, 0x91, 0x7C, 0xBE, 0xEE,
+    0x81, 0xDD, 0xBE, 0x23, 0x81, 0xDD, 0xBE, 0x23, 0x81, 0xDD,
+    0xBF, 0x49, 0x11, 0xBF, 0xEF, 0x11, 0xBF, 0xEF, 0x11, 0x29,
+    0x06, 0xBF, 0xEF, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xE3, 0x1E,
+    0xBF, 0xE2, 0x1E, 0x0B, 0x2B, 0xBF, 0xD5, 0x2B, 0xBF, 0xD5,
+    0x2B, 0xBF, 0xD5, 0x2B, 0xBF, 0xD5, 0x2B, 0xBF, 0xEE, 0x11,
+    0xBF, 0xEF, 0x11, 0xBF, 0xD6, 0x2B, 0xBF, 0xD5, 0x2B, 0xBF,
+    0x7C, 0x80, 0x91, 0x06, 0x2B, 0xBF, 0xD5, 0x2B, 0xCF, 0x04,
+    0x77, 0x61, 0x6C, 0x6B, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x80, 0xAD, 0x28, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x0A, 0x49, 0x74,
+    0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x73, 0x74, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x66,
+    0x20, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E,
+    0x20, 0x43, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x73, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x2C, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x2C, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x73, 0x84, 0xCD, 0x00,
+    0x00, 0x74, 0xF4, 0xDA, 0x03, 0xDA, 0x7D, 0xCF, 0x0C, 0x6D,
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68,
+    0x73, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x81, 0xE2,
+    0x54, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69,
+    0x6E, 0x67, 0x20, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69,
+    0x74, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x70, 0x72, 0x65, 0x66, 0x6F, 0x72, 0x6D, 0x65,
+    0x64, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+    0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x3A, 0x73, 0x79, 0x73,
+    0x3A, 0x20, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x73, 0x20,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x2A, 0x73,
+    0x79, 0x73, 0x70, 0x61, 0x74, 0x68, 0x2A, 0x2C, 0x20, 0x3A,
+    0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x62, 0x65, 0x63, 0x6F,
+    0x6D, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+    0x65, 0x20, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x66,
+    0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x2F, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20,
+    0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6C, 0x69, 0x74, 0x65, 0x72,
+    0x61, 0x6C, 0x6C, 0x79, 0x2E, 0x20, 0x20, 0x3A, 0x6E, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x3A, 0x20, 0x62, 0x65, 0x63, 0x6F,
+    0x6D, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x79,
+    0x6E, 0x61, 0x6D, 0x69, 0x63, 0x20, 0x6C, 0x69, 0x62, 0x72,
+    0x61, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x65,
+    0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x20,
+    0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x64, 0x6C,
+    0x6C, 0x20, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x6F, 0x2E, 0x20,
+    0x45, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x74, 0x77,
+    0x6F, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x20, 0x74, 0x65,
+    0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C, 0x20,
+    0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x6F,
+    0x72, 0x20, 0x3A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x69,
+    0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20,
+    0x68, 0x6F, 0x77, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x6C, 0x6F, 0x61, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73,
+    0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x61, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0xC0, 0x25, 0xCD, 0x00, 0x00, 0xC3, 0xED, 0xDA,
+    0x03, 0xDA, 0x81, 0x28, 0xDA, 0x68, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x80, 0x88, 0xDA, 0x06, 0xCE, 0x50, 0x28, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x20, 0x26, 0x20, 0x69, 0x74, 0x65, 0x6D,
+    0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63,
+    0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x69, 0x74,
+    0x65, 0x6D, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0xCF, 0x04, 0x62,
+    0x61, 0x6E, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x09, 0x00, 0x0D, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x04, 0x62,
+    0x61, 0x6E, 0x64, 0x37, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01,
+    0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0xFF, 0xFF, 0x03,
+    0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05,
+    0x00, 0x25, 0x03, 0xFF, 0xFF, 0x35, 0x04, 0x00, 0x00, 0x0C,
+    0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x0C,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x06, 0xCE, 0x5B, 0x28, 0x62, 0x61, 0x6E, 0x64, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69,
+    0x74, 0x2D, 0x77, 0x69, 0x73, 0x65, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73,
+    0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x78, 0x20, 0x69,
+    0x6E, 0x20, 0x78, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x2E, 0xCF, 0x0F, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61, 0x6E, 0x64, 0x6F,
+    0x6D, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0F, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61, 0x6E, 0x64,
+    0x6F, 0x6D, 0xDA, 0x06, 0xCE, 0x65, 0x28, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61, 0x6E, 0x64,
+    0x6F, 0x6D, 0x20, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x0A,
+    0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+    0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x6F, 0x72, 0x2E, 0x20, 0x27, 0x73, 0x65, 0x65,
+    0x64, 0x27, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF, 0x0B, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x7C, 0xDA, 0x06, 0xCE, 0x81,
+    0x04, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C,
+    0x69, 0x63, 0x65, 0x20, 0x61, 0x72, 0x72, 0x74, 0x75, 0x70,
+    0x20, 0x5B, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D, 0x30,
+    0x20, 0x5B, 0x2C, 0x65, 0x6E, 0x64, 0x3D, 0x28, 0x6C, 0x65,
+    0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x72, 0x72, 0x74, 0x75,
+    0x70, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B,
+    0x65, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62, 0x20, 0x73, 0x65,
+    0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75,
+    0x73, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x65, 0x78,
+    0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2E, 0x20, 0x49,
+    0x66, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x72,
+    0x20, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65,
+    0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x30,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x72, 0x72, 0x74, 0x75, 0x70, 0x20, 0x72, 0x65, 0x73, 0x70,
+    0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x2E, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x2E, 0xCF, 0x0F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x61,
+    0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x61, 0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xDA,
+    0x06, 0xCE, 0x80, 0xCF, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67,
+    0x2F, 0x61, 0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x47,
+    0x65, 0x74, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20,
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0x2E, 0x20, 0x4E, 0x6F, 0x72, 0x6D,
+    0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65,
+    0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x75, 0x6E, 0x6C,
+    0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+    0x73, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x70, 0x75,
+    0x73, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6D,
+    0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0xCF, 0x07, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x3F,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x24, 0x28, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x88, 0x9F, 0x88, 0xDF, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x9C, 0x00, 0x00, 0x05, 0x01, 0x02, 0x05, 0xCE, 0x07, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x3F, 0xDA, 0x24, 0xDA, 0x72,
+    0xD0, 0x06, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2B, 0x00,
+    0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x88, 0xCE,
+    0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x13, 0xBF, 0xED, 0x13,
+    0xBF, 0xED, 0x13, 0xCF, 0x04, 0x6E, 0x69, 0x6C, 0x3F, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x1C, 0x28, 0x6E, 0x69,
+    0x6C, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0x8E, 0x01, 0x8E, 0x2E, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x04, 0x01, 0x00, 0x03, 0xCE, 0x04,
+    0x6E, 0x69, 0x6C, 0x3F, 0xDA, 0x24, 0x22, 0x03, 0x00, 0x00,
+    0x1F, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00, 0x8E, 0x25,
+    0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF8, 0x08, 0xCF, 0x07, 0x63,
+    0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0xD4, 0x02, 0xD3, 0x02,
+    0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x2B, 0x28, 0x63, 0x6F,
+    0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x0A, 0x0A, 0x49, 0x67,
+    0x6E, 0x6F, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x95, 0x39, 0x95,
+    0x74, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0xCE, 0x07, 0x63, 0x6F, 0x6D, 0x6D, 0x65,
+    0x6E, 0x74, 0xDA, 0x24, 0x04, 0x00, 0x00, 0x00, 0x95, 0x39,
+    0x3B, 0xCF, 0x06, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x38,
+    0x28, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6F,
+    0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F,
+    0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x28, 0x6E, 0x6F,
+    0x74, 0x20, 0x2E, 0x2E, 0x2E, 0x20, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0x96, 0x76, 0x96, 0xE0, 0xDA, 0x03, 0xD7,
+    0xCD, 0x00, 0x99, 0x00, 0x00, 0x07, 0x01, 0x02, 0x0A, 0xCE,
+    0x06, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0xDA, 0x24, 0xDA,
+    0x65, 0xDA, 0x64, 0x26, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00,
+    0x00, 0x2E, 0x01, 0x00, 0x00, 0x3D, 0x03, 0x00, 0x00, 0x26,
+    0x05, 0x01, 0x00, 0x22, 0x06, 0x00, 0x00, 0x2D, 0x05, 0x00,
+    0x06, 0x2B, 0x03, 0x00, 0x00, 0x3D, 0x04, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x96, 0xC0, 0x1F, 0xBF, 0xE1, 0x1F, 0xBF,
+    0xE1, 0x1F, 0xBF, 0xE1, 0x1F, 0xBF, 0xE1, 0x1F, 0xBF, 0xE1,
+    0x1F, 0xBF, 0xE1, 0x1F, 0xBF, 0xE1, 0x1F, 0xBF, 0xE1, 0x1F,
+    0xBF, 0xE1, 0x1F, 0xDA, 0x82, 0x11, 0xD4, 0x02, 0xD3, 0x02,
+    0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x70, 0x28, 0x61, 0x6E,
+    0x64, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29,
+    0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x61, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x20,
+    0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x22,
+    0xA7, 0xCD, 0x00, 0x00, 0x23, 0xEC, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x99, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x11, 0xCE, 0x03,
+    0x61, 0x6E, 0x64, 0xDA, 0x24, 0xDA, 0x64, 0xDA, 0x80, 0x88,
+    0x23, 0x02, 0x00, 0x00, 0x37, 0x05, 0x00, 0x00, 0x25, 0x07,
+    0x00, 0x00, 0x40, 0x06, 0x05, 0x07, 0x1A, 0x06, 0x0C, 0x00,
+    0x05, 0x05, 0x05, 0xFF, 0x23, 0x08, 0x00, 0x00, 0x1F, 0x07,
+    0x02, 0x08, 0x1A, 0x07, 0x03, 0x00, 0x33, 0x02, 0x00, 0x05,
+    0x18, 0xF8, 0xFF, 0xFF, 0x33, 0x08, 0x00, 0x05, 0x26, 0x09,
+    0x00, 0x00, 0x2D, 0x09, 0x08, 0x02, 0x43, 0x02, 0x01, 0x00,
+    0x18, 0xF3, 0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x23, 0x2A, 0x0D, 0x0D, 0x0D, 0x1A, 0x06, 0xBF, 0xFA,
+    0x06, 0xBF, 0xF3, 0x80, 0x81, 0xBF, 0x92, 0x05, 0x13, 0x0B,
+    0xBF, 0xF5, 0x0B, 0xBF, 0xF1, 0x58, 0xBF, 0xC7, 0x0C, 0xBF,
+    0xD5, 0x58, 0xBF, 0xEE, 0x0C, 0xBF, 0xE9, 0x1C, 0xBF, 0xE4,
+    0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0x82, 0x80, 0x81, 0xBE, 0xC2,
+    0x81, 0x45, 0xCF, 0x07, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61,
+    0x6C, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x31, 0x28,
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0x20, 0x66, 0x20,
+    0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x50,
+    0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x70, 0x70, 0x6C,
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x79, 0x56,
+    0xCD, 0x00, 0x00, 0x79, 0xCD, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0xBB, 0x00, 0x00, 0x06, 0x01, 0x00, 0x08, 0x01, 0xCE, 0x07,
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0xDA, 0x24, 0x28,
+    0x02, 0x00, 0x00, 0x37, 0x03, 0x01, 0x00, 0x25, 0x05, 0x00,
+    0x00, 0x42, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x02, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0xCD, 0x00, 0xD1, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05,
+    0x01, 0xDA, 0x24, 0x27, 0x01, 0x00, 0x01, 0x2E, 0x01, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x30,
+    0x01, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x79, 0xBF,
+    0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B,
+    0xBF, 0xF5, 0x0B, 0xCD, 0x00, 0x00, 0x79, 0x56, 0x77, 0xBF,
+    0xD3, 0x0C, 0xBF, 0xED, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xE8,
+    0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xE9, 0x16, 0xBF, 0xEA, 0x16,
+    0xCF, 0x08, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0xB7, 0x28,
+    0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76, 0x20, 0x70,
+    0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x26, 0x29, 0x0A, 0x0A,
+    0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x69, 0x6E,
+    0x68, 0x65, 0x72, 0x69, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x70, 0x6F, 0x6C, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0xAD, 0xD6, 0xCD, 0x00, 0x00, 0xAE, 0xF5, 0xDA,
+    0x03, 0xDA, 0x81, 0x5B, 0xCF, 0x05, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x0C, 0x00,
+    0x04, 0x01, 0x00, 0x00, 0x02, 0xCE, 0x05, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x32, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+    0xDA, 0x06, 0xCE, 0x80, 0x8C, 0x28, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x73,
+    0x20, 0x61, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73,
+    0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61,
+    0x75, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20,
+    0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x73, 0x70, 0x65,
+    0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6E,
+    0x6E, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xCF, 0x06, 0x73, 0x74, 0x64,
+    0x6F, 0x75, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x64,
+    0xDA, 0x06, 0xCE, 0x19, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74,
+    0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x6F, 0x75, 0x74,
+    0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF,
+    0x07, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x70, 0x69, 0xD3, 0x02,
+    0xDA, 0x03, 0xC8, 0x18, 0x2D, 0x44, 0x54, 0xFB, 0x21, 0x09,
+    0x40, 0xDA, 0x06, 0xCE, 0x0D, 0x54, 0x68, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x69, 0x2E, 0xCF, 0x09,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x09, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x06, 0xCE, 0x80, 0xF5, 0x28,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0x20,
+    0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A,
+    0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0x6F,
+    0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6D, 0x65, 0x6D, 0x6F,
+    0x72, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x61, 0x70,
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x65, 0x6E, 0x74, 0x72,
+    0x69, 0x65, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x69, 0x66, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6B, 0x6E,
+    0x6F, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x6E,
+    0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x67, 0x6F, 0x69, 0x6E,
+    0x67, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F,
+    0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x2C, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x6D, 0x65,
+    0x6D, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x76, 0x6F, 0x69, 0x64, 0x65, 0x64,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x12, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2D, 0x75,
+    0x70, 0x70, 0x65, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x12,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63,
+    0x69, 0x69, 0x2D, 0x75, 0x70, 0x70, 0x65, 0x72, 0xDA, 0x06,
+    0xCE, 0x80, 0xBE, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2D, 0x75, 0x70, 0x70,
+    0x65, 0x72, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70,
+    0x70, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x20, 0x76, 0x65,
+    0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x6D, 0x73, 0x65, 0x6C, 0x76, 0x65, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x41, 0x53, 0x43, 0x49, 0x49, 0x2E, 0x20,
+    0x44, 0x6F, 0x65, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+    0x61, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x69, 0x6D,
+    0x70, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x63,
+    0x68, 0x65, 0x63, 0x6B, 0x2C, 0x20, 0x6D, 0x65, 0x61, 0x6E,
+    0x69, 0x6E, 0x67, 0x20, 0x6E, 0x6F, 0x20, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F,
+    0x72, 0x74, 0x2E, 0xCF, 0x09, 0x75, 0x6E, 0x6D, 0x61, 0x72,
+    0x73, 0x68, 0x61, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81,
+    0x8E, 0xDA, 0x06, 0xCE, 0x80, 0xC2, 0x28, 0x75, 0x6E, 0x6D,
+    0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x5B, 0x2C, 0x6C, 0x6F, 0x6F, 0x6B,
+    0x75, 0x70, 0x5D, 0x29, 0x0A, 0x0A, 0x55, 0x6E, 0x6D, 0x61,
+    0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x61, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x6F, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x6C, 0x6F, 0x6F,
+    0x6B, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x70, 0x72, 0x6F,
+    0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+    0x6C, 0x69, 0x61, 0x73, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20,
+    0x62, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65,
+    0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C,
+    0x6C, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E,
+    0xCF, 0x07, 0x73, 0x65, 0x74, 0x2F, 0x6E, 0x65, 0x77, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x84, 0xD3, 0xDA, 0x06, 0xCE, 0x81,
+    0x3E, 0x28, 0x73, 0x65, 0x74, 0x2F, 0x6E, 0x65, 0x77, 0x20,
+    0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x78, 0x73,
+    0x2E, 0x20, 0x41, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6F,
+    0x6E, 0x6C, 0x79, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6B, 0x65,
+    0x79, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x61,
+    0x6B, 0x65, 0x73, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20,
+    0x68, 0x61, 0x6C, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65,
+    0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x20, 0x28, 0x67, 0x65,
+    0x74, 0x20, 0x73, 0x20, 0x78, 0x29, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+    0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2E, 0x20,
+    0x28, 0x70, 0x75, 0x74, 0x20, 0x73, 0x20, 0x78, 0x20, 0x74,
+    0x72, 0x75, 0x65, 0x29, 0x20, 0x61, 0x64, 0x64, 0x73, 0x20,
+    0x78, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x28, 0x70, 0x75, 0x74, 0x20, 0x73, 0x20, 0x78,
+    0x20, 0x6E, 0x69, 0x6C, 0x29, 0x20, 0x72, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x73, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x49, 0x74,
+    0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63, 0x68,
+    0x20, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0xCF,
+    0x08, 0x77, 0x68, 0x65, 0x6E, 0x2D, 0x6C, 0x65, 0x74, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x41,
+    0x28, 0x77, 0x68, 0x65, 0x6E, 0x2D, 0x6C, 0x65, 0x74, 0x20,
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x26,
+    0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x53, 0x61,
+    0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x28, 0x69, 0x66, 0x2D,
+    0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0x20, 0x28, 0x64, 0x6F, 0x20, 0x3B, 0x62, 0x6F,
+    0x64, 0x79, 0x29, 0x29, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x4C, 0x59, 0xCD, 0x00, 0x00,
+    0x4C, 0xCB, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00,
+    0x06, 0x01, 0x02, 0x08, 0xCE, 0x08, 0x77, 0x68, 0x65, 0x6E,
+    0x2D, 0x6C, 0x65, 0x74, 0xDA, 0x24, 0xDA, 0x65, 0xDA, 0x7F,
+    0x26, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2E, 0x01,
+    0x00, 0x00, 0x3D, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00,
+    0x2D, 0x05, 0x00, 0x03, 0x3D, 0x04, 0x00, 0x00, 0x03, 0x04,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x4C, 0xAC, 0x1E, 0xBF, 0xE2,
+    0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xE2, 0x1E,
+    0xBF, 0xE2, 0x1E, 0xBF, 0xE2, 0x1E, 0xBF, 0xE2, 0x1E, 0xCF,
+    0x06, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x4A, 0x28, 0x73, 0x6F, 0x72, 0x74,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x62, 0x79, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x6F, 0x72, 0x74,
+    0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x64,
+    0x69, 0x66, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6F, 0x6C, 0x64, 0x20, 0x6F, 0x6E, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x56,
+    0x62, 0xCD, 0x00, 0x00, 0x56, 0xD5, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x05, 0x02, 0x02, 0x05, 0xCE, 0x06,
+    0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0xDA, 0x24, 0xDA, 0x82,
+    0xF2, 0xDA, 0x83, 0x8E, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x03,
+    0x00, 0x00, 0x2C, 0x03, 0x01, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x30, 0x04, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x56, 0xC0, 0x10,
+    0xBF, 0xF0, 0x10, 0xBF, 0xEA, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF,
+    0xE6, 0x1A, 0xCF, 0x04, 0x6B, 0x65, 0x65, 0x70, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x80, 0xA3,
+    0x28, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x70, 0x72, 0x65, 0x64,
+    0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x47, 0x69, 0x76,
+    0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x74, 0x61, 0x6B, 0x65,
+    0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x28,
+    0x70, 0x72, 0x65, 0x64, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75,
+    0x74, 0x68, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x72,
+    0x75, 0x74, 0x68, 0x79, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C,
+    0x74, 0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0xCD, 0x00, 0x00, 0x5E, 0xBD, 0xCD, 0x00, 0x00, 0x5F, 0xDA,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0C, 0x02,
+    0x01, 0x0E, 0xCE, 0x04, 0x6B, 0x65, 0x65, 0x70, 0xDA, 0x24,
+    0xDA, 0x2F, 0x38, 0x04, 0x00, 0x00, 0x17, 0x05, 0x01, 0x00,
+    0x37, 0x07, 0x05, 0x00, 0x25, 0x06, 0x00, 0x00, 0x3E, 0x08,
+    0x06, 0x07, 0x1A, 0x08, 0x08, 0x00, 0x33, 0x0A, 0x05, 0x06,
+    0x44, 0x0B, 0x0A, 0x00, 0x1A, 0x0B, 0x03, 0x00, 0x2C, 0x04,
+    0x0B, 0x00, 0x43, 0x09, 0x00, 0x00, 0x05, 0x06, 0x06, 0x01,
+    0x18, 0xF8, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x5F, 0x79, 0x0C, 0x04, 0x4A, 0xBF, 0xB6, 0x4A, 0xBF,
+    0xB6, 0x4A, 0xBF, 0xB6, 0x4A, 0xBF, 0xB6, 0x4A, 0xBF, 0xB6,
+    0x4A, 0xBF, 0xDA, 0x0A, 0xBF, 0xEB, 0x30, 0xBF, 0xEE, 0x11,
+    0xBF, 0xEF, 0x11, 0xBF, 0xB8, 0x4A, 0xBF, 0xB6, 0x4A, 0xBE,
+    0xEA, 0x81, 0x1D, 0xCF, 0x04, 0x64, 0x6F, 0x63, 0x2A, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x4A, 0x28, 0x64, 0x6F,
+    0x63, 0x2A, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x73, 0x79, 0x6D,
+    0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x9B, 0x63, 0xCD, 0x00, 0x00, 0x9E, 0x3A, 0xDA, 0x03,
+    0xDA, 0x80, 0xE7, 0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F,
+    0x70, 0x6F, 0x70, 0x65, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x6F, 0x70, 0x65,
+    0x6E, 0xDA, 0x06, 0xCE, 0x81, 0x1A, 0x28, 0x66, 0x69, 0x6C,
+    0x65, 0x2F, 0x70, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x70, 0x61,
+    0x74, 0x68, 0x20, 0x5B, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x5D,
+    0x29, 0x0A, 0x0A, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x61, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x20,
+    0x62, 0x79, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+    0x73, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x6F, 0x70, 0x65, 0x6E, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x3A, 0x72, 0x20, 0x28, 0x72, 0x65, 0x61, 0x64,
+    0x29, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x3A,
+    0x77, 0x20, 0x28, 0x77, 0x72, 0x69, 0x74, 0x65, 0x29, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x3A,
+    0x72, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63,
+    0x65, 0x73, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+    0x20, 0x49, 0x6E, 0x20, 0x3A, 0x77, 0x20, 0x6D, 0x6F, 0x64,
+    0x65, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x64,
+    0x69, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74,
+    0x65, 0x6E, 0x20, 0x74, 0x6F, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x08,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x6F, 0x73, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63,
+    0x6F, 0x73, 0xDA, 0x06, 0xCE, 0x26, 0x28, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x63, 0x6F, 0x73, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x6F, 0x73, 0x69, 0x6E, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x78, 0x2E, 0xCF, 0x0C, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xDA, 0x06, 0xCE, 0x81,
+    0x3C, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x73,
+    0x6C, 0x69, 0x63, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x5B, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D,
+    0x30, 0x20, 0x5B, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x3D, 0x28,
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x54, 0x61,
+    0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70,
+    0x65, 0x6E, 0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x49, 0x6E,
+    0x64, 0x65, 0x78, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20,
+    0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65,
+    0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x69, 0x6E,
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E,
+    0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x73, 0x74,
+    0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x0E, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2F, 0x67, 0x65, 0x74, 0x70, 0x72,
+    0x6F, 0x74, 0x6F, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x14,
+    0xDA, 0x06, 0xCE, 0x80, 0x83, 0x28, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2F, 0x67, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x20, 0x74, 0x61, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x61, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20,
+    0x6E, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79,
+    0x70, 0x65, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77,
+    0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74,
+    0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E, 0xCF, 0x11, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x6D, 0x61, 0x78,
+    0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x11, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74,
+    0x6D, 0x61, 0x78, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xDA, 0x06,
+    0xCE, 0x80, 0x8E, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F,
+    0x73, 0x65, 0x74, 0x6D, 0x61, 0x78, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x66, 0x69, 0x62, 0x20, 0x6D, 0x61, 0x78, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69,
+    0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20,
+    0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66,
+    0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74,
+    0x61, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x38, 0x31, 0x39, 0x32, 0x2E, 0xCF, 0x0D, 0x70, 0x6D, 0x61,
+    0x70, 0x2F, 0x74, 0x6F, 0x2D, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x70, 0x6D, 0x61, 0x70,
+    0x2F, 0x74, 0x6F, 0x2D, 0x74, 0x61, 0x62, 0x6C, 0x65, 0xDA,
+    0x06, 0xCE, 0x3D, 0x28, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x74,
+    0x6F, 0x2D, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6D, 0x61,
+    0x70, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6E, 0x76, 0x65, 0x72,
+    0x74, 0x20, 0x61, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73,
+    0x74, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2E, 0xCF, 0x03, 0x64, 0x65, 0x63, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x17, 0x28, 0x64, 0x65,
+    0x63, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x78, 0x20, 0x2D, 0x20, 0x31, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x92, 0x6F, 0x92,
+    0x95, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x03,
+    0x01, 0x00, 0x02, 0xCE, 0x03, 0x64, 0x65, 0x63, 0xDA, 0x24,
+    0x05, 0x02, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x92, 0x8E,
+    0x06, 0xBF, 0xFA, 0x06, 0xCF, 0x0B, 0x66, 0x72, 0x65, 0x71,
+    0x75, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0xD4, 0x02, 0xD3,
+    0x01, 0xDA, 0x06, 0xCE, 0x56, 0x28, 0x66, 0x72, 0x65, 0x71,
+    0x75, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x64, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x63, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63,
+    0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x83, 0x69, 0xCD, 0x00, 0x00, 0x84, 0x3C, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0C, 0x01, 0x00, 0x10,
+    0xCE, 0x0B, 0x66, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63,
+    0x69, 0x65, 0x73, 0xDA, 0x24, 0x3C, 0x03, 0x00, 0x00, 0x17,
+    0x04, 0x00, 0x00, 0x37, 0x06, 0x04, 0x00, 0x25, 0x05, 0x00,
+    0x00, 0x3E, 0x07, 0x05, 0x06, 0x1A, 0x07, 0x0A, 0x00, 0x33,
+    0x09, 0x04, 0x05, 0x33, 0x0A, 0x03, 0x09, 0x1A, 0x0A, 0x03,
+    0x00, 0x05, 0x08, 0x0A, 0x01, 0x18, 0x02, 0x00, 0x00, 0x25,
+    0x08, 0x01, 0x00, 0x34, 0x03, 0x09, 0x08, 0x05, 0x05, 0x05,
+    0x01, 0x18, 0xF6, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xCD,
+    0x00, 0x00, 0x83, 0xCD, 0x0E, 0x04, 0x54, 0xBF, 0xAC, 0x54,
+    0xBF, 0xAC, 0x54, 0xBF, 0xAC, 0x54, 0xBF, 0xAC, 0x54, 0xBF,
+    0xAC, 0x54, 0xBF, 0xCD, 0x0C, 0x16, 0x0F, 0xBF, 0xF7, 0x06,
+    0xBF, 0xF4, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xE2, 0x1F, 0xBF,
+    0xAD, 0x54, 0xBF, 0xAC, 0x54, 0xBF, 0x36, 0x80, 0xD3, 0xCF,
+    0x0B, 0x2A, 0x64, 0x6F, 0x63, 0x2D, 0x77, 0x69, 0x64, 0x74,
+    0x68, 0x2A, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x28,
+    0x57, 0x69, 0x64, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x63,
+    0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x73, 0x20, 0x74, 0x6F, 0x20,
+    0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x64, 0x6F, 0x63, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+    0xDA, 0x80, 0xD1, 0xDA, 0x80, 0xDC, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x97, 0xCC, 0xCD, 0x00,
+    0x00, 0x98, 0x0E, 0xCF, 0x07, 0x67, 0x65, 0x74, 0x6C, 0x69,
+    0x6E, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x38,
+    0x28, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x62,
+    0x75, 0x66, 0x20, 0x70, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x61, 0x64, 0x20, 0x61, 0x20, 0x6C, 0x69, 0x6E, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x64, 0x69,
+    0x6E, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xB0, 0xD9, 0xCD, 0x00,
+    0x00, 0xB1, 0x75, 0xDA, 0x03, 0xDA, 0x81, 0x69, 0xCF, 0x06,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x81, 0x0C, 0xDA, 0x06, 0xCE, 0x80, 0xCC, 0x28, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x26, 0x20, 0x6B, 0x76,
+    0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x2E, 0x20,
+    0x6B, 0x76, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6B, 0x31,
+    0x2C, 0x20, 0x76, 0x31, 0x2C, 0x20, 0x6B, 0x32, 0x2C, 0x20,
+    0x76, 0x32, 0x2C, 0x20, 0x6B, 0x33, 0x2C, 0x20, 0x76, 0x33,
+    0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6B,
+    0x76, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20,
+    0x6F, 0x64, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+    0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x6E, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x2E, 0xCF, 0x09, 0x67, 0x63, 0x63, 0x6F, 0x6C, 0x6C,
+    0x65, 0x63, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x67,
+    0x63, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0xDA, 0x06,
+    0xCE, 0x80, 0xA9, 0x28, 0x67, 0x63, 0x63, 0x6F, 0x6C, 0x6C,
+    0x65, 0x63, 0x74, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x79,
+    0x6F, 0x75, 0x6E, 0x67, 0x29, 0x0A, 0x0A, 0x52, 0x75, 0x6E,
+    0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63,
+    0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x79, 0x6F, 0x75, 0x6E, 0x67, 0x20,
+    0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2C,
+    0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+    0x65, 0x63, 0x74, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74,
+    0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6C,
+    0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x59,
+    0x6F, 0x75, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x70, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x79, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68,
+    0x69, 0x73, 0x20, 0x6D, 0x61, 0x6E, 0x75, 0x61, 0x6C, 0x6C,
+    0x79, 0x2E, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73,
+    0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E, 0xDA, 0x06, 0xCE, 0x24,
+    0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x6E, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x09, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x74,
+    0x61, 0x6E, 0xDA, 0x06, 0xCE, 0x2B, 0x28, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x74, 0x61, 0x6E, 0x67,
+    0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+    0x0A, 0x6F, 0x73, 0x2F, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x6F, 0x73, 0x2F,
+    0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0xDA, 0x06, 0xCE,
+    0x80, 0x82, 0x28, 0x6F, 0x73, 0x2F, 0x65, 0x78, 0x65, 0x63,
+    0x75, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61,
+    0x6D, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A,
+    0x0A, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x61,
+    0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x6F,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74,
+    0x65, 0x6D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x73,
+    0x73, 0x20, 0x69, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61,
+    0x6D, 0x2E, 0xCF, 0x06, 0x64, 0x69, 0x73, 0x61, 0x73, 0x6D,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x06, 0x64, 0x69, 0x73, 0x61,
+    0x73, 0x6D, 0xDA, 0x06, 0xCE, 0x80, 0xAB, 0x28, 0x64, 0x69,
+    0x73, 0x61, 0x73, 0x6D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x65,
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A, 0x66,
+    0x75, 0x6E, 0x63, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62,
+    0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x2C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20,
+    0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72,
+    0x6F, 0x77, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x61, 0x64,
+    0x6C, 0x79, 0x0A, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20, 0x61,
+    0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xCF, 0x09,
+    0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2D, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x4A,
+    0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2D,
+    0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F,
+    0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E,
+    0x65, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74,
+    0x65, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72,
+    0x74, 0x65, 0x64, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x84, 0xBF, 0x85, 0x41, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x99, 0x00, 0x00, 0x05, 0x01, 0x03, 0x06, 0xCE, 0x09, 0x64,
+    0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2D, 0xDA, 0x24,
+    0xDA, 0x5C, 0xDA, 0x81, 0x95, 0xDA, 0x83, 0x38, 0x26, 0x03,
+    0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2D, 0x00, 0x03, 0x04,
+    0x2E, 0x01, 0x00, 0x00, 0x26, 0x03, 0x02, 0x00, 0x30, 0x03,
+    0x00, 0x00, 0x85, 0x1B, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB,
+    0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB, 0x25,
+    0xCF, 0x03, 0x6D, 0x61, 0x78, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x3B, 0x28, 0x6D, 0x61, 0x78, 0x20, 0x26, 0x20,
+    0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x20, 0x6D, 0x61, 0x78,
+    0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x50, 0xE7, 0xCD, 0x00, 0x00, 0x51, 0x3E, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x03, 0x00, 0x02,
+    0x04, 0xCE, 0x03, 0x6D, 0x61, 0x78, 0xDA, 0x24, 0xD7, 0xCD,
+    0x00, 0x09, 0x00, 0x1A, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x01,
+    0x3E, 0x37, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19,
+    0x02, 0x0A, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01,
+    0x00, 0x33, 0x04, 0x00, 0x05, 0x40, 0x02, 0x03, 0x04, 0x1A,
+    0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04,
+    0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x81, 0xF7, 0x26, 0x02,
+    0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00,
+    0x30, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x51, 0x2E, 0x0F,
+    0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xCF,
+    0x06, 0x6D, 0x61, 0x70, 0x63, 0x61, 0x74, 0xD4, 0x02, 0xD3,
+    0x02, 0xDA, 0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x71, 0x28, 0x6D,
+    0x61, 0x70, 0x63, 0x61, 0x74, 0x20, 0x66, 0x20, 0x69, 0x6E,
+    0x64, 0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x70, 0x20, 0x61, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E,
+    0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x5B, 0x70, 0xCD, 0x00, 0x00, 0x5C, 0x3F, 0xDA, 0x03,
+    0xDA, 0x82, 0xE2, 0xCF, 0x0A, 0x74, 0x61, 0x6B, 0x65, 0x2D,
+    0x75, 0x6E, 0x74, 0x69, 0x6C, 0xD4, 0x02, 0xD3, 0x02, 0xDA,
+    0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x80, 0x9F, 0x28, 0x74, 0x61,
+    0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x70,
+    0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72,
+    0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x74,
+    0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x73, 0x61, 0x74, 0x69, 0x73, 0x66,
+    0x79, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65,
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x6F, 0x6E,
+    0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x61, 0x69,
+    0x6C, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x65, 0x31, 0xCD, 0x00,
+    0x00, 0x66, 0x31, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00,
+    0x00, 0x06, 0x02, 0x02, 0x08, 0xCE, 0x0A, 0x74, 0x61, 0x6B,
+    0x65, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0xDA, 0x24, 0xDA,
+    0x27, 0xDA, 0x82, 0xF2, 0x2C, 0x00, 0x01, 0x00, 0x43, 0x04,
+    0x00, 0x00, 0x1A, 0x04, 0x05, 0x00, 0x25, 0x05, 0x00, 0x00,
+    0x2D, 0x01, 0x05, 0x04, 0x26, 0x05, 0x01, 0x00, 0x30, 0x05,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x65,
+    0xF0, 0x14, 0xBF, 0xEC, 0x14, 0x05, 0x27, 0xBF, 0xE3, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF,
+    0xE2, 0x27, 0xCF, 0x06, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0x9F, 0x28,
+    0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x64, 0x73, 0x20,
+    0x6B, 0x65, 0x79, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x26,
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x41, 0x63,
+    0x63, 0x65, 0x70, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65,
+    0x79, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65,
+    0x73, 0x20, 0x69, 0x74, 0x73, 0x27, 0x20, 0x61, 0x73, 0x73,
+    0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x74, 0x68,
+    0x65, 0x6E, 0x2C, 0x20, 0x69, 0x73, 0x20, 0x61, 0x73, 0x73,
+    0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x27, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x7D, 0xB0,
+    0xCD, 0x00, 0x00, 0x7E, 0x96, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x99, 0x00, 0x00, 0x08, 0x03, 0x00, 0x06, 0xCE, 0x06, 0x75,
+    0x70, 0x64, 0x61, 0x74, 0x65, 0xDA, 0x24, 0x33, 0x06, 0x00,
+    0x01, 0x2B, 0x06, 0x00, 0x00, 0x2E, 0x03, 0x00, 0x00, 0x2F,
+    0x07, 0x02, 0x00, 0x34, 0x00, 0x01, 0x07, 0x03, 0x07, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0x7E, 0x67, 0x0B, 0x13, 0x0F, 0xBF,
+    0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xE3, 0x1E, 0xBF, 0xE2,
+    0x1E, 0xCF, 0x0C, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E,
+    0x2D, 0x69, 0x6E, 0x74, 0x6F, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x80, 0x91, 0x28, 0x66, 0x6C, 0x61, 0x74, 0x74,
+    0x65, 0x6E, 0x2D, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x61,
+    0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x73, 0x74,
+    0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x28,
+    0x74, 0x72, 0x65, 0x65, 0x29, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65,
+    0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x27, 0x69, 0x6E, 0x74, 0x6F, 0x27, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x86,
+    0xE2, 0xCD, 0x00, 0x00, 0x87, 0xE6, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x0A, 0x02, 0x02, 0x12, 0xCE, 0x0C,
+    0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x2D, 0x69, 0x6E,
+    0x74, 0x6F, 0xDA, 0x24, 0xDA, 0x83, 0xAF, 0xDA, 0x2F, 0x28,
+    0x02, 0x00, 0x00, 0x17, 0x03, 0x01, 0x00, 0x37, 0x05, 0x03,
+    0x00, 0x25, 0x04, 0x00, 0x00, 0x3E, 0x06, 0x04, 0x05, 0x1A,
+    0x06, 0x0C, 0x00, 0x33, 0x08, 0x03, 0x04, 0x2B, 0x08, 0x00,
+    0x00, 0x43, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x04, 0x00, 0x2C,
+    0x00, 0x08, 0x00, 0x2F, 0x09, 0x02, 0x00, 0x18, 0x03, 0x00,
+    0x00, 0x2C, 0x00, 0x08, 0x00, 0x43, 0x09, 0x01, 0x00, 0x05,
+    0x04, 0x04, 0x01, 0x18, 0xF4, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0x86, 0xE2, 0x81, 0x04, 0xBF, 0x9C,
+    0x5C, 0xBF, 0xA4, 0x5C, 0xBF, 0xA4, 0x5C, 0xBF, 0xA4, 0x5C,
+    0xBF, 0xA4, 0x5C, 0xBF, 0xA4, 0x5C, 0xBF, 0xBD, 0x0B, 0xBF,
+    0xF5, 0x0B, 0xBF, 0xF1, 0x46, 0xBF, 0xD1, 0x14, 0xBF, 0xEC,
+    0x14, 0xBF, 0xD5, 0x46, 0xBF, 0xED, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xA6, 0x5C, 0xBF, 0xA4, 0x5C, 0xBF, 0x04, 0x81, 0x04,
+    0xCF, 0x0A, 0x64, 0x6F, 0x63, 0x2D, 0x66, 0x6F, 0x72, 0x6D,
+    0x61, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x39,
+    0x28, 0x64, 0x6F, 0x63, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x61,
+    0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x61, 0x70,
+    0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65,
+    0x6E, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x98, 0x11, 0xCD,
+    0x00, 0x00, 0x9B, 0x60, 0xDA, 0x03, 0xDA, 0x80, 0xE4, 0xCF,
+    0x03, 0x61, 0x6C, 0x6C, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x21,
+    0xCB, 0xDA, 0x06, 0xCE, 0x59, 0x28, 0x61, 0x6C, 0x6C, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75,
+    0x74, 0x68, 0x79, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72,
+    0x77, 0x69, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
+    0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0xCD, 0x00, 0x00, 0xA7, 0xB1, 0xCD, 0x00, 0x00, 0xA8,
+    0x68, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0A,
+    0x02, 0x00, 0x0F, 0xCE, 0x03, 0x61, 0x6C, 0x6C, 0xDA, 0x24,
+    0x23, 0x03, 0x00, 0x00, 0x17, 0x04, 0x01, 0x00, 0x37, 0x06,
+    0x04, 0x00, 0x25, 0x05, 0x00, 0x00, 0x3E, 0x08, 0x05, 0x06,
+    0x1A, 0x08, 0x03, 0x00, 0x17, 0x07, 0x03, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x05, 0x00,
+    0x33, 0x09, 0x04, 0x05, 0x44, 0x03, 0x09, 0x00, 0x05, 0x05,
+    0x05, 0x01, 0x18, 0xF7, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0xA8, 0x22, 0x0D, 0x04, 0x2E, 0xBF, 0xD2,
+    0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xD2, 0x2E,
+    0xBF, 0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF,
+    0xD2, 0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0xF7, 0x07, 0xBF, 0xD4,
+    0x2E, 0xBF, 0xD2, 0x2E, 0xBF, 0x50, 0x80, 0xB7, 0xCF, 0x09,
+    0x64, 0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0x96, 0x28, 0x64,
+    0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x78,
+    0x20, 0x79, 0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20,
+    0x6E, 0x6F, 0x74, 0x3D, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x73, 0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x29, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64,
+    0x65, 0x72, 0x65, 0x64, 0x20, 0x20, 0x65, 0x71, 0x75, 0x61,
+    0x6C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+    0x68, 0x61, 0x76, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74,
+    0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x4D, 0x75, 0x63, 0x68,
+    0x20, 0x73, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x61, 0x6E, 0x20, 0x6E, 0x6F, 0x74, 0x3D, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xA9, 0x41,
+    0xCD, 0x00, 0x00, 0xAB, 0x74, 0xDA, 0x03, 0xDA, 0x81, 0x13,
+    0xCF, 0x02, 0x70, 0x70, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x1F, 0x28, 0x70, 0x70, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x50, 0x72, 0x65, 0x74, 0x74, 0x79, 0x20, 0x70, 0x72, 0x69,
+    0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x64, 0x6F,
+    0x75, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0xCD, 0x00, 0x00, 0xAD, 0x54, 0xCD, 0x00, 0x00, 0xAD, 0xA3,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01,
+    0x04, 0x09, 0xCE, 0x02, 0x70, 0x70, 0xDA, 0x24, 0xDA, 0x80,
+    0xD8, 0xDA, 0x83, 0x33, 0xDA, 0x83, 0x34, 0xDA, 0x80, 0xD0,
+    0x26, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x39, 0x02,
+    0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2D, 0x02, 0x03, 0x00,
+    0x43, 0x03, 0x02, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x02,
+    0x03, 0x00, 0x30, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00, 0xAD,
+    0x88, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE7,
+    0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xE0, 0x21,
+    0xBF, 0xDF, 0x21, 0xBF, 0xDF, 0x21, 0xDA, 0x84, 0x74, 0xD3,
+    0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x08, 0x00, 0x04, 0x02,
+    0x01, 0x00, 0x02, 0xCE, 0x05, 0x79, 0x69, 0x65, 0x6C, 0x64,
+    0x32, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x06,
+    0xCE, 0x80, 0xDE, 0x28, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x59, 0x69, 0x65, 0x6C, 0x64, 0x20,
+    0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F,
+    0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x68, 0x65,
+    0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+    0x79, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x2C, 0x20, 0x69, 0x74,
+    0x73, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x61, 0x6E,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65,
+    0x61, 0x64, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x73,
+    0x20, 0x69, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x74, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D,
+    0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x79, 0x69, 0x65, 0x6C,
+    0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x61,
+    0x73, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65,
+    0x73, 0x75, 0x6D, 0x65, 0x2E, 0xCF, 0x04, 0x6E, 0x6F, 0x74,
+    0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82, 0xC6, 0xDA, 0x06,
+    0xCE, 0x4C, 0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x26, 0x20,
+    0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20,
+    0x61, 0x6E, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C,
+    0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+    0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E, 0xCF, 0x08,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0x78, 0x70, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65,
+    0x78, 0x70, 0xDA, 0x06, 0xCE, 0x2A, 0x28, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x65, 0x78, 0x70, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x65, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F, 0x77,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x0B,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x6F, 0x70,
+    0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2F, 0x70, 0x6F, 0x70, 0x6E, 0xDA, 0x06,
+    0xCE, 0x5E, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x70, 0x6F, 0x70, 0x6E, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x0C, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0xDA, 0x06,
+    0xCE, 0x80, 0xE3, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x43, 0x6C, 0x65, 0x61,
+    0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20,
+    0x71, 0x75, 0x65, 0x75, 0x65, 0x2E, 0x20, 0x43, 0x61, 0x6E,
+    0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x69,
+    0x66, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x75,
+    0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x44, 0x6F,
+    0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x73,
+    0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x6E,
+    0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x75,
+    0x6D, 0x6E, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72,
+    0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65,
+    0x67, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E,
+    0x67, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2C, 0x20,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E,
+    0xCF, 0x0A, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x65,
+    0x6F, 0x66, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x78, 0xDA,
+    0x06, 0xCE, 0x79, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x64,
+    0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F,
+    0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x73,
+    0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x70,
+    0x75, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x3A, 0x64, 0x65, 0x61, 0x64, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x2E, 0xCF, 0x07, 0x73, 0x65, 0x74, 0x2F,
+    0x61, 0x64, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xD4,
+    0xDA, 0x06, 0xCE, 0x39, 0x28, 0x73, 0x65, 0x74, 0x2F, 0x61,
+    0x64, 0x64, 0x20, 0x73, 0x65, 0x74, 0x20, 0x26, 0x20, 0x78,
+    0x73, 0x29, 0x0A, 0x0A, 0x41, 0x64, 0x64, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74,
+    0x2E, 0xCF, 0x04, 0x63, 0x6F, 0x72, 0x6F, 0xD4, 0x02, 0xD3,
+    0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x51, 0x28, 0x63,
+    0x6F, 0x72, 0x6F, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79,
+    0x29, 0x0A, 0x0A, 0x41, 0x20, 0x77, 0x72, 0x61, 0x70, 0x70,
+    0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x61, 0x6B,
+    0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x73,
+    0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20,
+    0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77,
+    0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B, 0x26, 0x5D, 0x20, 0x2E,
+    0x2E, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x46,
+    0xC9, 0xCD, 0x00, 0x00, 0x47, 0x54, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x99, 0x00, 0x00, 0x04, 0x00, 0x04, 0x09, 0xCE, 0x04,
+    0x63, 0x6F, 0x72, 0x6F, 0xDA, 0x24, 0xDA, 0x80, 0xF3, 0xD2,
+    0x01, 0x01, 0xDA, 0x84, 0x73, 0xDA, 0x80, 0x88, 0xDA, 0x81,
+    0x7F, 0x26, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2C,
+    0x02, 0x03, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x43, 0x02, 0x02,
+    0x00, 0x26, 0x03, 0x03, 0x00, 0x2C, 0x03, 0x02, 0x00, 0x26,
+    0x03, 0x02, 0x00, 0x30, 0x03, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x47, 0x3D, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xBF,
+    0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0xDA, 0x27, 0xBF, 0xD9,
+    0x27, 0xBF, 0xD9, 0x27, 0xBF, 0xD9, 0x27, 0xCF, 0x04, 0x63,
+    0x6F, 0x6D, 0x70, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x70, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x20, 0x26, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x29, 0x0A,
+    0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x6D, 0x75, 0x6C,
+    0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x6F,
+    0x73, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0xCD, 0x00, 0x00, 0x4C, 0xCE, 0xCD, 0x00, 0x00, 0x4E, 0xB2,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBB, 0x00, 0x00, 0x19, 0x00,
+    0x01, 0x40, 0x04, 0xCE, 0x04, 0x63, 0x6F, 0x6D, 0x70, 0xDA,
+    0x24, 0xDA, 0x7C, 0x28, 0x01, 0x00, 0x00, 0x37, 0x02, 0x00,
+    0x00, 0x17, 0x03, 0x02, 0x00, 0x25, 0x04, 0x00, 0x00, 0x1F,
+    0x02, 0x03, 0x04, 0x1A, 0x02, 0x02, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x1F, 0x04, 0x03, 0x05, 0x1A,
+    0x04, 0x04, 0x00, 0x25, 0x06, 0x00, 0x00, 0x33, 0x05, 0x00,
+    0x06, 0x03, 0x05, 0x00, 0x00, 0x25, 0x06, 0x02, 0x00, 0x1F,
+    0x05, 0x03, 0x06, 0x1A, 0x05, 0x07, 0x00, 0x35, 0x06, 0x00,
+    0x00, 0x17, 0x07, 0x06, 0x00, 0x35, 0x06, 0x00, 0x01, 0x17,
+    0x08, 0x06, 0x00, 0x2A, 0x06, 0x00, 0x00, 0x03, 0x06, 0x00,
+    0x00, 0x25, 0x09, 0x03, 0x00, 0x1F, 0x06, 0x03, 0x09, 0x1A,
+    0x06, 0x09, 0x00, 0x35, 0x09, 0x00, 0x00, 0x17, 0x0A, 0x09,
+    0x00, 0x35, 0x09, 0x00, 0x01, 0x17, 0x0B, 0x09, 0x00, 0x35,
+    0x09, 0x00, 0x02, 0x17, 0x0C, 0x09, 0x00, 0x2A, 0x09, 0x01,
+    0x00, 0x03, 0x09, 0x00, 0x00, 0x25, 0x0D, 0x04, 0x00, 0x1F,
+    0x09, 0x03, 0x0D, 0x1A, 0x09, 0x0B, 0x00, 0x35, 0x0D, 0x00,
+    0x00, 0x17, 0x0E, 0x0D, 0x00, 0x35, 0x0D, 0x00, 0x01, 0x17,
+    0x0F, 0x0D, 0x00, 0x35, 0x0D, 0x00, 0x02, 0x17, 0x10, 0x0D,
+    0x00, 0x35, 0x0D, 0x00, 0x03, 0x17, 0x11, 0x0D, 0x00, 0x2A,
+    0x0D, 0x02, 0x00, 0x03, 0x0D, 0x00, 0x00, 0x35, 0x0D, 0x00,
+    0x00, 0x17, 0x12, 0x0D, 0x00, 0x35, 0x0D, 0x00, 0x01, 0x17,
+    0x13, 0x0D, 0x00, 0x35, 0x0D, 0x00, 0x02, 0x17, 0x14, 0x0D,
+    0x00, 0x35, 0x0D, 0x00, 0x03, 0x17, 0x15, 0x0D, 0x00, 0x35,
+    0x0D, 0x00, 0x04, 0x17, 0x16, 0x0D, 0x00, 0x2A, 0x0D, 0x03,
+    0x00, 0x25, 0x17, 0x05, 0x00, 0x25, 0x18, 0xFF, 0xFF, 0x2D,
+    0x00, 0x17, 0x18, 0x43, 0x17, 0x00, 0x00, 0x2B, 0x0D, 0x00,
+    0x00, 0x2E, 0x17, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0xCD,
+    0x00, 0xD4, 0x00, 0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0xDA,
+    0x24, 0x27, 0x02, 0x00, 0x08, 0x44, 0x01, 0x00, 0x02, 0x2B,
+    0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x07, 0x30, 0x02, 0x00,
+    0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x4D, 0xB6, 0x04, 0xBF,
+    0xFC, 0x04, 0xBF, 0xF9, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF8,
+    0x08, 0xCD, 0x00, 0xD4, 0x00, 0x00, 0x04, 0x01, 0x00, 0x07,
+    0x01, 0xDA, 0x24, 0x27, 0x02, 0x00, 0x0C, 0x44, 0x01, 0x00,
+    0x02, 0x27, 0x03, 0x00, 0x0B, 0x44, 0x02, 0x01, 0x03, 0x2B,
+    0x02, 0x00, 0x00, 0x27, 0x01, 0x00, 0x0A, 0x30, 0x01, 0x00,
+    0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x4D, 0xF0, 0x04, 0xBF,
+    0xFC, 0x04, 0xBF, 0xF9, 0x08, 0xBF, 0xF8, 0x08, 0xBF, 0xF5,
+    0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0xCD, 0x00, 0xD4,
+    0x00, 0x00, 0x04, 0x01, 0x00, 0x09, 0x01, 0xDA, 0x24, 0x27,
+    0x02, 0x00, 0x11, 0x44, 0x01, 0x00, 0x02, 0x27, 0x03, 0x00,
+    0x10, 0x44, 0x02, 0x01, 0x03, 0x27, 0x03, 0x00, 0x0F, 0x44,
+    0x01, 0x02, 0x03, 0x2B, 0x01, 0x00, 0x00, 0x27, 0x02, 0x00,
+    0x0E, 0x30, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00,
+    0x4E, 0x2E, 0x04, 0xBF, 0xFC, 0x04, 0xBF, 0xF9, 0x08, 0xBF,
+    0xF8, 0x08, 0xBF, 0xF5, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF1,
+    0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xCD, 0x00, 0xD4,
+    0x00, 0x00, 0x04, 0x01, 0x00, 0x0B, 0x01, 0xDA, 0x24, 0x27,
+    0x02, 0x00, 0x16, 0x44, 0x01, 0x00, 0x02, 0x27, 0x03, 0x00,
+    0x15, 0x44, 0x02, 0x01, 0x03, 0x27, 0x03, 0x00, 0x14, 0x44,
+    0x01, 0x02, 0x03, 0x27, 0x03, 0x00, 0x13, 0x44, 0x02, 0x01,
+    0x03, 0x2B, 0x02, 0x00, 0x00, 0x27, 0x01, 0x00, 0x12, 0x30,
+    0x01, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x4E, 0x7A,
+    0x04, 0xBF, 0xFC, 0x04, 0xBF, 0xF9, 0x08, 0xBF, 0xF8, 0x08,
+    0xBF, 0xF5, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF1, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xED, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC,
+    0x14, 0xCD, 0x00, 0x00, 0x4C, 0xCE, 0x81, 0xE4, 0xBE, 0xA1,
+    0x11, 0xBF, 0xE9, 0x81, 0x64, 0xBE, 0x9C, 0x81, 0x64, 0xBE,
+    0x9C, 0x81, 0x64, 0xBE, 0x9C, 0x81, 0x64, 0xBE, 0x9C, 0x81,
+    0x64, 0xBE, 0x9C, 0x81, 0x64, 0xBE, 0x9C, 0x81, 0x64, 0xBE,
+    0x9C, 0x81, 0x64, 0xBE, 0xC5, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xC7, 0x81, 0x64, 0xBE, 0x9C, 0x81, 0x64,
+    0xBE, 0x9C, 0x81, 0x64, 0xBE, 0xDD, 0x2F, 0xBF, 0xD1, 0x2F,
+    0xBF, 0xD1, 0x2F, 0xBF, 0xD1, 0x2F, 0xBF, 0xEE, 0x11, 0xBF,
+    0xEF, 0x11, 0xBF, 0x91, 0x81, 0x64, 0xBE, 0x9C, 0x81, 0x64,
+    0xBE, 0x9C, 0x81, 0x64, 0xBF, 0x14, 0x33, 0xBF, 0xCD, 0x33,
+    0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF,
+    0xCD, 0x33, 0xBF, 0xEA, 0x15, 0xBF, 0xEB, 0x15, 0xBF, 0x56,
+    0x81, 0x64, 0xBE, 0x9C, 0x81, 0x64, 0xBE, 0x9C, 0x81, 0x64,
+    0xBF, 0x4F, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF,
+    0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9,
+    0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xE6, 0x19, 0xBF, 0xE7, 0x19,
+    0x07, 0x73, 0xBF, 0x8D, 0x73, 0xBF, 0x8D, 0x73, 0xBF, 0x8D,
+    0x73, 0xBF, 0x8D, 0x73, 0xBF, 0x8D, 0x73, 0xBF, 0x8D, 0x73,
+    0xBF, 0x8D, 0x73, 0xBF, 0x8D, 0x73, 0xBF, 0x8D, 0x73, 0xBF,
+    0xB6, 0x1D, 0x0F, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C,
+    0xBF, 0xE4, 0x1C, 0xBF, 0xB2, 0x4F, 0xBF, 0xB1, 0x4F, 0xBF,
+    0xB1, 0x4F, 0xCF, 0x04, 0x73, 0x70, 0x69, 0x74, 0xD4, 0x02,
+    0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x62, 0x28, 0x73, 0x70, 0x69,
+    0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6D, 0x6F, 0x64, 0x65,
+    0x20, 0x26, 0x29, 0x0A, 0x0A, 0x57, 0x72, 0x69, 0x74, 0x65,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x61, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x20,
+    0x43, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0xCD, 0x00, 0x00, 0x8D, 0x3E, 0xCD, 0x00, 0x00, 0x8E,
+    0x5E, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x98, 0x00, 0x00, 0x0A,
+    0x03, 0x07, 0x16, 0xCE, 0x04, 0x73, 0x70, 0x69, 0x74, 0xDA,
+    0x24, 0xD0, 0x01, 0x77, 0xDA, 0x81, 0x55, 0xDA, 0x81, 0x89,
+    0xCE, 0x0B, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6D, 0x6F,
+    0x64, 0x65, 0x20, 0xDA, 0x80, 0xD5, 0xDA, 0x81, 0x65, 0xDA,
+    0x81, 0x56, 0x22, 0x06, 0x00, 0x00, 0x1F, 0x05, 0x06, 0x02,
+    0x1A, 0x05, 0x03, 0x00, 0x26, 0x04, 0x00, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x17, 0x04, 0x02, 0x00, 0x17, 0x05, 0x04, 0x00,
+    0x2C, 0x00, 0x05, 0x00, 0x43, 0x07, 0x01, 0x00, 0x1A, 0x07,
+    0x02, 0x00, 0x18, 0x07, 0x00, 0x00, 0x26, 0x08, 0x02, 0x00,
+    0x26, 0x09, 0x03, 0x00, 0x2D, 0x08, 0x00, 0x09, 0x2B, 0x05,
+    0x00, 0x00, 0x43, 0x08, 0x04, 0x00, 0x01, 0x08, 0x00, 0x00,
+    0x2C, 0x07, 0x01, 0x00, 0x43, 0x08, 0x05, 0x00, 0x2B, 0x07,
+    0x00, 0x00, 0x43, 0x09, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x8D, 0xAF, 0x10, 0xBF, 0xF0, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0,
+    0x10, 0xBF, 0xF0, 0x10, 0x0B, 0x14, 0xBF, 0xEC, 0x14, 0x05,
+    0x49, 0xBF, 0xB7, 0x49, 0xBF, 0xC8, 0x36, 0xBF, 0xCA, 0x36,
+    0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36, 0xBF, 0xCA, 0x36, 0xBF,
+    0xC3, 0x3E, 0x05, 0x16, 0xBF, 0xEA, 0x16, 0x04, 0x0D, 0xBF,
+    0xF3, 0x0D, 0xBE, 0xE7, 0x81, 0x20, 0xCF, 0x06, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80,
+    0xD5, 0xDA, 0x06, 0xCE, 0x80, 0xA7, 0x28, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x26, 0x20, 0x70, 0x61, 0x72, 0x74,
+    0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74,
+    0x65, 0x6E, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74,
+    0x68, 0x65, 0x72, 0x2E, 0x20, 0x56, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x64,
+    0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2E, 0xCF, 0x07, 0x62, 0x6C, 0x73, 0x68, 0x69,
+    0x66, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09,
+    0x00, 0x10, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x07, 0x62, 0x6C,
+    0x73, 0x68, 0x69, 0x66, 0x74, 0x37, 0x01, 0x00, 0x00, 0x20,
+    0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A,
+    0x02, 0x05, 0x00, 0x25, 0x03, 0x01, 0x00, 0x35, 0x04, 0x00,
+    0x00, 0x10, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x35,
+    0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04, 0x00,
+    0x05, 0x10, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F,
+    0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00,
+    0x00, 0xDA, 0x06, 0xCE, 0x80, 0x91, 0x28, 0x62, 0x6C, 0x73,
+    0x68, 0x69, 0x66, 0x74, 0x20, 0x78, 0x20, 0x26, 0x20, 0x73,
+    0x68, 0x69, 0x66, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74,
+    0x65, 0x64, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x20, 0x62, 0x79,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x73, 0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x2E, 0xCF, 0x07, 0x62, 0x72, 0x73, 0x68, 0x69, 0x66, 0x74,
+    0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x11,
+    0x06, 0x00, 0x00, 0x13, 0xCE, 0x07, 0x62, 0x72, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x37, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01,
+    0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05,
+    0x00, 0x25, 0x03, 0x01, 0x00, 0x35, 0x04, 0x00, 0x00, 0x12,
+    0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x12,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x06, 0xCE, 0x80, 0x92, 0x28, 0x62, 0x72, 0x73, 0x68, 0x69,
+    0x66, 0x74, 0x20, 0x78, 0x20, 0x26, 0x20, 0x73, 0x68, 0x69,
+    0x66, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20, 0x62,
+    0x69, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x65, 0x64,
+    0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74,
+    0x73, 0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65,
+    0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74,
+    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61,
+    0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E,
+    0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x74, 0x61, 0x6E, 0xDA, 0x06, 0xCE, 0x27, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x6E, 0x67, 0x65, 0x6E,
+    0x74, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x09, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x63, 0x6F, 0x73, 0x68, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63,
+    0x6F, 0x73, 0x68, 0xDA, 0x06, 0xCE, 0x31, 0x28, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x63, 0x6F, 0x73, 0x68, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x68, 0x79, 0x70, 0x65, 0x72, 0x62, 0x6F,
+    0x6C, 0x69, 0x63, 0x20, 0x63, 0x6F, 0x73, 0x69, 0x6E, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x08, 0x6F, 0x73,
+    0x2F, 0x73, 0x6C, 0x65, 0x65, 0x70, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x08, 0x6F, 0x73, 0x2F, 0x73, 0x6C, 0x65, 0x65, 0x70,
+    0xDA, 0x06, 0xCE, 0x60, 0x28, 0x6F, 0x73, 0x2F, 0x73, 0x6C,
+    0x65, 0x65, 0x70, 0x20, 0x6E, 0x73, 0x65, 0x63, 0x29, 0x0A,
+    0x0A, 0x53, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x6E, 0x73, 0x65, 0x63, 0x20,
+    0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x2E, 0x20, 0x27,
+    0x6E, 0x73, 0x65, 0x63, 0x27, 0x20, 0x63, 0x61, 0x6E, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E,
+    0xCF, 0x07, 0x6F, 0x73, 0x2F, 0x64, 0x61, 0x74, 0x65, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x07, 0x6F, 0x73, 0x2F, 0x64, 0x61,
+    0x74, 0x65, 0xDA, 0x06, 0xCE, 0x81, 0xFF, 0x28, 0x6F, 0x73,
+    0x2F, 0x64, 0x61, 0x74, 0x65, 0x20, 0x5B, 0x2C, 0x74, 0x69,
+    0x6D, 0x65, 0x5D, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69,
+    0x76, 0x65, 0x6E, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x61,
+    0x73, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x2C, 0x20, 0x6F, 0x72, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x69, 0x66, 0x20,
+    0x6E, 0x6F, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20,
+    0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x2E, 0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x30, 0x2D,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x2E, 0x0A, 0x0A,
+    0x09, 0x3A, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20,
+    0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20,
+    0x5B, 0x30, 0x2D, 0x36, 0x31, 0x5D, 0x0A, 0x09, 0x3A, 0x6D,
+    0x69, 0x6E, 0x75, 0x74, 0x65, 0x73, 0x20, 0x2D, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6D,
+    0x69, 0x6E, 0x75, 0x74, 0x65, 0x73, 0x20, 0x5B, 0x30, 0x2D,
+    0x35, 0x39, 0x5D, 0x0A, 0x09, 0x3A, 0x73, 0x65, 0x63, 0x6F,
+    0x6E, 0x64, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x68, 0x6F, 0x75, 0x72,
+    0x73, 0x20, 0x5B, 0x30, 0x2D, 0x32, 0x33, 0x5D, 0x0A, 0x09,
+    0x3A, 0x6D, 0x6F, 0x6E, 0x74, 0x68, 0x2D, 0x64, 0x61, 0x79,
+    0x20, 0x2D, 0x20, 0x64, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20,
+    0x6D, 0x6F, 0x6E, 0x74, 0x68, 0x20, 0x5B, 0x30, 0x2D, 0x33,
+    0x30, 0x5D, 0x0A, 0x09, 0x3A, 0x6D, 0x6F, 0x6E, 0x74, 0x68,
+    0x20, 0x2D, 0x20, 0x6D, 0x6F, 0x6E, 0x74, 0x68, 0x20, 0x6F,
+    0x66, 0x20, 0x79, 0x65, 0x61, 0x72, 0x20, 0x5B, 0x30, 0x2C,
+    0x20, 0x31, 0x31, 0x5D, 0x0A, 0x09, 0x3A, 0x79, 0x65, 0x61,
+    0x72, 0x20, 0x2D, 0x20, 0x79, 0x65, 0x61, 0x72, 0x73, 0x20,
+    0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x79, 0x65, 0x61, 0x72,
+    0x20, 0x30, 0x20, 0x28, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x32,
+    0x30, 0x31, 0x39, 0x29, 0x0A, 0x09, 0x3A, 0x77, 0x65, 0x65,
+    0x6B, 0x2D, 0x64, 0x61, 0x79, 0x20, 0x2D, 0x20, 0x64, 0x61,
+    0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77,
+    0x65, 0x65, 0x6B, 0x20, 0x5B, 0x30, 0x2D, 0x36, 0x5D, 0x0A,
+    0x09, 0x3A, 0x79, 0x65, 0x61, 0x72, 0x2D, 0x64, 0x61, 0x79,
+    0x20, 0x2D, 0x20, 0x64, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x79, 0x65, 0x61, 0x72, 0x20, 0x5B,
+    0x30, 0x2D, 0x33, 0x36, 0x35, 0x5D, 0x0A, 0x09, 0x3A, 0x64,
+    0x73, 0x74, 0x20, 0x2D, 0x20, 0x49, 0x66, 0x20, 0x44, 0x61,
+    0x79, 0x20, 0x4C, 0x69, 0x67, 0x68, 0x74, 0x20, 0x53, 0x61,
+    0x76, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0xCF, 0x0C,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x71, 0xDA,
+    0x06, 0xCE, 0x80, 0xFD, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x49, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65, 0x73, 0x73,
+    0x61, 0x67, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69,
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+    0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x41, 0x6C, 0x73, 0x6F,
+    0x20, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x65, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x71, 0x75, 0x65,
+    0x75, 0x65, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20,
+    0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x68, 0x61,
+    0x6E, 0x64, 0x6C, 0x65, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+    0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x62,
+    0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x61, 0x6C, 0x6C,
+    0x69, 0x6E, 0x67, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xCF, 0x04, 0x6E,
+    0x65, 0x67, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x24, 0x28, 0x6E, 0x65, 0x67, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20,
+    0x74, 0x68, 0x61, 0x6E, 0x20, 0x30, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0x88, 0x35, 0x88, 0x68, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x01, 0x00, 0x03,
+    0xCE, 0x04, 0x6E, 0x65, 0x67, 0x3F, 0xDA, 0x24, 0x25, 0x03,
+    0x00, 0x00, 0x3E, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00,
+    0x88, 0x61, 0x06, 0xBF, 0xFA, 0x06, 0xBF, 0xFA, 0x06, 0xDA,
+    0x82, 0x10, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x2E,
+    0x28, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72,
+    0x79, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x61, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0x8C, 0xB9, 0x8D, 0x28, 0xDA, 0x03, 0xDA,
+    0x82, 0x0F, 0xCF, 0x06, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3F,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x20, 0x28, 0x66,
+    0x61, 0x6C, 0x73, 0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+    0x20, 0x69, 0x73, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8D, 0xCC, 0x8D,
+    0xFF, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x03, 0xCE, 0x06, 0x66, 0x61, 0x6C, 0x73, 0x65,
+    0x3F, 0xDA, 0x24, 0x24, 0x03, 0x00, 0x00, 0x1F, 0x02, 0x00,
+    0x03, 0x03, 0x02, 0x00, 0x00, 0x8D, 0xF4, 0x0A, 0xBF, 0xF6,
+    0x0A, 0xBF, 0xF6, 0x0A, 0xCF, 0x07, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB,
+    0xDA, 0x06, 0xCE, 0x72, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75,
+    0x6C, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x76, 0x61, 0x6C,
+    0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20,
+    0x61, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+    0x6C, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x20, 0x20, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20, 0x73,
+    0x79, 0x6D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D, 0x20,
+    0x6E, 0x69, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x20, 0x76,
+    0x61, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x29, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0x94, 0x8A, 0x95, 0x36, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x06, 0x02, 0x03,
+    0x0C, 0xCE, 0x07, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0xDA, 0x24, 0xDA, 0x66, 0xDA, 0x64, 0xDA, 0x61, 0x26, 0x04,
+    0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x2D, 0x04, 0x05, 0x00,
+    0x3D, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05,
+    0x03, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x3D, 0x04, 0x00, 0x00,
+    0x26, 0x05, 0x02, 0x00, 0x2D, 0x05, 0x00, 0x04, 0x3D, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x95, 0x0F, 0x26, 0xBF,
+    0xDA, 0x26, 0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26, 0xBF, 0xDA,
+    0x26, 0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26,
+    0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26, 0xBF, 0xDA, 0x26, 0xBF,
+    0xDA, 0x26, 0xCF, 0x04, 0x2D, 0x3F, 0x3E, 0x3E, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x81, 0x1D,
+    0x28, 0x2D, 0x3F, 0x3E, 0x3E, 0x20, 0x78, 0x20, 0x26, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72,
+    0x74, 0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63,
+    0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+    0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C,
+    0x69, 0x6E, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x72, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E,
+    0x69, 0x6C, 0x2E, 0x20, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75,
+    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70,
+    0x65, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x70, 0x3F, 0xCD, 0x00, 0x00,
+    0x72, 0x96, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xB9, 0x00, 0x00,
+    0x06, 0x01, 0x01, 0x04, 0x01, 0xCE, 0x04, 0x2D, 0x3F, 0x3E,
+    0x3E, 0xDA, 0x24, 0xDA, 0x82, 0xF0, 0x2A, 0x04, 0x00, 0x00,
+    0x2D, 0x04, 0x00, 0x01, 0x26, 0x05, 0x00, 0x00, 0x30, 0x05,
+    0x00, 0x00, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0E, 0x02, 0x09,
+    0x25, 0xDA, 0x82, 0xF1, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x7B,
+    0xDA, 0x82, 0xF2, 0xDA, 0x80, 0x88, 0xDA, 0x60, 0xDA, 0x81,
+    0x00, 0xDA, 0x7C, 0xDA, 0x64, 0xDA, 0x81, 0xEB, 0x2B, 0x01,
+    0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x26, 0x06, 0x01, 0x00,
+    0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05, 0x09, 0x00, 0x25, 0x06,
+    0x00, 0x00, 0x33, 0x04, 0x01, 0x06, 0x25, 0x06, 0x01, 0x00,
+    0x2C, 0x01, 0x06, 0x00, 0x43, 0x06, 0x02, 0x00, 0x2C, 0x04,
+    0x06, 0x00, 0x43, 0x03, 0x03, 0x00, 0x18, 0x04, 0x00, 0x00,
+    0x38, 0x04, 0x00, 0x00, 0x2C, 0x01, 0x04, 0x00, 0x43, 0x03,
+    0x03, 0x00, 0x35, 0x05, 0x03, 0x00, 0x35, 0x06, 0x03, 0x01,
+    0x43, 0x07, 0x04, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x38, 0x08,
+    0x00, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00,
+    0x2D, 0x08, 0x06, 0x09, 0x43, 0x08, 0x05, 0x00, 0x2C, 0x07,
+    0x00, 0x00, 0x3D, 0x09, 0x00, 0x00, 0x25, 0x0B, 0x00, 0x00,
+    0x2C, 0x08, 0x0B, 0x00, 0x43, 0x0B, 0x06, 0x00, 0x26, 0x0D,
+    0x07, 0x00, 0x2D, 0x0D, 0x07, 0x0B, 0x3D, 0x0C, 0x00, 0x00,
+    0x26, 0x0D, 0x08, 0x00, 0x2D, 0x0D, 0x09, 0x0C, 0x3D, 0x0B,
+    0x00, 0x00, 0x03, 0x0B, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x71,
+    0xA2, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xEF, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEA, 0x6B, 0xBF, 0xC5, 0x08, 0xBF, 0xF8, 0x08,
+    0x02, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xDF,
+    0x22, 0xBF, 0xDE, 0x22, 0xBF, 0xB5, 0x6B, 0xBF, 0xF3, 0x0C,
+    0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0x8B, 0x77, 0xBF,
+    0x89, 0x77, 0x0F, 0x07, 0x12, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF,
+    0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5,
+    0x1B, 0x07, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF,
+    0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD,
+    0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33,
+    0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xCD, 0x00, 0x00, 0x71,
+    0x72, 0x81, 0x0C, 0x04, 0x13, 0xBF, 0xED, 0x13, 0xBF, 0xED,
+    0x13, 0xCF, 0x04, 0x61, 0x73, 0x2D, 0x3E, 0xD4, 0x02, 0xD3,
+    0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x80, 0x9E, 0x28,
+    0x61, 0x73, 0x2D, 0x3E, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20,
+    0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A,
+    0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65,
+    0x72, 0x2C, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72,
+    0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x78, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x6C, 0x61, 0x73, 0x74,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x76, 0x42, 0xCD,
+    0x00, 0x00, 0x77, 0xA7, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBB,
+    0x00, 0x00, 0x09, 0x02, 0x03, 0x09, 0x02, 0xCE, 0x04, 0x61,
+    0x73, 0x2D, 0x3E, 0xDA, 0x24, 0xDA, 0x60, 0xDA, 0x7E, 0xDA,
+    0x81, 0xEB, 0x28, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00,
+    0x17, 0x05, 0x02, 0x00, 0x37, 0x06, 0x05, 0x00, 0x17, 0x07,
+    0x06, 0x00, 0x25, 0x06, 0x00, 0x00, 0x2A, 0x08, 0x01, 0x00,
+    0x2F, 0x08, 0x08, 0x00, 0x03, 0x04, 0x00, 0x00, 0xCD, 0x00,
+    0xD4, 0x00, 0x00, 0x03, 0x01, 0x00, 0x06, 0x01, 0xDA, 0x24,
+    0x27, 0x02, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x02, 0x1A, 0x01,
+    0x03, 0x00, 0x27, 0x02, 0x00, 0x0B, 0x03, 0x02, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x77,
+    0x5A, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF5, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xCD, 0x00, 0xFA,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x1B, 0x01, 0x01, 0xDA, 0x80,
+    0x80, 0xDA, 0x24, 0xDA, 0x60, 0xDA, 0x7E, 0xDA, 0x81, 0xEB,
+    0x27, 0x01, 0x00, 0x06, 0x27, 0x02, 0x00, 0x07, 0x3E, 0x00,
+    0x01, 0x02, 0x19, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x27, 0x02, 0x00, 0x05, 0x27, 0x03, 0x00, 0x06, 0x33, 0x01,
+    0x02, 0x03, 0x17, 0x02, 0x01, 0x00, 0x43, 0x01, 0x00, 0x00,
+    0x17, 0x03, 0x01, 0x00, 0x2A, 0x01, 0x00, 0x00, 0x2C, 0x01,
+    0x02, 0x00, 0x43, 0x04, 0x01, 0x00, 0x17, 0x01, 0x04, 0x00,
+    0x27, 0x05, 0x00, 0x04, 0x2C, 0x03, 0x05, 0x00, 0x3D, 0x04,
+    0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2D, 0x06, 0x04, 0x01,
+    0x3D, 0x05, 0x00, 0x00, 0x29, 0x05, 0x00, 0x04, 0x27, 0x04,
+    0x00, 0x06, 0x05, 0x01, 0x04, 0x01, 0x29, 0x01, 0x00, 0x06,
+    0x28, 0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0xBF, 0xFF,
+    0xCD, 0x00, 0xD4, 0x00, 0x00, 0x03, 0x01, 0x00, 0x06, 0x02,
+    0xDA, 0x24, 0x27, 0x02, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x02,
+    0x1A, 0x01, 0x03, 0x00, 0x27, 0x02, 0x01, 0x03, 0x03, 0x02,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD,
+    0x00, 0x00, 0x77, 0x5A, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF5,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12,
+    0xCD, 0x00, 0x00, 0x77, 0x03, 0x80, 0x9C, 0xBF, 0x64, 0x80,
+    0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF,
+    0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80,
+    0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF,
+    0x88, 0x07, 0xBF, 0xF0, 0x11, 0x1F, 0x1B, 0xBF, 0xDB, 0x2B,
+    0xBF, 0xD5, 0x2B, 0xBF, 0xC6, 0x3B, 0x10, 0x1D, 0xBF, 0xE3,
+    0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D,
+    0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0x66, 0x80, 0x9C,
+    0xBF, 0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF, 0x64,
+    0x80, 0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xCD, 0x00, 0x00, 0x76,
+    0x42, 0x81, 0x65, 0xBF, 0x4D, 0x0B, 0x04, 0x80, 0x9C, 0xBF,
+    0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80,
+    0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBF, 0x64, 0x80, 0x9C, 0xBE,
+    0xA3, 0x81, 0x65, 0xCF, 0x04, 0x72, 0x65, 0x70, 0x6C, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0xED, 0x28, 0x72,
+    0x65, 0x70, 0x6C, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73,
+    0x20, 0x6F, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20,
+    0x26, 0x29, 0x0A, 0x0A, 0x52, 0x75, 0x6E, 0x20, 0x61, 0x20,
+    0x72, 0x65, 0x70, 0x6C, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x61,
+    0x6D, 0x65, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x6F, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x6F,
+    0x20, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61, 0x20, 0x63, 0x68,
+    0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x6F, 0x75,
+    0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69,
+    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x64, 0x20,
+    0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
+    0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72,
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20,
+    0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x20, 0x63, 0x61,
+    0x75, 0x67, 0x68, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0xD3, 0xB4, 0xCD, 0x00, 0x00,
+    0xD6, 0x6B, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBA, 0x00, 0x00,
+    0x09, 0x02, 0x07, 0x17, 0x01, 0xCE, 0x04, 0x72, 0x65, 0x70,
+    0x6C, 0xDA, 0x24, 0xDA, 0x81, 0x5B, 0xDA, 0x81, 0x5D, 0xDA,
+    0x81, 0x5E, 0xDA, 0x81, 0x5F, 0xDA, 0x81, 0x2A, 0xDA, 0x86,
+    0xCA, 0xDA, 0x81, 0x85, 0x28, 0x02, 0x00, 0x00, 0x43, 0x03,
+    0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x22, 0x07, 0x00, 0x00,
+    0x1F, 0x06, 0x07, 0x01, 0x1A, 0x06, 0x04, 0x00, 0x2A, 0x07,
+    0x00, 0x00, 0x17, 0x05, 0x07, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x17, 0x05, 0x01, 0x00, 0x17, 0x06, 0x05, 0x00, 0x26, 0x07,
+    0x01, 0x00, 0x26, 0x08, 0x02, 0x00, 0x2D, 0x07, 0x04, 0x08,
+    0x26, 0x07, 0x03, 0x00, 0x2D, 0x06, 0x07, 0x00, 0x26, 0x07,
+    0x04, 0x00, 0x26, 0x08, 0x05, 0x00, 0x2C, 0x07, 0x08, 0x00,
+    0x3B, 0x07, 0x00, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x08,
+    0x06, 0x00, 0x30, 0x08, 0x00, 0x00, 0xCD, 0x00, 0xD4, 0x00,
+    0x00, 0x07, 0x02, 0x09, 0x17, 0x01, 0xDA, 0x24, 0xDA, 0x81,
+    0x91, 0xDA, 0x81, 0x92, 0xDA, 0x03, 0xCF, 0x01, 0x5F, 0xDA,
+    0x80, 0xD8, 0xCE, 0x05, 0x25, 0x2E, 0x32, 0x30, 0x70, 0xDA,
+    0x83, 0x34, 0xDA, 0x80, 0xD0, 0xDA, 0x81, 0x6A, 0x2B, 0x00,
+    0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x1F, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x10, 0x00, 0x26, 0x04,
+    0x02, 0x00, 0x2C, 0x04, 0x01, 0x00, 0x3C, 0x04, 0x00, 0x00,
+    0x27, 0x05, 0x00, 0x04, 0x26, 0x06, 0x03, 0x00, 0x34, 0x05,
+    0x06, 0x04, 0x26, 0x04, 0x04, 0x00, 0x2B, 0x04, 0x00, 0x00,
+    0x39, 0x04, 0x00, 0x00, 0x26, 0x05, 0x05, 0x00, 0x2D, 0x04,
+    0x05, 0x01, 0x43, 0x05, 0x06, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x26, 0x04, 0x07, 0x00, 0x30, 0x04, 0x00, 0x00, 0x2C, 0x00,
+    0x01, 0x00, 0x26, 0x04, 0x08, 0x00, 0x30, 0x04, 0x00, 0x00,
+    0xBF, 0xFF, 0xCD, 0x00, 0x00, 0xD5, 0x04, 0x0F, 0xBF, 0xF1,
+    0x0F, 0xBF, 0xEB, 0x80, 0xEA, 0xBF, 0x16, 0x80, 0xEA, 0xBF,
+    0x16, 0x80, 0xEA, 0xBF, 0x6F, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF,
+    0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6, 0x1A, 0xBF, 0xE6,
+    0x1A, 0x29, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF,
+    0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xDD,
+    0x24, 0xBF, 0xDC, 0x24, 0xBF, 0xDC, 0x24, 0x1B, 0x15, 0xBF,
+    0xEB, 0x15, 0xBF, 0xEB, 0x15, 0xCD, 0x00, 0x00, 0xD3, 0xB4,
+    0x82, 0xB7, 0xBE, 0x53, 0x09, 0xBF, 0xEB, 0x16, 0x04, 0x81,
+    0x1E, 0xBE, 0xE2, 0x81, 0x1E, 0xBE, 0xE2, 0x81, 0x1E, 0xBE,
+    0xF4, 0x81, 0x0B, 0xBE, 0xE3, 0x81, 0x1E, 0xBE, 0xE2, 0x81,
+    0x1E, 0xBE, 0xE2, 0x81, 0x1E, 0xBE, 0xE2, 0x81, 0x1E, 0x04,
+    0x7C, 0xBF, 0x84, 0x7C, 0xBF, 0x84, 0x7C, 0xBF, 0x84, 0x7C,
+    0xBF, 0x84, 0x7C, 0xBF, 0x84, 0x7C, 0xBF, 0x84, 0x7C, 0xBF,
+    0x84, 0x7C, 0xBF, 0x84, 0x7C, 0xBF, 0x84, 0x7C, 0xBF, 0x84,
+    0x7C, 0xBF, 0x84, 0x7C, 0xCF, 0x04, 0x74, 0x79, 0x70, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x72, 0xDA, 0x06, 0xCE, 0x80,
+    0xE7, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65,
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x73, 0x79, 0x6D, 0x62,
+    0x6F, 0x6C, 0x2E, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6F,
+    0x6E, 0x65, 0x20, 0x6F, 0x66, 0x0A, 0x09, 0x3A, 0x6E, 0x69,
+    0x6C, 0x0A, 0x09, 0x3A, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61,
+    0x6E, 0x0A, 0x09, 0x3A, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x0A, 0x09, 0x3A, 0x72, 0x65, 0x61, 0x6C, 0x0A, 0x09,
+    0x3A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x0A, 0x09, 0x3A, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x0A, 0x09, 0x3A, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x0A, 0x09, 0x3A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0A,
+    0x09, 0x3A, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x09,
+    0x3A, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x0A, 0x09,
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A,
+    0x09, 0x3A, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x0A, 0x0A, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x62,
+    0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x2E, 0xCF, 0x06, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E,
+    0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x14,
+    0x06, 0x00, 0x00, 0x10, 0xCE, 0x06, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x3E, 0x37, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02,
+    0x19, 0x02, 0x0A, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x1B, 0x02, 0x03, 0x04,
+    0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03,
+    0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF,
+    0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE, 0x70,
+    0x28, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0x20, 0x26, 0x20,
+    0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B,
+    0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x64,
+    0x65, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65,
+    0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61,
+    0x6E, 0x2E, 0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73,
+    0x71, 0x72, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x73, 0x71, 0x72, 0x74, 0xDA, 0x06,
+    0xCE, 0x2C, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x71,
+    0x72, 0x74, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x72, 0x6F, 0x6F, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF, 0x0A, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0x32, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61,
+    0x74, 0x61, 0x6E, 0x32, 0xDA, 0x06, 0xCE, 0x47, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0x32, 0x20,
+    0x79, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63,
+    0x74, 0x61, 0x6E, 0x67, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66,
+    0x20, 0x79, 0x2F, 0x78, 0x2E, 0x20, 0x57, 0x6F, 0x72, 0x6B,
+    0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x77, 0x68, 0x65,
+    0x6E, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x30, 0x2E, 0xCF,
+    0x0A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69,
+    0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0xDA, 0x06, 0xCE,
+    0x6D, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62,
+    0x69, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74,
+    0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69,
+    0x76, 0x65, 0x6E, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x66, 0x61, 0x6C,
+    0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x2E,
+    0xCF, 0x08, 0x6F, 0x73, 0x2F, 0x77, 0x68, 0x69, 0x63, 0x68,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x24, 0xDA, 0x06, 0xCE,
+    0x80, 0xA2, 0x28, 0x6F, 0x73, 0x2F, 0x77, 0x68, 0x69, 0x63,
+    0x68, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6E,
+    0x67, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6F, 0x6E,
+    0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x77,
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x20, 0x2D, 0x20, 0x4D,
+    0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x57,
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x0A, 0x09, 0x3A, 0x6D,
+    0x61, 0x63, 0x6F, 0x73, 0x20, 0x2D, 0x20, 0x41, 0x70, 0x70,
+    0x6C, 0x65, 0x20, 0x6D, 0x61, 0x63, 0x6F, 0x73, 0x0A, 0x09,
+    0x3A, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x20, 0x2D, 0x20, 0x41,
+    0x20, 0x50, 0x4F, 0x53, 0x49, 0x58, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x79,
+    0x73, 0x74, 0x65, 0x6D, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x29, 0xCF, 0x09, 0x70, 0x76, 0x65, 0x63,
+    0x2F, 0x70, 0x75, 0x73, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x09, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x70, 0x75, 0x73, 0x68,
+    0xDA, 0x06, 0xCE, 0x73, 0x28, 0x70, 0x76, 0x65, 0x63, 0x2F,
+    0x70, 0x75, 0x73, 0x68, 0x20, 0x76, 0x65, 0x63, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74,
+    0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x78, 0x73, 0x20, 0x61, 0x64, 0x64, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+    0x6E, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6F, 0x72,
+    0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x63,
+    0x74, 0x6F, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x2E, 0xCF,
+    0x08, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x3F, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x26, 0x28, 0x6B, 0x65,
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79,
+    0x77, 0x6F, 0x72, 0x64, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0x89, 0xA4, 0x89, 0xE7, 0xDA, 0x03, 0xDA, 0x81,
+    0xD5, 0xCF, 0x08, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E,
+    0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x26, 0x28,
+    0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x3F, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+    0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x62,
+    0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0x8B, 0xC9, 0x8C, 0x0C, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x05, 0x01, 0x02, 0x05,
+    0xCE, 0x08, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x3F,
+    0xDA, 0x24, 0xDA, 0x72, 0xD0, 0x07, 0x62, 0x6F, 0x6F, 0x6C,
+    0x65, 0x61, 0x6E, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00,
+    0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03,
+    0x03, 0x00, 0x00, 0x8B, 0xFA, 0x07, 0xBF, 0xF9, 0x07, 0xBF,
+    0xF6, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xCF, 0x0A,
+    0x74, 0x61, 0x6B, 0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65,
+    0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x21, 0xCB, 0xDA, 0x06, 0xCE,
+    0x42, 0x28, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x77, 0x68, 0x69,
+    0x6C, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x64, 0x29, 0x0A, 0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61,
+    0x73, 0x20, 0x28, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75, 0x6E,
+    0x74, 0x69, 0x6C, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65, 0x64,
+    0x29, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x2E, 0xDA, 0x23, 0xD2,
+    0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x66, 0x34, 0xCD,
+    0x00, 0x00, 0x66, 0xB0, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C,
+    0x00, 0x00, 0x05, 0x02, 0x02, 0x05, 0xCE, 0x0A, 0x74, 0x61,
+    0x6B, 0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xDA, 0x24,
+    0xDA, 0x83, 0xF2, 0xDA, 0x86, 0x26, 0x2B, 0x00, 0x00, 0x00,
+    0x43, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x01, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x30, 0x04, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x66,
+    0x9A, 0x10, 0xBF, 0xF0, 0x10, 0xBF, 0xE4, 0x21, 0xBF, 0xDF,
+    0x21, 0xBF, 0xDF, 0x21, 0xCF, 0x0E, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x58, 0x54, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x70, 0x69, 0x6E,
+    0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C,
+    0x79, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x20, 0x55, 0x73, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65,
+    0x6E, 0x74, 0x20, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6C,
+    0x61, 0x72, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65,
+    0x6E, 0x63, 0x69, 0x65, 0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xC9, 0xBE, 0xCD, 0x00,
+    0x00, 0xCA, 0x35, 0xDA, 0x03, 0xDA, 0x81, 0x5C, 0xDA, 0x63,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x60, 0xDA, 0x06, 0xCE, 0x80,
+    0xD1, 0x28, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x20, 0x61, 0x63, 0x72,
+    0x6F, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75,
+    0x6E, 0x74, 0x69, 0x6D, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69,
+    0x73, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x69, 0x74,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x63, 0x6F, 0x6C, 0x6C, 0x69, 0x64, 0x65, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x61, 0x6C, 0x72,
+    0x65, 0x61, 0x64, 0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73,
+    0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F,
+    0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C,
+    0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x6E,
+    0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69,
+    0x6E, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63,
+    0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E,
+    0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F,
+    0x73, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x56, 0xDA,
+    0x06, 0xCE, 0x80, 0xAC, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F,
+    0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x66, 0x29, 0x0A, 0x0A,
+    0x43, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x61, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C,
+    0x65, 0x61, 0x73, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x72,
+    0x65, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x73,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x2E, 0x20, 0x57, 0x68,
+    0x65, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x2C, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x69, 0x74,
+    0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E,
+    0x74, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x6C, 0x65, 0x61, 0x6B, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x6F, 0x74, 0x68, 0x65,
+    0x72, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65,
+    0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x09, 0x66, 0x69,
+    0x6C, 0x65, 0x2F, 0x73, 0x65, 0x65, 0x6B, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x73, 0x65,
+    0x65, 0x6B, 0xDA, 0x06, 0xCE, 0x81, 0xC1, 0x28, 0x66, 0x69,
+    0x6C, 0x65, 0x2F, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x66, 0x20,
+    0x5B, 0x2C, 0x77, 0x68, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x5B,
+    0x2C, 0x6E, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x4A, 0x75, 0x6D,
+    0x70, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6C,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x27, 0x77,
+    0x68, 0x65, 0x6E, 0x63, 0x65, 0x27, 0x20, 0x6D, 0x75, 0x73,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F,
+    0x66, 0x0A, 0x0A, 0x09, 0x3A, 0x63, 0x75, 0x72, 0x20, 0x2D,
+    0x20, 0x6A, 0x75, 0x6D, 0x70, 0x20, 0x72, 0x65, 0x6C, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x0A, 0x09, 0x3A, 0x73, 0x65, 0x74, 0x20,
+    0x2D, 0x20, 0x6A, 0x75, 0x6D, 0x70, 0x20, 0x72, 0x65, 0x6C,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x6E, 0x69,
+    0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x65, 0x6E, 0x64,
+    0x20, 0x2D, 0x20, 0x6A, 0x75, 0x6D, 0x70, 0x20, 0x72, 0x65,
+    0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A,
+    0x0A, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+    0x74, 0x2C, 0x20, 0x27, 0x77, 0x68, 0x65, 0x6E, 0x63, 0x65,
+    0x27, 0x20, 0x69, 0x73, 0x20, 0x3A, 0x63, 0x75, 0x72, 0x2E,
+    0x20, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C,
+    0x79, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x6E, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x70,
+    0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x69, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20,
+    0x6E, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x61,
+    0x20, 0x72, 0x65, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x68, 0x61, 0x6E, 0x64,
+    0x6C, 0x65, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x6F,
+    0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x34, 0x47, 0x42,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x68,
+    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0xCF, 0x08, 0x70, 0x76,
+    0x65, 0x63, 0x2F, 0x70, 0x75, 0x74, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x08, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x70, 0x75, 0x74,
+    0xDA, 0x06, 0xCE, 0x80, 0xA3, 0x28, 0x70, 0x76, 0x65, 0x63,
+    0x2F, 0x70, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x65, 0x72,
+    0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x65,
+    0x63, 0x74, 0x6F, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x61, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x72,
+    0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x2E, 0x20, 0x41,
+    0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x65, 0x71,
+    0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F,
+    0x72, 0x20, 0x61, 0x64, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0xCF, 0x04,
+    0x63, 0x6F, 0x6E, 0x64, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C,
+    0xCB, 0xDA, 0x06, 0xCE, 0x81, 0x0A, 0x28, 0x63, 0x6F, 0x6E,
+    0x64, 0x20, 0x26, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x29,
+    0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x74,
+    0x69, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x75, 0x6E, 0x74, 0x69,
+    0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+    0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x20, 0x69, 0x73,
+    0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x78, 0x65,
+    0x63, 0x75, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x6F, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x20, 0x6F, 0x64, 0x64,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x78, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73,
+    0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x64, 0x20,
+    0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x73, 0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x74,
+    0x63, 0x68, 0x65, 0x64, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E,
+    0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x2C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69,
+    0x6C, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x96,
+    0xE3, 0x98, 0xE5, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBB, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x06, 0x01, 0xCE, 0x04, 0x63, 0x6F,
+    0x6E, 0x64, 0xDA, 0x24, 0x28, 0x01, 0x00, 0x00, 0x2A, 0x02,
+    0x00, 0x00, 0x17, 0x03, 0x02, 0x00, 0x25, 0x04, 0x00, 0x00,
+    0x2B, 0x04, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0xCD, 0x00,
+    0xDC, 0x00, 0x00, 0x0A, 0x01, 0x02, 0x1A, 0x01, 0xDA, 0x82,
+    0x05, 0xDA, 0x24, 0xDA, 0x64, 0xDA, 0x80, 0x88, 0x28, 0x01,
+    0x00, 0x00, 0x27, 0x03, 0x00, 0x00, 0x37, 0x02, 0x03, 0x00,
+    0x07, 0x02, 0x02, 0x00, 0x25, 0x05, 0x00, 0x00, 0x1F, 0x04,
+    0x02, 0x05, 0x1A, 0x04, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x25, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x02, 0x06, 0x1A, 0x05,
+    0x04, 0x00, 0x27, 0x07, 0x00, 0x00, 0x33, 0x06, 0x07, 0x00,
+    0x03, 0x06, 0x00, 0x00, 0x27, 0x07, 0x00, 0x00, 0x33, 0x06,
+    0x07, 0x00, 0x05, 0x07, 0x00, 0x01, 0x27, 0x09, 0x00, 0x00,
+    0x33, 0x08, 0x09, 0x07, 0x05, 0x07, 0x00, 0x02, 0x44, 0x09,
+    0x07, 0x01, 0x26, 0x07, 0x00, 0x00, 0x2D, 0x07, 0x06, 0x08,
+    0x2B, 0x09, 0x00, 0x00, 0x26, 0x07, 0x01, 0x00, 0x30, 0x07,
+    0x00, 0x00, 0xBF, 0xFF, 0x98, 0x02, 0x80, 0xD8, 0xBF, 0x4A,
+    0x0D, 0xBF, 0xF3, 0x0D, 0xBF, 0xF0, 0x13, 0x0B, 0x0C, 0xBF,
+    0xF4, 0x0C, 0xBF, 0xF0, 0x80, 0x9E, 0xBF, 0x62, 0x80, 0x9E,
+    0xBF, 0x82, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF0, 0x80, 0x81,
+    0xBF, 0x91, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0x15,
+    0x0C, 0xBF, 0xF4, 0x0C, 0x1C, 0x06, 0xBF, 0xEF, 0x12, 0xBF,
+    0xEE, 0x12, 0x16, 0x06, 0xBF, 0xF5, 0x0C, 0xBF, 0xA9, 0x58,
+    0xBF, 0xA8, 0x58, 0xBF, 0xA8, 0x58, 0xBF, 0xA8, 0x58, 0xBF,
+    0xA8, 0x58, 0x96, 0xE3, 0x82, 0x02, 0xBF, 0x1D, 0x80, 0xD8,
+    0xBF, 0x28, 0x80, 0xD8, 0x04, 0x06, 0xBF, 0xFA, 0x06, 0xBF,
+    0xFA, 0x06, 0xCF, 0x03, 0x66, 0x6F, 0x72, 0xD4, 0x02, 0xD3,
+    0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x54, 0x28, 0x66,
+    0x6F, 0x72, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x65, 0x6E, 0x64,
+    0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A,
+    0x44, 0x6F, 0x20, 0x61, 0x20, 0x63, 0x20, 0x73, 0x74, 0x79,
+    0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x6F, 0x6F,
+    0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x64, 0x65,
+    0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+    0x6C, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x45, 0xA4, 0xCD, 0x00, 0x00, 0x46, 0x44, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x07, 0x03, 0x03,
+    0x09, 0xCE, 0x03, 0x66, 0x6F, 0x72, 0xDA, 0x24, 0xDA, 0x80,
+    0x88, 0xDA, 0x82, 0xC3, 0xDA, 0x82, 0xCF, 0x2C, 0x01, 0x02,
+    0x00, 0x43, 0x05, 0x00, 0x00, 0x26, 0x06, 0x01, 0x00, 0x2D,
+    0x00, 0x06, 0x05, 0x43, 0x06, 0x00, 0x00, 0x2B, 0x06, 0x00,
+    0x00, 0x2E, 0x03, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x30,
+    0x05, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x46, 0x2C, 0x10, 0xBF,
+    0xF0, 0x10, 0xBF, 0xDA, 0x27, 0xBF, 0xD9, 0x27, 0xBF, 0xD9,
+    0x27, 0xBF, 0xCD, 0x39, 0xBF, 0xC7, 0x39, 0xBF, 0xC7, 0x39,
+    0xBF, 0xC7, 0x39, 0xCF, 0x09, 0x6D, 0x61, 0x78, 0x2D, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x65, 0x28, 0x6D, 0x61, 0x78, 0x2D, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75,
+    0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61,
+    0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65,
+    0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0xCD, 0x00, 0x00, 0x51, 0x9B, 0xCD, 0x00, 0x00, 0x52, 0x22,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x03, 0x00,
+    0x02, 0x04, 0xCE, 0x09, 0x6D, 0x61, 0x78, 0x2D, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0xDA, 0x24, 0xDA, 0x86, 0xD4, 0xDA, 0x81,
+    0xF7, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26,
+    0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x52, 0x0D, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF,
+    0xEC, 0x14, 0xCF, 0x05, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0xD4,
+    0x02, 0xD3, 0x02, 0xDA, 0x21, 0xCB, 0xDA, 0x06, 0xCE, 0x52,
+    0x28, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65,
+    0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x43, 0x6F,
+    0x75, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x74,
+    0x65, 0x6D, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+    0x20, 0x28, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65,
+    0x6D, 0x29, 0x20, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75,
+    0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x5D, 0xF6, 0xCD, 0x00, 0x00, 0x5E, 0xBA, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0A, 0x02, 0x00,
+    0x0D, 0xCE, 0x05, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0xDA, 0x24,
+    0x25, 0x03, 0x00, 0x00, 0x17, 0x04, 0x01, 0x00, 0x37, 0x06,
+    0x04, 0x00, 0x25, 0x05, 0x00, 0x00, 0x3E, 0x07, 0x05, 0x06,
+    0x1A, 0x07, 0x07, 0x00, 0x33, 0x09, 0x04, 0x05, 0x44, 0x08,
+    0x09, 0x00, 0x1A, 0x08, 0x02, 0x00, 0x05, 0x03, 0x03, 0x01,
+    0x05, 0x05, 0x05, 0x01, 0x18, 0xF9, 0xFF, 0xFF, 0x03, 0x03,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x5E, 0x61, 0x0E, 0x04, 0x3C,
+    0xBF, 0xC4, 0x3C, 0xBF, 0xC4, 0x3C, 0xBF, 0xC4, 0x3C, 0xBF,
+    0xC4, 0x3C, 0xBF, 0xC4, 0x3C, 0xBF, 0xE1, 0x0A, 0xBF, 0xF2,
+    0x22, 0xBF, 0xF4, 0x0B, 0xBF, 0xC6, 0x3C, 0xBF, 0xC4, 0x3C,
+    0xBF, 0x47, 0x80, 0xC4, 0xCF, 0x0A, 0x67, 0x63, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0A, 0x67, 0x63, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76,
+    0x61, 0x6C, 0xDA, 0x06, 0xCE, 0x70, 0x28, 0x67, 0x63, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x62, 0x65,
+    0x66, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x72,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x67,
+    0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6F, 0x6C,
+    0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xCF, 0x0B,
+    0x67, 0x63, 0x61, 0x72, 0x65, 0x6E, 0x61, 0x2D, 0x65, 0x6E,
+    0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x67, 0x63, 0x61,
+    0x72, 0x65, 0x6E, 0x61, 0x2D, 0x65, 0x6E, 0x64, 0xDA, 0x06,
+    0xCE, 0x80, 0xB0, 0x28, 0x67, 0x63, 0x61, 0x72, 0x65, 0x6E,
+    0x61, 0x2D, 0x65, 0x6E, 0x64, 0x20, 0x68, 0x61, 0x6E, 0x64,
+    0x6C, 0x65, 0x29, 0x0A, 0x0A, 0x43, 0x6C, 0x6F, 0x73, 0x65,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x6E, 0x61, 0x20,
+    0x73, 0x63, 0x6F, 0x70, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x67, 0x63, 0x61, 0x72,
+    0x65, 0x6E, 0x61, 0x2D, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x2E,
+    0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6F, 0x75, 0x74, 0x65, 0x72, 0x6D, 0x6F, 0x73, 0x74, 0x20,
+    0x73, 0x63, 0x6F, 0x70, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63,
+    0x6C, 0x6F, 0x73, 0x65, 0x64, 0x2C, 0x20, 0x61, 0x6C, 0x6C,
+    0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6C,
+    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x69, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x6E, 0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x65,
+    0x72, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x66, 0x72, 0x65, 0x65, 0x64,
+    0x20, 0x61, 0x74, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x2E, 0xCF,
+    0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x66, 0x6C, 0x6F, 0x6F,
+    0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0xDA, 0x06, 0xCE,
+    0x54, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x66, 0x6C, 0x6F,
+    0x6F, 0x72, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x61, 0x72, 0x67, 0x65, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x61, 0x6E, 0x20, 0x78, 0x2E, 0xCF, 0x08, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x69, 0x6E, 0x66, 0xD3, 0x02, 0xDA, 0x03, 0xC8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0xDA, 0x06,
+    0xCE, 0x29, 0x54, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65,
+    0x6E, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x6F, 0x73, 0x69,
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x69, 0x6E,
+    0x69, 0x74, 0x79, 0xCF, 0x0B, 0x73, 0x6F, 0x72, 0x74, 0x65,
+    0x64, 0x2F, 0x63, 0x65, 0x69, 0x6C, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0B, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x63,
+    0x65, 0x69, 0x6C, 0xDA, 0x06, 0xCE, 0x56, 0x28, 0x73, 0x6F,
+    0x72, 0x74, 0x65, 0x64, 0x2F, 0x63, 0x65, 0x69, 0x6C, 0x20,
+    0x6D, 0x61, 0x70, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x6B, 0x65,
+    0x79, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6E,
+    0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6E,
+    0x69, 0x6C, 0x2E, 0xCF, 0x09, 0x70, 0x61, 0x72, 0x74, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x63, 0x28, 0x70, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A,
+    0x0A, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65,
+    0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x74,
+    0x6F, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x20, 0x20,
+    0x6F, 0x66, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6E, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00,
+    0x00, 0x8A, 0xAA, 0xCD, 0x00, 0x00, 0x8C, 0x24, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x0C, 0x02, 0x04, 0x1D,
+    0xDA, 0x83, 0x8F, 0xDA, 0x24, 0xDA, 0x85, 0x1C, 0xDA, 0x14,
+    0xDA, 0x7C, 0xDA, 0x2F, 0x25, 0x03, 0x00, 0x00, 0x17, 0x04,
+    0x00, 0x00, 0x37, 0x06, 0x01, 0x00, 0x0B, 0x07, 0x06, 0x00,
+    0x2B, 0x07, 0x00, 0x00, 0x43, 0x08, 0x00, 0x00, 0x2B, 0x08,
+    0x00, 0x00, 0x43, 0x08, 0x01, 0x00, 0x3F, 0x09, 0x04, 0x06,
+    0x1A, 0x09, 0x08, 0x00, 0x2D, 0x01, 0x03, 0x04, 0x43, 0x0A,
+    0x02, 0x00, 0x2C, 0x08, 0x0A, 0x00, 0x43, 0x0B, 0x03, 0x00,
+    0x17, 0x03, 0x04, 0x00, 0x45, 0x04, 0x04, 0x00, 0x18, 0xF8,
+    0xFF, 0xFF, 0x1F, 0x09, 0x03, 0x06, 0x19, 0x09, 0x03, 0x00,
+    0x23, 0x09, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x09,
+    0x00, 0x00, 0x1A, 0x09, 0x06, 0x00, 0x2C, 0x01, 0x03, 0x00,
+    0x43, 0x0A, 0x02, 0x00, 0x2C, 0x08, 0x0A, 0x00, 0x43, 0x0B,
+    0x03, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x8B, 0x1C, 0x08, 0x02, 0x0C, 0x0D, 0x0B,
+    0x24, 0x08, 0xBF, 0xED, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xE1,
+    0x20, 0xBF, 0xE0, 0x20, 0x0C, 0x0D, 0xBF, 0xEC, 0x67, 0xBF,
+    0xC3, 0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xD8, 0x29, 0xBF, 0xD7,
+    0x29, 0x06, 0x0C, 0x06, 0x0B, 0xBF, 0x9A, 0x67, 0x08, 0x0B,
+    0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF,
+    0xF5, 0x0B, 0xBF, 0xF1, 0x35, 0xBF, 0xEC, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xDE, 0x23, 0xBF, 0xDD, 0x23, 0xBF, 0xCC, 0x35,
+    0xBE, 0x8D, 0x81, 0x7A, 0xCF, 0x04, 0x65, 0x76, 0x61, 0x6C,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0x81, 0x28,
+    0x65, 0x76, 0x61, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x65, 0x6E, 0x76, 0x20, 0x26, 0x29, 0x0A, 0x0A, 0x45, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64,
+    0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x2D,
+    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xBD, 0xE7,
+    0xCD, 0x00, 0x00, 0xBE, 0xF3, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x98, 0x00, 0x00, 0x0A, 0x02, 0x06, 0x14, 0xCE, 0x04, 0x65,
+    0x76, 0x61, 0x6C, 0xDA, 0x24, 0xDA, 0x80, 0x91, 0xDA, 0x87,
+    0x4A, 0xDA, 0x80, 0xA6, 0xDA, 0x72, 0xDA, 0x81, 0x80, 0xDA,
+    0x81, 0x7C, 0x22, 0x05, 0x00, 0x00, 0x1F, 0x04, 0x05, 0x01,
+    0x1A, 0x04, 0x04, 0x00, 0x26, 0x03, 0x00, 0x00, 0x35, 0x03,
+    0x03, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x03, 0x01, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x00,
+    0x04, 0x05, 0x43, 0x06, 0x02, 0x00, 0x2B, 0x06, 0x00, 0x00,
+    0x43, 0x07, 0x03, 0x00, 0x26, 0x09, 0x04, 0x00, 0x1F, 0x08,
+    0x07, 0x09, 0x1A, 0x08, 0x02, 0x00, 0x30, 0x06, 0x00, 0x00,
+    0x26, 0x09, 0x05, 0x00, 0x44, 0x07, 0x09, 0x06, 0x01, 0x07,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0xBE, 0x77, 0x12, 0xBF, 0xEE,
+    0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12,
+    0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xBF, 0xEE, 0x12, 0x0D,
+    0x18, 0xBF, 0xE8, 0x18, 0xBF, 0xE8, 0x18, 0x0C, 0x09, 0xBF,
+    0xF7, 0x09, 0xBF, 0xF4, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE5,
+    0x3F, 0xBF, 0xE2, 0x04, 0x0D, 0x0B, 0xBF, 0xF5, 0x0B, 0xBF,
+    0xEE, 0x13, 0xCF, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x96, 0xDA, 0x06, 0xCE,
+    0x80, 0xA4, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20,
+    0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x6E,
+    0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20, 0x56, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63,
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x76, 0x69,
+    0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65,
+    0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x81, 0xEA, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x82, 0xCD, 0xDA, 0x06, 0xCE, 0x81,
+    0x60, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x5B, 0x2C, 0x78, 0x5D, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x75,
+    0x73, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x70,
+    0x61, 0x73, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x20, 0x70, 0x65, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2C, 0x20,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61,
+    0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x65, 0x69, 0x74,
+    0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C,
+    0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20, 0x64, 0x69, 0x73,
+    0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+    0x78, 0x74, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x63,
+    0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2E, 0xCF, 0x04, 0x62, 0x6E, 0x6F, 0x74, 0xD3,
+    0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x0C, 0x00, 0x13, 0x01,
+    0x01, 0x00, 0x02, 0xCE, 0x04, 0x62, 0x6E, 0x6F, 0x74, 0x0F,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x06, 0xCE,
+    0x34, 0x28, 0x62, 0x6E, 0x6F, 0x74, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x77, 0x69, 0x73,
+    0x65, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x20, 0x78, 0x2E, 0xCF, 0x03, 0x6E, 0x6F, 0x74, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x80, 0xC3, 0xDA, 0x06, 0xCE, 0x2A, 0x28,
+    0x6E, 0x6F, 0x74, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+    0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x2E, 0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x63,
+    0x6F, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x61, 0x63, 0x6F, 0x73, 0xDA, 0x06, 0xCE,
+    0x2A, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x63, 0x6F,
+    0x73, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+    0x63, 0x63, 0x6F, 0x73, 0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x78, 0x2E, 0xCF, 0x06, 0x6F, 0x73, 0x2F, 0x63, 0x77,
+    0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x06, 0x6F, 0x73, 0x2F,
+    0x63, 0x77, 0x64, 0xDA, 0x06, 0xCE, 0x30, 0x28, 0x6F, 0x73,
+    0x2F, 0x63, 0x77, 0x64, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x6F, 0x72,
+    0x6B, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
+    0x74, 0x6F, 0x72, 0x79, 0x2E, 0xCF, 0x0D, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0xDA,
+    0x06, 0xCE, 0x80, 0xF2, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74,
+    0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69,
+    0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73,
+    0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x69,
+    0x70, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x63,
+    0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73,
+    0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x61, 0x6C, 0x6C,
+    0x6F, 0x77, 0x20, 0x61, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x64, 0x64, 0x20, 0x65, 0x78, 0x74,
+    0x72, 0x61, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x73, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78,
+    0x61, 0x6D, 0x70, 0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0xCF, 0x0D, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x2F, 0x75, 0x6E, 0x62, 0x72, 0x65, 0x61,
+    0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x2F, 0x75, 0x6E, 0x62, 0x72, 0x65, 0x61, 0x6B,
+    0xDA, 0x06, 0xCE, 0x80, 0xC4, 0x28, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x2F, 0x75, 0x6E, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x2D, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x61, 0x20,
+    0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x61,
+    0x74, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65,
+    0x74, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x6F, 0x66, 0x66, 0x73,
+    0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x30, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x57, 0x69, 0x6C,
+    0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70,
+    0x6F, 0x69, 0x6E, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+    0x2E, 0xCF, 0x08, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x6E, 0x65,
+    0x77, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x70, 0x6D, 0x61,
+    0x70, 0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x06, 0xCE, 0x81, 0x2B,
+    0x28, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x6E, 0x65, 0x77, 0x20,
+    0x26, 0x20, 0x6B, 0x76, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E,
+    0x74, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x2E, 0x20, 0x50, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65,
+    0x6E, 0x74, 0x20, 0x6D, 0x61, 0x70, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x69, 0x6D, 0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x73, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x20,
+    0x72, 0x65, 0x6D, 0x6F, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x20, 0x6B, 0x65, 0x79, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6D, 0x61, 0x70,
+    0x20, 0x69, 0x6E, 0x20, 0x4F, 0x28, 0x6C, 0x6F, 0x67, 0x20,
+    0x6E, 0x29, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x73, 0x20,
+    0x6D, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x74,
+    0x73, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6C,
+    0x64, 0x20, 0x6D, 0x61, 0x70, 0x2E, 0x20, 0x55, 0x73, 0x65,
+    0x20, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x6E, 0x65, 0x78, 0x74,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+    0x68, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x65, 0x72,
+    0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61,
+    0x70, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x20,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0xCF,
+    0x0A, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x70, 0x76, 0x65,
+    0x63, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xDA, 0x06, 0xCE,
+    0x80, 0xE6, 0x28, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x73, 0x6C,
+    0x69, 0x63, 0x65, 0x20, 0x76, 0x65, 0x63, 0x20, 0x26, 0x6F,
+    0x70, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x65,
+    0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69,
+    0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x65, 0x63, 0x74,
+    0x6F, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x76, 0x65, 0x63, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E,
+    0x64, 0x2E, 0x20, 0x49, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73,
+    0x20, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x6C, 0x69, 0x6B, 0x65,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x73, 0x68, 0x61,
+    0x72, 0x65, 0x73, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x76, 0x65, 0x63, 0x2C,
+    0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x6B, 0x65, 0x65,
+    0x70, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20,
+    0x76, 0x65, 0x63, 0x20, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x20,
+    0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x75, 0x73,
+    0x68, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x74, 0x6F, 0x20, 0x69,
+    0x74, 0x2E, 0xCF, 0x0D, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0D, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xDA, 0x06, 0xCE, 0x52,
+    0x28, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x7C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x20,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F,
+    0x72, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0xCF, 0x0A, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x27, 0x28, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x61,
+    0x20, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x8A, 0x87,
+    0x8A, 0xCD, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x05, 0x01, 0x02, 0x05, 0xCE, 0x0A, 0x63, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0xDA, 0x24, 0xDA, 0x72,
+    0xD0, 0x09, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00,
+    0x00, 0x8A, 0xB9, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x16,
+    0xBF, 0xEA, 0x16, 0xBF, 0xEA, 0x16, 0xCF, 0x03, 0x73, 0x65,
+    0x71, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06,
+    0xCE, 0x78, 0x28, 0x73, 0x65, 0x71, 0x20, 0x68, 0x65, 0x61,
+    0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+    0x0A, 0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74,
+    0x6F, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 0x20, 0x62, 0x75,
+    0x74, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6D, 0x75, 0x6C, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x2E, 0x20,
+    0x20, 0x53, 0x65, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6C,
+    0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x43, 0xC1, 0xCD, 0x00, 0x00, 0x44, 0xB1, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x09, 0x01, 0x05,
+    0x14, 0xCE, 0x03, 0x73, 0x65, 0x71, 0xDA, 0x24, 0xDA, 0x60,
+    0xDA, 0x61, 0xDA, 0x65, 0xDA, 0x81, 0xAD, 0xDA, 0x84, 0x68,
+    0x43, 0x04, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x26, 0x07,
+    0x01, 0x00, 0x2D, 0x07, 0x04, 0x05, 0x3D, 0x06, 0x00, 0x00,
+    0x26, 0x07, 0x02, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x2E, 0x01,
+    0x00, 0x00, 0x3D, 0x05, 0x00, 0x00, 0x26, 0x08, 0x03, 0x00,
+    0x2D, 0x08, 0x04, 0x05, 0x3D, 0x07, 0x00, 0x00, 0x26, 0x08,
+    0x04, 0x00, 0x2D, 0x08, 0x00, 0x07, 0x3D, 0x05, 0x00, 0x00,
+    0x26, 0x08, 0x02, 0x00, 0x2D, 0x08, 0x06, 0x05, 0x2B, 0x04,
+    0x00, 0x00, 0x3D, 0x07, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x44, 0x58, 0x07, 0x05, 0x4C, 0xBF, 0xB4,
+    0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C,
+    0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF,
+    0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4,
+    0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C,
+    0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF, 0xB4, 0x4C, 0xBF,
+    0xB4, 0x4C, 0xCF, 0x0A, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x75,
+    0x6E, 0x74, 0x69, 0x6C, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x21,
+    0xCB, 0xDA, 0x06, 0xCE, 0x80, 0x9C, 0x28, 0x64, 0x72, 0x6F,
+    0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x70, 0x72,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x47,
+    0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65,
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x72, 0x65,
+    0x6D, 0x6F, 0x76, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x79, 0x20, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61,
+    0x74, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x62,
+    0x6F, 0x72, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0x66, 0xB3, 0xCD, 0x00, 0x00, 0x67, 0x9B, 0xDA,
+    0x03, 0xDA, 0x83, 0xF4, 0xCF, 0x07, 0x72, 0x65, 0x76, 0x65,
+    0x72, 0x73, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x62, 0x28, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20,
+    0x74, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x7A,
+    0x8A, 0xCD, 0x00, 0x00, 0x7B, 0x90, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x9C, 0x00, 0x00, 0x0B, 0x01, 0x02, 0x0D, 0xCE, 0x07,
+    0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0xDA, 0x24, 0xDA,
+    0x14, 0xDA, 0x2F, 0x37, 0x03, 0x00, 0x00, 0x05, 0x05, 0x03,
+    0xFF, 0x2B, 0x03, 0x00, 0x00, 0x43, 0x07, 0x00, 0x00, 0x25,
+    0x09, 0x00, 0x00, 0x41, 0x08, 0x05, 0x09, 0x1A, 0x08, 0x06,
+    0x00, 0x33, 0x09, 0x00, 0x05, 0x2C, 0x07, 0x09, 0x00, 0x43,
+    0x0A, 0x01, 0x00, 0x05, 0x05, 0x05, 0xFF, 0x18, 0xF9, 0xFF,
+    0xFF, 0x03, 0x07, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x7B, 0x03,
+    0x09, 0x0C, 0x08, 0x13, 0x0E, 0xBF, 0xF2, 0x0E, 0x0C, 0x07,
+    0xBF, 0xF9, 0x07, 0xBF, 0xF2, 0x3E, 0xBF, 0xEB, 0x08, 0xBF,
+    0xE3, 0x1E, 0xBF, 0xE2, 0x1E, 0x06, 0x05, 0xBF, 0xC3, 0x3E,
+    0xBF, 0x06, 0x81, 0x06, 0xCF, 0x05, 0x73, 0x6C, 0x75, 0x72,
+    0x70, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x50, 0x28,
+    0x73, 0x6C, 0x75, 0x72, 0x70, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x61, 0x64, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x70,
+    0x61, 0x74, 0x68, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x6E, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x8C,
+    0x47, 0xCD, 0x00, 0x00, 0x8D, 0x3B, 0xDA, 0x03, 0xDA, 0x81,
+    0x8B, 0xCF, 0x01, 0x2F, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83,
+    0xE2, 0xDA, 0x06, 0xCE, 0x80, 0xFA, 0x28, 0x2F, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75,
+    0x6F, 0x74, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20,
+    0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20,
+    0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x31, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x68, 0x61, 0x73,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x69,
+    0x70, 0x72, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x66, 0x20,
+    0x78, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+    0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x73, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x6C, 0x79, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x64,
+    0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+    0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x44, 0x69, 0x76, 0x69,
+    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x79, 0x20, 0x74, 0x77,
+    0x6F, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73,
+    0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x74, 0x72, 0x75, 0x6E,
+    0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x69, 0x76,
+    0x69, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0xCF, 0x0A, 0x66, 0x69,
+    0x6C, 0x65, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66,
+    0x6C, 0x75, 0x73, 0x68, 0xDA, 0x06, 0xCE, 0x80, 0x90, 0x28,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68,
+    0x20, 0x66, 0x29, 0x0A, 0x0A, 0x46, 0x6C, 0x75, 0x73, 0x68,
+    0x20, 0x61, 0x6E, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x20,
+    0x49, 0x6E, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x73, 0x2C, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65,
+    0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x63, 0x79, 0x20,
+    0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x68, 0x61, 0x6E, 0x64,
+    0x6C, 0x65, 0x2E, 0xCF, 0x01, 0x25, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x82, 0x7A, 0xDA, 0x06, 0xCE, 0x42, 0x28, 0x25, 0x20,
+    0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x6E, 0x64, 0x20, 0x64,
+    0x69, 0x76, 0x69, 0x73, 0x6F, 0x72, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x64, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65,
+    0x6E, 0x64, 0x20, 0x2F, 0x20, 0x64, 0x69, 0x76, 0x69, 0x73,
+    0x6F, 0x72, 0x2E, 0xDA, 0x84, 0x75, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x81, 0x7F, 0xDA, 0x06, 0xCE, 0x82, 0x32, 0x28, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x20, 0x5B, 0x2C, 0x73, 0x69, 0x67, 0x6D,
+    0x61, 0x73, 0x6B, 0x5D, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x2E,
+    0x20, 0x43, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x74, 0x61, 0x6B, 0x65,
+    0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20,
+    0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x68, 0x65,
+    0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x69,
+    0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65,
+    0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79,
+    0x77, 0x6F, 0x72, 0x64, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72,
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x75,
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64,
+    0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x73, 0x69,
+    0x67, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x6C,
+    0x6F, 0x63, 0x6B, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x73, 0x69, 0x67,
+    0x6D, 0x61, 0x73, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x3A, 0x79,
+    0x2E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6D,
+    0x70, 0x6C, 0x65, 0x2C, 0x20, 0x0A, 0x0A, 0x09, 0x28, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6D,
+    0x79, 0x66, 0x75, 0x6E, 0x20, 0x3A, 0x65, 0x31, 0x32, 0x33,
+    0x29, 0x0A, 0x0A, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E,
+    0x61, 0x6C, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x73,
+    0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73,
+    0x20, 0x31, 0x2C, 0x20, 0x32, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x33, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61,
+    0x73, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x3A,
+    0x20, 0x0A, 0x0A, 0x09, 0x61, 0x20, 0x2D, 0x20, 0x62, 0x6C,
+    0x6F, 0x63, 0x6B, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x69,
+    0x67, 0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09, 0x64, 0x20, 0x2D,
+    0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73,
+    0x0A, 0x09, 0x65, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+    0x6B, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x69,
+    0x67, 0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09, 0x75, 0x20, 0x2D,
+    0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x75, 0x73, 0x65,
+    0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x0A,
+    0x09, 0x79, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+    0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09, 0x30, 0x2D, 0x39, 0x20,
+    0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x61, 0x20,
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x75,
+    0x73, 0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+    0xCF, 0x0B, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x62,
+    0x79, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x62, 0x79, 0x74, 0x65,
+    0xDA, 0x06, 0xCE, 0x5C, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x62, 0x79, 0x74, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x20, 0x62, 0x29, 0x0A, 0x0A, 0x49, 0x6E,
+    0x70, 0x75, 0x74, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67,
+    0x6C, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73,
+    0x74, 0x72, 0x65, 0x61, 0x6D, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0xCF, 0x13, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x2F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x2D,
+    0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x13, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x2D, 0x70, 0x72, 0x6F, 0x66, 0x69,
+    0x6C, 0x65, 0xDA, 0x06, 0xCE, 0x82, 0xCD, 0x28, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x2F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x2D,
+    0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x26, 0x6F,
+    0x70, 0x74, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x29, 0x0A,
+    0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x65, 0x64, 0x20,
+    0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6C, 0x6C,
+    0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x72,
+    0x6F, 0x66, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C, 0x20,
+    0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x2E,
+    0x20, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x74, 0x74,
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72,
+    0x6D, 0x6F, 0x73, 0x74, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61,
+    0x63, 0x6B, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x74, 0x73,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20,
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2E, 0x20, 0x45, 0x61,
+    0x63, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x68,
+    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C,
+    0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x63, 0x6F, 0x75, 0x6E,
+    0x74, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x09, 0x3A, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65,
+    0x64, 0x0A, 0x09, 0x3A, 0x70, 0x63, 0x20, 0x2D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09, 0x3A, 0x6E, 0x61, 0x6D,
+    0x65, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61,
+    0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09,
+    0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x2D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x0A, 0x09, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x2D, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6C,
+    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x0A, 0x09, 0x3A,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D, 0x65, 0x6E, 0x64,
+    0x20, 0x2D, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6F, 0x66,
+    0x66, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x0A, 0x09,
+    0x3A, 0x63, 0x20, 0x2D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6D, 0x61, 0x64, 0x65,
+    0x20, 0x6F, 0x75, 0x74, 0x73, 0x69, 0x64, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6A, 0x61, 0x6E, 0x65,
+    0x74, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x0A, 0x0A, 0x49, 0x66, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79,
+    0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F,
+    0x72, 0x64, 0x65, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6C, 0x65, 0x61,
+    0x72, 0x65, 0x64, 0x2E, 0xCF, 0x0E, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65,
+    0xDA, 0x06, 0xCE, 0x4B, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20,
+    0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72,
+    0x73, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F,
+    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x2E, 0xCF,
+    0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x70,
+    0x6C, 0x69, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x23,
+    0xDA, 0x06, 0xCE, 0x80, 0xDC, 0x28, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x20, 0x64,
+    0x65, 0x6C, 0x69, 0x6D, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A,
+    0x0A, 0x53, 0x70, 0x6C, 0x69, 0x74, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x65, 0x6C, 0x69,
+    0x6D, 0x69, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65, 0x6C, 0x69,
+    0x6D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x75, 0x62, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x6C, 0x69, 0x6D, 0x69,
+    0x74, 0x65, 0x72, 0x20, 0x64, 0x65, 0x6C, 0x69, 0x6D, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x64, 0x65, 0x6C, 0x69, 0x6D, 0x20,
+    0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75,
+    0x6E, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x68, 0x61,
+    0x76, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xCF, 0x09, 0x73, 0x65, 0x74,
+    0x2F, 0x75, 0x6E, 0x69, 0x6F, 0x6E, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x09, 0x73, 0x65, 0x74, 0x2F, 0x75, 0x6E, 0x69, 0x6F,
+    0x6E, 0xDA, 0x06, 0xCE, 0x7C, 0x28, 0x73, 0x65, 0x74, 0x2F,
+    0x75, 0x6E, 0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20, 0x73, 0x65,
+    0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x74, 0x73,
+    0x2E, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x74, 0x73, 0x2E, 0xCF,
+    0x07, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3F, 0xD4, 0x02,
+    0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x24, 0x28, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x89,
+    0xE9, 0x8A, 0x29, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00,
+    0x00, 0x05, 0x01, 0x02, 0x05, 0xCE, 0x07, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA, 0x80,
+    0xC5, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00,
+    0x00, 0x8A, 0x18, 0x07, 0xBF, 0xF9, 0x07, 0xBF, 0xF6, 0x13,
+    0xBF, 0xED, 0x13, 0xBF, 0xED, 0x13, 0xCF, 0x07, 0x70, 0x72,
+    0x65, 0x77, 0x61, 0x6C, 0x6B, 0xD4, 0x02, 0xD3, 0x01, 0xDA,
+    0x06, 0xCE, 0x42, 0x28, 0x70, 0x72, 0x65, 0x77, 0x61, 0x6C,
+    0x6B, 0x20, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x0A,
+    0x0A, 0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74,
+    0x6F, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x77, 0x61, 0x6C, 0x6B,
+    0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x70,
+    0x72, 0x65, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74,
+    0x72, 0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x75,
+    0xC9, 0xCD, 0x00, 0x00, 0x76, 0x3F, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0xBE, 0x00, 0x00, 0x06, 0x02, 0x01, 0x06, 0x01, 0xCE,
+    0x07, 0x70, 0x72, 0x65, 0x77, 0x61, 0x6C, 0x6B, 0xDA, 0x24,
+    0xDA, 0x7D, 0x28, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00,
+    0x44, 0x04, 0x01, 0x00, 0x2C, 0x03, 0x04, 0x00, 0x26, 0x05,
+    0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0xCD, 0x00, 0xD4, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x04, 0x01, 0xDA, 0x24, 0x27, 0x01,
+    0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x02,
+    0x30, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x76,
+    0x27, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4,
+    0x0C, 0xCD, 0x00, 0x00, 0x75, 0xC9, 0x76, 0xBF, 0xE0, 0x15,
+    0x02, 0x07, 0xBF, 0xDC, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB,
+    0x25, 0xCF, 0x07, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x75, 0x28, 0x66,
+    0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x28, 0x74, 0x72, 0x65, 0x65, 0x29, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x70,
+    0x74, 0x68, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74,
+    0x72, 0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F,
+    0x66, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x87, 0xE9, 0xCD, 0x00, 0x00,
+    0x88, 0x82, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x04, 0x01, 0x01, 0x04, 0xCE, 0x07, 0x66, 0x6C, 0x61, 0x74,
+    0x74, 0x65, 0x6E, 0xDA, 0x24, 0xDA, 0x86, 0x34, 0x38, 0x02,
+    0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x30, 0x03, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x88, 0x6D, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xCF,
+    0x03, 0x62, 0x6F, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x09, 0x00, 0x0E, 0x06, 0x00, 0x00, 0x13, 0xCE, 0x03,
+    0x62, 0x6F, 0x72, 0x37, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01,
+    0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05,
+    0x00, 0x25, 0x03, 0x00, 0x00, 0x35, 0x04, 0x00, 0x00, 0x0D,
+    0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x0D,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x06, 0xCE, 0x59, 0x28, 0x62, 0x6F, 0x72, 0x20, 0x26, 0x20,
+    0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74,
+    0x2D, 0x77, 0x69, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x2E, 0x20,
+    0x45, 0x61, 0x63, 0x68, 0x20, 0x78, 0x20, 0x69, 0x6E, 0x20,
+    0x78, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x2E, 0xCF, 0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F,
+    0x70, 0x65, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x55,
+    0xDA, 0x06, 0xCE, 0x81, 0xED, 0x28, 0x66, 0x69, 0x6C, 0x65,
+    0x2F, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x20, 0x5B, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x29, 0x0A,
+    0x0A, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x2E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C,
+    0x75, 0x74, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x6C,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x6F, 0x64, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x69,
+    0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x74,
+    0x6F, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x2E, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x77, 0x68,
+    0x65, 0x72, 0x65, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63,
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x72,
+    0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x61, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x2E, 0x20, 0x49, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x6F, 0x70, 0x65, 0x6E, 0x65, 0x64, 0x2C, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0x20,
+    0x4D, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73,
+    0x3A, 0x0A, 0x0A, 0x09, 0x72, 0x20, 0x2D, 0x20, 0x61, 0x6C,
+    0x6C, 0x6F, 0x77, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x77, 0x20, 0x2D,
+    0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x77, 0x72, 0x69,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x61, 0x20,
+    0x2D, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x0A, 0x09, 0x62, 0x20, 0x2D, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x20, 0x28, 0x72, 0x61, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x09,
+    0x2B, 0x20, 0x2D, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x77, 0x72,
+    0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x74, 0xCF, 0x10,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73,
+    0x68, 0x2D, 0x62, 0x79, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x80, 0xDF, 0xDA, 0x06, 0xCE, 0x80, 0xA6, 0x28, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68,
+    0x2D, 0x62, 0x79, 0x74, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x41, 0x70, 0x70,
+    0x65, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x65,
+    0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20,
+    0x6E, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+    0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C,
+    0x6F, 0x77, 0x73, 0x2E, 0xCF, 0x0B, 0x70, 0x6D, 0x61, 0x70,
+    0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0B, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x72, 0x65,
+    0x6D, 0x6F, 0x76, 0x65, 0xDA, 0x06, 0xCE, 0x6F, 0x28, 0x70,
+    0x6D, 0x61, 0x70, 0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65,
+    0x20, 0x6D, 0x61, 0x70, 0x20, 0x26, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x65,
+    0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x6D,
+    0x61, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+    0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20,
+    0x6D, 0x61, 0x70, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x2E, 0xCF,
+    0x0A, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x6D, 0x65, 0x72, 0x67,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x70, 0x6D, 0x61,
+    0x70, 0x2F, 0x6D, 0x65, 0x72, 0x67, 0x65, 0xDA, 0x06, 0xCE,
+    0x80, 0xB1, 0x28, 0x70, 0x6D, 0x61, 0x70, 0x2F, 0x6D, 0x65,
+    0x72, 0x67, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x26, 0x20,
+    0x63, 0x6F, 0x6C, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65,
+    0x6E, 0x74, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x70, 0x65, 0x72,
+    0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61,
+    0x70, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x73,
+    0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+    0x6D, 0x61, 0x70, 0x2E, 0x20, 0x4C, 0x61, 0x74, 0x65, 0x72,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65,
+    0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x65, 0x61, 0x72, 0x6C,
+    0x69, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x65, 0x73, 0x2E, 0xCF,
+    0x10, 0x73, 0x65, 0x74, 0x2F, 0x69, 0x6E, 0x74, 0x65, 0x72,
+    0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x10, 0x73, 0x65, 0x74, 0x2F, 0x69, 0x6E, 0x74,
+    0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0xDA,
+    0x06, 0xCE, 0x80, 0x92, 0x28, 0x73, 0x65, 0x74, 0x2F, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x73, 0x65, 0x74, 0x20, 0x26, 0x20, 0x73, 0x65,
+    0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73,
+    0x65, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x74,
+    0x73, 0x2E, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x74, 0x73, 0x2E,
+    0xCF, 0x0A, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E,
+    0x65, 0x77, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x74, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x06,
+    0xCE, 0x5C, 0x28, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x6E, 0x65, 0x77, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x73,
+    0x69, 0x7A, 0x65, 0x20, 0x5B, 0x73, 0x74, 0x72, 0x69, 0x64,
+    0x65, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5B, 0x6F, 0x66, 0x66,
+    0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x20, 0x5B, 0x74,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x7C, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x5D, 0x5D, 0x5D, 0x20, 0x29, 0x0A,
+    0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2E, 0xCF, 0x03, 0x73, 0x75, 0x6D, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x3B, 0x28, 0x73, 0x75,
+    0x6D, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x73, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65,
+    0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x30, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x47, 0x57, 0xCD, 0x00,
+    0x00, 0x47, 0xD6, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00,
+    0x00, 0x09, 0x01, 0x00, 0x0B, 0xCE, 0x03, 0x73, 0x75, 0x6D,
+    0xDA, 0x24, 0x25, 0x02, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
+    0x37, 0x05, 0x03, 0x00, 0x25, 0x04, 0x00, 0x00, 0x3E, 0x06,
+    0x04, 0x05, 0x1A, 0x06, 0x05, 0x00, 0x33, 0x08, 0x03, 0x04,
+    0x06, 0x02, 0x02, 0x08, 0x05, 0x04, 0x04, 0x01, 0x18, 0xFB,
+    0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x47,
+    0xA0, 0x0C, 0x04, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D,
+    0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF,
+    0xF4, 0x0B, 0xBF, 0xE4, 0x1D, 0xBF, 0xE3, 0x1D, 0xBF, 0x8A,
+    0x7F, 0xCF, 0x06, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x83, 0x32, 0xDA, 0x06, 0xCE, 0x80,
+    0xA8, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x62, 0x79, 0x20,
+    0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2E,
+    0x20, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x76, 0x69, 0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+    0x69, 0x62, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65,
+    0x6E, 0x63, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF,
+    0x0D, 0x67, 0x63, 0x73, 0x65, 0x74, 0x69, 0x6E, 0x74, 0x65,
+    0x72, 0x76, 0x61, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0D,
+    0x67, 0x63, 0x73, 0x65, 0x74, 0x69, 0x6E, 0x74, 0x65, 0x72,
+    0x76, 0x61, 0x6C, 0xDA, 0x06, 0xCE, 0x80, 0xD4, 0x28, 0x67,
+    0x63, 0x73, 0x65, 0x74, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76,
+    0x61, 0x6C, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6C, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20, 0x61, 0x6E,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C,
+    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x62, 0x65, 0x66,
+    0x6F, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E,
+    0x67, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20,
+    0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0x20, 0x4C, 0x6F, 0x77, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x69, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6C, 0x6F, 0x77, 0x65,
+    0x72, 0x20, 0x62, 0x75, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x6C, 0x65, 0x73, 0x73, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72,
+    0x79, 0x2E, 0x20, 0x48, 0x69, 0x67, 0x68, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x62, 0x65, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20,
+    0x62, 0x75, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6D, 0x6F,
+    0x72, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2E,
+    0xCF, 0x03, 0x70, 0x75, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7,
+    0xCD, 0x00, 0x0C, 0x00, 0x07, 0x03, 0x03, 0x00, 0x02, 0xCE,
+    0x03, 0x70, 0x75, 0x74, 0x34, 0x00, 0x01, 0x02, 0x03, 0x00,
+    0x00, 0x00, 0xDA, 0x06, 0xCE, 0x82, 0x57, 0x28, 0x70, 0x75,
+    0x74, 0x20, 0x64, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x41, 0x73, 0x73,
+    0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x49,
+    0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+    0x65, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x73, 0x29, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61,
+    0x63, 0x63, 0x65, 0x70, 0x74, 0x20, 0x6E, 0x6F, 0x6E, 0x2D,
+    0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x69,
+    0x66, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x73, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x2E, 0x20, 0x49, 0x6E,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C,
+    0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x73, 0x70, 0x61,
+    0x63, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x6E, 0x69, 0x6C, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x65, 0x78, 0x74, 0x72,
+    0x61, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x6C,
+    0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x30, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x2E, 0x20, 0x49, 0x6E, 0x20,
+    0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x70,
+    0x75, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x64,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74,
+    0x79, 0x70, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x68,
+    0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73,
+    0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D,
+    0x75, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x50, 0x75, 0x74,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x6E, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+    0x72, 0x65, 0x20, 0x64, 0x73, 0x2E, 0xCF, 0x02, 0x3E, 0x3D,
+    0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x1C,
+    0x06, 0x00, 0x00, 0x10, 0xCE, 0x02, 0x3E, 0x3D, 0x37, 0x01,
+    0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00,
+    0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x33, 0x04,
+    0x00, 0x05, 0x41, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00,
+    0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02,
+    0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0xDA, 0x06, 0xCE, 0x50, 0x28, 0x3E, 0x3D, 0x20,
+    0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72,
+    0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6E, 0x6F, 0x6E,
+    0x2D, 0x61, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F,
+    0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x0C, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x91, 0xDA, 0x06, 0xCE,
+    0x81, 0x91, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73,
+    0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x66, 0x69, 0x62, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x6E,
+    0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x64,
+    0x65, 0x61, 0x64, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20,
+    0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x0A, 0x09,
+    0x3A, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x68,
+    0x61, 0x73, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x65, 0x64,
+    0x20, 0x6F, 0x75, 0x74, 0x0A, 0x09, 0x3A, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x73, 0x75,
+    0x73, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x6D, 0x6F, 0x64,
+    0x65, 0x0A, 0x09, 0x3A, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65,
+    0x65, 0x6E, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x65, 0x64,
+    0x0A, 0x09, 0x3A, 0x75, 0x73, 0x65, 0x72, 0x28, 0x30, 0x2D,
+    0x39, 0x29, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x73, 0x75,
+    0x73, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79,
+    0x20, 0x61, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x73, 0x69,
+    0x67, 0x6E, 0x61, 0x6C, 0x0A, 0x09, 0x3A, 0x61, 0x6C, 0x69,
+    0x76, 0x65, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x72, 0x75,
+    0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x0A, 0x09, 0x3A,
+    0x6E, 0x65, 0x77, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20,
+    0x6A, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x79, 0x65, 0x74, 0x20,
+    0x72, 0x75, 0x6E, 0xCF, 0x0E, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x81, 0x4E, 0xDA, 0x06, 0xCE, 0x80,
+    0xA7, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72,
+    0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x70, 0x61, 0x74,
+    0x74, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x20, 0x73, 0x74,
+    0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x63,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x75, 0x62, 0x73,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E,
+    0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x66,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66,
+    0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65,
+    0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x73, 0x74, 0x72, 0x2E, 0xCF, 0x08,
+    0x70, 0x76, 0x65, 0x63, 0x2F, 0x70, 0x6F, 0x70, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x08, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x70,
+    0x6F, 0x70, 0xDA, 0x06, 0xCE, 0x4E, 0x28, 0x70, 0x76, 0x65,
+    0x63, 0x2F, 0x70, 0x6F, 0x70, 0x20, 0x76, 0x65, 0x63, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x65, 0x72, 0x73,
+    0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x65, 0x63,
+    0x74, 0x6F, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75,
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x76, 0x65, 0x63, 0x2E, 0xCF, 0x0D, 0x70, 0x76, 0x65, 0x63,
+    0x2F, 0x74, 0x6F, 0x2D, 0x74, 0x75, 0x70, 0x6C, 0x65, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x70, 0x76, 0x65, 0x63, 0x2F,
+    0x74, 0x6F, 0x2D, 0x74, 0x75, 0x70, 0x6C, 0x65, 0xDA, 0x06,
+    0xCE, 0x40, 0x28, 0x70, 0x76, 0x65, 0x63, 0x2F, 0x74, 0x6F,
+    0x2D, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x76, 0x65, 0x63,
+    0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74,
+    0x20, 0x61, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74,
+    0x65, 0x6E, 0x74, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0xCF, 0x0B, 0x72, 0x6F,
+    0x70, 0x65, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x72, 0x6F, 0x70, 0x65, 0x2F,
+    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0xDA, 0x06, 0xCE, 0x80,
+    0x84, 0x28, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0x20, 0x72, 0x6F, 0x70, 0x65, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x26, 0x20, 0x61, 0x72,
+    0x67, 0x73, 0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x70,
+    0x75, 0x73, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x64, 0x20,
+    0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x20, 0x72, 0x6F, 0x70, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x72, 0x6F,
+    0x70, 0x65, 0x2E, 0xCF, 0x0C, 0x73, 0x6F, 0x72, 0x74, 0x65,
+    0x64, 0x2F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0C, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F,
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0xDA, 0x06, 0xCE, 0x80, 0xA4,
+    0x28, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x72, 0x61,
+    0x6E, 0x67, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x26, 0x6F,
+    0x70, 0x74, 0x20, 0x6C, 0x6F, 0x20, 0x68, 0x69, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20,
+    0x6C, 0x6F, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6C, 0x65, 0x73,
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x68, 0x69, 0x2C,
+    0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E,
+    0x20, 0x41, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x62, 0x6F, 0x75,
+    0x6E, 0x64, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65,
+    0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x73,
+    0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73,
+    0x69, 0x64, 0x65, 0x2E, 0xCF, 0x06, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x3F, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x36,
+    0x28, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3F, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x73, 0x79, 0x6D, 0x62,
+    0x6F, 0x6C, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA,
+    0x24, 0x8C, 0x0E, 0x8C, 0xB7, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x9C, 0x00, 0x00, 0x09, 0x01, 0x05, 0x14, 0xCE, 0x06, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x3F, 0xDA, 0x24, 0xDA, 0x72, 0xDA,
+    0x83, 0x37, 0xDA, 0x81, 0x04, 0xDA, 0x81, 0xD4, 0xDA, 0x80,
+    0xC5, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x26,
+    0x05, 0x01, 0x00, 0x1F, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x03,
+    0x00, 0x23, 0x05, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x26,
+    0x06, 0x02, 0x00, 0x1F, 0x05, 0x03, 0x06, 0x1A, 0x05, 0x03,
+    0x00, 0x23, 0x06, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x26,
+    0x07, 0x03, 0x00, 0x1F, 0x06, 0x03, 0x07, 0x1A, 0x06, 0x03,
+    0x00, 0x23, 0x07, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x26,
+    0x08, 0x04, 0x00, 0x1F, 0x07, 0x03, 0x08, 0x03, 0x07, 0x00,
+    0x00, 0x8C, 0x55, 0x07, 0xBF, 0xF9, 0x07, 0x09, 0x0C, 0xBF,
+    0xF4, 0x0C, 0xBF, 0xF0, 0x55, 0xBF, 0xAB, 0x55, 0xBF, 0xAB,
+    0x55, 0xBF, 0xC6, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF0, 0x3D,
+    0xBF, 0xC3, 0x3D, 0xBF, 0xC3, 0x3D, 0xBF, 0xDE, 0x0D, 0xBF,
+    0xF3, 0x0D, 0xBF, 0xEF, 0x25, 0xBF, 0xDB, 0x25, 0xBF, 0xDB,
+    0x25, 0xBF, 0xF3, 0x0C, 0xBF, 0xF4, 0x0C, 0xBF, 0xF4, 0x0C,
+    0xCF, 0x08, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x39, 0x28, 0x69,
+    0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x41, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x4E, 0xB5, 0xCD, 0x00, 0x00,
+    0x4E, 0xFD, 0xDA, 0x03, 0xDA, 0x80, 0xF7, 0xCF, 0x05, 0x6A,
+    0x75, 0x78, 0x74, 0x2A, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x7C, 0x28, 0x6A, 0x75, 0x78, 0x74, 0x2A, 0x20, 0x26,
+    0x20, 0x66, 0x75, 0x6E, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6A, 0x75, 0x78, 0x74, 0x61, 0x70, 0x6F, 0x73, 0x69, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x49, 0x6E,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x6F, 0x72,
+    0x64, 0x73, 0x2C, 0x20, 0x20, 0x28, 0x28, 0x6A, 0x75, 0x78,
+    0x74, 0x2A, 0x20, 0x61, 0x20, 0x62, 0x20, 0x63, 0x29, 0x20,
+    0x78, 0x29, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x28, 0x28, 0x61, 0x20,
+    0x78, 0x29, 0x20, 0x28, 0x62, 0x20, 0x78, 0x29, 0x20, 0x28,
+    0x63, 0x20, 0x78, 0x29, 0x29, 0x2E, 0xDA, 0x23, 0xD2, 0x03,
+    0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x68, 0x1D, 0xCD, 0x00,
+    0x00, 0x69, 0x18, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBB, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0xCE, 0x05, 0x6A, 0x75,
+    0x78, 0x74, 0x2A, 0xDA, 0x24, 0x28, 0x01, 0x00, 0x00, 0x2A,
+    0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x00, 0xD1,
+    0x00, 0x00, 0x0A, 0x00, 0x02, 0x11, 0x01, 0xDA, 0x24, 0xDA,
+    0x2F, 0xDA, 0x7C, 0x38, 0x02, 0x00, 0x00, 0x27, 0x03, 0x00,
+    0x00, 0x37, 0x05, 0x03, 0x00, 0x25, 0x04, 0x00, 0x00, 0x3E,
+    0x06, 0x04, 0x05, 0x1A, 0x06, 0x08, 0x00, 0x33, 0x08, 0x03,
+    0x04, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x2C,
+    0x02, 0x07, 0x00, 0x43, 0x09, 0x00, 0x00, 0x05, 0x04, 0x04,
+    0x01, 0x18, 0xF8, 0xFF, 0xFF, 0x25, 0x03, 0x00, 0x00, 0x2C,
+    0x02, 0x03, 0x00, 0x26, 0x03, 0x01, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0xBF, 0xFF, 0xCD, 0x00, 0x00, 0x68, 0xB9, 0x0C, 0x06,
+    0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33,
+    0xBF, 0xCD, 0x33, 0xBF, 0xCD, 0x33, 0xBF, 0xF6, 0x08, 0xBF,
+    0xF8, 0x08, 0xBF, 0xE8, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xCE,
+    0x33, 0xBF, 0xCD, 0x33, 0x06, 0x12, 0xBF, 0xEE, 0x12, 0xBF,
+    0xEE, 0x12, 0xBF, 0xEE, 0x12, 0xCD, 0x00, 0x00, 0x68, 0x1D,
+    0x80, 0xFB, 0xBF, 0x90, 0x6F, 0xBF, 0x91, 0x6F, 0xCF, 0x06,
+    0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0xD4, 0x02, 0xD3, 0x01,
+    0xDA, 0x06, 0xCE, 0x4A, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78,
+    0x31, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x45, 0x78, 0x70, 0x61,
+    0x6E, 0x64, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C,
+    0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76,
+    0x65, 0x6C, 0x79, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64,
+    0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x2E, 0xDA, 0x23,
+    0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0x9E, 0xBF,
+    0xCD, 0x00, 0x00, 0xA7, 0xAE, 0xDA, 0x03, 0xDA, 0x81, 0x0F,
+    0xCF, 0x0B, 0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE,
+    0x44, 0x28, 0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x66, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+    0x6C, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA,
+    0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD, 0x00, 0x00, 0xB0,
+    0x12, 0xCD, 0x00, 0x00, 0xB0, 0xD6, 0xDA, 0x03, 0xDA, 0x81,
+    0x6E, 0xCF, 0x0B, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x78, 0x74, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06,
+    0xCE, 0x82, 0x96, 0x28, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F,
+    0x6E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x73,
+    0x29, 0x0A, 0x0A, 0x52, 0x75, 0x6E, 0x20, 0x61, 0x20, 0x63,
+    0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x20, 0x54, 0x68,
+    0x69, 0x73, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x73, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x73,
+    0x20, 0x65, 0x6E, 0x63, 0x61, 0x70, 0x73, 0x75, 0x6C, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20, 0x6F, 0x70, 0x74,
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6F, 0x70, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6F,
+    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77,
+    0x73, 0x3A, 0x0A, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x63, 0x68,
+    0x75, 0x6E, 0x6B, 0x73, 0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C,
+    0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x2D, 0x20,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x0A, 0x09,
+    0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20,
+    0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x77,
+    0x68, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x73, 0x20, 0x2D, 0x20,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x0A, 0x09, 0x20, 0x20, 0x3A, 0x65, 0x6E, 0x76, 0x20, 0x2D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+    0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x67,
+    0x61, 0x69, 0x6E, 0x73, 0x74, 0x20, 0x2D, 0x20, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x2A,
+    0x65, 0x6E, 0x76, 0x2A, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x73,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x2D, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
+    0x6F, 0x66, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x62, 0x65, 0x74, 0x74, 0x65, 0x72,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x2D, 0x20,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x22, 0x3C, 0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F,
+    0x75, 0x73, 0x3E, 0x22, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x6F,
+    0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x63, 0x61,
+    0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x77, 0x68, 0x65,
+    0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x73, 0x20,
+    0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x6F,
+    0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x2D,
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20,
+    0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x65, 0x76, 0x61, 0x6C,
+    0x75, 0x61, 0x74, 0x65, 0x64, 0x20, 0x2D, 0x20, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x74, 0x72, 0x61, 0x63, 0x65, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0xB1, 0x78, 0xCD, 0x00, 0x00,
+    0xBB, 0x00, 0xDA, 0x03, 0xDA, 0x81, 0x85, 0xCF, 0x06, 0x67,
+    0x63, 0x73, 0x74, 0x65, 0x70, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x06, 0x67, 0x63, 0x73, 0x74, 0x65, 0x70, 0xDA, 0x06, 0xCE,
+    0x54, 0x28, 0x67, 0x63, 0x73, 0x74, 0x65, 0x70, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x64, 0x6F,
+    0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x65, 0x61, 0x63, 0x68,
+    0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x6E, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xCF, 0x06, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x3C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83, 0x8D,
+    0xDA, 0x06, 0xCE, 0x70, 0x28, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x3C, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73,
+    0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74,
+    0x6C, 0x79, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73,
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74,
+    0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F,
+    0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x01, 0x3E, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0x19, 0xDA, 0x06, 0xCE, 0x4C,
+    0x28, 0x3E, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6E, 0x75,
+    0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x64, 0x65, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F,
+    0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x0C, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x00, 0xDA, 0x06, 0xCE,
+    0x81, 0x37, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63,
+    0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x61, 0x72, 0x72, 0x20,
+    0x26, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x0A,
+    0x43, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74,
+    0x65, 0x73, 0x20, 0x61, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61,
+    0x64, 0x69, 0x63, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73,
+    0x20, 0x28, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x73, 0x29, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x61,
+    0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x68,
+    0x69, 0x63, 0x68, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x49,
+    0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20,
+    0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x4F,
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20,
+    0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x61, 0x70, 0x70,
+    0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x72, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+    0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x61,
+    0x72, 0x72, 0x2E, 0xCF, 0x11, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x74, 0x6F, 0x67, 0x67,
+    0x6C, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x11, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x74,
+    0x6F, 0x67, 0x67, 0x6C, 0x65, 0xDA, 0x06, 0xCE, 0x67, 0x28,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69, 0x74,
+    0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x29, 0x0A, 0x0A, 0x54, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x20, 0x61,
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65,
+    0x6E, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0xCF, 0x09, 0x6F, 0x73, 0x2F, 0x67, 0x65, 0x74,
+    0x65, 0x6E, 0x76, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6F,
+    0x73, 0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0xDA, 0x06,
+    0xCE, 0x46, 0x28, 0x6F, 0x73, 0x2F, 0x67, 0x65, 0x74, 0x65,
+    0x6E, 0x76, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C,
+    0x65, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0xCF, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x81, 0x7A, 0xDA, 0x06, 0xCE, 0x80, 0xA0,
+    0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x70, 0x72,
+    0x6F, 0x64, 0x75, 0x63, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x71, 0x75, 0x65,
+    0x75, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78,
+    0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2E, 0x20, 0x57, 0x69,
+    0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65,
+    0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+    0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x64, 0x65, 0x71,
+    0x75, 0x65, 0x75, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x65, 0x78, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E,
+    0xCF, 0x0C, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x66,
+    0x6C, 0x6F, 0x6F, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C,
+    0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2F, 0x66, 0x6C, 0x6F,
+    0x6F, 0x72, 0xDA, 0x06, 0xCE, 0x5D, 0x28, 0x73, 0x6F, 0x72,
+    0x74, 0x65, 0x64, 0x2F, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x20,
+    0x6D, 0x61, 0x70, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x74,
+    0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x61,
+    0x70, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6B, 0x65, 0x79,
+    0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xCF,
+    0x13, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x2F,
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x13, 0x61, 0x62, 0x73, 0x74,
+    0x72, 0x61, 0x63, 0x74, 0x2F, 0x70, 0x72, 0x6F, 0x70, 0x65,
+    0x72, 0x74, 0x69, 0x65, 0x73, 0xDA, 0x06, 0xCE, 0x48, 0x28,
+    0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x2F, 0x70,
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20,
+    0x74, 0x61, 0x67, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61,
+    0x63, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x70, 0x72,
+    0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61,
+    0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x2E, 0xCF, 0x08, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72,
+    0x6F, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06,
+    0xCE, 0x27, 0x28, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72,
+    0x6F, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D,
+    0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69,
+    0x6E, 0x65, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+    0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x84, 0x63,
+    0x84, 0xBC, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00,
+    0x04, 0x01, 0x02, 0x05, 0xCE, 0x08, 0x64, 0x65, 0x66, 0x6D,
+    0x61, 0x63, 0x72, 0x6F, 0xDA, 0x24, 0xDA, 0x5C, 0xDA, 0x83,
+    0x38, 0x26, 0x03, 0x00, 0x00, 0x2C, 0x00, 0x03, 0x00, 0x2E,
+    0x01, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0x84, 0x9F, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C,
+    0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xCF, 0x0A, 0x77, 0x69,
+    0x74, 0x68, 0x2D, 0x61, 0x72, 0x65, 0x6E, 0x61, 0xD4, 0x02,
+    0xD3, 0x02, 0xDA, 0x5C, 0xCB, 0xDA, 0x06, 0xCE, 0x81, 0xDB,
+    0x28, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x61, 0x72, 0x65, 0x6E,
+    0x61, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+    0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E,
+    0x20, 0x61, 0x72, 0x65, 0x6E, 0x61, 0x20, 0x73, 0x63, 0x6F,
+    0x70, 0x65, 0x2E, 0x20, 0x43, 0x6F, 0x6C, 0x6C, 0x65, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x64, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x75,
+    0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20,
+    0x73, 0x63, 0x6F, 0x70, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x73,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E,
+    0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74, 0x68, 0x69, 0x6E,
+    0x67, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x6D, 0x6F, 0x72, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x66, 0x72, 0x65, 0x65, 0x64, 0x20,
+    0x61, 0x74, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x2E, 0x20, 0x55,
+    0x73, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x68, 0x6F,
+    0x72, 0x74, 0x20, 0x6C, 0x69, 0x76, 0x65, 0x64, 0x20, 0x77,
+    0x6F, 0x72, 0x6B, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x20,
+    0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x6D,
+    0x6F, 0x73, 0x74, 0x6C, 0x79, 0x20, 0x67, 0x61, 0x72, 0x62,
+    0x61, 0x67, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x6F, 0x64, 0x79,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x63, 0x6F, 0x70,
+    0x65, 0x20, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x20, 0x77, 0x68,
+    0x65, 0x6E, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x2C, 0x20, 0x72, 0x61, 0x69,
+    0x73, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E,
+    0x61, 0x6C, 0x73, 0x2C, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20,
+    0x61, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x79, 0x69,
+    0x65, 0x6C, 0x64, 0x2E, 0x20, 0x20, 0x45, 0x72, 0x72, 0x6F,
+    0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x6E, 0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x64,
+    0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x62, 0x6F, 0x64, 0x79, 0x2C, 0x20, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x72,
+    0x75, 0x6E, 0x73, 0x20, 0x6F, 0x75, 0x74, 0x73, 0x69, 0x64,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x65, 0x6E, 0x61, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0x9F, 0x98, 0xCD, 0x00, 0x00, 0x22, 0xA4, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x0C, 0x00, 0x0F,
+    0x30, 0xCE, 0x0A, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x61, 0x72,
+    0x65, 0x6E, 0x61, 0xDA, 0x24, 0xDA, 0x60, 0xDA, 0x80, 0xF3,
+    0xDA, 0x81, 0x7F, 0xDA, 0x81, 0x7E, 0xDA, 0x84, 0x43, 0xDA,
+    0x81, 0xEA, 0xDA, 0x80, 0xF1, 0xDA, 0x87, 0x31, 0xDA, 0x81,
+    0x91, 0xDA, 0x86, 0x51, 0xDA, 0x81, 0x92, 0xDA, 0x81, 0xDA,
+    0xDA, 0x80, 0xF2, 0xDA, 0x80, 0xF5, 0xDA, 0x81, 0xEB, 0x43,
+    0x03, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x43, 0x05, 0x00,
+    0x00, 0x3D, 0x02, 0x00, 0x00, 0x26, 0x07, 0x01, 0x00, 0x2C,
+    0x07, 0x02, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x06, 0x00,
+    0x00, 0x26, 0x07, 0x02, 0x00, 0x26, 0x08, 0x03, 0x00, 0x2D,
+    0x07, 0x06, 0x08, 0x3D, 0x02, 0x00, 0x00, 0x26, 0x07, 0x04,
+    0x00, 0x2B, 0x07, 0x00, 0x00, 0x3D, 0x06, 0x00, 0x00, 0x2D,
+    0x04, 0x02, 0x03, 0x2B, 0x06, 0x00, 0x00, 0x3D, 0x07, 0x00,
+    0x00, 0x26, 0x06, 0x05, 0x00, 0x2C, 0x06, 0x04, 0x00, 0x3D,
+    0x02, 0x00, 0x00, 0x26, 0x08, 0x06, 0x00, 0x2D, 0x08, 0x05,
+    0x02, 0x3D, 0x06, 0x00, 0x00, 0x26, 0x08, 0x07, 0x00, 0x2C,
+    0x08, 0x03, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x26, 0x09, 0x08,
+    0x00, 0x2C, 0x09, 0x04, 0x00, 0x3D, 0x08, 0x00, 0x00, 0x26,
+    0x0A, 0x09, 0x00, 0x26, 0x0B, 0x0A, 0x00, 0x2D, 0x0A, 0x08,
+    0x0B, 0x3D, 0x09, 0x00, 0x00, 0x26, 0x0A, 0x0B, 0x00, 0x2D,
+    0x0A, 0x05, 0x04, 0x3D, 0x08, 0x00, 0x00, 0x26, 0x0B, 0x0C,
+    0x00, 0x2D, 0x0B, 0x05, 0x08, 0x3D, 0x0A, 0x00, 0x00, 0x26,
+    0x0B, 0x0D, 0x00, 0x2D, 0x0B, 0x09, 0x0A, 0x3D, 0x08, 0x00,
+    0x00, 0x26, 0x0A, 0x0E, 0x00, 0x2D, 0x0A, 0x07, 0x06, 0x2D,
+    0x02, 0x08, 0x05, 0x3D, 0x09, 0x00, 0x00, 0x03, 0x09, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0x21, 0x93, 0x07, 0x0C, 0x07, 0x0C,
+    0x07, 0x07, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25,
+    0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB, 0xBF, 0x25, 0x80, 0xDB,
+    0xCF, 0x06, 0x65, 0x76, 0x65, 0x72, 0x79, 0x3F, 0xD4, 0x02,
+    0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x59, 0x28, 0x65, 0x76, 0x65,
+    0x72, 0x79, 0x3F, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20,
+    0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2C,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x79, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0x79, 0xD0, 0xCD, 0x00, 0x00,
+    0x7A, 0x87, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00,
+    0x09, 0x01, 0x00, 0x11, 0xCE, 0x06, 0x65, 0x76, 0x65, 0x72,
+    0x79, 0x3F, 0xDA, 0x24, 0x23, 0x02, 0x00, 0x00, 0x17, 0x03,
+    0x00, 0x00, 0x37, 0x05, 0x03, 0x00, 0x25, 0x04, 0x00, 0x00,
+    0x3E, 0x07, 0x04, 0x05, 0x1A, 0x07, 0x03, 0x00, 0x17, 0x06,
+    0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00,
+    0x1A, 0x06, 0x07, 0x00, 0x33, 0x08, 0x03, 0x04, 0x1A, 0x08,
+    0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x02, 0x08, 0x00,
+    0x05, 0x04, 0x04, 0x01, 0x18, 0xF5, 0xFF, 0xFF, 0x03, 0x02,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x7A, 0x38, 0x0D, 0x04, 0x37,
+    0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF,
+    0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9,
+    0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xC9, 0x37, 0xBF, 0xEA, 0x15,
+    0xBF, 0xEB, 0x15, 0xBF, 0xF5, 0x0A, 0xBF, 0xCB, 0x37, 0xBF,
+    0xC9, 0x37, 0xBF, 0x50, 0x80, 0xB7, 0xCF, 0x0B, 0x65, 0x76,
+    0x61, 0x6C, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xD4,
+    0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x80, 0x89, 0x28, 0x65,
+    0x76, 0x61, 0x6C, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x73, 0x74, 0x72, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x26,
+    0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76,
+    0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F,
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x6F, 0x76, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x65, 0x6E, 0x76, 0x69,
+    0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x75,
+    0x73, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x78, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0xBB, 0x03, 0xCD, 0x00, 0x00,
+    0xBD, 0xE4, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0xBA, 0x00, 0x00,
+    0x0C, 0x02, 0x0A, 0x19, 0x02, 0xCE, 0x0B, 0x65, 0x76, 0x61,
+    0x6C, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xDA, 0x24,
+    0xDA, 0x80, 0xD5, 0xDA, 0x81, 0x5D, 0xDA, 0x81, 0x61, 0xD7,
+    0xCD, 0x00, 0x0C, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0xCE,
+    0x05, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x01, 0x00, 0x00, 0x00,
+    0xDA, 0x81, 0x5E, 0xDA, 0x81, 0x5F, 0xDA, 0x81, 0x2A, 0xDA,
+    0x87, 0x4A, 0xDA, 0x81, 0x62, 0xDA, 0x81, 0x85, 0x28, 0x02,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x2A, 0x05, 0x00, 0x00, 0x17, 0x06,
+    0x05, 0x00, 0x22, 0x07, 0x00, 0x00, 0x2A, 0x08, 0x01, 0x00,
+    0x26, 0x09, 0x01, 0x00, 0x26, 0x0A, 0x02, 0x00, 0x2D, 0x09,
+    0x01, 0x0A, 0x26, 0x09, 0x03, 0x00, 0x26, 0x0A, 0x04, 0x00,
+    0x2D, 0x09, 0x0A, 0x08, 0x26, 0x09, 0x05, 0x00, 0x26, 0x0A,
+    0x06, 0x00, 0x2D, 0x09, 0x06, 0x0A, 0x26, 0x09, 0x07, 0x00,
+    0x26, 0x0A, 0x08, 0x00, 0x26, 0x0B, 0x03, 0x00, 0x2D, 0x09,
+    0x0A, 0x0B, 0x3B, 0x08, 0x00, 0x00, 0x2B, 0x08, 0x00, 0x00,
+    0x43, 0x09, 0x09, 0x00, 0x03, 0x07, 0x00, 0x00, 0xCD, 0x00,
+    0xDC, 0x00, 0x00, 0x05, 0x02, 0x02, 0x0C, 0x01, 0xDA, 0x81,
+    0x90, 0xDA, 0x24, 0xDA, 0x80, 0xDE, 0xDA, 0x80, 0xD7, 0x27,
+    0x03, 0x00, 0x04, 0x22, 0x04, 0x00, 0x00, 0x29, 0x04, 0x00,
+    0x04, 0x1A, 0x03, 0x08, 0x00, 0x27, 0x04, 0x00, 0x00, 0x2C,
+    0x00, 0x04, 0x00, 0x43, 0x04, 0x00, 0x00, 0x26, 0x04, 0x01,
+    0x00, 0x2C, 0x00, 0x04, 0x00, 0x26, 0x04, 0x00, 0x00, 0x30,
+    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD,
+    0x00, 0x00, 0xBB, 0xCF, 0x0E, 0x06, 0x0E, 0xBF, 0xF2, 0x0E,
+    0x06, 0x50, 0xBF, 0xC0, 0x1B, 0xBF, 0xE5, 0x1B, 0xBF, 0xE5,
+    0x1B, 0x08, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF, 0xE4, 0x1C, 0xBF,
+    0xE4, 0x1C, 0xBF, 0xB1, 0x50, 0xCD, 0x00, 0xD4, 0x00, 0x00,
+    0x05, 0x02, 0x03, 0x0A, 0x01, 0xDA, 0x24, 0xDA, 0x81, 0x91,
+    0xDA, 0x81, 0x92, 0xDA, 0x81, 0x6A, 0x29, 0x01, 0x00, 0x07,
+    0x2B, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x1A, 0x03, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x02,
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x00,
+    0x00, 0xBD, 0x2A, 0x12, 0x2A, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF,
+    0xEE, 0x19, 0xBF, 0xE7, 0x19, 0xBF, 0xDF, 0x5A, 0xBF, 0xA6,
+    0x5A, 0xBF, 0xE8, 0x17, 0xBF, 0xE9, 0x17, 0xBF, 0xE9, 0x17,
+    0xCD, 0x00, 0x00, 0xBB, 0x03, 0x82, 0xE1, 0xBD, 0xC2, 0x0B,
+    0xBF, 0xF5, 0x0B, 0xBF, 0xEA, 0x17, 0x04, 0x80, 0x92, 0xBF,
+    0x6E, 0x80, 0x92, 0x04, 0x12, 0x80, 0xA3, 0x80, 0xB5, 0xBE,
+    0xAC, 0x81, 0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81,
+    0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE,
+    0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81,
+    0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE,
+    0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81,
+    0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE, 0x8B, 0x81, 0x75, 0xBE,
+    0x8B, 0x81, 0x75, 0xBD, 0x2C, 0x82, 0xE1, 0xCF, 0x0B, 0x6D,
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E, 0x64,
+    0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x81, 0x00, 0x28,
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E,
+    0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x0A, 0x54,
+    0x72, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+    0x20, 0x6F, 0x72, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6E,
+    0x61, 0x6D, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+    0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x73, 0x2E, 0x20, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x66, 0x75, 0x6C,
+    0x6C, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6B, 0x69, 0x6E, 0x64,
+    0x29, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6B, 0x69, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x3A, 0x73, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x2C, 0x20, 0x3A, 0x6E, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x2C, 0x20, 0x20, 0x6F, 0x72, 0x20, 0x69,
+    0x6D, 0x61, 0x67, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x69, 0x73, 0x65, 0x20, 0x61, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+    0x20, 0x6E, 0x69, 0x6C, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F,
+    0x77, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73,
+    0x73, 0x61, 0x67, 0x65, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00,
+    0xDA, 0x24, 0xCD, 0x00, 0x00, 0xC5, 0x32, 0xCD, 0x00, 0x00,
+    0xC9, 0x45, 0xDA, 0x03, 0xDA, 0x81, 0x58, 0xCF, 0x05, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x88,
+    0x70, 0xDA, 0x06, 0xCE, 0x4E, 0x28, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x20, 0x65, 0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72, 0x6F,
+    0x77, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x20, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61, 0x75, 0x67,
+    0x68, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x61, 0x6E,
+    0x64, 0x6C, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20,
+    0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2E, 0xCF, 0x0B, 0x73, 0x63, 0x61, 0x6E, 0x2D,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0B, 0x73, 0x63, 0x61, 0x6E, 0x2D, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0xDA, 0x06, 0xCE, 0x80, 0xD8, 0x28, 0x73,
+    0x63, 0x61, 0x6E, 0x2D, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x50, 0x61, 0x72,
+    0x73, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+    0x63, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x2C, 0x20, 0x65, 0x69, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x20,
+    0x72, 0x65, 0x61, 0x6C, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6D, 0x75, 0x73,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0x20, 0x61, 0x73, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x20, 0x63, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x57, 0x69, 0x6C,
+    0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E,
+    0x69, 0x6C, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x2E, 0xCF, 0x0C, 0x67, 0x63, 0x73, 0x65,
+    0x74, 0x73, 0x77, 0x65, 0x65, 0x70, 0x65, 0x72, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0C, 0x67, 0x63, 0x73, 0x65, 0x74, 0x73,
+    0x77, 0x65, 0x65, 0x70, 0x65, 0x72, 0xDA, 0x06, 0xCE, 0x80,
+    0xD8, 0x28, 0x67, 0x63, 0x73, 0x65, 0x74, 0x73, 0x77, 0x65,
+    0x65, 0x70, 0x65, 0x72, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C,
+    0x65, 0x29, 0x0A, 0x0A, 0x54, 0x75, 0x72, 0x6E, 0x20, 0x66,
+    0x72, 0x65, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20,
+    0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x6E,
+    0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+    0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x66, 0x66,
+    0x2E, 0x20, 0x46, 0x69, 0x6E, 0x61, 0x6C, 0x69, 0x7A, 0x65,
+    0x72, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x62, 0x73, 0x74,
+    0x72, 0x61, 0x63, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73,
+    0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x75, 0x6E,
+    0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65,
+    0x61, 0x64, 0x2E, 0x20, 0x52, 0x61, 0x69, 0x73, 0x65, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x69, 0x66, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x20, 0x73, 0x77, 0x65, 0x65, 0x70, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20,
+    0x6F, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x6C,
+    0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0xCF, 0x04, 0x6E,
+    0x65, 0x78, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x2E, 0xDA,
+    0x06, 0xCE, 0x81, 0x68, 0x28, 0x6E, 0x65, 0x78, 0x74, 0x20,
+    0x64, 0x69, 0x63, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A,
+    0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6E, 0x65, 0x78, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69,
+    0x6E, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x20, 0x6F, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E,
+    0x20, 0x43, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x65, 0x72,
+    0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x73,
+    0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x4B, 0x65, 0x79, 0x73,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x67, 0x75, 0x61, 0x72, 0x61,
+    0x6E, 0x74, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62,
+    0x65, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x6C,
+    0x79, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72,
+    0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x64,
+    0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x75, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x6D, 0x75, 0x74, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64,
+    0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x74, 0x65, 0x72,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x6B, 0x65, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C,
+    0x2C, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x6E, 0x6F, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x65,
+    0x72, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75,
+    0x67, 0x68, 0x2E, 0x20, 0xCF, 0x05, 0x61, 0x70, 0x70, 0x6C,
+    0x79, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00,
+    0x03, 0x06, 0x01, 0x00, 0x0C, 0xCE, 0x05, 0x61, 0x70, 0x70,
+    0x6C, 0x79, 0x37, 0x02, 0x01, 0x00, 0x20, 0x03, 0x02, 0x00,
+    0x19, 0x03, 0x09, 0x00, 0x25, 0x04, 0x00, 0x00, 0x33, 0x05,
+    0x01, 0x04, 0x05, 0x04, 0x04, 0x01, 0x1F, 0x03, 0x04, 0x02,
+    0x19, 0x03, 0x03, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x18, 0xFB,
+    0xFF, 0xFF, 0x2E, 0x05, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0xDA, 0x06, 0xCE, 0x81, 0x5D, 0x28, 0x61, 0x70, 0x70, 0x6C,
+    0x79, 0x20, 0x66, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73,
+    0x29, 0x0A, 0x0A, 0x41, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x73,
+    0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x76, 0x61, 0x72,
+    0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x20, 0x45, 0x61, 0x63,
+    0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x69, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x73, 0x20, 0x69, 0x73,
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x74, 0x6F, 0x20, 0x66, 0x2C, 0x20, 0x65, 0x78, 0x63,
+    0x65, 0x70, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x73, 0x2C, 0x20,
+    0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2D, 0x6C, 0x69, 0x6B, 0x65, 0x2E, 0x20, 0x45,
+    0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+    0x6C, 0x61, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x70, 0x75, 0x73,
+    0x68, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74,
+    0x6F, 0x20, 0x66, 0x2E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x65,
+    0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x3A, 0x0A, 0x0A, 0x09,
+    0x28, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x2B, 0x20, 0x31,
+    0x30, 0x30, 0x30, 0x20, 0x28, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x20, 0x31, 0x30, 0x29, 0x29, 0x0A, 0x0A, 0x73, 0x75, 0x6D,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x31, 0x30, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67,
+    0x65, 0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x30,
+    0x30, 0x30, 0x2E, 0x29, 0xCF, 0x04, 0x62, 0x78, 0x6F, 0x72,
+    0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x0F,
+    0x06, 0x00, 0x00, 0x13, 0xCE, 0x04, 0x62, 0x78, 0x6F, 0x72,
+    0x37, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02,
+    0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03,
+    0x00, 0x00, 0x35, 0x04, 0x00, 0x00, 0x0E, 0x03, 0x03, 0x04,
+    0x03, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x01, 0x00, 0x33, 0x04, 0x00, 0x05, 0x0E, 0x03, 0x03, 0x04,
+    0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02,
+    0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE, 0x59,
+    0x28, 0x62, 0x78, 0x6F, 0x72, 0x20, 0x26, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x77,
+    0x69, 0x73, 0x65, 0x20, 0x78, 0x6F, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x45,
+    0x61, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20,
+    0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF,
+    0x02, 0x3D, 0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x09, 0x00, 0x1E, 0x06, 0x00, 0x00, 0x10, 0xCE, 0x02, 0x3D,
+    0x3D, 0x37, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19,
+    0x02, 0x0A, 0x00, 0x35, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01,
+    0x00, 0x33, 0x04, 0x00, 0x05, 0x42, 0x02, 0x03, 0x04, 0x1A,
+    0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04,
+    0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x06, 0xCE, 0x59, 0x28,
+    0x3D, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C,
+    0x79, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x28, 0x34,
+    0x2E, 0x30, 0x20, 0x3D, 0x3D, 0x20, 0x34, 0x29, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x09,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x81, 0x68, 0xDA, 0x06, 0xCE, 0x81,
+    0x9A, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61,
+    0x64, 0x20, 0x66, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x5B,
+    0x2C, 0x62, 0x75, 0x66, 0x5D, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x61, 0x64, 0x20, 0x61, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x41, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E,
+    0x20, 0x62, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64,
+    0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F,
+    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x66, 0x6F,
+    0x75, 0x72, 0x74, 0x68, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72,
+    0x77, 0x69, 0x73, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x73,
+    0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2E, 0x20,
+    0x27, 0x77, 0x68, 0x61, 0x74, 0x27, 0x20, 0x63, 0x61, 0x6E,
+    0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79,
+    0x77, 0x6F, 0x72, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+    0x6E, 0x74, 0x73, 0x2E, 0x20, 0x56, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x27, 0x77, 0x68, 0x61,
+    0x74, 0x27, 0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x61, 0x6C, 0x6C,
+    0x20, 0x2D, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x6C, 0x69, 0x6E, 0x65, 0x20,
+    0x2D, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x75, 0x70, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x63,
+    0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x6C,
+    0x69, 0x6E, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63,
+    0x74, 0x65, 0x72, 0x0A, 0x09, 0x6E, 0x20, 0x28, 0x69, 0x6E,
+    0x74, 0x65, 0x67, 0x65, 0x72, 0x29, 0x20, 0x2D, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20,
+    0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0xCF, 0x0B, 0x76, 0x69, 0x65, 0x77, 0x2F, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B,
+    0x76, 0x69, 0x65, 0x77, 0x2F, 0x70, 0x61, 0x72, 0x65, 0x6E,
+    0x74, 0xDA, 0x06, 0xCE, 0x3C, 0x28, 0x76, 0x69, 0x65, 0x77,
+    0x2F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x69,
+    0x65, 0x77, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x20,
+    0x76, 0x69, 0x65, 0x77, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72,
+    0x73, 0x20, 0x74, 0x6F, 0x2E, 0xCF, 0x09, 0x64, 0x65, 0x66,
+    0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0xD4, 0x02, 0xD3, 0x01,
+    0xDA, 0x06, 0xCE, 0x38, 0x28, 0x64, 0x65, 0x66, 0x67, 0x6C,
+    0x6F, 0x62, 0x61, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x79,
+    0x6E, 0x61, 0x6D, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x67,
+    0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x66, 0x2E,
+    0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0x86, 0x37, 0x86,
+    0xC0, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x9C, 0x00, 0x00, 0x07,
+    0x02, 0x03, 0x09, 0xCE, 0x09, 0x64, 0x65, 0x66, 0x67, 0x6C,
+    0x6F, 0x62, 0x61, 0x6C, 0xDA, 0x24, 0xDA, 0x81, 0x96, 0xDA,
+    0x03, 0xDA, 0x80, 0x91, 0x2B, 0x00, 0x00, 0x00, 0x43, 0x04,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2C, 0x05, 0x01, 0x00,
+    0x3C, 0x05, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x35, 0x06,
+    0x06, 0x00, 0x34, 0x06, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00,
+    0x86, 0x88, 0x0C, 0xBF, 0xF4, 0x0C, 0x05, 0x20, 0xBF, 0xE0,
+    0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20, 0xBF, 0xE0, 0x20,
+    0xBF, 0xE0, 0x20, 0xBF, 0x7E, 0x80, 0x89, 0xCF, 0x04, 0x6A,
+    0x75, 0x78, 0x74, 0xD4, 0x02, 0xD3, 0x02, 0xDA, 0x5C, 0xCB,
+    0xDA, 0x06, 0xCE, 0x45, 0x28, 0x6A, 0x75, 0x78, 0x74, 0x20,
+    0x26, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x29, 0x0A, 0x0A, 0x4D,
+    0x61, 0x63, 0x72, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x6F, 0x66, 0x20, 0x6A, 0x75, 0x78, 0x74, 0x2A, 0x2E, 0x20,
+    0x53, 0x61, 0x6D, 0x65, 0x20, 0x62, 0x65, 0x68, 0x61, 0x76,
+    0x69, 0x6F, 0x72, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6D, 0x6F,
+    0x72, 0x65, 0x20, 0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65,
+    0x6E, 0x74, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24,
+    0xCD, 0x00, 0x00, 0x69, 0x1B, 0xCD, 0x00, 0x00, 0x6A, 0x16,
+    0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x99, 0x00, 0x00, 0x0D, 0x00,
+    0x08, 0x1B, 0xCE, 0x04, 0x6A, 0x75, 0x78, 0x74, 0xDA, 0x24,
+    0xDA, 0x68, 0xDA, 0x60, 0xDA, 0x88, 0x88, 0xDA, 0x80, 0x88,
+    0xDA, 0x2F, 0xDA, 0x84, 0x73, 0xDA, 0x7C, 0xDA, 0x80, 0xF3,
+    0x26, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x38, 0x03,
+    0x00, 0x00, 0x43, 0x05, 0x01, 0x00, 0x17, 0x06, 0x00, 0x00,
+    0x37, 0x08, 0x06, 0x00, 0x25, 0x07, 0x00, 0x00, 0x3E, 0x09,
+    0x07, 0x08, 0x1A, 0x09, 0x09, 0x00, 0x33, 0x0B, 0x06, 0x07,
+    0x26, 0x0A, 0x02, 0x00, 0x2D, 0x0A, 0x0B, 0x05, 0x43, 0x0A,
+    0x03, 0x00, 0x2C, 0x03, 0x0A, 0x00, 0x43, 0x0C, 0x04, 0x00,
+    0x05, 0x07, 0x07, 0x01, 0x18, 0xF7, 0xFF, 0xFF, 0x26, 0x06,
+    0x05, 0x00, 0x2C, 0x06, 0x05, 0x00, 0x43, 0x06, 0x03, 0x00,
+    0x25, 0x07, 0x00, 0x00, 0x2C, 0x03, 0x07, 0x00, 0x43, 0x07,
+    0x06, 0x00, 0x26, 0x08, 0x07, 0x00, 0x2D, 0x08, 0x06, 0x07,
+    0x26, 0x08, 0x03, 0x00, 0x30, 0x08, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x69, 0x72, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14,
+    0x0F, 0x07, 0x05, 0x3F, 0xBF, 0xC1, 0x3F, 0xBF, 0xC1, 0x3F,
+    0xBF, 0xC1, 0x3F, 0xBF, 0xC1, 0x3F, 0xBF, 0xC1, 0x3F, 0xBF,
+    0xEA, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xDA,
+    0x27, 0xBF, 0xD9, 0x27, 0xBF, 0xC2, 0x3F, 0xBF, 0xC1, 0x3F,
+    0x0F, 0x0F, 0xBF, 0xF1, 0x0F, 0xBF, 0xF1, 0x0F, 0x02, 0x14,
+    0xBF, 0xEC, 0x14, 0xBF, 0xEC, 0x14, 0xBF, 0xD0, 0x31, 0xBF,
+    0xCF, 0x31, 0xBF, 0xCF, 0x31, 0xBF, 0xCF, 0x31, 0xCF, 0x0C,
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x63, 0x61, 0x63,
+    0x68, 0x65, 0xD4, 0x02, 0xD3, 0x01, 0xDA, 0x06, 0xCE, 0x3E,
+    0x54, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x70,
+    0x69, 0x6E, 0x67, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69, 0x64,
+    0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0xDA, 0x23, 0xD2, 0x03, 0x00, 0xDA, 0x24, 0xCD,
+    0x00, 0x00, 0xC9, 0x61, 0xCD, 0x00, 0x00, 0xC9, 0xBB, 0xDA,
+    0x03, 0xDA, 0x81, 0x20,
+    0
+};
+
+const unsigned char *janet_core_image = janet_core_image_bytes;
+size_t janet_core_image_size = sizeof(janet_core_image_bytes);
@@ -33,3 +33,9 @@ void *janet_abstract(const JanetAbstractType *atype, size_t size) {
     header->type = atype;
     return (void *) & (header->data);
 }
+
+/* Write barrier for abstract types with JANET_ABSTRACT_FLAG_BARRIER.
+ * Call before storing a reference to another value in an abstract. */
+void janet_abstract_barrier(void *abstract) {
+    janet_gc_barrier(janet_abstract_header(abstract));
+}
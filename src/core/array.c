@@ -37,6 +37,7 @@ JanetArray *janet_array_init(JanetArray *array, int32_t capacity) {
             JANET_OUT_OF_MEMORY;
         }
     }
+    array->gc.flags &= ~(JANET_MEM_OLD | JANET_MEM_REMEMBERED);
     array->count = 0;
     array->capacity = capacity;
     array->data = data;
@@ -66,10 +67,13 @@ JanetArray *janet_array_n(const Janet *elements, int32_t n) {
     return array;
 }
 
-/* Ensure the array has enough capacity for elements */
+/* Ensure the array has enough capacity for elements. Pushing and
+ * inserting go through here before storing, so this is where their
+ * write barrier is. */
 void janet_array_ensure(JanetArray *array, int32_t capacity, int32_t growth) {
     Janet *newData;
     Janet *old = array->data;
+    janet_gc_barrier(array);
     if (capacity <= array->capacity) return;
     capacity *= growth;
     newData = realloc(old, capacity * sizeof(Janet));
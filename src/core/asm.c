@@ -66,25 +66,31 @@ struct JanetAssembler {
 static const JanetInstructionDef janet_ops[] = {
     {"add", JOP_ADD},
     {"addim", JOP_ADD_IMMEDIATE},
+    {"addnc", JOP_ADD_UNCHECKED},
     {"band", JOP_BAND},
     {"bnot", JOP_BNOT},
     {"bor", JOP_BOR},
     {"bxor", JOP_BXOR},
     {"call", JOP_CALL},
+    {"callk", JOP_CALL_CONSTANT},
     {"clo", JOP_CLOSURE},
     {"cmp", JOP_COMPARE},
     {"div", JOP_DIVIDE},
     {"divim", JOP_DIVIDE_IMMEDIATE},
+    {"divnc", JOP_DIVIDE_UNCHECKED},
     {"eq", JOP_EQUALS},
     {"eqim", JOP_EQUALS_IMMEDIATE},
     {"eqn", JOP_NUMERIC_EQUAL},
+    {"eqnnc", JOP_NUMERIC_EQUAL_UNCHECKED},
     {"err", JOP_ERROR},
     {"get", JOP_GET},
     {"geti", JOP_GET_INDEX},
     {"gt", JOP_GREATER_THAN},
     {"gten", JOP_NUMERIC_GREATER_THAN_EQUAL},
+    {"gtennc", JOP_NUMERIC_GREATER_THAN_EQUAL_UNCHECKED},
     {"gtim", JOP_GREATER_THAN_IMMEDIATE},
     {"gtn", JOP_NUMERIC_GREATER_THAN},
+    {"gtnnc", JOP_NUMERIC_GREATER_THAN_UNCHECKED},
     {"jmp", JOP_JUMP},
     {"jmpif", JOP_JUMP_IF},
     {"jmpno", JOP_JUMP_IF_NOT},
@@ -98,8 +104,10 @@ static const JanetInstructionDef janet_ops[] = {
     {"len", JOP_LENGTH},
     {"lt", JOP_LESS_THAN},
     {"lten", JOP_NUMERIC_LESS_THAN_EQUAL},
+    {"ltennc", JOP_NUMERIC_LESS_THAN_EQUAL_UNCHECKED},
     {"ltim", JOP_LESS_THAN_IMMEDIATE},
     {"ltn", JOP_NUMERIC_LESS_THAN},
+    {"ltnnc", JOP_NUMERIC_LESS_THAN_UNCHECKED},
     {"mkarr", JOP_MAKE_ARRAY},
     {"mkbuf", JOP_MAKE_BUFFER},
     {"mkstr", JOP_MAKE_STRING},
@@ -110,11 +118,14 @@ static const JanetInstructionDef janet_ops[] = {
     {"movn", JOP_MOVE_NEAR},
     {"mul", JOP_MULTIPLY},
     {"mulim", JOP_MULTIPLY_IMMEDIATE},
+    {"mulnc", JOP_MULTIPLY_UNCHECKED},
     {"noop", JOP_NOOP},
+    {"prop", JOP_PROPAGATE},
     {"push", JOP_PUSH},
     {"push2", JOP_PUSH_2},
     {"push3", JOP_PUSH_3},
     {"pusha", JOP_PUSH_ARRAY},
+    {"pushcall", JOP_PUSH_CALL},
     {"put", JOP_PUT},
     {"puti", JOP_PUT_INDEX},
     {"res", JOP_RESUME},
@@ -129,6 +140,7 @@ static const JanetInstructionDef janet_ops[] = {
     {"sru", JOP_SHIFT_RIGHT_UNSIGNED},
     {"sruim", JOP_SHIFT_RIGHT_UNSIGNED_IMMEDIATE},
     {"sub", JOP_SUBTRACT},
+    {"subnc", JOP_SUBTRACT_UNCHECKED},
     {"tcall", JOP_TAILCALL},
     {"tchck", JOP_TYPECHECK}
 };
@@ -93,7 +93,19 @@ enum JanetInstructionType janet_instructions[JOP_INSTRUCTION_COUNT] = {
     JINT_SSS, /* JOP_NUMERIC_LESS_THAN_EQUAL */
     JINT_SSS, /* JOP_NUMERIC_GREATER_THAN */
     JINT_SSS, /* JOP_NUMERIC_GREATER_THAN_EQUAL */
-    JINT_SSS /* JOP_NUMERIC_EQUAL */
+    JINT_SSS, /* JOP_NUMERIC_EQUAL */
+    JINT_SC, /* JOP_CALL_CONSTANT */
+    JINT_SSS, /* JOP_PUSH_CALL */
+    JINT_SSS, /* JOP_ADD_UNCHECKED */
+    JINT_SSS, /* JOP_SUBTRACT_UNCHECKED */
+    JINT_SSS, /* JOP_MULTIPLY_UNCHECKED */
+    JINT_SSS, /* JOP_DIVIDE_UNCHECKED */
+    JINT_SSS, /* JOP_NUMERIC_LESS_THAN_UNCHECKED */
+    JINT_SSS, /* JOP_NUMERIC_LESS_THAN_EQUAL_UNCHECKED */
+    JINT_SSS, /* JOP_NUMERIC_GREATER_THAN_UNCHECKED */
+    JINT_SSS, /* JOP_NUMERIC_GREATER_THAN_EQUAL_UNCHECKED */
+    JINT_SSS, /* JOP_NUMERIC_EQUAL_UNCHECKED */
+    JINT_SSS /* JOP_PROPAGATE */
 };
 
 /* Verify some bytecode */
@@ -211,6 +223,7 @@ JanetFuncDef *janet_funcdef_alloc() {
     def->source = NULL;
     def->sourcemap = NULL;
     def->name = NULL;
+    def->icache = NULL;
     def->defs = NULL;
     def->defs_length = 0;
     def->constants_length = 0;
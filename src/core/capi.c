@@ -160,6 +160,8 @@ JanetDictView janet_getdictionary(const Janet *argv, int32_t n) {
     Janet x = argv[n];
     JanetDictView view;
     if (!janet_dictionary_view(x, &view.kvs, &view.len, &view.cap)) {
+        if (janet_checktype(x, JANET_TABLE))
+            janet_panicf("bad slot #%d, cannot view table with shape or array part %v", n, x);
         janet_panic_type(x, n, JANET_TFLAG_DICTIONARY);
     }
     return view;
@@ -25,6 +25,7 @@
 #include "compile.h"
 #include "emit.h"
 #include "vector.h"
+#include <math.h>
 #endif
 
 static int fixarity0(JanetFopts opts, JanetSlot *args) {
@@ -62,6 +63,195 @@ static JanetSlot genericSSI(JanetFopts opts, int op, JanetSlot s, int32_t imm) {
     return target;
 }
 
+/* Index a constant tuple or string like the get instruction. Returns 0
+ * if the lookup would be an error. */
+static int foldindex(Janet ds, Janet key, Janet *out) {
+    int32_t index, len;
+    if (!janet_checkint(key)) return 0;
+    index = janet_unwrap_integer(key);
+    if (janet_checktype(ds, JANET_TUPLE)) {
+        const Janet *tup = janet_unwrap_tuple(ds);
+        len = janet_tuple_length(tup);
+        *out = (index >= 0 && index < len) ? tup[index] : janet_wrap_nil();
+    } else {
+        const uint8_t *str = janet_unwrap_string(ds);
+        len = janet_string_length(str);
+        *out = (index >= 0 && index < len)
+               ? janet_wrap_integer(str[index])
+               : janet_wrap_nil();
+    }
+    return 1;
+}
+
+/* Evaluate a binary instruction on constants with the same semantics
+ * as the vm. Returns 0 if the instruction can't be folded, in which case
+ * it is emitted and will raise any errors at runtime. */
+static int foldop(int op, Janet x, Janet y, Janet *out) {
+    if (op == JOP_GET) {
+        switch (janet_type(x)) {
+            default:
+                return 0;
+            case JANET_STRUCT:
+                *out = janet_struct_get(janet_unwrap_struct(x), y);
+                return 1;
+            case JANET_TUPLE:
+            case JANET_STRING:
+            case JANET_SYMBOL:
+            case JANET_KEYWORD:
+                return foldindex(x, y, out);
+        }
+    }
+    if (!janet_checktype(x, JANET_NUMBER) || !janet_checktype(y, JANET_NUMBER))
+        return 0;
+    double dx = janet_unwrap_number(x);
+    double dy = janet_unwrap_number(y);
+    switch (op) {
+        case JOP_ADD:
+            *out = janet_wrap_number(dx + dy);
+            return 1;
+        case JOP_SUBTRACT:
+            *out = janet_wrap_number(dx - dy);
+            return 1;
+        case JOP_MULTIPLY:
+            *out = janet_wrap_number(dx * dy);
+            return 1;
+        case JOP_DIVIDE:
+            *out = janet_wrap_number(dx / dy);
+            return 1;
+        default:
+            break;
+    }
+    /* Bitwise operations. Only fold well defined integer arguments. */
+    if (!janet_checkint(x) || !janet_checkint(y))
+        return 0;
+    int32_t ix = janet_unwrap_integer(x);
+    int32_t iy = janet_unwrap_integer(y);
+    switch (op) {
+        default:
+            return 0;
+        case JOP_BAND:
+            *out = janet_wrap_integer(ix & iy);
+            return 1;
+        case JOP_BOR:
+            *out = janet_wrap_integer(ix | iy);
+            return 1;
+        case JOP_BXOR:
+            *out = janet_wrap_integer(ix ^ iy);
+            return 1;
+        case JOP_SHIFT_LEFT:
+        case JOP_SHIFT_RIGHT:
+        case JOP_SHIFT_RIGHT_UNSIGNED:
+            break;
+    }
+    if (iy < 0 || iy > 31)
+        return 0;
+    if (op == JOP_SHIFT_LEFT)
+        *out = janet_wrap_integer((int32_t)((uint32_t) ix << iy));
+    else if (op == JOP_SHIFT_RIGHT)
+        *out = janet_wrap_integer(ix >> iy);
+    else
+        *out = janet_wrap_integer((int32_t)((uint32_t) ix >> iy));
+    return 1;
+}
+
+/* Get the form of a numeric instruction that doesn't check the types of
+ * its operands, or -1 */
+static int unchecked(int op) {
+    switch (op) {
+        default:
+            return -1;
+        case JOP_ADD:
+            return JOP_ADD_UNCHECKED;
+        case JOP_SUBTRACT:
+            return JOP_SUBTRACT_UNCHECKED;
+        case JOP_MULTIPLY:
+            return JOP_MULTIPLY_UNCHECKED;
+        case JOP_DIVIDE:
+            return JOP_DIVIDE_UNCHECKED;
+        case JOP_NUMERIC_LESS_THAN:
+            return JOP_NUMERIC_LESS_THAN_UNCHECKED;
+        case JOP_NUMERIC_LESS_THAN_EQUAL:
+            return JOP_NUMERIC_LESS_THAN_EQUAL_UNCHECKED;
+        case JOP_NUMERIC_GREATER_THAN:
+            return JOP_NUMERIC_GREATER_THAN_UNCHECKED;
+        case JOP_NUMERIC_GREATER_THAN_EQUAL:
+            return JOP_NUMERIC_GREATER_THAN_EQUAL_UNCHECKED;
+        case JOP_NUMERIC_EQUAL:
+            return JOP_NUMERIC_EQUAL_UNCHECKED;
+    }
+}
+
+/* Check if an instruction raises an error unless its operands are numbers */
+static int numericop(int op) {
+    switch (op) {
+        default:
+            return 0;
+        case JOP_ADD:
+        case JOP_SUBTRACT:
+        case JOP_MULTIPLY:
+        case JOP_DIVIDE:
+        case JOP_BAND:
+        case JOP_BOR:
+        case JOP_BXOR:
+        case JOP_SHIFT_LEFT:
+        case JOP_SHIFT_RIGHT:
+        case JOP_SHIFT_RIGHT_UNSIGNED:
+        case JOP_NUMERIC_LESS_THAN:
+        case JOP_NUMERIC_LESS_THAN_EQUAL:
+        case JOP_NUMERIC_GREATER_THAN:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL:
+        case JOP_NUMERIC_EQUAL:
+            return 1;
+    }
+}
+
+/* Check if a slot is an integer constant that fits in an immediate. -0
+ * is not, as it would lose its sign. */
+static int immediate(JanetSlot s, int32_t *imm) {
+    if ((s.flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF)) != JANET_SLOT_CONSTANT ||
+            !janet_checkint(s.constant))
+        return 0;
+    *imm = janet_unwrap_integer(s.constant);
+    if (*imm == 0 && signbit(janet_unwrap_number(s.constant))) return 0;
+    return *imm >= INT8_MIN && *imm <= INT8_MAX;
+}
+
+/* Emit $t = $lhs op $rhs, with an immediate operand for small integer
+ * constants, or without type checks when both operands are known
+ * to be numbers. */
+static void emit_binop(JanetCompiler *c, int op, JanetSlot t, JanetSlot lhs, JanetSlot rhs) {
+    int32_t imm;
+    if ((op == JOP_ADD || op == JOP_MULTIPLY) &&
+            !(rhs.flags & JANET_SLOT_CONSTANT) && immediate(lhs, &imm)) {
+        JanetSlot temp = lhs;
+        lhs = rhs;
+        rhs = temp;
+    }
+    if (!(lhs.flags & JANET_SLOT_CONSTANT) && immediate(rhs, &imm)) {
+        switch (op) {
+            default:
+                break;
+            case JOP_ADD:
+                janetc_emit_ssi(c, JOP_ADD_IMMEDIATE, t, lhs, (int8_t) imm, 1);
+                return;
+            case JOP_SUBTRACT:
+                /* x - 0 keeps the sign of a zero x, but x + 0 does not */
+                if (imm == INT8_MIN || imm == 0) break;
+                janetc_emit_ssi(c, JOP_ADD_IMMEDIATE, t, lhs, (int8_t) -imm, 1);
+                return;
+            case JOP_MULTIPLY:
+                janetc_emit_ssi(c, JOP_MULTIPLY_IMMEDIATE, t, lhs, (int8_t) imm, 1);
+                return;
+            case JOP_DIVIDE:
+                janetc_emit_ssi(c, JOP_DIVIDE_IMMEDIATE, t, lhs, (int8_t) imm, 1);
+                return;
+        }
+    }
+    if (unchecked(op) >= 0 && janetc_isnumber(lhs) && janetc_isnumber(rhs))
+        op = unchecked(op);
+    janetc_emit_sss(c, op, t, lhs, rhs, 1);
+}
+
 /* Emit a series of instructions instead of a function call to a math op */
 static JanetSlot opreduce(
     JanetFopts opts,
@@ -74,15 +264,34 @@ static JanetSlot opreduce(
     JanetSlot t;
     if (len == 0) {
         return janetc_cslot(nullary);
-    } else if (len == 1) {
-        t = janetc_gettarget(opts);
-        janetc_emit_sss(c, op, t, janetc_cslot(nullary), args[0], 1);
-        return t;
+    }
+    if (janetc_allconst(args)) {
+        Janet acc = (len == 1) ? nullary : args[0].constant;
+        for (i = (len == 1) ? 0 : 1; i < len; i++) {
+            if (!foldop(op, acc, args[i].constant, &acc))
+                break;
+        }
+        if (i == len)
+            return janetc_cslot(acc);
     }
     t = janetc_gettarget(opts);
-    janetc_emit_sss(c, op, t, args[0], args[1], 1);
+    if (!numericop(op)) {
+        janetc_emit_sss(c, op, t, len == 1 ? janetc_cslot(nullary) : args[0], args[len == 1 ? 0 : 1], 1);
+        for (i = 2; i < len; i++)
+            janetc_emit_sss(c, op, t, t, args[i], 1);
+        return t;
+    }
+    /* Past this point every argument and the result are numbers */
+    if (len == 1) {
+        emit_binop(c, op, t, janetc_cslot(nullary), args[0]);
+    } else {
+        emit_binop(c, op, t, args[0], args[1]);
+    }
+    t.flags = (t.flags & ~JANET_SLOTTYPE_ANY) | JANET_TFLAG_NUMBER;
     for (i = 2; i < len; i++)
-        janetc_emit_sss(c, op, t, t, args[i], 1);
+        emit_binop(c, op, t, t, args[i]);
+    for (i = 0; i < len; i++)
+        janetc_knownumber(c, args[i]);
     return t;
 }
 
@@ -112,6 +321,9 @@ static JanetSlot do_put(JanetFopts opts, JanetSlot *args) {
     }
 }
 static JanetSlot do_length(JanetFopts opts, JanetSlot *args) {
+    int lengthable = (JANET_TFLAG_BYTES & ~JANET_TFLAG_BUFFER) | JANET_TFLAG_TUPLE | JANET_TFLAG_STRUCT;
+    if (janetc_allconst(args) && janet_checktypes(args[0].constant, lengthable))
+        return janetc_cslot(janet_wrap_integer(janet_length(args[0].constant)));
     return genericSS(opts, JOP_LENGTH, args[0]);
 }
 static JanetSlot do_yield(JanetFopts opts, JanetSlot *args) {
@@ -120,6 +332,9 @@ static JanetSlot do_yield(JanetFopts opts, JanetSlot *args) {
 static JanetSlot do_resume(JanetFopts opts, JanetSlot *args) {
     return opreduce(opts, args, JOP_RESUME, janet_wrap_nil());
 }
+static JanetSlot do_propagate(JanetFopts opts, JanetSlot *args) {
+    return opreduce(opts, args, JOP_PROPAGATE, janet_wrap_nil());
+}
 static JanetSlot do_apply(JanetFopts opts, JanetSlot *args) {
     /* Push phase */
     JanetCompiler *c = opts.compiler;
@@ -175,10 +390,56 @@ static JanetSlot do_rshift(JanetFopts opts, JanetSlot *args) {
     return opreduce(opts, args, JOP_SHIFT_RIGHT, janet_wrap_integer(1));
 }
 static JanetSlot do_rshiftu(JanetFopts opts, JanetSlot *args) {
-    return opreduce(opts, args, JOP_SHIFT_RIGHT, janet_wrap_integer(1));
+    return opreduce(opts, args, JOP_SHIFT_RIGHT_UNSIGNED, janet_wrap_integer(1));
 }
 static JanetSlot do_bnot(JanetFopts opts, JanetSlot *args) {
-    return genericSS(opts, JOP_BNOT, args[0]);
+    if (janetc_allconst(args) && janet_checkint(args[0].constant))
+        return janetc_cslot(janet_wrap_integer(~janet_unwrap_integer(args[0].constant)));
+    JanetSlot t = genericSS(opts, JOP_BNOT, args[0]);
+    janetc_knownumber(opts.compiler, args[0]);
+    t.flags = (t.flags & ~JANET_SLOTTYPE_ANY) | JANET_TFLAG_NUMBER;
+    return t;
+}
+
+/* Compare constants with the same semantics as the vm. Returns 0
+ * if the comparison can't be folded. */
+static int foldcompare(int op, Janet x, Janet y, int *out) {
+    switch (op) {
+        case JOP_GREATER_THAN:
+            *out = janet_compare(x, y) > 0;
+            return 1;
+        case JOP_LESS_THAN:
+            *out = janet_compare(x, y) < 0;
+            return 1;
+        case JOP_EQUALS:
+            *out = janet_equals(x, y);
+            return 1;
+        default:
+            break;
+    }
+    if (!janet_checktype(x, JANET_NUMBER) || !janet_checktype(y, JANET_NUMBER))
+        return 0;
+    double dx = janet_unwrap_number(x);
+    double dy = janet_unwrap_number(y);
+    switch (op) {
+        default:
+            return 0;
+        case JOP_NUMERIC_GREATER_THAN:
+            *out = dx > dy;
+            return 1;
+        case JOP_NUMERIC_LESS_THAN:
+            *out = dx < dy;
+            return 1;
+        case JOP_NUMERIC_GREATER_THAN_EQUAL:
+            *out = dx >= dy;
+            return 1;
+        case JOP_NUMERIC_LESS_THAN_EQUAL:
+            *out = dx <= dy;
+            return 1;
+        case JOP_NUMERIC_EQUAL:
+            *out = dx == dy;
+            return 1;
+    }
 }
 
 /* Specialization for comparators */
@@ -197,9 +458,22 @@ static JanetSlot compreduce(
                ? janetc_cslot(janet_wrap_false())
                : janetc_cslot(janet_wrap_true());
     }
+    if (janetc_allconst(args)) {
+        int result = 1, cmp = 1;
+        for (i = 1; result && i < len; i++) {
+            if (!foldcompare(op, args[i - 1].constant, args[i].constant, &cmp))
+                break;
+            result = cmp;
+        }
+        if (!result || i == len)
+            return janetc_cslot(janet_wrap_boolean(result != invert));
+    }
     t = janetc_gettarget(opts);
     for (i = 1; i < len; i++) {
-        janetc_emit_sss(c, op, t, args[i - 1], args[i], 1);
+        int cop = op;
+        if (unchecked(op) >= 0 && janetc_isnumber(args[i - 1]) && janetc_isnumber(args[i]))
+            cop = unchecked(op);
+        janetc_emit_sss(c, cop, t, args[i - 1], args[i], 1);
         if (i != (len - 1)) {
             int32_t label = janetc_emit_si(c, JOP_JUMP_IF_NOT, t, 0, 1);
             janet_v_push(labels, label);
@@ -217,6 +491,11 @@ static JanetSlot compreduce(
         c->buffer[label] |= ((end - label) << 16);
     }
     janet_v_free(labels);
+    /* The first comparison always runs */
+    if (numericop(op)) {
+        janetc_knownumber(c, args[0]);
+        janetc_knownumber(c, args[1]);
+    }
     return t;
 }
 
@@ -289,7 +568,8 @@ static const JanetFunOptimizer optimizers[] = {
     {NULL, do_gte},
     {NULL, do_lte},
     {NULL, do_eq},
-    {NULL, do_neq}
+    {NULL, do_neq},
+    {fixarity2, do_propagate}
 };
 
 const JanetFunOptimizer *janetc_funopt(uint32_t flags) {
@@ -26,6 +26,7 @@
 #include "emit.h"
 #include "vector.h"
 #include "util.h"
+#include "state.h"
 #endif
 
 JanetFopts janetc_fopts_default(JanetCompiler *c) {
@@ -96,6 +97,7 @@ void janetc_scope(JanetScope *s, JanetCompiler *c, int flags, const char *name)
     scope.consts = NULL;
     scope.syms = NULL;
     scope.envs = NULL;
+    scope.numbers = NULL;
     scope.defs = NULL;
     scope.selfconst = -1;
     scope.bytecode_start = janet_v_count(c->buffer);
@@ -146,6 +148,7 @@ void janetc_popscope(JanetCompiler *c) {
     janet_v_free(oldscope->consts);
     janet_v_free(oldscope->syms);
     janet_v_free(oldscope->envs);
+    janet_v_free(oldscope->numbers);
     janet_v_free(oldscope->defs);
     janetc_regalloc_deinit(&oldscope->ra);
     /* Update pointer */
@@ -164,6 +167,57 @@ void janetc_popscope_keepslot(JanetCompiler *c, JanetSlot retslot) {
     }
 }
 
+/* Check if a slot is known to hold a number */
+int janetc_isnumber(JanetSlot s) {
+    return (s.flags & JANET_SLOTTYPE_ANY) == JANET_TFLAG_NUMBER;
+}
+
+/* Remember that a named local holds a number, after an instruction that
+ * checks its type. Code compiled later in the current scope can skip
+ * the check. */
+void janetc_knownumber(JanetCompiler *c, JanetSlot s) {
+    if (!(s.flags & JANET_SLOT_NAMED) ||
+            (s.flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF)) ||
+            s.envindex >= 0 || s.index < 0 ||
+            janetc_isnumber(s))
+        return;
+    janet_v_push(c->scope->numbers, s.index);
+}
+
+/* Forget what is known about a var that is set to a value of unknown type */
+void janetc_forgetnumber(JanetCompiler *c, JanetSlot s) {
+    JanetScope *scope;
+    if (s.envindex >= 0 || s.index < 0) return;
+    for (scope = c->scope; scope; scope = scope->parent) {
+        int32_t i;
+        for (i = 0; i < janet_v_count(scope->numbers); i++)
+            if (scope->numbers[i] == s.index)
+                scope->numbers[i] = -1;
+        if (scope->flags & JANET_SCOPE_FUNCTION)
+            break;
+    }
+}
+
+/* Check if a local found in the current function is known to hold a
+ * number. A var can be set again later in a loop or in a closure, so
+ * what is known about vars doesn't cross loops and isn't used for vars
+ * that closures capture. */
+static int janetc_localnumber(JanetCompiler *c, SymPair *pair) {
+    JanetScope *scope;
+    int mutable = pair->slot.flags & JANET_SLOT_MUTABLE;
+    if (mutable && pair->keep) return 0;
+    for (scope = c->scope; scope; scope = scope->parent) {
+        int32_t i;
+        for (i = 0; i < janet_v_count(scope->numbers); i++)
+            if (scope->numbers[i] == pair->slot.index)
+                return 1;
+        if ((scope->flags & JANET_SCOPE_FUNCTION) ||
+                (mutable && (scope->flags & JANET_SCOPE_WHILE)))
+            break;
+    }
+    return 0;
+}
+
 /* Allow searching for symbols. Return information about the symbol */
 JanetSlot janetc_resolve(
     JanetCompiler *c,
@@ -226,11 +280,25 @@ found:
     /* Unused references and locals shouldn't add captured envs. */
     if (unused || foundlocal) {
         ret.envindex = -1;
+        if (foundlocal && janetc_localnumber(c, pair))
+            ret.flags = (ret.flags & ~JANET_SLOTTYPE_ANY) | JANET_TFLAG_NUMBER;
         return ret;
     }
 
     /* non-local scope needs to expose its environment */
     pair->keep = 1;
+
+    /* Closures that may outlive an iteration of a loop need a fresh
+     * environment for each iteration. Closures that are only called
+     * while the loop body runs can share the environment of the loop. */
+    {
+        JanetScope *s = c->scope;
+        while (s != scope && (!(s->flags & JANET_SCOPE_FUNCTION) ||
+                              (s->flags & JANET_SCOPE_NOESCAPE)))
+            s = s->parent;
+        if (s != scope)
+            scope->flags |= JANET_SCOPE_CLOSURE;
+    }
     while (scope && !(scope->flags & JANET_SCOPE_FUNCTION))
         scope = scope->parent;
     janet_assert(scope, "invalid scopes");
@@ -309,13 +377,11 @@ JanetSlot *janetc_toslots(JanetCompiler *c, const Janet *vals, int32_t len) {
 JanetSlot *janetc_toslotskv(JanetCompiler *c, Janet ds) {
     JanetSlot *ret = NULL;
     JanetFopts subopts = janetc_fopts_default(c);
-    const JanetKV *kvs = NULL;
-    int32_t cap, i, len;
-    janet_dictionary_view(ds, &kvs, &len, &cap);
-    for (i = 0; i < cap; i++) {
-        if (janet_checktype(kvs[i].key, JANET_NIL)) continue;
-        janet_v_push(ret, janetc_value(subopts, kvs[i].key));
-        janet_v_push(ret, janetc_value(subopts, kvs[i].value));
+    int32_t i = 0;
+    Janet key, value;
+    while (janet_dictionary_iter(ds, &i, &key, &value)) {
+        janet_v_push(ret, janetc_value(subopts, key));
+        janet_v_push(ret, janetc_value(subopts, value));
     }
     return ret;
 }
@@ -359,6 +425,18 @@ static int has_spliced(JanetSlot *slots) {
     return 0;
 }
 
+/* Check if every slot holds a value known at compile time. Refs to
+ * top level vars are constant slots but may change. */
+int janetc_allconst(JanetSlot *slots) {
+    int32_t i;
+    for (i = 0; i < janet_v_count(slots); i++) {
+        if ((slots[i].flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF | JANET_SLOT_SPLICED))
+                != JANET_SLOT_CONSTANT)
+            return 0;
+    }
+    return 1;
+}
+
 /* Free slots loaded via janetc_toslots */
 void janetc_freeslots(JanetCompiler *c, JanetSlot *slots) {
     int32_t i;
@@ -386,12 +464,299 @@ void janetc_throwaway(JanetFopts opts, Janet x) {
     }
 }
 
+/* Pure C functions that are evaluated at compile time when their
+ * arguments are constant strings, numbers, booleans or nil. */
+static const char *const janetc_foldable[] = {
+    "keyword", "string", "symbol", NULL
+};
+
+static int janetc_foldcall(JanetSlot *slots, JanetSlot fun, JanetSlot *out) {
+    int32_t i;
+    if ((fun.flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF)) != JANET_SLOT_CONSTANT ||
+            !janet_checktype(fun.constant, JANET_CFUNCTION) ||
+            !janetc_allconst(slots))
+        return 0;
+    for (i = 0; i < janet_v_count(slots); i++) {
+        if (!janet_checktypes(slots[i].constant,
+                              JANET_TFLAG_NIL | JANET_TFLAG_BOOLEAN | JANET_TFLAG_NUMBER |
+                              JANET_TFLAG_STRING | JANET_TFLAG_SYMBOL | JANET_TFLAG_KEYWORD))
+            return 0;
+    }
+    Janet name = janet_table_get(janet_vm_registry, fun.constant);
+    if (!janet_checktype(name, JANET_SYMBOL))
+        return 0;
+    for (i = 0; janetc_foldable[i]; i++) {
+        if (!janet_cstrcmp(janet_unwrap_symbol(name), janetc_foldable[i]))
+            break;
+    }
+    if (!janetc_foldable[i])
+        return 0;
+    Janet *argv = NULL;
+    for (i = 0; i < janet_v_count(slots); i++)
+        janet_v_push(argv, slots[i].constant);
+    *out = janetc_cslot(janet_unwrap_cfunction(fun.constant)(janet_v_count(argv), argv));
+    janet_v_free(argv);
+    return 1;
+}
+
+#ifndef JANET_NO_INLINE
+
+/* Get the registers used by an instruction. */
+static int janetc_inline_regs(uint32_t instr, int32_t *regs) {
+    switch (janet_instructions[instr & 0x7F]) {
+        default:
+            return 0;
+        case JINT_S:
+            regs[0] = instr >> 8;
+            return 1;
+        case JINT_SL:
+        case JINT_ST:
+        case JINT_SI:
+        case JINT_SU:
+        case JINT_SC:
+            regs[0] = (instr >> 8) & 0xFF;
+            return 1;
+        case JINT_SS:
+            regs[0] = (instr >> 8) & 0xFF;
+            regs[1] = instr >> 16;
+            return 2;
+        case JINT_SSI:
+        case JINT_SSU:
+            regs[0] = (instr >> 8) & 0xFF;
+            regs[1] = (instr >> 16) & 0xFF;
+            return 2;
+        case JINT_SSS:
+            regs[0] = (instr >> 8) & 0xFF;
+            regs[1] = (instr >> 16) & 0xFF;
+            regs[2] = instr >> 24;
+            return 3;
+    }
+}
+
+/* Get the register written by an instruction, or -1. */
+static int32_t janetc_inline_written(uint32_t instr) {
+    switch (instr & 0x7F) {
+        case JOP_NOOP:
+        case JOP_ERROR:
+        case JOP_TYPECHECK:
+        case JOP_RETURN:
+        case JOP_RETURN_NIL:
+        case JOP_JUMP:
+        case JOP_JUMP_IF:
+        case JOP_JUMP_IF_NOT:
+        case JOP_SET_UPVALUE:
+        case JOP_PUSH:
+        case JOP_PUSH_2:
+        case JOP_PUSH_3:
+        case JOP_PUSH_ARRAY:
+        case JOP_TAILCALL:
+        case JOP_PUT:
+        case JOP_PUT_INDEX:
+            return -1;
+        case JOP_MOVE_FAR:
+            return instr >> 16;
+        default: {
+            int32_t regs[3];
+            janetc_inline_regs(instr, regs);
+            return regs[0];
+        }
+    }
+}
+
+static JanetSlot janetc_regslot(int32_t reg) {
+    JanetSlot ret;
+    ret.flags = JANET_SLOTTYPE_ANY;
+    ret.index = reg;
+    ret.constant = janet_wrap_nil();
+    ret.envindex = -1;
+    return ret;
+}
+
+/* Splice the bytecode of a small function into the current function
+ * instead of calling it. The function must not call other functions, use
+ * closures or upvalues, or refer to itself. Its registers are moved into fresh registers of the
+ * caller, except arguments that it never writes, which are read in place.
+ * Returns become moves into the result register and jumps past the end. */
+static int janetc_inline(JanetFopts opts, JanetSlot *args, JanetFunction *f, JanetSlot *out) {
+    JanetCompiler *c = opts.compiler;
+    JanetFuncDef *def = f->def;
+    int32_t i, j, nregs, regs[3];
+    int32_t len = def->bytecode_length;
+    int32_t argc = janet_v_count(args);
+    int32_t self = -1, retreg = -1, result;
+    int32_t map[JANET_INLINE_MAX];
+    int32_t pos[JANET_INLINE_MAX + 1];
+    uint8_t used[JANET_INLINE_MAX] = {0};
+    uint8_t written[JANET_INLINE_MAX] = {0};
+    uint8_t owned[JANET_INLINE_MAX] = {0};
+    if (len == 0 || len > JANET_INLINE_MAX ||
+            def->slotcount > JANET_INLINE_MAX ||
+            def->environments_length || def->defs_length ||
+            (def->flags & (JANET_FUNCDEF_FLAG_VARARG | JANET_FUNCDEF_FLAG_NEEDSENV)) ||
+            def->arity != argc)
+        return 0;
+
+    /* Check the instructions and find the registers they use */
+    for (i = 0; i < len; i++) {
+        uint32_t instr = def->bytecode[i];
+        int op = instr & 0x7F;
+        if (op >= JOP_INSTRUCTION_COUNT ||
+                janet_instructions[op] == JINT_SES ||
+                janet_instructions[op] == JINT_SD)
+            return 0;
+        /* Only inline leaf functions, so stack traces and profiles still
+         * show functions that call others. */
+        if (op == JOP_CALL || op == JOP_TAILCALL || op == JOP_CALL_CONSTANT ||
+                op == JOP_PUSH_CALL || op == JOP_RESUME)
+            return 0;
+        nregs = janetc_inline_regs(instr, regs);
+        for (j = 0; j < nregs; j++)
+            if (regs[j] >= def->slotcount) return 0;
+        if (op == JOP_LOAD_SELF) {
+            if (self >= 0) return 0;
+            self = regs[0];
+            continue;
+        }
+        for (j = 0; j < nregs; j++)
+            used[regs[j]] = 1;
+        int32_t w = janetc_inline_written(instr);
+        if (w >= 0)
+            written[w] = 1;
+    }
+
+    /* Recursive functions refer to themselves through the self register */
+    if (self >= 0 && used[self])
+        return 0;
+
+    /* A single return at the end can leave its value in place */
+    for (i = 0; i < len; i++) {
+        int op = def->bytecode[i] & 0x7F;
+        if (op == JOP_RETURN_NIL || (op == JOP_RETURN && i != len - 1))
+            break;
+    }
+    if (i == len && (def->bytecode[len - 1] & 0x7F) == JOP_RETURN)
+        retreg = def->bytecode[len - 1] >> 8;
+
+    /* Map registers */
+    for (i = 0; i < def->slotcount; i++) {
+        map[i] = -1;
+        if (!used[i]) continue;
+        JanetSlot arg = i < argc ? args[i] : janetc_regslot(-1);
+        if (i < argc && !written[i] && i != retreg &&
+                !(arg.flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF)) &&
+                arg.envindex < 0 && arg.index >= 0 && arg.index <= 0xFF) {
+            map[i] = arg.index;
+        } else {
+            map[i] = janetc_allocfar(c);
+            owned[i] = 1;
+        }
+    }
+    result = (retreg >= 0) ? map[retreg] : janetc_allocfar(c);
+    for (i = 0; i < def->slotcount; i++)
+        if (map[i] > 0xFF) break;
+    if (i < def->slotcount || result > 0xFF) {
+        for (i = 0; i < def->slotcount; i++)
+            if (owned[i]) janetc_regalloc_free(&c->scope->ra, map[i]);
+        if (retreg < 0) janetc_regalloc_free(&c->scope->ra, result);
+        return 0;
+    }
+
+    /* Find where each instruction will go */
+    for (i = 0, j = 0; i < len; i++) {
+        int op = def->bytecode[i] & 0x7F;
+        pos[i] = j;
+        if (op == JOP_LOAD_SELF || (i == len - 1 && retreg >= 0))
+            continue;
+        j += (i != len - 1 && (op == JOP_RETURN || op == JOP_RETURN_NIL)) ? 2 : 1;
+    }
+    pos[len] = j;
+
+    /* Load arguments */
+    for (i = 0; i < argc; i++)
+        if (owned[i])
+            janetc_copy(c, janetc_regslot(map[i]), args[i]);
+
+    /* Emit */
+    int32_t start = janet_v_count(c->buffer);
+    for (i = 0; i < len; i++) {
+        uint32_t instr = def->bytecode[i];
+        int op = instr & 0x7F;
+        int32_t offset;
+        nregs = janetc_inline_regs(instr, regs);
+        for (j = 0; j < nregs; j++)
+            regs[j] = map[regs[j]];
+        switch (op) {
+            case JOP_LOAD_SELF:
+                continue;
+            case JOP_RETURN:
+                if (i == len - 1 && retreg >= 0) continue;
+                janetc_emit(c, JOP_MOVE_NEAR | (result << 8) | (regs[0] << 16));
+                break;
+            case JOP_RETURN_NIL:
+                janetc_emit(c, JOP_LOAD_NIL | (result << 8));
+                break;
+            case JOP_JUMP:
+                offset = pos[i + (((int32_t) instr) >> 8)] - pos[i];
+                janetc_emit(c, JOP_JUMP | ((uint32_t) offset << 8));
+                continue;
+            case JOP_JUMP_IF:
+            case JOP_JUMP_IF_NOT:
+                offset = pos[i + (((int32_t) instr) >> 16)] - pos[i];
+                janetc_emit(c, op | (regs[0] << 8) | ((uint32_t) offset << 16));
+                continue;
+            case JOP_LOAD_CONSTANT:
+                janetc_emit_sc(c, op, janetc_regslot(regs[0]), def->constants[instr >> 16], 1);
+                continue;
+            default:
+                switch (janet_instructions[op]) {
+                    default:
+                        janetc_emit(c, op);
+                        break;
+                    case JINT_S:
+                        janetc_emit(c, op | (regs[0] << 8));
+                        break;
+                    case JINT_ST:
+                    case JINT_SI:
+                    case JINT_SU:
+                        janetc_emit(c, (instr & 0xFFFF0000) | (regs[0] << 8) | op);
+                        break;
+                    case JINT_SS:
+                        janetc_emit(c, op | (regs[0] << 8) | (regs[1] << 16));
+                        break;
+                    case JINT_SSI:
+                    case JINT_SSU:
+                        janetc_emit(c, (instr & 0xFF000000) | (regs[0] << 8) | (regs[1] << 16) | op);
+                        break;
+                    case JINT_SSS:
+                        janetc_emit(c, op | (regs[0] << 8) | (regs[1] << 16) | ((uint32_t) regs[2] << 24));
+                        break;
+                }
+                continue;
+        }
+        /* Returns jump past the end */
+        if (i != len - 1) {
+            offset = start + pos[len] - janet_v_count(c->buffer);
+            janetc_emit(c, JOP_JUMP | ((uint32_t) offset << 8));
+        }
+    }
+
+    for (i = 0; i < def->slotcount; i++)
+        if (owned[i] && i != retreg)
+            janetc_regalloc_free(&c->scope->ra, map[i]);
+    *out = janetc_regslot(result);
+    return 1;
+}
+
+#endif
+
 /* Compile a call or tailcall instruction */
 static JanetSlot janetc_call(JanetFopts opts, JanetSlot *slots, JanetSlot fun) {
     JanetSlot retslot;
     JanetCompiler *c = opts.compiler;
     int specialized = 0;
-    if (fun.flags & JANET_SLOT_CONSTANT && !has_spliced(slots)) {
+    if (janetc_foldcall(slots, fun, &retslot)) {
+        specialized = 1;
+    } else if (fun.flags & JANET_SLOT_CONSTANT && !has_spliced(slots)) {
         if (janet_checktype(fun.constant, JANET_FUNCTION)) {
             JanetFunction *f = janet_unwrap_function(fun.constant);
             const JanetFunOptimizer *o = janetc_funopt(f->def->flags);
@@ -400,17 +765,31 @@ static JanetSlot janetc_call(JanetFopts opts, JanetSlot *slots, JanetSlot fun) {
                 retslot = o->optimize(opts, slots);
             }
         }
-        /* TODO janet function inlining (no c functions)*/
+#ifndef JANET_NO_INLINE
+        if (!specialized && janet_checktype(fun.constant, JANET_FUNCTION) &&
+                !(fun.flags & JANET_SLOT_REF))
+            specialized = janetc_inline(opts, slots, janet_unwrap_function(fun.constant), &retslot);
+#endif
     }
     if (!specialized) {
-        janetc_pushslots(c, slots);
         if ((opts.flags & JANET_FOPTS_TAIL) &&
                 /* Prevent top level tail calls for better errors */
                 !(c->scope->flags & JANET_SCOPE_TOP)) {
+            janetc_pushslots(c, slots);
             janetc_emit_s(c, JOP_TAILCALL, fun, 0);
             retslot = janetc_cslot(janet_wrap_nil());
             retslot.flags = JANET_SLOT_RETURNED;
+        } else if ((fun.flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF)) == JANET_SLOT_CONSTANT) {
+            /* Fuse loading the callee constant into the call */
+            janetc_pushslots(c, slots);
+            retslot = janetc_gettarget(opts);
+            janetc_emit_sc(c, JOP_CALL_CONSTANT, retslot, fun.constant, 1);
+        } else if (janet_v_count(slots) == 1 && !has_spliced(slots)) {
+            /* Fuse pushing a single argument into the call */
+            retslot = janetc_gettarget(opts);
+            janetc_emit_sss(c, JOP_PUSH_CALL, retslot, slots[0], fun, 1);
         } else {
+            janetc_pushslots(c, slots);
             retslot = janetc_gettarget(opts);
             janetc_emit_ss(c, JOP_CALL, retslot, fun, 1);
         }
@@ -440,16 +819,33 @@ static JanetSlot janetc_array(JanetFopts opts, Janet x) {
 static JanetSlot janetc_tuple(JanetFopts opts, Janet x) {
     JanetCompiler *c = opts.compiler;
     const Janet *t = janet_unwrap_tuple(x);
-    return janetc_maker(opts,
-                        janetc_toslots(c, t, janet_tuple_length(t)),
-                        JOP_MAKE_TUPLE);
+    JanetSlot *slots = janetc_toslots(c, t, janet_tuple_length(t));
+    if (janetc_allconst(slots)) {
+        /* Immutable, so build it now */
+        int32_t i, len = janet_v_count(slots);
+        Janet *tup = janet_tuple_begin(len);
+        for (i = 0; i < len; i++)
+            tup[i] = slots[i].constant;
+        janetc_freeslots(c, slots);
+        return janetc_cslot(janet_wrap_tuple(janet_tuple_end(tup)));
+    }
+    return janetc_maker(opts, slots, JOP_MAKE_TUPLE);
 }
 
 static JanetSlot janetc_tablector(JanetFopts opts, Janet x, int op) {
     JanetCompiler *c = opts.compiler;
-    return janetc_maker(opts,
-                        janetc_toslotskv(c, x),
-                        op);
+    JanetSlot *slots = janetc_toslotskv(c, x);
+    if (op == JOP_MAKE_STRUCT && janetc_allconst(slots)) {
+        /* Immutable, so build it now. Nil and NaN keys are dropped
+         * by janet_struct_put, as they are by the instruction. */
+        int32_t i, len = janet_v_count(slots);
+        JanetKV *st = janet_struct_begin(len / 2);
+        for (i = 0; i < len; i += 2)
+            janet_struct_put(st, slots[i].constant, slots[i + 1].constant);
+        janetc_freeslots(c, slots);
+        return janetc_cslot(janet_wrap_struct(janet_struct_end(st)));
+    }
+    return janetc_maker(opts, slots, op);
 }
 
 static JanetSlot janetc_bufferctor(JanetFopts opts, Janet x) {
@@ -461,6 +857,37 @@ static JanetSlot janetc_bufferctor(JanetFopts opts, Janet x) {
                         JOP_MAKE_BUFFER);
 }
 
+/* Check if the callee of a call is a global binding marked :noescape.
+ * Such functions only call their first argument and don't keep it. */
+static int janetc_noescape(JanetCompiler *c, Janet sym, JanetSlot head) {
+    if ((head.flags & (JANET_SLOT_CONSTANT | JANET_SLOT_REF)) != JANET_SLOT_CONSTANT ||
+            !janet_checktype(sym, JANET_SYMBOL))
+        return 0;
+    Janet entry = janet_table_get(c->env, sym);
+    if (!janet_checktype(entry, JANET_TABLE))
+        return 0;
+    JanetTable *entry_table = janet_unwrap_table(entry);
+    return janet_truthy(janet_table_get(entry_table, janet_ckeywordv("noescape"))) &&
+           janet_equals(janet_table_get(entry_table, janet_ckeywordv("value")), head.constant);
+}
+
+/* Get slots for the arguments of a call */
+static JanetSlot *janetc_callargs(JanetCompiler *c, const Janet *tup, JanetSlot head) {
+    int32_t len = janet_tuple_length(tup);
+    if (len < 2 || !janetc_noescape(c, tup[0], head))
+        return janetc_toslots(c, tup + 1, len - 1);
+    JanetFopts subopts = janetc_fopts_default(c);
+    subopts.flags = JANET_FOPTS_NOESCAPE;
+    JanetSlot first = janetc_value(subopts, tup[1]);
+    JanetSlot *rest = janetc_toslots(c, tup + 2, len - 2);
+    JanetSlot *ret = NULL;
+    janet_v_push(ret, first);
+    for (int32_t i = 0; i < janet_v_count(rest); i++)
+        janet_v_push(ret, rest[i]);
+    janet_v_free(rest);
+    return ret;
+}
+
 /* Expand a macro one time. Also get the special form compiler if we
  * find that instead. */
 static int macroexpand1(
@@ -561,7 +988,7 @@ JanetSlot janetc_value(JanetFopts opts, Janet x) {
                 } else {
                     JanetSlot head = janetc_value(subopts, tup[0]);
                     subopts.flags = JANET_FUNCTION | JANET_CFUNCTION;
-                    ret = janetc_call(opts, janetc_toslots(c, tup + 1, janet_tuple_length(tup) - 1), head);
+                    ret = janetc_call(opts, janetc_callargs(c, tup, head), head);
                     janetc_freeslot(c, head);
                 }
                 ret.flags &= ~JANET_SLOT_SPLICED;
@@ -620,6 +1047,7 @@ JanetFuncDef *janetc_pop_funcdef(JanetCompiler *c) {
     def->defs = janet_v_flatten(scope->defs);
 
     /* Copy bytecode (only last chunk) */
+    janetc_peephole(c);
     def->bytecode_length = janet_v_count(c->buffer) - scope->bytecode_start;
     if (def->bytecode_length) {
         size_t s = sizeof(int32_t) * def->bytecode_length;
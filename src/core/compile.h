@@ -60,6 +60,7 @@
 #define JANET_FUN_LTE 29
 #define JANET_FUN_EQ 30
 #define JANET_FUN_NEQ 31
+#define JANET_FUN_PROPAGATE 32
 
 /* Compiler typedefs */
 typedef struct JanetCompiler JanetCompiler;
@@ -96,6 +97,8 @@ struct JanetSlot {
 #define JANET_SCOPE_TOP 4
 #define JANET_SCOPE_UNUSED 8
 #define JANET_SCOPE_CLOSURE 16
+#define JANET_SCOPE_NOESCAPE 32
+#define JANET_SCOPE_WHILE 64
 
 /* A symbol and slot pair */
 typedef struct SymPair {
@@ -126,6 +129,10 @@ struct JanetScope {
     /* Regsiter allocator */
     JanetcRegisterAllocator ra;
 
+    /* Registers of named locals that are known to hold numbers from
+     * where they were checked until the end of this scope. */
+    int32_t *numbers;
+
     /* Referenced closure environents. The values at each index correspond
      * to which index to get the environment from in the parent. The environment
      * that corresponds to the direct parent's stack will always have value 0. */
@@ -166,6 +173,7 @@ struct JanetCompiler {
 #define JANET_FOPTS_TAIL 0x10000
 #define JANET_FOPTS_HINT 0x20000
 #define JANET_FOPTS_DROP 0x40000
+#define JANET_FOPTS_NOESCAPE 0x80000
 
 /* Options for compiling a single form */
 struct JanetFopts {
@@ -220,6 +228,14 @@ void janetc_pushslots(JanetCompiler *c, JanetSlot *slots);
 /* Free slots loaded via janetc_toslots */
 void janetc_freeslots(JanetCompiler *c, JanetSlot *slots);
 
+/* Check if every slot holds a value known at compile time */
+int janetc_allconst(JanetSlot *slots);
+
+/* Type information for slots */
+int janetc_isnumber(JanetSlot s);
+void janetc_knownumber(JanetCompiler *c, JanetSlot s);
+void janetc_forgetnumber(JanetCompiler *c, JanetSlot s);
+
 /* Generate the return instruction for a slot. */
 JanetSlot janetc_return(JanetCompiler *c, JanetSlot s);
 
@@ -236,6 +252,9 @@ void janetc_popscope(JanetCompiler *c);
 void janetc_popscope_keepslot(JanetCompiler *c, JanetSlot retslot);
 JanetFuncDef *janetc_pop_funcdef(JanetCompiler *c);
 
+/* Optimize the bytecode of the current function scope in place */
+void janetc_peephole(JanetCompiler *c);
+
 /* Create a destory slots */
 JanetSlot janetc_cslot(Janet x);
 
@@ -24,6 +24,7 @@
 #include <janet.h>
 #include "compile.h"
 #include "state.h"
+#include "gc.h"
 #include "util.h"
 #endif
 
@@ -193,9 +194,12 @@ static Janet janet_core_gensym(int32_t argc, Janet *argv) {
 }
 
 static Janet janet_core_gccollect(int32_t argc, Janet *argv) {
-    (void) argv;
-    (void) argc;
-    janet_collect();
+    janet_arity(argc, 0, 1);
+    if (argc > 0 && janet_truthy(argv[0])) {
+        janet_collect_young();
+    } else {
+        janet_collect();
+    }
     return janet_wrap_nil();
 }
 
@@ -214,6 +218,79 @@ static Janet janet_core_gcinterval(int32_t argc, Janet *argv) {
     return janet_wrap_number(janet_vm_gc_interval);
 }
 
+static Janet janet_core_gcsetstep(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    int32_t val = janet_getinteger(argv, 0);
+    if (val < 0)
+        janet_panic("expected non-negative integer");
+    janet_vm_gc_step = val;
+    return janet_wrap_nil();
+}
+
+static Janet janet_core_gcstep(int32_t argc, Janet *argv) {
+    (void) argv;
+    janet_fixarity(argc, 0);
+    return janet_wrap_number(janet_vm_gc_step);
+}
+
+static Janet janet_core_gcsetsweeper(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    if (!janet_gc_sweeper(janet_truthy(argv[0])))
+        janet_panic("background sweeping not supported");
+    return janet_wrap_nil();
+}
+
+static Janet janet_core_arenabegin(int32_t argc, Janet *argv) {
+    janet_arity(argc, 0, 1);
+    int32_t limit = argc > 0 ? janet_getinteger(argv, 0) : 0;
+    if (limit < 0)
+        janet_panic("expected non-negative integer");
+    return janet_wrap_integer(janet_arena_begin(limit));
+}
+
+static Janet janet_core_arenaend(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    int32_t handle = janet_getinteger(argv, 0);
+    if (handle < 0)
+        janet_panic("expected non-negative integer");
+    janet_arena_end(handle);
+    return janet_wrap_nil();
+}
+
+static Janet janet_core_gcstats(int32_t argc, Janet *argv) {
+    static const char *const type_names[JANET_GC_TYPE_COUNT] = {
+        NULL, "string", "symbol", "array", "tuple", "table", "struct",
+        "fiber", "buffer", "function", "abstract", "funcenv", "funcdef"
+    };
+    JanetGCStats stats;
+    JanetTable *objects, *bytes, *t;
+    int i;
+    (void) argv;
+    janet_fixarity(argc, 0);
+    janet_gcstats(&stats);
+    objects = janet_table(JANET_GC_TYPE_COUNT);
+    bytes = janet_table(JANET_GC_TYPE_COUNT);
+    for (i = 1; i < JANET_GC_TYPE_COUNT; i++) {
+        janet_table_put(objects, janet_ckeywordv(type_names[i]),
+                        janet_wrap_number((double) stats.live_objects[i]));
+        janet_table_put(bytes, janet_ckeywordv(type_names[i]),
+                        janet_wrap_number((double) stats.live_bytes[i]));
+    }
+    t = janet_table(12);
+    janet_table_put(t, janet_ckeywordv("live-objects"), janet_wrap_table(objects));
+    janet_table_put(t, janet_ckeywordv("live-bytes"), janet_wrap_table(bytes));
+    janet_table_put(t, janet_ckeywordv("allocated"), janet_wrap_number((double) stats.allocated));
+    janet_table_put(t, janet_ckeywordv("collections"), janet_wrap_number((double) stats.collections));
+    janet_table_put(t, janet_ckeywordv("full-collections"), janet_wrap_number((double) stats.full_collections));
+    janet_table_put(t, janet_ckeywordv("pause-time"), janet_wrap_number(stats.pause_time));
+    janet_table_put(t, janet_ckeywordv("last-pause"), janet_wrap_number(stats.last_pause));
+    janet_table_put(t, janet_ckeywordv("mark-time"), janet_wrap_number(stats.mark_time));
+    janet_table_put(t, janet_ckeywordv("sweep-time"), janet_wrap_number(stats.sweep_time));
+    janet_table_put(t, janet_ckeywordv("roots"), janet_wrap_number(stats.roots));
+    janet_table_put(t, janet_ckeywordv("interval"), janet_wrap_number(janet_vm_gc_interval));
+    return janet_wrap_table(t);
+}
+
 static Janet janet_core_type(int32_t argc, Janet *argv) {
     janet_fixarity(argc, 1);
     JanetType t = janet_type(argv[0]);
@@ -226,11 +303,21 @@ static Janet janet_core_type(int32_t argc, Janet *argv) {
 
 static Janet janet_core_next(int32_t argc, Janet *argv) {
     janet_fixarity(argc, 2);
+    if (janet_checktype(argv[0], JANET_ABSTRACT)) {
+        void *abst = janet_unwrap_abstract(argv[0]);
+        const JanetAbstractType *type = janet_abstract_type(abst);
+        if (NULL != type->next) return type->next(abst, argv[1]);
+    }
+    if (janet_checktype(argv[0], JANET_TABLE))
+        return janet_table_next(janet_unwrap_table(argv[0]), argv[1]);
     JanetDictView view = janet_getdictionary(argv, 0);
     const JanetKV *end = view.kvs + view.cap;
-    const JanetKV *kv = janet_checktype(argv[1], JANET_NIL)
-                        ? view.kvs
-                        : janet_dict_find(view.kvs, view.cap, argv[1]) + 1;
+    const JanetKV *kv;
+    if (janet_checktype(argv[1], JANET_NIL)) {
+        kv = view.kvs;
+    } else {
+        kv = janet_dict_find(view.kvs, view.cap, argv[1]) + 1;
+    }
     while (kv < end) {
         if (!janet_checktype(kv->key, JANET_NIL)) return kv->key;
         kv++;
@@ -341,8 +428,9 @@ static const JanetReg corelib_cfuns[] = {
     },
     {
         "gccollect", janet_core_gccollect,
-        JDOC("(gccollect)\n\n"
-             "Run garbage collection. You should probably not call this manually.")
+        JDOC("(gccollect &opt young)\n\n"
+             "Run garbage collection. If young is truthy, only collect objects allocated "
+             "since the last collection. You should probably not call this manually.")
     },
     {
         "gcsetinterval", janet_core_gcsetinterval,
@@ -357,6 +445,57 @@ static const JanetReg corelib_cfuns[] = {
              "Returns the integer number of bytes to allocate before running an iteration "
              "of garbage collection.")
     },
+    {
+        "gcsetstep", janet_core_gcsetstep,
+        JDOC("(gcsetstep step)\n\n"
+             "Set the amount of work done by each step of an incremental collection. "
+             "Collections of the whole heap are spread over many small steps so that pauses "
+             "stay short. A step of 0 disables incremental collection.")
+    },
+    {
+        "gcstep", janet_core_gcstep,
+        JDOC("(gcstep)\n\n"
+             "Returns the amount of work done by each step of an incremental collection.")
+    },
+    {
+        "gcsetsweeper", janet_core_gcsetsweeper,
+        JDOC("(gcsetsweeper enable)\n\n"
+             "Turn freeing of garbage on a background thread on or off. Finalizers "
+             "of abstract types still run on the current thread. Raises an error if "
+             "background sweeping is not supported on this platform.")
+    },
+    {
+        "gcarena-begin", janet_core_arenabegin,
+        JDOC("(gcarena-begin &opt limit)\n\n"
+             "Open an arena scope and return a handle for gcarena-end. While the scope "
+             "is open, collections only run once more than limit bytes have been allocated. "
+             "Prefer the with-arena macro.")
+    },
+    {
+        "gcarena-end", janet_core_arenaend,
+        JDOC("(gcarena-end handle)\n\n"
+             "Close an arena scope opened by gcarena-begin. When the outermost scope is "
+             "closed, all memory allocated in it that is no longer reachable is freed at once.")
+    },
+    {
+        "gcstats", janet_core_gcstats,
+        JDOC("(gcstats)\n\n"
+             "Get statistics about the garbage collector as a table with the following keys:\n\n"
+             "\t:live-objects - table of the number of live objects of each memory type\n"
+             "\t:live-bytes - table of the number of bytes used by live objects of each memory type\n"
+             "\t:allocated - bytes allocated since the last collection\n"
+             "\t:collections - number of collection pauses\n"
+             "\t:full-collections - number of completed collections of the whole heap\n"
+             "\t:pause-time - total time spent in collection pauses in seconds\n"
+             "\t:last-pause - time spent in the last collection pause in seconds\n"
+             "\t:mark-time - total time spent marking in seconds\n"
+             "\t:sweep-time - total time spent sweeping in seconds\n"
+             "\t:roots - number of gc roots\n"
+             "\t:interval - the current collection interval\n\n"
+             "Counting live objects walks the whole heap, so this function is slow on "
+             "large heaps. Objects that became garbage since the last collection are "
+             "counted as live.")
+    },
     {
         "type", janet_core_type,
         JDOC("(type x)\n\n"
@@ -600,6 +739,10 @@ static const uint32_t resume_asm[] = {
     JOP_RESUME | (1 << 24),
     JOP_RETURN
 };
+static const uint32_t propagate_asm[] = {
+    JOP_PROPAGATE | (1 << 24),
+    JOP_RETURN
+};
 static const uint32_t get_asm[] = {
     JOP_GET | (1 << 24),
     JOP_RETURN
@@ -645,6 +788,13 @@ JanetTable *janet_core_env(void) {
                          "will be returned to the last yield in the case of a pending fiber, or the argument to "
                          "the dispatch function in the case of a new fiber. Returns either the return result of "
                          "the fiber's dispatch function, or the value from the next yield call in fiber."));
+    janet_quick_asm(env, JANET_FUN_PROPAGATE | JANET_FUNCDEF_FLAG_FIXARITY,
+                    "propagate", 2, 2, propagate_asm, sizeof(propagate_asm),
+                    JDOC("(propagate x fiber)\n\n"
+                         "Raise the last signal of fiber, such as an error or a yield, from the current "
+                         "fiber with the value x. Stack traces include the frames of fiber. If the "
+                         "current fiber is resumed, fiber is resumed first, and propagate returns what "
+                         "fiber returns or signals next."));
     janet_quick_asm(env, JANET_FUN_GET | JANET_FUNCDEF_FLAG_FIXARITY,
                     "get", 2, 2, get_asm, sizeof(get_asm),
                     JDOC("(get ds key)\n\n"
@@ -784,6 +934,12 @@ JanetTable *janet_core_env(void) {
 #ifdef JANET_PEG
     janet_lib_peg(env);
 #endif
+    janet_lib_pmap(env);
+    janet_lib_pvec(env);
+    janet_lib_rope(env);
+    janet_lib_set(env);
+    janet_lib_sorted(env);
+    janet_lib_view(env);
 #ifdef JANET_ASSEMBLER
     janet_lib_asm(env);
 #endif
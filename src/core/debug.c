@@ -55,13 +55,20 @@ void janet_debug_find(
     const uint8_t *source, int32_t offset) {
     /* Scan the heap for right func def */
     JanetGCObject *current = janet_vm_blocks;
+    int young = 0;
     /* Keep track of the best source mapping we have seen so far */
     int32_t besti = -1;
     int32_t best_range = INT32_MAX;
     JanetFuncDef *best_def = NULL;
-    while (NULL != current) {
+    while (NULL != current || !young) {
+        if (NULL == current) {
+            /* Continue with the young generation */
+            current = janet_vm_young_blocks;
+            young = 1;
+            continue;
+        }
         if ((current->flags & JANET_MEM_TYPEBITS) == JANET_MEMORY_FUNCDEF) {
-            JanetFuncDef *def = (JanetFuncDef *)(current + 1);
+            JanetFuncDef *def = (JanetFuncDef *) current;
             if (def->sourcemap &&
                     def->source &&
                     !janet_string_compare(source, def->source)) {
@@ -159,6 +166,122 @@ void janet_stacktrace(JanetFiber *fiber, Janet err) {
     janet_v_free(fibers);
 }
 
+/*
+ * Allocation profiler
+ */
+
+/* Allocations are attributed to the funcdef of the innermost janet
+ * function on the stack of the current fiber, and the bytecode offset it
+ * is at. The collector marks the funcdefs of the sites so they stay
+ * valid until the profile is cleared. Closures and their environments
+ * are not kept alive. */
+typedef struct {
+    JanetFuncDef *def;
+    int32_t pc;
+    uint64_t count;
+    uint64_t bytes;
+} JanetAllocSite;
+
+JANET_THREAD_LOCAL uint32_t janet_vm_alloc_sample = 0;
+static JANET_THREAD_LOCAL uint32_t alloc_countdown = 0;
+static JANET_THREAD_LOCAL JanetAllocSite *alloc_sites = NULL;
+static JANET_THREAD_LOCAL int32_t alloc_site_count = 0;
+static JANET_THREAD_LOCAL int32_t alloc_site_capacity = 0;
+
+static uint32_t alloc_site_hash(JanetFuncDef *def, int32_t pc) {
+    uint32_t hash = (uint32_t)((uintptr_t) def >> 4);
+    hash = (hash ^ (uint32_t) pc) * 0x9E3779B1u;
+    return hash ^ (hash >> 16);
+}
+
+/* Find the bucket of an allocation site */
+static JanetAllocSite *alloc_site_find(JanetAllocSite *sites, int32_t cap, JanetFuncDef *def, int32_t pc) {
+    uint32_t i = janet_maphash(cap, alloc_site_hash(def, pc));
+    for (;;) {
+        JanetAllocSite *site = sites + i;
+        if (site->count == 0) return site;
+        if (site->pc == pc && site->def == def) return site;
+        i = (i + 1) & (cap - 1);
+    }
+}
+
+static void alloc_site_grow(void) {
+    int32_t i, newcap = alloc_site_capacity ? 2 * alloc_site_capacity : 64;
+    JanetAllocSite *newsites = calloc(newcap, sizeof(JanetAllocSite));
+    if (NULL == newsites) {
+        JANET_OUT_OF_MEMORY;
+    }
+    for (i = 0; i < alloc_site_capacity; i++) {
+        JanetAllocSite *site = alloc_sites + i;
+        if (site->count) {
+            *alloc_site_find(newsites, newcap, site->def, site->pc) = *site;
+        }
+    }
+    free(alloc_sites);
+    alloc_sites = newsites;
+    alloc_site_capacity = newcap;
+}
+
+/* Record an allocation of size bytes. Called by janet_gcalloc while
+ * janet_vm_alloc_sample is non-zero. Must not allocate gc memory. */
+void janet_debug_alloc(size_t size) {
+    JanetFuncDef *def = NULL;
+    JanetAllocSite *site;
+    int32_t pc = 0;
+    if (alloc_countdown > 1) {
+        alloc_countdown--;
+        return;
+    }
+    alloc_countdown = janet_vm_alloc_sample;
+    if (NULL != janet_vm_fiber) {
+        JanetFiber *fiber = janet_vm_fiber;
+        int32_t i = fiber->frame;
+        while (i > 0) {
+            JanetStackFrame *frame = (JanetStackFrame *)(fiber->data + i - JANET_FRAME_SIZE);
+            if (NULL != frame->func) {
+                def = frame->func->def;
+                if (frame->pc) pc = (int32_t)(frame->pc - def->bytecode);
+                break;
+            }
+            i = frame->prevframe;
+        }
+    }
+    if (2 * (alloc_site_count + 1) > alloc_site_capacity) alloc_site_grow();
+    site = alloc_site_find(alloc_sites, alloc_site_capacity, def, pc);
+    if (0 == site->count) {
+        site->def = def;
+        site->pc = pc;
+        alloc_site_count++;
+    }
+    site->count += janet_vm_alloc_sample;
+    site->bytes += (uint64_t) size * janet_vm_alloc_sample;
+}
+
+/* Mark the funcdefs of the recorded sites. Called by the collector. */
+void janet_debug_alloc_mark(void) {
+    int32_t i;
+    for (i = 0; i < alloc_site_capacity; i++) {
+        JanetAllocSite *site = alloc_sites + i;
+        if (site->count && NULL != site->def)
+            janet_gc_mark_funcdef(site->def);
+    }
+}
+
+/* Clear the allocation profile */
+void janet_debug_alloc_clear(void) {
+    free(alloc_sites);
+    alloc_sites = NULL;
+    alloc_site_count = 0;
+    alloc_site_capacity = 0;
+}
+
+static int alloc_site_compare(const void *a, const void *b) {
+    const JanetAllocSite *sa = (const JanetAllocSite *) a;
+    const JanetAllocSite *sb = (const JanetAllocSite *) b;
+    if (sa->bytes == sb->bytes) return 0;
+    return sa->bytes < sb->bytes ? 1 : -1;
+}
+
 /*
  * CFuns
  */
@@ -303,6 +426,57 @@ static Janet cfun_debug_argstack(int32_t argc, Janet *argv) {
     return janet_wrap_array(array);
 }
 
+static Janet cfun_debug_alloc_sample(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    int32_t n = janet_getinteger(argv, 0);
+    if (n < 0) janet_panic("expected non-negative integer");
+    janet_vm_alloc_sample = n;
+    alloc_countdown = n;
+    return janet_wrap_nil();
+}
+
+static Janet cfun_debug_alloc_profile(int32_t argc, Janet *argv) {
+    int32_t i, n = 0;
+    JanetAllocSite *sites;
+    JanetArray *array;
+    janet_arity(argc, 0, 1);
+    /* Copy the sites, as the table may change while building the result */
+    sites = malloc(sizeof(JanetAllocSite) * (alloc_site_count + 1));
+    if (NULL == sites) {
+        JANET_OUT_OF_MEMORY;
+    }
+    for (i = 0; i < alloc_site_capacity; i++) {
+        if (alloc_sites[i].count) sites[n++] = alloc_sites[i];
+    }
+    qsort(sites, n, sizeof(JanetAllocSite), alloc_site_compare);
+    array = janet_array(n);
+    for (i = 0; i < n; i++) {
+        JanetAllocSite *site = sites + i;
+        JanetTable *t = janet_table(8);
+        janet_table_put(t, janet_ckeywordv("count"), janet_wrap_number((double) site->count));
+        janet_table_put(t, janet_ckeywordv("bytes"), janet_wrap_number((double) site->bytes));
+        if (NULL != site->def) {
+            JanetFuncDef *def = site->def;
+            janet_table_put(t, janet_ckeywordv("pc"), janet_wrap_integer(site->pc));
+            if (def->name)
+                janet_table_put(t, janet_ckeywordv("name"), janet_wrap_string(def->name));
+            if (def->source)
+                janet_table_put(t, janet_ckeywordv("source"), janet_wrap_string(def->source));
+            if (def->sourcemap && site->pc < def->bytecode_length) {
+                JanetSourceMapping mapping = def->sourcemap[site->pc];
+                janet_table_put(t, janet_ckeywordv("source-start"), janet_wrap_integer(mapping.start));
+                janet_table_put(t, janet_ckeywordv("source-end"), janet_wrap_integer(mapping.end));
+            }
+        } else {
+            janet_table_put(t, janet_ckeywordv("c"), janet_wrap_true());
+        }
+        janet_array_push(array, janet_wrap_table(t));
+    }
+    free(sites);
+    if (argc > 0 && janet_truthy(argv[0])) janet_debug_alloc_clear();
+    return janet_wrap_array(array);
+}
+
 static const JanetReg debug_cfuns[] = {
     {
         "debug/break", cfun_debug_break,
@@ -363,6 +537,30 @@ static const JanetReg debug_cfuns[] = {
              "err must be passed to the function as fiber's do not keep track of "
              "the last error they have thrown. Returns the fiber.")
     },
+    {
+        "debug/alloc-sample", cfun_debug_alloc_sample,
+        JDOC("(debug/alloc-sample n)\n\n"
+             "Turn on the allocation profiler, recording one out of every n allocations "
+             "of garbage collected memory. Each recorded allocation is counted n times. "
+             "An n of 0 turns the profiler off but keeps the recorded profile.")
+    },
+    {
+        "debug/alloc-profile", cfun_debug_alloc_profile,
+        JDOC("(debug/alloc-profile &opt clear)\n\n"
+             "Get the allocations recorded by the allocation profiler as an array of tables, "
+             "sorted by the number of bytes allocated. Allocations are attributed to the "
+             "innermost janet function on the stack and its bytecode offset. Each table "
+             "has the following keys:\n\n"
+             "\t:count - number of allocations\n"
+             "\t:bytes - number of bytes allocated\n"
+             "\t:pc - the bytecode offset in the function\n"
+             "\t:name - the name of the function\n"
+             "\t:source - the source file of the function\n"
+             "\t:source-start - byte offset of the allocating form in the source\n"
+             "\t:source-end - byte offset of the end of the allocating form\n"
+             "\t:c - true for allocations made outside of any janet function\n\n"
+             "If clear is truthy, the recorded profile is cleared.")
+    },
     {
         "debug/lineage", cfun_debug_lineage,
         JDOC("(debug/lineage fib)\n\n"
@@ -25,6 +25,7 @@
 #include "emit.h"
 #include "vector.h"
 #include "regalloc.h"
+#include <math.h>
 #endif
 
 /* Get a register */
@@ -87,7 +88,9 @@ static void janetc_loadconst(JanetCompiler *c, Janet k, int32_t reg) {
         case JANET_NUMBER: {
             double dval = janet_unwrap_number(k);
             int32_t i = (int32_t) dval;
-            if (dval != i || !(dval >= INT16_MIN && dval <= INT16_MAX))
+            /* ldi cannot load -0 */
+            if (dval != i || !(dval >= INT16_MIN && dval <= INT16_MAX) ||
+                    (i == 0 && signbit(dval)))
                 goto do_constant;
             janetc_emit(c,
                         (i << 16) |
@@ -280,6 +283,10 @@ int32_t janetc_emit_st(JanetCompiler *c, uint8_t op, JanetSlot s, int32_t tflags
     return emit1s(c, op, s, tflags, 0);
 }
 
+int32_t janetc_emit_sc(JanetCompiler *c, uint8_t op, JanetSlot s, Janet k, int wr) {
+    return emit1s(c, op, s, janetc_const(c, k), wr);
+}
+
 int32_t janetc_emit_si(JanetCompiler *c, uint8_t op, JanetSlot s, int16_t immediate, int wr) {
     return emit1s(c, op, s, immediate, wr);
 }
@@ -35,6 +35,7 @@ int32_t janetc_allocnear(JanetCompiler *c, JanetcRegisterTemp);
 int32_t janetc_emit_s(JanetCompiler *c, uint8_t op, JanetSlot s, int wr);
 int32_t janetc_emit_sl(JanetCompiler *c, uint8_t op, JanetSlot s, int32_t label);
 int32_t janetc_emit_st(JanetCompiler *c, uint8_t op, JanetSlot s, int32_t tflags);
+int32_t janetc_emit_sc(JanetCompiler *c, uint8_t op, JanetSlot s, Janet k, int wr);
 int32_t janetc_emit_si(JanetCompiler *c, uint8_t op, JanetSlot s, int16_t immediate, int wr);
 int32_t janetc_emit_su(JanetCompiler *c, uint8_t op, JanetSlot s, uint16_t immediate, int wr);
 int32_t janetc_emit_ss(JanetCompiler *c, uint8_t op, JanetSlot s1, JanetSlot s2, int wr);
@@ -56,6 +56,7 @@ static JanetFiber *fiber_alloc(int32_t capacity) {
 /* Create a new fiber with argn values on the stack by reusing a fiber. */
 JanetFiber *janet_fiber_reset(JanetFiber *fiber, JanetFunction *callee, int32_t argc, const Janet *argv) {
     int32_t newstacktop;
+    janet_gc_barrier(fiber);
     fiber_reset(fiber);
     if (argc) {
         newstacktop = fiber->stacktop + argc;
@@ -190,6 +191,7 @@ static void janet_env_detach(JanetFuncEnv *env) {
             JANET_OUT_OF_MEMORY;
         }
         memcpy(vmem, env->as.fiber->data + env->offset, s);
+        janet_gc_barrier(env);
         env->offset = 0;
         env->as.values = vmem;
     }
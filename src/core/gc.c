@@ -25,11 +25,26 @@
 #include "state.h"
 #include "symcache.h"
 #include "gc.h"
+#include "util.h"
+#endif
+
+#ifdef JANET_SWEEP_THREAD
+#include <pthread.h>
+#endif
+
+#ifdef JANET_WINDOWS
+#include <windows.h>
+#elif defined(__MACH__)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
 #endif
 
 /* GC State */
 JANET_THREAD_LOCAL void *janet_vm_blocks;
+JANET_THREAD_LOCAL void *janet_vm_young_blocks;
 JANET_THREAD_LOCAL uint32_t janet_vm_gc_interval;
+JANET_THREAD_LOCAL uint32_t janet_vm_gc_step;
 JANET_THREAD_LOCAL uint32_t janet_vm_next_collection;
 JANET_THREAD_LOCAL int janet_vm_gc_suspend = 0;
 
@@ -38,81 +53,136 @@ JANET_THREAD_LOCAL Janet *janet_vm_roots;
 JANET_THREAD_LOCAL uint32_t janet_vm_root_count;
 JANET_THREAD_LOCAL uint32_t janet_vm_root_capacity;
 
-/* Helpers for marking the various gc types */
-static void janet_mark_funcenv(JanetFuncEnv *env);
-static void janet_mark_funcdef(JanetFuncDef *def);
-static void janet_mark_function(JanetFunction *func);
-static void janet_mark_array(JanetArray *array);
-static void janet_mark_table(JanetTable *table);
-static void janet_mark_struct(const JanetKV *st);
-static void janet_mark_tuple(const Janet *tuple);
-static void janet_mark_buffer(JanetBuffer *buffer);
-static void janet_mark_string(const uint8_t *str);
-static void janet_mark_fiber(JanetFiber *fiber);
-static void janet_mark_abstract(void *adata);
-
-/* Local state that is only temporary */
-static JANET_THREAD_LOCAL uint32_t depth = JANET_RECURSION_GUARD;
-static JANET_THREAD_LOCAL uint32_t orig_rootcount;
-
-/* Mark a value */
-void janet_mark(Janet x) {
-    if (depth) {
-        depth--;
-        switch (janet_type(x)) {
-            default:
-                break;
-            case JANET_STRING:
-            case JANET_KEYWORD:
-            case JANET_SYMBOL:
-                janet_mark_string(janet_unwrap_string(x));
-                break;
-            case JANET_FUNCTION:
-                janet_mark_function(janet_unwrap_function(x));
-                break;
-            case JANET_ARRAY:
-                janet_mark_array(janet_unwrap_array(x));
-                break;
-            case JANET_TABLE:
-                janet_mark_table(janet_unwrap_table(x));
-                break;
-            case JANET_STRUCT:
-                janet_mark_struct(janet_unwrap_struct(x));
-                break;
-            case JANET_TUPLE:
-                janet_mark_tuple(janet_unwrap_tuple(x));
-                break;
-            case JANET_BUFFER:
-                janet_mark_buffer(janet_unwrap_buffer(x));
-                break;
-            case JANET_FIBER:
-                janet_mark_fiber(janet_unwrap_fiber(x));
-                break;
-            case JANET_ABSTRACT:
-                janet_mark_abstract(janet_unwrap_abstract(x));
-                break;
+/* Slab state. Each size class has a free list of blocks, linked through
+ * the next field of the gc header. Pages are kept until the vm is
+ * deinitialized. */
+#ifdef JANET_SLABS
+static const uint16_t janet_slab_sizes[JANET_SLAB_CLASSES] = {
+    32, 48, 64, 96, 128, 192, 256
+};
+static const uint8_t janet_slab_lookup[(JANET_SLAB_MAX >> 4) + 1] = {
+    0, 0, 0, 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6
+};
+#endif
+static JANET_THREAD_LOCAL JanetGCObject *slab_free[JANET_SLAB_CLASSES];
+static JANET_THREAD_LOCAL void **slab_pages;
+static JANET_THREAD_LOCAL uint32_t slab_page_count;
+static JANET_THREAD_LOCAL uint32_t slab_page_capacity;
+
+/* Generational state. The remembered set holds old objects that may
+ * point to young objects. */
+static JANET_THREAD_LOCAL JanetGCObject **remembered = NULL;
+static JANET_THREAD_LOCAL uint32_t remembered_count = 0;
+static JANET_THREAD_LOCAL uint32_t remembered_capacity = 0;
+static JANET_THREAD_LOCAL uint32_t old_count = 0;
+static JANET_THREAD_LOCAL uint32_t old_limit = JANET_GC_OLD_MIN;
+
+/* Statistics. Times are kept in nanoseconds. */
+static JANET_THREAD_LOCAL uint64_t stat_collections = 0;
+static JANET_THREAD_LOCAL uint64_t stat_full_collections = 0;
+static JANET_THREAD_LOCAL uint64_t stat_pause = 0;
+static JANET_THREAD_LOCAL uint64_t stat_last_pause = 0;
+static JANET_THREAD_LOCAL uint64_t stat_mark = 0;
+static JANET_THREAD_LOCAL uint64_t stat_sweep = 0;
+static JANET_THREAD_LOCAL uint64_t pause_start = 0;
+static JANET_THREAD_LOCAL uint64_t lap_start = 0;
+static JANET_THREAD_LOCAL JanetGCHook gc_hook = NULL;
+static JANET_THREAD_LOCAL void *gc_hook_data = NULL;
+
+/* Arena scopes. Collections are deferred while an arena is open, and
+ * values promoted by C code are rooted until it closes. */
+static JANET_THREAD_LOCAL int arena_depth = 0;
+static JANET_THREAD_LOCAL uint32_t arena_interval = 0;
+static JANET_THREAD_LOCAL Janet *arena_keep = NULL;
+static JANET_THREAD_LOCAL uint32_t arena_keep_count = 0;
+static JANET_THREAD_LOCAL uint32_t arena_keep_capacity = 0;
+
+/* Incremental state. A full collection can be spread over many vm
+ * checkpoints. Old blocks are first unmarked, then marked from the mark
+ * stack, and then swept lazily. */
+#define JANET_GC_IDLE 0
+#define JANET_GC_CLEAR 1
+#define JANET_GC_MARK 2
+#define JANET_GC_SWEEP 3
+static JANET_THREAD_LOCAL int gc_phase = JANET_GC_IDLE;
+static JANET_THREAD_LOCAL JanetGCObject *clear_cursor = NULL;
+static JANET_THREAD_LOCAL JanetGCObject **sweep_cursor = NULL;
+static JANET_THREAD_LOCAL JanetGCObject **grey = NULL;
+static JANET_THREAD_LOCAL uint32_t grey_count = 0;
+static JANET_THREAD_LOCAL uint32_t grey_capacity = 0;
+static JANET_THREAD_LOCAL uint32_t work = 0;
+
+/* While marking incrementally, young blocks are skipped as if they were
+ * already marked. They are traced when marking finishes, since writes
+ * into young blocks do not go through the write barrier. */
+static JANET_THREAD_LOCAL int32_t skip_flip = 0;
+static JANET_THREAD_LOCAL int32_t skip_mask = JANET_MEM_REACHABLE;
+#define janet_gc_skip(m) ((janet_gc_header(m)->flags ^ skip_flip) & skip_mask)
+
+#if defined(__GNUC__)
+#define janet_gc_prefetch(m) __builtin_prefetch(m)
+#else
+#define janet_gc_prefetch(m) ((void) 0)
+#endif
+
+/* Push a block onto the mark stack. Its header is prefetched so that it
+ * is likely in cache by the time the block is popped and scanned. */
+static void janet_gc_push(JanetGCObject *mem) {
+    if (grey_count >= grey_capacity) {
+        uint32_t newcap = 2 * grey_count + 64;
+        JanetGCObject **newgrey = realloc(grey, newcap * sizeof(JanetGCObject *));
+        if (NULL == newgrey) {
+            JANET_OUT_OF_MEMORY;
         }
-        depth++;
-    } else {
-        janet_gcroot(x);
+        grey = newgrey;
+        grey_capacity = newcap;
     }
+    janet_gc_prefetch(mem);
+    grey[grey_count++] = mem;
 }
 
-static void janet_mark_string(const uint8_t *str) {
-    janet_gc_mark(janet_string_head(str));
+/* Mark a block with no children */
+static void janet_mark_leaf(JanetGCObject *mem) {
+    if (!janet_gc_skip(mem))
+        janet_gc_mark(mem);
 }
 
-static void janet_mark_buffer(JanetBuffer *buffer) {
-    janet_gc_mark(buffer);
+/* Mark a value. Strings and buffers are marked right away, other blocks
+ * are pushed onto the mark stack and scanned later. */
+void janet_mark(Janet x) {
+    work++;
+    switch (janet_type(x)) {
+        default:
+            break;
+        case JANET_STRING:
+        case JANET_KEYWORD:
+        case JANET_SYMBOL:
+            janet_mark_leaf((JanetGCObject *) janet_string_head(janet_unwrap_string(x)));
+            break;
+        case JANET_BUFFER:
+            janet_mark_leaf((JanetGCObject *) janet_unwrap_buffer(x));
+            break;
+        case JANET_STRUCT:
+            janet_gc_push((JanetGCObject *) janet_struct_head(janet_unwrap_struct(x)));
+            break;
+        case JANET_TUPLE:
+            janet_gc_push((JanetGCObject *) janet_tuple_head(janet_unwrap_tuple(x)));
+            break;
+        case JANET_ABSTRACT:
+            janet_gc_push((JanetGCObject *) janet_abstract_header(janet_unwrap_abstract(x)));
+            break;
+        case JANET_FUNCTION:
+        case JANET_ARRAY:
+        case JANET_TABLE:
+        case JANET_FIBER:
+            janet_gc_push((JanetGCObject *) janet_unwrap_pointer(x));
+            break;
+    }
 }
 
-static void janet_mark_abstract(void *adata) {
-    if (janet_gc_reachable(janet_abstract_header(adata)))
-        return;
-    janet_gc_mark(janet_abstract_header(adata));
-    if (janet_abstract_header(adata)->type->gcmark) {
-        janet_abstract_header(adata)->type->gcmark(adata, janet_abstract_size(adata));
-    }
+/* Mark a funcdef that is referenced from outside of the heap */
+void janet_gc_mark_funcdef(JanetFuncDef *def) {
+    janet_gc_push((JanetGCObject *) def);
 }
 
 /* Mark a bunch of items in memory */
@@ -134,89 +204,31 @@ static void janet_mark_kvs(const JanetKV *kvs, int32_t n) {
     }
 }
 
-static void janet_mark_array(JanetArray *array) {
-    if (janet_gc_reachable(array))
-        return;
-    janet_gc_mark(array);
-    janet_mark_many(array->data, array->count);
-}
-
-static void janet_mark_table(JanetTable *table) {
-recur: /* Manual tail recursion */
-    if (janet_gc_reachable(table))
-        return;
-    janet_gc_mark(table);
-    janet_mark_kvs(table->data, table->capacity);
-    if (table->proto) {
-        table = table->proto;
-        goto recur;
-    }
-}
-
-static void janet_mark_struct(const JanetKV *st) {
-    if (janet_gc_reachable(janet_struct_head(st)))
-        return;
-    janet_gc_mark(janet_struct_head(st));
-    janet_mark_kvs(st, janet_struct_capacity(st));
-}
-
-static void janet_mark_tuple(const Janet *tuple) {
-    if (janet_gc_reachable(janet_tuple_head(tuple)))
-        return;
-    janet_gc_mark(janet_tuple_head(tuple));
-    janet_mark_many(tuple, janet_tuple_length(tuple));
-}
-
-/* Helper to mark function environments */
-static void janet_mark_funcenv(JanetFuncEnv *env) {
-    if (janet_gc_reachable(env))
-        return;
-    janet_gc_mark(env);
-    if (env->offset) {
-        /* On stack */
-        janet_mark_fiber(env->as.fiber);
-    } else {
-        /* Not on stack */
-        janet_mark_many(env->as.values, env->length);
-    }
-}
-
 /* GC helper to mark a FuncDef */
-static void janet_mark_funcdef(JanetFuncDef *def) {
+static void janet_scan_funcdef(JanetFuncDef *def) {
     int32_t i;
-    if (janet_gc_reachable(def))
-        return;
-    janet_gc_mark(def);
     janet_mark_many(def->constants, def->constants_length);
     for (i = 0; i < def->defs_length; ++i) {
-        janet_mark_funcdef(def->defs[i]);
+        janet_gc_push((JanetGCObject *) def->defs[i]);
     }
     if (def->source)
-        janet_mark_string(def->source);
+        janet_mark_leaf((JanetGCObject *) janet_string_head(def->source));
     if (def->name)
-        janet_mark_string(def->name);
+        janet_mark_leaf((JanetGCObject *) janet_string_head(def->name));
 }
 
-static void janet_mark_function(JanetFunction *func) {
+static void janet_scan_function(JanetFunction *func) {
     int32_t i;
-    int32_t numenvs;
-    if (janet_gc_reachable(func))
-        return;
-    janet_gc_mark(func);
-    numenvs = func->def->environments_length;
+    int32_t numenvs = func->def->environments_length;
     for (i = 0; i < numenvs; ++i) {
-        janet_mark_funcenv(func->envs[i]);
+        janet_gc_push((JanetGCObject *) func->envs[i]);
     }
-    janet_mark_funcdef(func->def);
+    janet_gc_push((JanetGCObject *) func->def);
 }
 
-static void janet_mark_fiber(JanetFiber *fiber) {
+static void janet_scan_fiber(JanetFiber *fiber) {
     int32_t i, j;
     JanetStackFrame *frame;
-recur:
-    if (janet_gc_reachable(fiber))
-        return;
-    janet_gc_mark(fiber);
 
     /* Mark values on the argument stack */
     janet_mark_many(fiber->data + fiber->stackstart,
@@ -227,20 +239,159 @@ recur:
     while (i > 0) {
         frame = (JanetStackFrame *)(fiber->data + i - JANET_FRAME_SIZE);
         if (NULL != frame->func)
-            janet_mark_function(frame->func);
+            janet_gc_push((JanetGCObject *) frame->func);
         if (NULL != frame->env)
-            janet_mark_funcenv(frame->env);
+            janet_gc_push((JanetGCObject *) frame->env);
         /* Mark all values in the stack frame */
         janet_mark_many(fiber->data + i, j - i);
         j = i - JANET_FRAME_SIZE;
         i = frame->prevframe;
     }
 
-    /* Explicit tail recursion */
-    if (fiber->child) {
-        fiber = fiber->child;
-        goto recur;
+    if (fiber->child)
+        janet_gc_push((JanetGCObject *) fiber->child);
+}
+
+/* Mark a block popped from the mark stack and push its children */
+static void janet_gc_scan(JanetGCObject *mem) {
+    if (janet_gc_skip(mem))
+        return;
+    janet_gc_mark(mem);
+    switch (mem->flags & JANET_MEM_TYPEBITS) {
+        default:
+            break;
+        case JANET_MEMORY_ARRAY: {
+            JanetArray *array = (JanetArray *) mem;
+            janet_mark_many(array->data, array->count);
+            break;
+        }
+        case JANET_MEMORY_TABLE: {
+            JanetTable *table = (JanetTable *) mem;
+            if (NULL != table->shape) {
+                janet_gc_push((JanetGCObject *) janet_tuple_head(table->shape));
+                janet_mark_many(janet_table_slots(table), table->count);
+            }
+            janet_mark_kvs(table->data, table->capacity);
+            if (NULL != table->array)
+                janet_mark_many(table->array, table->acapacity);
+            if (table->proto)
+                janet_gc_push((JanetGCObject *) table->proto);
+            break;
+        }
+        case JANET_MEMORY_STRUCT: {
+            JanetStructHead *head = (JanetStructHead *) mem;
+            janet_mark_kvs(head->data, head->capacity);
+            break;
+        }
+        case JANET_MEMORY_TUPLE: {
+            JanetTupleHead *head = (JanetTupleHead *) mem;
+            janet_mark_many(head->data, head->length);
+            break;
+        }
+        case JANET_MEMORY_FUNCTION:
+            janet_scan_function((JanetFunction *) mem);
+            break;
+        case JANET_MEMORY_FUNCENV: {
+            JanetFuncEnv *env = (JanetFuncEnv *) mem;
+            if (env->offset) {
+                /* On stack */
+                janet_gc_push((JanetGCObject *) env->as.fiber);
+            } else {
+                /* Not on stack */
+                janet_mark_many(env->as.values, env->length);
+            }
+            break;
+        }
+        case JANET_MEMORY_FUNCDEF:
+            janet_scan_funcdef((JanetFuncDef *) mem);
+            break;
+        case JANET_MEMORY_FIBER:
+            janet_scan_fiber((JanetFiber *) mem);
+            break;
+        case JANET_MEMORY_ABSTRACT: {
+            JanetAbstractHead *head = (JanetAbstractHead *) mem;
+            if (head->type->gcmark)
+                head->type->gcmark(head->data, head->size);
+            break;
+        }
+    }
+}
+
+/* Get the gc header of a value, or NULL if the value is not collected */
+static JanetGCObject *janet_value_header(Janet x) {
+    switch (janet_type(x)) {
+        default:
+            return NULL;
+        case JANET_STRING:
+        case JANET_KEYWORD:
+        case JANET_SYMBOL:
+            return (JanetGCObject *) janet_string_head(janet_unwrap_string(x));
+        case JANET_STRUCT:
+            return (JanetGCObject *) janet_struct_head(janet_unwrap_struct(x));
+        case JANET_TUPLE:
+            return (JanetGCObject *) janet_tuple_head(janet_unwrap_tuple(x));
+        case JANET_ABSTRACT:
+            return (JanetGCObject *) janet_abstract_header(janet_unwrap_abstract(x));
+        case JANET_FUNCTION:
+        case JANET_ARRAY:
+        case JANET_TABLE:
+        case JANET_BUFFER:
+        case JANET_FIBER:
+            return (JanetGCObject *) janet_unwrap_pointer(x);
+    }
+}
+
+/* Mark the children of a root even if it is old. */
+static void janet_mark_root(Janet x) {
+    JanetGCObject *mem = janet_value_header(x);
+    if (NULL != mem) mem->flags &= ~JANET_MEM_REACHABLE;
+    janet_mark(x);
+}
+
+/* Mark the children of a remembered object. */
+static void janet_mark_remembered(JanetGCObject *mem) {
+    mem->flags &= ~JANET_MEM_REACHABLE;
+    janet_gc_push(mem);
+}
+
+/* Check if an object must stay in the remembered set while it is old.
+ * Abstract types can change what they reference without a write barrier,
+ * unless they have JANET_ABSTRACT_FLAG_BARRIER. */
+static int janet_gc_sticky(JanetGCObject *mem) {
+    const JanetAbstractType *type;
+    if ((mem->flags & JANET_MEM_TYPEBITS) != JANET_MEMORY_ABSTRACT) return 0;
+    type = ((JanetAbstractHead *) mem)->type;
+    return NULL != type->gcmark && !(type->flags & JANET_ABSTRACT_FLAG_BARRIER);
+}
+
+/* Add an old object to the remembered set */
+void janet_gc_remember(JanetGCObject *mem) {
+    if (remembered_count >= remembered_capacity) {
+        uint32_t newcap = 2 * remembered_count + 16;
+        JanetGCObject **newmem = realloc(remembered, newcap * sizeof(JanetGCObject *));
+        if (NULL == newmem) {
+            JANET_OUT_OF_MEMORY;
+        }
+        remembered = newmem;
+        remembered_capacity = newcap;
+    }
+    mem->flags |= JANET_MEM_REMEMBERED;
+    remembered[remembered_count++] = mem;
+}
+
+/* Clear the remembered set after a minor collection, keeping only
+ * the objects that must always be remembered. */
+static void janet_gc_forget(void) {
+    uint32_t i, j = 0;
+    for (i = 0; i < remembered_count; i++) {
+        JanetGCObject *mem = remembered[i];
+        if (janet_gc_sticky(mem)) {
+            remembered[j++] = mem;
+        } else {
+            mem->flags &= ~JANET_MEM_REMEMBERED;
+        }
     }
+    remembered_count = j;
 }
 
 /* Deinitialize a block of memory */
@@ -285,33 +436,255 @@ static void janet_deinit_block(JanetGCObject *mem) {
             free(def->constants);
             free(def->bytecode);
             free(def->sourcemap);
+            free(def->icache);
         }
         break;
     }
 }
 
-/* Iterate over all allocated memory, and free memory that is not
- * marked as reachable. Flip the gc color flag for next sweep. */
-void janet_sweep() {
-    JanetGCObject *previous = NULL;
-    JanetGCObject *current = janet_vm_blocks;
+#ifdef JANET_SLABS
+/* Get a new slab page for a size class and thread its blocks onto
+ * the free list. */
+static void janet_slab_refill(int sc) {
+    size_t bsize = janet_slab_sizes[sc];
+    size_t i, n = JANET_SLAB_PAGE / bsize;
+    char *page;
+    if (slab_page_count >= slab_page_capacity) {
+        uint32_t newcap = 2 * slab_page_count + 16;
+        void **newpages = realloc(slab_pages, newcap * sizeof(void *));
+        if (NULL == newpages) {
+            JANET_OUT_OF_MEMORY;
+        }
+        slab_pages = newpages;
+        slab_page_capacity = newcap;
+    }
+    page = malloc(JANET_SLAB_PAGE);
+    if (NULL == page) {
+        JANET_OUT_OF_MEMORY;
+    }
+    slab_pages[slab_page_count++] = page;
+    for (i = n; i > 0; i--) {
+        JanetGCObject *mem = (JanetGCObject *)(page + (i - 1) * bsize);
+        mem->next = slab_free[sc];
+        slab_free[sc] = mem;
+    }
+}
+#endif
+
+/* Release the memory of a dead block */
+static void janet_gc_free(JanetGCObject *mem) {
+    int sc = (mem->flags & JANET_MEM_SLABBITS) >> JANET_MEM_SLABSHIFT;
+    if (sc) {
+        mem->next = slab_free[sc - 1];
+        slab_free[sc - 1] = mem;
+    } else {
+        free(mem);
+    }
+}
+
+#ifdef JANET_SWEEP_THREAD
+
+/* Background sweeper. Dead blocks are handed to a helper thread that
+ * runs janet_deinit_block and frees them. Blocks from slab pages are
+ * returned to the vm thread, which reuses them when a free list runs
+ * dry. The sweeper shares no thread local state with the vm. */
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    JanetGCObject *queue;
+    JanetGCObject *returned[JANET_SLAB_CLASSES];
+    int quit;
+} JanetSweeper;
+
+static JANET_THREAD_LOCAL JanetSweeper *sweeper = NULL;
+static JANET_THREAD_LOCAL JanetGCObject *handoff = NULL;
+static JANET_THREAD_LOCAL JanetGCObject *handoff_tail = NULL;
+
+static void *janet_sweeper_main(void *arg) {
+    JanetSweeper *sw = (JanetSweeper *) arg;
+    pthread_mutex_lock(&sw->lock);
+    for (;;) {
+        int sc;
+        JanetGCObject *current, *next;
+        JanetGCObject *head[JANET_SLAB_CLASSES] = {NULL};
+        JanetGCObject *tail[JANET_SLAB_CLASSES] = {NULL};
+        while (NULL == sw->queue && !sw->quit)
+            pthread_cond_wait(&sw->cond, &sw->lock);
+        if (NULL == sw->queue)
+            break;
+        current = sw->queue;
+        sw->queue = NULL;
+        pthread_mutex_unlock(&sw->lock);
+        while (NULL != current) {
+            next = current->next;
+            janet_deinit_block(current);
+            sc = (current->flags & JANET_MEM_SLABBITS) >> JANET_MEM_SLABSHIFT;
+            if (sc) {
+                if (NULL == head[sc - 1]) tail[sc - 1] = current;
+                current->next = head[sc - 1];
+                head[sc - 1] = current;
+            } else {
+                free(current);
+            }
+            current = next;
+        }
+        pthread_mutex_lock(&sw->lock);
+        for (sc = 0; sc < JANET_SLAB_CLASSES; sc++) {
+            if (NULL != head[sc]) {
+                tail[sc]->next = sw->returned[sc];
+                sw->returned[sc] = head[sc];
+            }
+        }
+    }
+    pthread_mutex_unlock(&sw->lock);
+    return NULL;
+}
+
+/* Check if a block must be deinitialized on the vm thread. Symbols live
+ * in the thread local symbol cache, cached tables invalidate the inline
+ * caches of this vm, and finalizers of abstract types may use the vm. */
+static int janet_gc_owned(JanetGCObject *mem) {
+    switch (mem->flags & JANET_MEM_TYPEBITS) {
+        default:
+            return 0;
+        case JANET_MEMORY_SYMBOL:
+            return 1;
+        case JANET_MEMORY_TABLE:
+            return mem->flags & JANET_MEM_CACHED;
+        case JANET_MEMORY_ABSTRACT:
+            return NULL != ((JanetAbstractHead *) mem)->type->gc;
+    }
+}
+
+/* Send queued dead blocks to the sweeper */
+static void janet_sweeper_flush(void) {
+    if (NULL == handoff) return;
+    pthread_mutex_lock(&sweeper->lock);
+    handoff_tail->next = sweeper->queue;
+    sweeper->queue = handoff;
+    pthread_cond_signal(&sweeper->cond);
+    pthread_mutex_unlock(&sweeper->lock);
+    handoff = NULL;
+    handoff_tail = NULL;
+}
+
+#ifdef JANET_SLABS
+/* Take back slab blocks freed by the sweeper. Returns 1 if the free list
+ * for the size class is no longer empty. */
+static int janet_sweeper_reclaim(int sc) {
+    pthread_mutex_lock(&sweeper->lock);
+    slab_free[sc] = sweeper->returned[sc];
+    sweeper->returned[sc] = NULL;
+    pthread_mutex_unlock(&sweeper->lock);
+    return NULL != slab_free[sc];
+}
+#endif
+
+#endif
+
+/* Release a dead block, either right away or on the sweeper thread */
+static void janet_gc_release(JanetGCObject *mem) {
+#ifdef JANET_SWEEP_THREAD
+    if (NULL != sweeper) {
+        if (janet_gc_owned(mem)) {
+            janet_deinit_block(mem);
+            mem->flags &= JANET_MEM_SLABBITS;
+        }
+        if (NULL == handoff) handoff_tail = mem;
+        mem->next = handoff;
+        handoff = mem;
+        return;
+    }
+#endif
+    janet_deinit_block(mem);
+    janet_gc_free(mem);
+}
+
+/* Finish releasing dead blocks after a sweep */
+static void janet_gc_release_done(void) {
+#ifdef JANET_SWEEP_THREAD
+    if (NULL != sweeper) janet_sweeper_flush();
+#endif
+}
+
+/* Start or stop the sweeper thread. Returns 0 if background sweeping
+ * is not supported. */
+int janet_gc_sweeper(int enable) {
+#ifdef JANET_SWEEP_THREAD
+    if (enable && NULL == sweeper) {
+        JanetSweeper *sw = calloc(1, sizeof(JanetSweeper));
+        if (NULL == sw) {
+            JANET_OUT_OF_MEMORY;
+        }
+        pthread_mutex_init(&sw->lock, NULL);
+        pthread_cond_init(&sw->cond, NULL);
+        if (pthread_create(&sw->thread, NULL, janet_sweeper_main, sw)) {
+            pthread_cond_destroy(&sw->cond);
+            pthread_mutex_destroy(&sw->lock);
+            free(sw);
+            return 0;
+        }
+        sweeper = sw;
+    } else if (!enable && NULL != sweeper) {
+        int sc;
+        pthread_mutex_lock(&sweeper->lock);
+        sweeper->quit = 1;
+        pthread_cond_signal(&sweeper->cond);
+        pthread_mutex_unlock(&sweeper->lock);
+        pthread_join(sweeper->thread, NULL);
+        for (sc = 0; sc < JANET_SLAB_CLASSES; sc++) {
+            JanetGCObject *current = sweeper->returned[sc];
+            while (NULL != current) {
+                JanetGCObject *next = current->next;
+                current->next = slab_free[sc];
+                slab_free[sc] = current;
+                current = next;
+            }
+        }
+        pthread_cond_destroy(&sweeper->cond);
+        pthread_mutex_destroy(&sweeper->lock);
+        free(sweeper);
+        sweeper = NULL;
+    }
+    return 1;
+#else
+    return !enable;
+#endif
+}
+
+/* Free all blocks in a list that are not marked as reachable, and
+ * move the rest to the old generation. Old blocks keep the reachable
+ * flag until the next full collection. */
+static void janet_sweep_list(JanetGCObject *current) {
     JanetGCObject *next;
     while (NULL != current) {
         next = current->next;
         if (current->flags & (JANET_MEM_REACHABLE | JANET_MEM_DISABLED)) {
-            previous = current;
-            current->flags &= ~JANET_MEM_REACHABLE;
+            current->flags |= JANET_MEM_OLD | JANET_MEM_REACHABLE;
+            if (!(current->flags & JANET_MEM_REMEMBERED) && janet_gc_sticky(current))
+                janet_gc_remember(current);
+            current->next = janet_vm_blocks;
+            janet_vm_blocks = current;
+            old_count++;
         } else {
-            janet_deinit_block(current);
-            if (NULL != previous) {
-                previous->next = next;
-            } else {
-                janet_vm_blocks = next;
-            }
-            free(current);
+            janet_gc_release(current);
         }
         current = next;
     }
+    janet_gc_release_done();
+}
+
+/* Iterate over all allocated memory, and free memory that is not
+ * marked as reachable. */
+void janet_sweep() {
+    JanetGCObject *old = janet_vm_blocks;
+    JanetGCObject *young = janet_vm_young_blocks;
+    janet_vm_blocks = NULL;
+    janet_vm_young_blocks = NULL;
+    old_count = 0;
+    janet_sweep_list(old);
+    janet_sweep_list(young);
 }
 
 /* Allocate some memory that is tracked for garbage collection */
@@ -320,38 +693,336 @@ void *janet_gcalloc(enum JanetMemoryType type, size_t size) {
 
     /* Make sure everything is inited */
     janet_assert(NULL != janet_vm_cache, "please initialize janet before use");
-    mem = malloc(size);
 
-    /* Check for bad malloc */
-    if (NULL == mem) {
-        JANET_OUT_OF_MEMORY;
-    }
+#ifdef JANET_SLABS
+    if (size <= JANET_SLAB_MAX) {
+        int sc = janet_slab_lookup[(size + 15) >> 4];
+        if (NULL == slab_free[sc]) {
+#ifdef JANET_SWEEP_THREAD
+            if (NULL == sweeper || !janet_sweeper_reclaim(sc))
+#endif
+                janet_slab_refill(sc);
+        }
+        mem = slab_free[sc];
+        slab_free[sc] = mem->next;
+        mem->flags = type | ((sc + 1) << JANET_MEM_SLABSHIFT);
+    } else
+#endif
+    {
+        mem = malloc(size);
 
-    /* Configure block */
-    mem->flags = type;
+        /* Check for bad malloc */
+        if (NULL == mem) {
+            JANET_OUT_OF_MEMORY;
+        }
 
-    /* Prepend block to heap list */
+        mem->flags = type;
+    }
+
+    /* Prepend block to young generation */
     janet_vm_next_collection += (int32_t) size;
-    mem->next = janet_vm_blocks;
-    janet_vm_blocks = mem;
+    mem->next = janet_vm_young_blocks;
+    janet_vm_young_blocks = mem;
+
+    if (janet_vm_alloc_sample) janet_debug_alloc(size);
 
     return (void *)mem;
 }
 
-/* Run garbage collection */
+/* Get a monotonic time in nanoseconds */
+static uint64_t janet_gc_clock(void) {
+#ifdef JANET_WINDOWS
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t)((double) count.QuadPart * 1e9 / (double) freq.QuadPart);
+#elif defined(__MACH__)
+    static mach_timebase_info_data_t info;
+    if (0 == info.denom) mach_timebase_info(&info);
+    return mach_absolute_time() * info.numer / info.denom;
+#else
+    struct timespec tv;
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+    return (uint64_t) tv.tv_sec * 1000000000 + (uint64_t) tv.tv_nsec;
+#endif
+}
+
+/* Start timing a collection pause */
+static void janet_gc_begin(void) {
+    if (NULL != gc_hook) gc_hook(JANET_GC_BEGIN, gc_hook_data);
+    pause_start = lap_start = janet_gc_clock();
+}
+
+/* Add the time since the last lap to a timer */
+static void janet_gc_lap(uint64_t *timer) {
+    uint64_t now = janet_gc_clock();
+    *timer += now - lap_start;
+    lap_start = now;
+}
+
+/* Finish timing a collection pause */
+static void janet_gc_end(void) {
+    stat_last_pause = janet_gc_clock() - pause_start;
+    stat_pause += stat_last_pause;
+    stat_collections++;
+    if (NULL != gc_hook) gc_hook(JANET_GC_END, gc_hook_data);
+}
+
+/* Mark everything on the mark stack */
+static void janet_gc_drain(void) {
+    while (grey_count) {
+        janet_gc_scan(grey[--grey_count]);
+    }
+}
+
+/* Stop an incremental collection in progress. Only used before running a
+ * full collection, which redoes all of the work. */
+static void janet_gc_abort(void) {
+    gc_phase = JANET_GC_IDLE;
+    grey_count = 0;
+    skip_flip = 0;
+    skip_mask = JANET_MEM_REACHABLE;
+}
+
+/* Run garbage collection over the whole heap */
 void janet_collect(void) {
     uint32_t i;
+    JanetGCObject *current;
     if (janet_vm_gc_suspend) return;
-    depth = JANET_RECURSION_GUARD;
-    orig_rootcount = janet_vm_root_count;
-    for (i = 0; i < orig_rootcount; i++)
+    janet_gc_begin();
+    janet_gc_abort();
+    /* Forget sticky marks and the remembered set */
+    for (current = janet_vm_blocks; NULL != current; current = current->next)
+        current->flags &= ~(JANET_MEM_REACHABLE | JANET_MEM_REMEMBERED);
+    remembered_count = 0;
+    for (i = 0; i < janet_vm_root_count; i++)
         janet_mark(janet_vm_roots[i]);
-    while (orig_rootcount < janet_vm_root_count) {
-        Janet x = janet_vm_roots[--janet_vm_root_count];
-        janet_mark(x);
-    }
+    janet_debug_alloc_mark();
+    janet_gc_drain();
+    janet_gc_lap(&stat_mark);
     janet_sweep();
+    janet_gc_lap(&stat_sweep);
+    old_limit = 2 * old_count + JANET_GC_OLD_MIN;
+    janet_vm_next_collection = 0;
+    stat_full_collections++;
+    janet_gc_end();
+}
+
+/* Collect the young generation. Roots and remembered objects are
+ * scanned, but old objects are never traced. */
+static void janet_collect_minor(void) {
+    uint32_t i;
+    JanetGCObject *young;
+    for (i = 0; i < janet_vm_root_count; i++)
+        janet_mark_root(janet_vm_roots[i]);
+    janet_debug_alloc_mark();
+    for (i = 0; i < remembered_count; i++)
+        janet_mark_remembered(remembered[i]);
+    janet_gc_drain();
+    janet_gc_forget();
+    janet_gc_lap(&stat_mark);
+    young = janet_vm_young_blocks;
+    janet_vm_young_blocks = NULL;
+    janet_sweep_list(young);
+    janet_gc_lap(&stat_sweep);
+}
+
+/* Unmark some old blocks. Returns 1 when all old blocks are unmarked. */
+static int janet_clear_step(uint32_t budget) {
+    while (NULL != clear_cursor && budget--) {
+        clear_cursor->flags &= ~JANET_MEM_REACHABLE;
+        clear_cursor = clear_cursor->next;
+    }
+    janet_gc_lap(&stat_mark);
+    return NULL == clear_cursor;
+}
+
+/* Start marking from the roots */
+static void janet_mark_start(void) {
+    uint32_t i;
+    skip_flip = JANET_MEM_OLD;
+    skip_mask = JANET_MEM_REACHABLE | JANET_MEM_OLD;
+    for (i = 0; i < janet_vm_root_count; i++)
+        janet_mark(janet_vm_roots[i]);
+    janet_debug_alloc_mark();
+    gc_phase = JANET_GC_MARK;
+}
+
+/* Scan some blocks from the mark stack. Returns 1 when the stack is
+ * empty. */
+static int janet_mark_step(uint32_t budget) {
+    work = 0;
+    while (grey_count && work < budget) {
+        work++;
+        janet_gc_scan(grey[--grey_count]);
+    }
+    janet_gc_lap(&stat_mark);
+    return 0 == grey_count;
+}
+
+/* Finish marking without interruption. Roots, remembered blocks and
+ * young blocks may have changed since they were scanned, so trace them
+ * again. Then sweep the young generation and begin sweeping the old
+ * generation lazily. */
+static void janet_mark_finish(void) {
+    uint32_t i, j = 0;
+    JanetGCObject *oldhead, *young;
+    skip_flip = 0;
+    skip_mask = JANET_MEM_REACHABLE;
+    for (i = 0; i < janet_vm_root_count; i++)
+        janet_mark_root(janet_vm_roots[i]);
+    janet_debug_alloc_mark();
+    for (i = 0; i < remembered_count; i++) {
+        if (janet_gc_reachable(remembered[i]))
+            janet_mark_remembered(remembered[i]);
+    }
+    janet_gc_drain();
+    /* There are no young blocks left after sweeping, so only blocks that
+     * are always remembered stay in the remembered set */
+    for (i = 0; i < remembered_count; i++) {
+        JanetGCObject *mem = remembered[i];
+        if (janet_gc_reachable(mem) && janet_gc_sticky(mem)) {
+            remembered[j++] = mem;
+        } else {
+            mem->flags &= ~JANET_MEM_REMEMBERED;
+        }
+    }
+    remembered_count = j;
+    janet_gc_lap(&stat_mark);
+    old_count = 0;
+    oldhead = janet_vm_blocks;
+    young = janet_vm_young_blocks;
+    janet_vm_young_blocks = NULL;
+    janet_sweep_list(young);
+    sweep_cursor = (JanetGCObject **) &janet_vm_blocks;
+    while (*sweep_cursor != oldhead)
+        sweep_cursor = &(*sweep_cursor)->next;
+    janet_gc_lap(&stat_sweep);
+    gc_phase = JANET_GC_SWEEP;
+}
+
+/* Sweep some old blocks. Returns 1 when all old blocks are swept. */
+static int janet_sweep_step(uint32_t budget) {
+    while (NULL != *sweep_cursor && budget--) {
+        JanetGCObject *current = *sweep_cursor;
+        if (current->flags & (JANET_MEM_REACHABLE | JANET_MEM_DISABLED)) {
+            current->flags |= JANET_MEM_REACHABLE;
+            old_count++;
+            sweep_cursor = &current->next;
+        } else {
+            *sweep_cursor = current->next;
+            janet_gc_release(current);
+        }
+    }
+    janet_gc_release_done();
+    janet_gc_lap(&stat_sweep);
+    return NULL == *sweep_cursor;
+}
+
+/* Run a collection step from a vm checkpoint. Usually this collects the
+ * young generation. Once the old generation has grown enough, a full
+ * collection is run, either all at once or in steps of janet_vm_gc_step
+ * units of work if incremental collection is enabled. */
+void janet_collect_young(void) {
+    if (janet_vm_gc_suspend) return;
+    if (JANET_GC_IDLE == gc_phase && old_count > old_limit && !janet_vm_gc_step) {
+        janet_collect();
+        return;
+    }
+    janet_gc_begin();
+    switch (gc_phase) {
+        case JANET_GC_CLEAR:
+            if (janet_clear_step(janet_vm_gc_step))
+                janet_mark_start();
+            break;
+        case JANET_GC_MARK:
+            if (janet_mark_step(janet_vm_gc_step))
+                janet_mark_finish();
+            break;
+        case JANET_GC_SWEEP:
+            janet_collect_minor();
+            if (janet_sweep_step(janet_vm_gc_step)) {
+                old_limit = 2 * old_count + JANET_GC_OLD_MIN;
+                gc_phase = JANET_GC_IDLE;
+                stat_full_collections++;
+            }
+            break;
+        default:
+            janet_collect_minor();
+            if (old_count > old_limit) {
+                clear_cursor = janet_vm_blocks;
+                gc_phase = JANET_GC_CLEAR;
+            }
+            break;
+    }
     janet_vm_next_collection = 0;
+    janet_gc_end();
+}
+
+/* Open an arena scope. Until the scope is closed, young collections only
+ * run if more than limit bytes are allocated, so short lived objects
+ * are never traced or promoted. A limit of 0 uses JANET_ARENA_LIMIT.
+ * Returns a handle to pass to janet_arena_end. */
+int janet_arena_begin(uint32_t limit) {
+    if (0 == arena_depth) {
+        arena_interval = janet_vm_gc_interval;
+        janet_vm_gc_interval = limit ? limit : JANET_ARENA_LIMIT;
+    }
+    return arena_depth++;
+}
+
+/* Keep a value alive past the end of the outermost arena scope even if it
+ * is not reachable from a root, such as a result held by C code. The value
+ * is rooted until the scope closes, so collections inside of the scope
+ * keep it too. */
+void janet_arena_promote(Janet x) {
+    if (0 == arena_depth) return;
+    janet_gcroot(x);
+    if (arena_keep_count >= arena_keep_capacity) {
+        uint32_t newcap = 2 * arena_keep_count + 8;
+        Janet *newkeep = realloc(arena_keep, newcap * sizeof(Janet));
+        if (NULL == newkeep) {
+            JANET_OUT_OF_MEMORY;
+        }
+        arena_keep = newkeep;
+        arena_keep_capacity = newcap;
+    }
+    arena_keep[arena_keep_count++] = x;
+}
+
+/* Close an arena scope. When the outermost scope closes, everything
+ * allocated in it is freed at once except for blocks that escaped. A
+ * block escapes if it is reachable from a root, from an old block through
+ * the write barrier, or from a promoted value. Only escaped blocks are
+ * traced. */
+void janet_arena_end(int handle) {
+    uint32_t i;
+    if (handle != arena_depth - 1)
+        janet_panicf("expected handle of innermost arena %d, got %d", arena_depth - 1, handle);
+    arena_depth = handle;
+    if (arena_depth) return;
+    janet_vm_gc_interval = arena_interval;
+    if (!janet_vm_gc_suspend) {
+        janet_gc_begin();
+        switch (gc_phase) {
+            case JANET_GC_CLEAR:
+                janet_clear_step(UINT32_MAX);
+                janet_mark_start();
+            /* fallthrough */
+            case JANET_GC_MARK:
+                janet_mark_step(UINT32_MAX);
+                janet_mark_finish();
+                break;
+            default:
+                janet_collect_minor();
+                break;
+        }
+        janet_vm_next_collection = 0;
+        janet_gc_end();
+    }
+    for (i = 0; i < arena_keep_count; i++)
+        janet_gcunroot(arena_keep[i]);
+    arena_keep_count = 0;
 }
 
 /* Add a root value to the GC. This prevents the GC from removing a value
@@ -416,16 +1087,138 @@ int janet_gcunrootall(Janet root) {
     return ret;
 }
 
-/* Free all allocated memory */
-void janet_clear_memory(void) {
-    JanetGCObject *current = janet_vm_blocks;
+/* Free all blocks in a list */
+static void janet_free_list(JanetGCObject *current) {
     while (NULL != current) {
         janet_deinit_block(current);
         JanetGCObject *next = current->next;
-        free(current);
+        janet_gc_free(current);
         current = next;
     }
+}
+
+/* Get the number of bytes used by a block, including memory it owns */
+static size_t janet_block_size(JanetGCObject *mem) {
+    switch (mem->flags & JANET_MEM_TYPEBITS) {
+        default:
+            return sizeof(JanetGCObject);
+        case JANET_MEMORY_STRING:
+        case JANET_MEMORY_SYMBOL:
+            return sizeof(JanetStringHead) + ((JanetStringHead *) mem)->length + 1;
+        case JANET_MEMORY_ARRAY:
+            return sizeof(JanetArray) + ((JanetArray *) mem)->capacity * sizeof(Janet);
+        case JANET_MEMORY_TUPLE:
+            return sizeof(JanetTupleHead) + ((JanetTupleHead *) mem)->length * sizeof(Janet);
+        case JANET_MEMORY_TABLE: {
+            JanetTable *table = (JanetTable *) mem;
+            int32_t cap = table->capacity;
+            if (NULL != table->shape)
+                return sizeof(JanetTable) + table->count * sizeof(Janet);
+            /* One control byte per bucket, and at least one group of them */
+            return sizeof(JanetTable) + cap * sizeof(JanetKV) + (cap ? (cap < 16 ? 16 : cap) : 0) +
+                   table->acapacity * sizeof(Janet);
+        }
+        case JANET_MEMORY_STRUCT:
+            return sizeof(JanetStructHead) + ((JanetStructHead *) mem)->capacity * sizeof(JanetKV);
+        case JANET_MEMORY_FIBER:
+            return sizeof(JanetFiber) + ((JanetFiber *) mem)->capacity * sizeof(Janet);
+        case JANET_MEMORY_BUFFER:
+            return sizeof(JanetBuffer) + ((JanetBuffer *) mem)->capacity;
+        case JANET_MEMORY_FUNCTION:
+            return sizeof(JanetFunction) +
+                   ((JanetFunction *) mem)->def->environments_length * sizeof(JanetFuncEnv *);
+        case JANET_MEMORY_ABSTRACT:
+            return sizeof(JanetAbstractHead) + ((JanetAbstractHead *) mem)->size;
+        case JANET_MEMORY_FUNCENV: {
+            JanetFuncEnv *env = (JanetFuncEnv *) mem;
+            return sizeof(JanetFuncEnv) + (env->offset ? 0 : env->length * sizeof(Janet));
+        }
+        case JANET_MEMORY_FUNCDEF: {
+            JanetFuncDef *def = (JanetFuncDef *) mem;
+            size_t size = sizeof(JanetFuncDef);
+            size += def->bytecode_length * sizeof(uint32_t);
+            size += def->constants_length * sizeof(Janet);
+            size += def->defs_length * sizeof(JanetFuncDef *);
+            size += def->environments_length * sizeof(int32_t);
+            if (def->sourcemap)
+                size += def->bytecode_length * sizeof(JanetSourceMapping);
+            return size;
+        }
+    }
+}
+
+/* Count the live blocks in a list */
+static void janet_gcstats_list(JanetGCStats *stats, JanetGCObject *current, int skipdead) {
+    for (; NULL != current; current = current->next) {
+        int type = current->flags & JANET_MEM_TYPEBITS;
+        if (skipdead && !(current->flags & (JANET_MEM_REACHABLE | JANET_MEM_DISABLED)))
+            continue;
+        stats->live_objects[type]++;
+        stats->live_bytes[type] += janet_block_size(current);
+    }
+}
+
+/* Get statistics about the collector. Walks the whole heap. */
+void janet_gcstats(JanetGCStats *stats) {
+    memset(stats, 0, sizeof(JanetGCStats));
+    /* Old blocks that are not marked while sweeping lazily are dead, and
+     * may point to blocks that were already freed. */
+    janet_gcstats_list(stats, janet_vm_blocks, JANET_GC_SWEEP == gc_phase);
+    janet_gcstats_list(stats, janet_vm_young_blocks, 0);
+    stats->allocated = janet_vm_next_collection;
+    stats->collections = stat_collections;
+    stats->full_collections = stat_full_collections;
+    stats->pause_time = stat_pause / 1e9;
+    stats->last_pause = stat_last_pause / 1e9;
+    stats->mark_time = stat_mark / 1e9;
+    stats->sweep_time = stat_sweep / 1e9;
+    stats->roots = janet_vm_root_count;
+}
+
+/* Set a function to call at the beginning and end of each collection */
+void janet_gchook(JanetGCHook hook, void *data) {
+    gc_hook = hook;
+    gc_hook_data = data;
+}
+
+/* Free all allocated memory */
+void janet_clear_memory(void) {
+    janet_gc_sweeper(0);
+    free(arena_keep);
+    arena_keep = NULL;
+    arena_keep_count = 0;
+    arena_keep_capacity = 0;
+    arena_depth = 0;
+    gc_hook = NULL;
+    gc_hook_data = NULL;
+    stat_collections = 0;
+    stat_full_collections = 0;
+    stat_pause = 0;
+    stat_last_pause = 0;
+    stat_mark = 0;
+    stat_sweep = 0;
+    janet_free_list(janet_vm_blocks);
+    janet_free_list(janet_vm_young_blocks);
     janet_vm_blocks = NULL;
+    janet_vm_young_blocks = NULL;
+    free(remembered);
+    remembered = NULL;
+    remembered_count = 0;
+    remembered_capacity = 0;
+    old_count = 0;
+    old_limit = JANET_GC_OLD_MIN;
+    janet_gc_abort();
+    free(grey);
+    grey = NULL;
+    grey_capacity = 0;
+    for (uint32_t i = 0; i < slab_page_count; i++)
+        free(slab_pages[i]);
+    free(slab_pages);
+    slab_pages = NULL;
+    slab_page_count = 0;
+    slab_page_capacity = 0;
+    for (int i = 0; i < JANET_SLAB_CLASSES; i++)
+        slab_free[i] = NULL;
 }
 
 /* Primitives for suspending GC. */
@@ -33,6 +33,18 @@
 #define JANET_MEM_TYPEBITS 0xFF
 #define JANET_MEM_REACHABLE 0x100
 #define JANET_MEM_DISABLED 0x200
+/* Set on tables that an inline cache in the vm depends on. Changing the
+ * keys or prototype of such a table invalidates all inline caches. */
+#define JANET_MEM_CACHED 0x400
+/* Generational collection. Old objects keep their reachable bit set
+ * between collections, so minor collections never trace into them.
+ * Old objects that may point to young objects are remembered. */
+#define JANET_MEM_OLD 0x800
+#define JANET_MEM_REMEMBERED 0x1000
+/* Size class of a block allocated from a slab page, plus one. Blocks
+ * allocated directly with malloc have a slab class of 0. */
+#define JANET_MEM_SLABBITS 0xE000
+#define JANET_MEM_SLABSHIFT 13
 
 #define janet_gc_settype(m, t) ((janet_gc_header(m)->flags |= (0xFF & (t))))
 #define janet_gc_type(m) (janet_gc_header(m)->flags & 0xFF)
@@ -40,6 +52,24 @@
 #define janet_gc_mark(m) (janet_gc_header(m)->flags |= JANET_MEM_REACHABLE)
 #define janet_gc_reachable(m) (janet_gc_header(m)->flags & JANET_MEM_REACHABLE)
 
+/* Write barrier for the generational collector. Must be called on an
+ * array, table, fiber, or function environment before storing a
+ * reference into it outside of the object's constructor. */
+#define janet_gc_barrier(m) do { \
+    if ((janet_gc_header(m)->flags & (JANET_MEM_OLD | JANET_MEM_REMEMBERED)) == JANET_MEM_OLD) \
+        janet_gc_remember(janet_gc_header(m)); \
+} while (0)
+
+/* Minimum number of old objects before a full collection is run
+ * instead of a minor collection */
+#define JANET_GC_OLD_MIN 0x1000
+#define JANET_ARENA_LIMIT 0x4000000
+
+/* Small blocks are carved out of slab pages of this many bytes. */
+#define JANET_SLAB_PAGE 0x4000
+#define JANET_SLAB_CLASSES 7
+#define JANET_SLAB_MAX 256
+
 /* Memory types for the GC. Different from JanetType to include funcenv and funcdef. */
 enum JanetMemoryType {
     JANET_MEMORY_NONE,
@@ -61,4 +91,18 @@ enum JanetMemoryType {
  * and then call when janet_enablegc when it is initailize and reachable by the gc (on the JANET stack) */
 void *janet_gcalloc(enum JanetMemoryType type, size_t size);
 
+/* Add an old object to the remembered set. Use janet_gc_barrier instead. */
+void janet_gc_remember(JanetGCObject *mem);
+
+/* Collect only the young generation, unless the old generation has
+ * grown enough to warrant a full collection. */
+void janet_collect_young(void);
+int janet_gc_sweeper(int enable);
+
+/* Allocation profiler hooks, implemented in debug.c */
+void janet_debug_alloc(size_t size);
+void janet_debug_alloc_clear(void);
+void janet_debug_alloc_mark(void);
+void janet_gc_mark_funcdef(JanetFuncDef *def);
+
 #endif
@@ -58,7 +58,10 @@ JanetAbstractType cfun_io_filetype = {
     io_file_get,
     NULL,
     NULL,
-    NULL
+    NULL,
+    NULL,
+    NULL,
+    0
 };
 
 /* Check arguments to fopen */
@@ -224,6 +227,12 @@ static Janet cfun_io_fread(int32_t argc, Janet *argv) {
 }
 
 /* Write bytes to a file */
+static void io_write_bytes(IOFile *iof, const uint8_t *bytes, int32_t len) {
+    if (len && !fwrite(bytes, len, 1, iof->file)) {
+        janet_panic("error writing to file");
+    }
+}
+
 static Janet cfun_io_fwrite(int32_t argc, Janet *argv) {
     janet_arity(argc, 1, -1);
     IOFile *iof = janet_getabstract(argv, 0, &cfun_io_filetype);
@@ -231,16 +240,21 @@ static Janet cfun_io_fwrite(int32_t argc, Janet *argv) {
         janet_panic("file is closed");
     if (!(iof->flags & (IO_WRITE | IO_APPEND | IO_UPDATE)))
         janet_panic("file is not writeable");
-    int32_t i;
+    int32_t i, j;
     /* Verify all arguments before writing to file */
     for (i = 1; i < argc; i++)
-        janet_getbytes(argv, i);
+        if (NULL == janet_rope_chunks(argv[i]))
+            janet_getbytes(argv, i);
     for (i = 1; i < argc; i++) {
-        JanetByteView view = janet_getbytes(argv, i);
-        if (view.len) {
-            if (!fwrite(view.bytes, view.len, 1, iof->file)) {
-                janet_panic("error writing to file");
-            }
+        JanetArray *chunks = janet_rope_chunks(argv[i]);
+        if (NULL != chunks) {
+            /* Write ropes a chunk at a time */
+            for (j = 0; j < chunks->count; j++)
+                io_write_bytes(iof, janet_unwrap_buffer(chunks->data[j])->data,
+                               janet_unwrap_buffer(chunks->data[j])->count);
+        } else {
+            JanetByteView view = janet_getbytes(argv, i);
+            io_write_bytes(iof, view.bytes, view.len);
         }
     }
     return argv[0];
@@ -369,7 +383,7 @@ static const JanetReg io_cfuns[] = {
     {
         "file/write", cfun_io_fwrite,
         JDOC("(file/write f bytes)\n\n"
-             "Writes to a file. 'bytes' must be string, buffer, or symbol. Returns the "
+             "Writes to a file. 'bytes' must be string, buffer, symbol or rope. Returns the "
              "file.")
     },
     {
@@ -435,6 +435,19 @@ static void marshal_one(MarshalState *st, Janet x, int flags) {
             pushint(st, t->count);
             if (t->proto)
                 marshal_one(st, janet_wrap_table(t->proto), flags + 1);
+            for (int32_t i = 0; i < t->acapacity; i++) {
+                if (janet_checktype(t->array[i], JANET_NIL))
+                    continue;
+                marshal_one(st, janet_wrap_integer(i), flags + 1);
+                marshal_one(st, t->array[i], flags + 1);
+            }
+            if (NULL != t->shape) {
+                for (int32_t i = 0; i < t->count; i++) {
+                    marshal_one(st, t->shape[i], flags + 1);
+                    marshal_one(st, janet_table_slots(t)[i], flags + 1);
+                }
+                return;
+            }
             for (int32_t i = 0; i < t->capacity; i++) {
                 if (janet_checktype(t->data[i].key, JANET_NIL))
                     continue;
@@ -648,6 +661,7 @@ static const uint8_t *unmarshal_one_def(
         def->bytecode_length = 0;
         def->name = NULL;
         def->source = NULL;
+        def->icache = NULL;
         janet_v_push(st->lookup_defs, def);
 
         /* Set default lengths to zero */
@@ -931,15 +945,20 @@ void janet_unmarshal_janet(JanetMarshalContext *ctx, Janet *out) {
 
 static const uint8_t *unmarshal_one_abstract(UnmarshalState *st, const uint8_t *data, Janet *out, int flags) {
     Janet key;
+    /* Abstracts are numbered before their type name and contents when
+     * marshalling, so reserve a slot for the abstract */
+    int32_t id = st->lookup.count;
+    janet_array_push(&st->lookup, janet_wrap_nil());
     data = unmarshal_one(st, data, &key, flags + 1);
     const JanetAbstractType *at = janet_get_abstract_type(key);
     if (at == NULL) return NULL;
     if (at->unmarshal) {
         void *p = janet_abstract(at, readint(st, &data));
         JanetMarshalContext context = {NULL, st, flags, data};
+        st->lookup.data[id] = janet_wrap_abstract(p);
         at->unmarshal(p, &context);
         *out = janet_wrap_abstract(p);
-        return data;
+        return context.data;
     }
     return NULL;
 }
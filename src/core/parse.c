@@ -647,7 +647,10 @@ static JanetAbstractType janet_parse_parsertype = {
     parserget,
     NULL,
     NULL,
-    NULL
+    NULL,
+    NULL,
+    NULL,
+    0
 };
 
 /* C Function parser */
@@ -0,0 +1,399 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#ifndef JANET_AMALG
+#include <janet.h>
+#include "compile.h"
+#include "vector.h"
+#endif
+
+/* Peephole optimization of the bytecode of a function before its funcdef
+ * is created. Each round threads jumps, removes unreachable code, jumps
+ * to the next instruction, moves of a register to itself and pure
+ * instructions whose result is never read, and folds a move of a
+ * temporary into the instruction that computed it. The source map is
+ * compacted along with the bytecode. */
+
+/* Widths of the field an instruction writes its register to */
+#define PH_A 0xFF
+#define PH_E 0xFFFF
+#define PH_D 0xFFFFFF
+
+/* Get the register an instruction writes, or -1. Sets the mask of the
+ * field the register is stored in. */
+static int32_t ph_write(uint32_t instr, uint32_t *field) {
+    switch (instr & 0x7F) {
+        default:
+            break;
+        case JOP_LOAD_NIL:
+        case JOP_LOAD_TRUE:
+        case JOP_LOAD_FALSE:
+        case JOP_LOAD_SELF:
+        case JOP_MAKE_ARRAY:
+        case JOP_MAKE_BUFFER:
+        case JOP_MAKE_TUPLE:
+        case JOP_MAKE_STRUCT:
+        case JOP_MAKE_TABLE:
+        case JOP_MAKE_STRING:
+            *field = PH_D;
+            return (int32_t)(instr >> 8);
+        case JOP_MOVE_FAR:
+            *field = PH_E;
+            return (int32_t)(instr >> 16);
+        case JOP_NOOP:
+        case JOP_ERROR:
+        case JOP_TYPECHECK:
+        case JOP_RETURN:
+        case JOP_RETURN_NIL:
+        case JOP_JUMP:
+        case JOP_JUMP_IF:
+        case JOP_JUMP_IF_NOT:
+        case JOP_SET_UPVALUE:
+        case JOP_PUSH:
+        case JOP_PUSH_2:
+        case JOP_PUSH_3:
+        case JOP_PUSH_ARRAY:
+        case JOP_TAILCALL:
+        case JOP_PUT:
+        case JOP_PUT_INDEX:
+            return -1;
+    }
+    *field = PH_A;
+    return (int32_t)((instr >> 8) & 0xFF);
+}
+
+/* Get the registers an instruction reads. Returns the number of registers. */
+static int ph_reads(uint32_t instr, int32_t *regs) {
+    switch (janet_instructions[instr & 0x7F]) {
+        default:
+            return 0;
+        case JINT_S:
+            switch (instr & 0x7F) {
+                default:
+                    return 0;
+                case JOP_ERROR:
+                case JOP_RETURN:
+                case JOP_PUSH:
+                case JOP_PUSH_ARRAY:
+                case JOP_TAILCALL:
+                    regs[0] = (int32_t)(instr >> 8);
+                    return 1;
+            }
+        case JINT_SL:
+        case JINT_ST:
+            regs[0] = (int32_t)((instr >> 8) & 0xFF);
+            return 1;
+        case JINT_SES:
+            if ((instr & 0x7F) != JOP_SET_UPVALUE) return 0;
+            regs[0] = (int32_t)((instr >> 8) & 0xFF);
+            return 1;
+        case JINT_SS:
+            switch (instr & 0x7F) {
+                default:
+                    regs[0] = (int32_t)(instr >> 16);
+                    return 1;
+                case JOP_MOVE_FAR:
+                    regs[0] = (int32_t)((instr >> 8) & 0xFF);
+                    return 1;
+                case JOP_PUSH_2:
+                    regs[0] = (int32_t)((instr >> 8) & 0xFF);
+                    regs[1] = (int32_t)(instr >> 16);
+                    return 2;
+            }
+        case JINT_SSI:
+        case JINT_SSU:
+            regs[0] = (int32_t)((instr >> 16) & 0xFF);
+            if ((instr & 0x7F) != JOP_PUT_INDEX) return 1;
+            regs[1] = (int32_t)((instr >> 8) & 0xFF);
+            return 2;
+        case JINT_SSS:
+            regs[0] = (int32_t)((instr >> 16) & 0xFF);
+            regs[1] = (int32_t)(instr >> 24);
+            if ((instr & 0x7F) != JOP_PUSH_3 && (instr & 0x7F) != JOP_PUT) return 2;
+            regs[2] = (int32_t)((instr >> 8) & 0xFF);
+            return 3;
+    }
+}
+
+/* Check if an instruction does nothing but write its register */
+static int ph_pure(uint32_t instr) {
+    switch (instr & 0x7F) {
+        default:
+            return 0;
+        case JOP_MOVE_NEAR:
+        case JOP_MOVE_FAR:
+        case JOP_LOAD_NIL:
+        case JOP_LOAD_TRUE:
+        case JOP_LOAD_FALSE:
+        case JOP_LOAD_INTEGER:
+        case JOP_LOAD_CONSTANT:
+        case JOP_LOAD_UPVALUE:
+        case JOP_LOAD_SELF:
+        case JOP_CLOSURE:
+        case JOP_EQUALS:
+        case JOP_ADD_UNCHECKED:
+        case JOP_SUBTRACT_UNCHECKED:
+        case JOP_MULTIPLY_UNCHECKED:
+        case JOP_DIVIDE_UNCHECKED:
+        case JOP_NUMERIC_LESS_THAN_UNCHECKED:
+        case JOP_NUMERIC_LESS_THAN_EQUAL_UNCHECKED:
+        case JOP_NUMERIC_GREATER_THAN_UNCHECKED:
+        case JOP_NUMERIC_GREATER_THAN_EQUAL_UNCHECKED:
+        case JOP_NUMERIC_EQUAL_UNCHECKED:
+            return 1;
+    }
+}
+
+/* Check if control never continues to the next instruction */
+static int ph_noreturn(uint32_t instr) {
+    switch (instr & 0x7F) {
+        default:
+            return 0;
+        case JOP_JUMP:
+        case JOP_RETURN:
+        case JOP_RETURN_NIL:
+        case JOP_ERROR:
+        case JOP_TAILCALL:
+            return 1;
+    }
+}
+
+/* Get the index an instruction jumps to, or -1 */
+static int32_t ph_target(uint32_t instr, int32_t i) {
+    switch (instr & 0x7F) {
+        default:
+            return -1;
+        case JOP_JUMP:
+            return i + (((int32_t) instr) >> 8);
+        case JOP_JUMP_IF:
+        case JOP_JUMP_IF_NOT:
+            return i + (((int32_t) instr) >> 16);
+    }
+}
+
+/* Make an instruction jump to another index. Returns 0 if the offset
+ * does not fit. */
+static int ph_retarget(uint32_t *instr, int32_t i, int32_t target) {
+    int32_t offset = target - i;
+    if ((*instr & 0x7F) == JOP_JUMP) {
+        if (offset < -0x800000 || offset > 0x7FFFFF) return 0;
+        *instr = (*instr & 0xFF) | ((uint32_t) offset << 8);
+    } else {
+        if (offset < INT16_MIN || offset > INT16_MAX) return 0;
+        *instr = (*instr & 0xFFFF) | ((uint32_t) offset << 16);
+    }
+    return 1;
+}
+
+/* Follow a chain of unconditional jumps */
+static int32_t ph_thread(const uint32_t *code, int32_t n, int32_t target) {
+    int32_t steps;
+    for (steps = 0; steps < n && (code[target] & 0x7F) == JOP_JUMP; steps++) {
+        int32_t next = ph_target(code[target], target);
+        if (next == target) break;
+        target = next;
+    }
+    return target;
+}
+
+#define ph_bit(set, r) ((set)[(r) >> 5] & ((uint32_t) 1 << ((r) & 31)))
+
+/* Compute the registers live before each instruction */
+static void ph_liveness(const uint32_t *code, int32_t n, uint32_t *live, int32_t words) {
+    int32_t i, j, w;
+    int changed = 1;
+    memset(live, 0, sizeof(uint32_t) * words * n);
+    while (changed) {
+        changed = 0;
+        for (i = n - 1; i >= 0; i--) {
+            uint32_t *in = live + (size_t) i * words;
+            int32_t target = ph_target(code[i], i);
+            int32_t regs[3];
+            uint32_t field;
+            int32_t written = ph_write(code[i], &field);
+            int nreads = ph_reads(code[i], regs);
+            for (w = 0; w < words; w++) {
+                uint32_t out = 0;
+                if (!ph_noreturn(code[i]) && i + 1 < n) out |= live[(size_t)(i + 1) * words + w];
+                if (target >= 0) out |= live[(size_t) target * words + w];
+                if (written >= 0 && (written >> 5) == w) out &= ~((uint32_t) 1 << (written & 31));
+                for (j = 0; j < nreads; j++)
+                    if ((regs[j] >> 5) == w) out |= (uint32_t) 1 << (regs[j] & 31);
+                if (out != in[w]) {
+                    in[w] = out;
+                    changed = 1;
+                }
+            }
+        }
+    }
+}
+
+/* Check if a register is live after an instruction */
+static int ph_liveafter(const uint32_t *code, int32_t n, const uint32_t *live,
+                        int32_t words, int32_t i, int32_t reg) {
+    int32_t target = ph_target(code[i], i);
+    if (!ph_noreturn(code[i]) && i + 1 < n && ph_bit(live + (size_t)(i + 1) * words, reg)) return 1;
+    return target >= 0 && ph_bit(live + (size_t) target * words, reg);
+}
+
+/* Run one round of the optimizer. Returns the new bytecode length. */
+static int32_t ph_round(uint32_t *code, JanetSourceMapping *map, int32_t n,
+                        int32_t slots, int canfold, int *changed) {
+    int32_t i, k;
+    int32_t words = (slots + 31) >> 5;
+    uint8_t *flags = calloc(n, 1);
+    int32_t *newpos = malloc(sizeof(int32_t) * (n + 1));
+    uint32_t *live = canfold ? malloc(sizeof(uint32_t) * words * n) : NULL;
+    if (NULL == flags || NULL == newpos || (canfold && NULL == live)) {
+        JANET_OUT_OF_MEMORY;
+    }
+#define PH_DELETE 1
+#define PH_TARGET 2
+#define PH_REACHED 4
+
+    /* Thread jumps */
+    for (i = 0; i < n; i++) {
+        int32_t target = ph_target(code[i], i);
+        if (target < 0) continue;
+        int32_t final = ph_thread(code, n, target);
+        if ((code[i] & 0x7F) == JOP_JUMP &&
+                ((code[final] & 0x7F) == JOP_RETURN || (code[final] & 0x7F) == JOP_RETURN_NIL)) {
+            code[i] = code[final];
+            *changed = 1;
+        } else if (final != target && ph_retarget(code + i, i, final)) {
+            *changed = 1;
+        }
+    }
+
+    /* Find reachable instructions and jump targets */
+    {
+        int32_t *stack = newpos;
+        int32_t top = 0;
+        stack[top++] = 0;
+        flags[0] |= PH_REACHED;
+        while (top) {
+            int32_t succ[2];
+            int32_t nsucc = 0;
+            i = stack[--top];
+            if (!ph_noreturn(code[i]) && i + 1 < n) succ[nsucc++] = i + 1;
+            if (ph_target(code[i], i) >= 0) {
+                succ[nsucc++] = ph_target(code[i], i);
+                flags[ph_target(code[i], i)] |= PH_TARGET;
+            }
+            while (nsucc) {
+                int32_t s = succ[--nsucc];
+                if (!(flags[s] & PH_REACHED)) {
+                    flags[s] |= PH_REACHED;
+                    stack[top++] = s;
+                }
+            }
+        }
+    }
+
+    if (canfold) ph_liveness(code, n, live, words);
+
+    /* Mark instructions to delete, and fold moves */
+    for (i = 0; i < n; i++) {
+        uint32_t instr = code[i];
+        uint32_t field;
+        int32_t written = ph_write(instr, &field);
+        if (!(flags[i] & PH_REACHED)) {
+            flags[i] |= PH_DELETE;
+        } else if (ph_target(instr, i) == i + 1) {
+            flags[i] |= PH_DELETE;
+        } else if ((instr & 0x7F) == JOP_MOVE_NEAR && ((instr >> 8) & 0xFF) == (instr >> 16)) {
+            flags[i] |= PH_DELETE;
+        } else if ((instr & 0x7F) == JOP_MOVE_FAR && ((instr >> 8) & 0xFF) == (instr >> 16)) {
+            flags[i] |= PH_DELETE;
+        } else if (canfold && written >= 0 && ph_pure(instr) &&
+                   !ph_liveafter(code, n, live, words, i, written)) {
+            flags[i] |= PH_DELETE;
+        } else if (canfold && i > 0 && written >= 0 &&
+                   ((instr & 0x7F) == JOP_MOVE_NEAR || (instr & 0x7F) == JOP_MOVE_FAR) &&
+                   !(flags[i] & PH_TARGET) && !(flags[i - 1] & PH_DELETE)) {
+            /* $t = op ...; $d = $t becomes $d = op ... when $t is dead */
+            int32_t temp = (instr & 0x7F) == JOP_MOVE_NEAR
+                           ? (int32_t)(instr >> 16)
+                           : (int32_t)((instr >> 8) & 0xFF);
+            uint32_t pfield;
+            int32_t pwritten = ph_write(code[i - 1], &pfield);
+            if (pwritten == temp && (uint32_t) written <= pfield &&
+                    (code[i - 1] & 0x7F) != JOP_SIGNAL &&
+                    (code[i - 1] & 0x7F) != JOP_RESUME &&
+                    (code[i - 1] & 0x7F) != JOP_PROPAGATE &&
+                    !ph_liveafter(code, n, live, words, i, temp)) {
+                int shift = pfield == PH_E ? 16 : 8;
+                code[i - 1] = (code[i - 1] & ~(pfield << shift)) | ((uint32_t) written << shift);
+                flags[i] |= PH_DELETE;
+            }
+        }
+    }
+
+    /* Compact the code and fix up jumps */
+    for (i = 0, k = 0; i < n; i++) {
+        newpos[i] = k;
+        if (!(flags[i] & PH_DELETE)) k++;
+    }
+    newpos[n] = k;
+    if (k != n) *changed = 1;
+    for (i = 0; i < n; i++) {
+        int32_t target;
+        if (flags[i] & PH_DELETE) continue;
+        target = ph_target(code[i], i);
+        if (target >= 0) ph_retarget(code + i, newpos[i], newpos[target]);
+        code[newpos[i]] = code[i];
+        if (NULL != map) map[newpos[i]] = map[i];
+    }
+
+#undef PH_DELETE
+#undef PH_TARGET
+#undef PH_REACHED
+    free(flags);
+    free(newpos);
+    free(live);
+    return k;
+}
+
+/* Maximum size of the liveness sets in words. Functions with larger
+ * sets are only optimized with the passes that don't need them. */
+#define PH_MAX_LIVENESS (1 << 22)
+
+void janetc_peephole(JanetCompiler *c) {
+    JanetScope *scope = c->scope;
+    int32_t start = scope->bytecode_start;
+    int32_t n = janet_v_count(c->buffer) - start;
+    int32_t slots = scope->ra.max + 1 < 256 ? 256 : scope->ra.max + 1;
+    /* A closure may read any register through the environment of the
+     * function, so registers are only known to be dead when there is none. */
+    int canfold = !(scope->flags & JANET_SCOPE_ENV) &&
+                  (int64_t)((slots + 31) >> 5) * n <= PH_MAX_LIVENESS;
+    int round, changed = 1;
+    if (n == 0) return;
+    for (round = 0; changed && round < 8; round++) {
+        changed = 0;
+        n = ph_round(c->buffer + start,
+                     NULL == c->mapbuffer ? NULL : c->mapbuffer + start,
+                     n, slots, canfold, &changed);
+    }
+    janet_v__cnt(c->buffer) = start + n;
+    if (NULL != c->mapbuffer) janet_v__cnt(c->mapbuffer) = start + n;
+}
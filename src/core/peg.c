@@ -986,7 +986,10 @@ static JanetAbstractType peg_type = {
     NULL,
     NULL,
     NULL,
-    NULL
+    NULL,
+    NULL,
+    NULL,
+    0
 };
 
 /* Used to ensure that if we place several arrays in one memory chunk, each
@@ -0,0 +1,604 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#ifndef JANET_AMALG
+#include <janet.h>
+#include <math.h>
+#include "gc.h"
+#include "util.h"
+#endif
+
+/* Persistent maps are hash array mapped tries. Each level of the trie
+ * uses 5 bits of the key hash, so a map of n keys is about log32(n)
+ * levels deep, and an update copies one node per level and shares the
+ * rest with the old map.
+ *
+ * Nodes are tuples, so they are immutable and managed by the gc. A node
+ * is laid out as
+ *
+ *   [datamap nodemap k0 v0 k1 v1 ... child0 child1 ...]
+ *
+ * where datamap and nodemap are bitmaps of which of the 32 hash slices
+ * hold a key value pair in this node, or a child node. Once all 32 bits
+ * of the hash are used, keys with the same hash go into a collision
+ * node, which is [false nil k0 v0 k1 v1 ...]. A node other than the root
+ * never holds a single pair and nothing else, which keeps the layout of a
+ * map independent of the order in which its keys were added. */
+
+#define PMAP_BITS 5
+#define PMAP_HASHBITS 32
+#define PMAP_MAXDEPTH 8
+
+typedef struct {
+    Janet root;
+    int32_t count;
+} JanetPMap;
+
+static int pmap_gcmark(void *p, size_t size);
+static Janet pmap_get(void *p, Janet key);
+static void pmap_marshal(void *p, JanetMarshalContext *ctx);
+static void pmap_unmarshal(void *p, JanetMarshalContext *ctx);
+static Janet pmap_next(void *p, Janet key);
+static int32_t pmap_length(void *p, size_t size);
+
+const JanetAbstractType janet_pmap_type = {
+    "core/pmap",
+    NULL,
+    pmap_gcmark,
+    pmap_get,
+    NULL,
+    pmap_marshal,
+    pmap_unmarshal,
+    pmap_next,
+    pmap_length,
+    JANET_ABSTRACT_FLAG_BARRIER
+};
+
+static int pmap_popcount(uint32_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    return (int)((((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#endif
+}
+
+#define pmap_collision(node) janet_checktype((node)[0], JANET_FALSE)
+#define pmap_datamap(node) ((uint32_t) janet_unwrap_number((node)[0]))
+#define pmap_nodemap(node) ((uint32_t) janet_unwrap_number((node)[1]))
+#define pmap_hash(key) ((uint32_t) janet_hash(key))
+#define pmap_bit(hash, shift) (1u << (((hash) >> (shift)) & 31))
+
+/* Number of key value pairs stored directly in a node */
+static int32_t pmap_ndata(const Janet *node) {
+    return pmap_collision(node)
+           ? (janet_tuple_length(node) - 2) / 2
+           : pmap_popcount(pmap_datamap(node));
+}
+
+/* Check if a node holds a single pair and no children */
+static int pmap_single(const Janet *node) {
+    return janet_tuple_length(node) == 4 && (pmap_collision(node) || pmap_datamap(node));
+}
+
+static Janet *pmap_node_begin(int32_t length, Janet first, Janet second) {
+    Janet *node = janet_tuple_begin(length);
+    node[0] = first;
+    node[1] = second;
+    return node;
+}
+
+static Janet pmap_node_end(Janet *node) {
+    return janet_wrap_tuple(janet_tuple_end(node));
+}
+
+static Janet pmap_bitmap(uint32_t map) {
+    return janet_wrap_number((double) map);
+}
+
+/* Copy a node, replacing one element */
+static Janet pmap_node_set(const Janet *node, int32_t index, Janet x) {
+    int32_t len = janet_tuple_length(node);
+    Janet *newnode = janet_tuple_begin(len);
+    memcpy(newnode, node, len * sizeof(Janet));
+    newnode[index] = x;
+    return pmap_node_end(newnode);
+}
+
+/* Find the value slot of a key, or NULL if the key is not in the map */
+static const Janet *pmap_find(Janet root, Janet key, uint32_t hash) {
+    const Janet *node;
+    int shift = 0;
+    if (janet_checktype(root, JANET_NIL)) return NULL;
+    node = janet_unwrap_tuple(root);
+    for (;;) {
+        if (pmap_collision(node)) {
+            int32_t i, len = janet_tuple_length(node);
+            for (i = 2; i < len; i += 2)
+                if (janet_equals(node[i], key)) return node + i + 1;
+            return NULL;
+        }
+        uint32_t bit = pmap_bit(hash, shift);
+        uint32_t datamap = pmap_datamap(node);
+        uint32_t nodemap = pmap_nodemap(node);
+        if (datamap & bit) {
+            int32_t index = 2 + 2 * pmap_popcount(datamap & (bit - 1));
+            return janet_equals(node[index], key) ? node + index + 1 : NULL;
+        }
+        if (!(nodemap & bit)) return NULL;
+        node = janet_unwrap_tuple(node[2 + 2 * pmap_popcount(datamap) + pmap_popcount(nodemap & (bit - 1))]);
+        shift += PMAP_BITS;
+    }
+}
+
+/* Make a node holding two pairs with different keys */
+static Janet pmap_merge(Janet k0, Janet v0, uint32_t h0, Janet k1, Janet v1, uint32_t h1, int shift) {
+    Janet *node;
+    if (shift >= PMAP_HASHBITS) {
+        node = pmap_node_begin(6, janet_wrap_false(), janet_wrap_nil());
+        node[2] = k0;
+        node[3] = v0;
+        node[4] = k1;
+        node[5] = v1;
+    } else {
+        uint32_t b0 = pmap_bit(h0, shift);
+        uint32_t b1 = pmap_bit(h1, shift);
+        if (b0 == b1) {
+            node = pmap_node_begin(3, pmap_bitmap(0), pmap_bitmap(b0));
+            node[2] = pmap_merge(k0, v0, h0, k1, v1, h1, shift + PMAP_BITS);
+        } else {
+            node = pmap_node_begin(6, pmap_bitmap(b0 | b1), pmap_bitmap(0));
+            int first = b0 < b1 ? 2 : 4;
+            node[first] = k0;
+            node[first + 1] = v0;
+            node[6 - first] = k1;
+            node[7 - first] = v1;
+        }
+    }
+    return pmap_node_end(node);
+}
+
+/* Insert a pair into a node, returning the new node. Sets *added if the
+ * key was not in the node. */
+static Janet pmap_insert(Janet nodev, int shift, Janet key, uint32_t hash, Janet value, int *added) {
+    Janet *newnode;
+    if (janet_checktype(nodev, JANET_NIL)) {
+        newnode = pmap_node_begin(4, pmap_bitmap(pmap_bit(hash, shift)), pmap_bitmap(0));
+        newnode[2] = key;
+        newnode[3] = value;
+        *added = 1;
+        return pmap_node_end(newnode);
+    }
+    const Janet *node = janet_unwrap_tuple(nodev);
+    int32_t len = janet_tuple_length(node);
+    if (pmap_collision(node)) {
+        int32_t i;
+        for (i = 2; i < len; i += 2) {
+            if (janet_equals(node[i], key)) {
+                if (janet_equals(node[i + 1], value)) return nodev;
+                return pmap_node_set(node, i + 1, value);
+            }
+        }
+        newnode = janet_tuple_begin(len + 2);
+        memcpy(newnode, node, len * sizeof(Janet));
+        newnode[len] = key;
+        newnode[len + 1] = value;
+        *added = 1;
+        return pmap_node_end(newnode);
+    }
+    uint32_t bit = pmap_bit(hash, shift);
+    uint32_t datamap = pmap_datamap(node);
+    uint32_t nodemap = pmap_nodemap(node);
+    int32_t dataend = 2 + 2 * pmap_popcount(datamap);
+    if (datamap & bit) {
+        int32_t index = 2 + 2 * pmap_popcount(datamap & (bit - 1));
+        Janet oldkey = node[index];
+        if (janet_equals(oldkey, key)) {
+            if (janet_equals(node[index + 1], value)) return nodev;
+            return pmap_node_set(node, index + 1, value);
+        }
+        /* Push both pairs down into a new child */
+        Janet child = pmap_merge(oldkey, node[index + 1], pmap_hash(oldkey),
+                                 key, value, hash, shift + PMAP_BITS);
+        int32_t cindex = dataend - 2 + pmap_popcount(nodemap & (bit - 1));
+        newnode = pmap_node_begin(len - 1, pmap_bitmap(datamap ^ bit), pmap_bitmap(nodemap | bit));
+        memcpy(newnode + 2, node + 2, (index - 2) * sizeof(Janet));
+        memcpy(newnode + index, node + index + 2, (cindex - index) * sizeof(Janet));
+        newnode[cindex] = child;
+        memcpy(newnode + cindex + 1, node + cindex + 2, (len - cindex - 2) * sizeof(Janet));
+        *added = 1;
+        return pmap_node_end(newnode);
+    }
+    if (nodemap & bit) {
+        int32_t cindex = dataend + pmap_popcount(nodemap & (bit - 1));
+        Janet child = pmap_insert(node[cindex], shift + PMAP_BITS, key, hash, value, added);
+        if (janet_unwrap_tuple(child) == janet_unwrap_tuple(node[cindex])) return nodev;
+        return pmap_node_set(node, cindex, child);
+    }
+    /* Add a pair to this node */
+    int32_t index = 2 + 2 * pmap_popcount(datamap & (bit - 1));
+    newnode = pmap_node_begin(len + 2, pmap_bitmap(datamap | bit), pmap_bitmap(nodemap));
+    memcpy(newnode + 2, node + 2, (index - 2) * sizeof(Janet));
+    newnode[index] = key;
+    newnode[index + 1] = value;
+    memcpy(newnode + index + 2, node + index, (len - index) * sizeof(Janet));
+    *added = 1;
+    return pmap_node_end(newnode);
+}
+
+/* Remove a key from a node, returning the new node, or nil if the node
+ * is now empty. Sets *removed if the key was in the node. */
+static Janet pmap_remove(Janet nodev, int shift, Janet key, uint32_t hash, int *removed) {
+    Janet *newnode;
+    if (janet_checktype(nodev, JANET_NIL)) return nodev;
+    const Janet *node = janet_unwrap_tuple(nodev);
+    int32_t len = janet_tuple_length(node);
+    if (pmap_collision(node)) {
+        int32_t i;
+        for (i = 2; i < len; i += 2) {
+            if (janet_equals(node[i], key)) {
+                newnode = pmap_node_begin(len - 2, node[0], node[1]);
+                memcpy(newnode + 2, node + 2, (i - 2) * sizeof(Janet));
+                memcpy(newnode + i, node + i + 2, (len - i - 2) * sizeof(Janet));
+                *removed = 1;
+                return pmap_node_end(newnode);
+            }
+        }
+        return nodev;
+    }
+    uint32_t bit = pmap_bit(hash, shift);
+    uint32_t datamap = pmap_datamap(node);
+    uint32_t nodemap = pmap_nodemap(node);
+    int32_t dataend = 2 + 2 * pmap_popcount(datamap);
+    if (datamap & bit) {
+        int32_t index = 2 + 2 * pmap_popcount(datamap & (bit - 1));
+        if (!janet_equals(node[index], key)) return nodev;
+        *removed = 1;
+        if (len == 4) return janet_wrap_nil();
+        newnode = pmap_node_begin(len - 2, pmap_bitmap(datamap ^ bit), pmap_bitmap(nodemap));
+        memcpy(newnode + 2, node + 2, (index - 2) * sizeof(Janet));
+        memcpy(newnode + index, node + index + 2, (len - index - 2) * sizeof(Janet));
+        return pmap_node_end(newnode);
+    }
+    if (nodemap & bit) {
+        int32_t cindex = dataend + pmap_popcount(nodemap & (bit - 1));
+        Janet child = pmap_remove(node[cindex], shift + PMAP_BITS, key, hash, removed);
+        if (!*removed) return nodev;
+        const Janet *c = janet_unwrap_tuple(child);
+        if (!pmap_single(c)) return pmap_node_set(node, cindex, child);
+        /* Pull the last pair of the child up into this node */
+        int32_t index = 2 + 2 * pmap_popcount(datamap & (bit - 1));
+        newnode = pmap_node_begin(len + 1, pmap_bitmap(datamap | bit), pmap_bitmap(nodemap ^ bit));
+        memcpy(newnode + 2, node + 2, (index - 2) * sizeof(Janet));
+        newnode[index] = c[2];
+        newnode[index + 1] = c[3];
+        memcpy(newnode + index + 2, node + index, (cindex - index) * sizeof(Janet));
+        memcpy(newnode + cindex + 2, node + cindex + 1, (len - cindex - 1) * sizeof(Janet));
+        return pmap_node_end(newnode);
+    }
+    return nodev;
+}
+
+/* Get the first key in a node */
+static Janet pmap_first(const Janet *node) {
+    while (0 == pmap_ndata(node))
+        node = janet_unwrap_tuple(node[2]);
+    return node[2];
+}
+
+/* Get the key after a given key. Walks down to the key, remembering the
+ * path, then moves to the next pair or child, going back up as needed. */
+static Janet pmap_next_key(Janet root, Janet key) {
+    const Janet *path[PMAP_MAXDEPTH];
+    int32_t slots[PMAP_MAXDEPTH];
+    uint32_t hash = pmap_hash(key);
+    int depth = 0, shift = 0;
+    int32_t slot;
+    if (janet_checktype(root, JANET_NIL)) return janet_wrap_nil();
+    const Janet *node = janet_unwrap_tuple(root);
+    if (janet_checktype(key, JANET_NIL)) return pmap_first(node);
+    /* Find the key */
+    for (;;) {
+        if (pmap_collision(node)) {
+            int32_t i, len = janet_tuple_length(node);
+            for (i = 2; i < len; i += 2)
+                if (janet_equals(node[i], key)) break;
+            if (i >= len) return janet_wrap_nil();
+            slot = (i - 2) / 2;
+            break;
+        }
+        uint32_t bit = pmap_bit(hash, shift);
+        uint32_t datamap = pmap_datamap(node);
+        uint32_t nodemap = pmap_nodemap(node);
+        if (datamap & bit) {
+            slot = pmap_popcount(datamap & (bit - 1));
+            if (!janet_equals(node[2 + 2 * slot], key)) return janet_wrap_nil();
+            break;
+        }
+        if (!(nodemap & bit)) return janet_wrap_nil();
+        slot = pmap_popcount(datamap) + pmap_popcount(nodemap & (bit - 1));
+        path[depth] = node;
+        slots[depth++] = slot;
+        node = janet_unwrap_tuple(node[2 + pmap_popcount(datamap) + slot]);
+        shift += PMAP_BITS;
+    }
+    /* Move to the next slot. Slots are the pairs of a node followed by
+     * its children. */
+    for (;;) {
+        int32_t ndata = pmap_ndata(node);
+        int32_t nslots = janet_tuple_length(node) - 2 - ndata;
+        if (++slot < nslots) {
+            if (slot < ndata) return node[2 + 2 * slot];
+            return pmap_first(janet_unwrap_tuple(node[2 + ndata + slot]));
+        }
+        if (0 == depth) return janet_wrap_nil();
+        node = path[--depth];
+        slot = slots[depth];
+    }
+}
+
+/* Call a function on every pair in a node */
+static void pmap_each(const Janet *node, void (*fn)(void *, Janet, Janet), void *arg) {
+    int32_t i, ndata = pmap_ndata(node), len = janet_tuple_length(node);
+    for (i = 0; i < ndata; i++)
+        fn(arg, node[2 + 2 * i], node[3 + 2 * i]);
+    for (i = 2 + 2 * ndata; i < len; i++)
+        pmap_each(janet_unwrap_tuple(node[i]), fn, arg);
+}
+
+/* Abstract type methods */
+
+static int pmap_gcmark(void *p, size_t size) {
+    (void) size;
+    janet_mark(((JanetPMap *) p)->root);
+    return 0;
+}
+
+static Janet pmap_get(void *p, Janet key) {
+    JanetPMap *map = (JanetPMap *) p;
+    const Janet *slot = pmap_find(map->root, key, pmap_hash(key));
+    return slot ? *slot : janet_wrap_nil();
+}
+
+static Janet pmap_next(void *p, Janet key) {
+    return pmap_next_key(((JanetPMap *) p)->root, key);
+}
+
+static int32_t pmap_length(void *p, size_t size) {
+    (void) size;
+    return ((JanetPMap *) p)->count;
+}
+
+static void pmap_marshal_pair(void *ctx, Janet key, Janet value) {
+    janet_marshal_janet((JanetMarshalContext *) ctx, key);
+    janet_marshal_janet((JanetMarshalContext *) ctx, value);
+}
+
+static void pmap_marshal(void *p, JanetMarshalContext *ctx) {
+    JanetPMap *map = (JanetPMap *) p;
+    janet_marshal_int(ctx, map->count);
+    if (map->count)
+        pmap_each(janet_unwrap_tuple(map->root), pmap_marshal_pair, ctx);
+}
+
+static void pmap_unmarshal(void *p, JanetMarshalContext *ctx) {
+    JanetPMap *map = (JanetPMap *) p;
+    int32_t i, count;
+    map->root = janet_wrap_nil();
+    map->count = 0;
+    janet_unmarshal_int(ctx, &count);
+    for (i = 0; i < count; i++) {
+        Janet key, value;
+        int added = 0;
+        janet_unmarshal_janet(ctx, &key);
+        janet_unmarshal_janet(ctx, &value);
+        map->root = pmap_insert(map->root, 0, key, pmap_hash(key), value, &added);
+        map->count += added;
+    }
+}
+
+/* C API */
+
+static JanetPMap *pmap_new(Janet root, int32_t count) {
+    JanetPMap *map = janet_abstract(&janet_pmap_type, sizeof(JanetPMap));
+    map->root = root;
+    map->count = count;
+    return map;
+}
+
+/* Check if a value can be used as a key, like in a table */
+static int pmap_validkey(Janet key) {
+    return !janet_checktype(key, JANET_NIL) &&
+           !(janet_checktype(key, JANET_NUMBER) && isnan(janet_unwrap_number(key)));
+}
+
+/* Get a map with a key set to a value, or removed if value is nil */
+static JanetPMap *pmap_put(JanetPMap *map, Janet key, Janet value) {
+    uint32_t hash;
+    Janet root;
+    int changed = 0;
+    if (!pmap_validkey(key)) return map;
+    hash = pmap_hash(key);
+    if (janet_checktype(value, JANET_NIL)) {
+        root = pmap_remove(map->root, 0, key, hash, &changed);
+        return changed ? pmap_new(root, map->count - 1) : map;
+    }
+    root = pmap_insert(map->root, 0, key, hash, value, &changed);
+    if (!changed && janet_unwrap_tuple(root) == janet_unwrap_tuple(map->root)) return map;
+    return pmap_new(root, map->count + changed);
+}
+
+static JanetPMap *pmap_unwrap(Janet map) {
+    if (!janet_checktype(map, JANET_ABSTRACT) ||
+            janet_abstract_type(janet_unwrap_abstract(map)) != &janet_pmap_type)
+        janet_panicf("expected persistent map, got %v", map);
+    return (JanetPMap *) janet_unwrap_abstract(map);
+}
+
+/* Create an empty persistent map */
+Janet janet_pmap(void) {
+    return janet_wrap_abstract(pmap_new(janet_wrap_nil(), 0));
+}
+
+/* Get a value from a persistent map */
+Janet janet_pmap_get(Janet map, Janet key) {
+    return pmap_get(pmap_unwrap(map), key);
+}
+
+/* Get a new persistent map with a key set to a value. A nil value
+ * removes the key. */
+Janet janet_pmap_put(Janet map, Janet key, Janet value) {
+    return janet_wrap_abstract(pmap_put(pmap_unwrap(map), key, value));
+}
+
+/* C functions */
+
+static JanetPMap *pmap_getmap(const Janet *argv, int32_t n) {
+    return (JanetPMap *) janet_getabstract(argv, n, &janet_pmap_type);
+}
+
+static Janet cfun_pmap_new(int32_t argc, Janet *argv) {
+    int32_t i;
+    if (argc & 1)
+        janet_panic("expected even number of arguments");
+    JanetPMap *map = pmap_new(janet_wrap_nil(), 0);
+    for (i = 0; i < argc; i += 2)
+        map = pmap_put(map, argv[i], argv[i + 1]);
+    return janet_wrap_abstract(map);
+}
+
+static Janet cfun_pmap_put(int32_t argc, Janet *argv) {
+    int32_t i;
+    janet_arity(argc, 3, -1);
+    if (!(argc & 1))
+        janet_panic("expected a value for each key");
+    JanetPMap *map = pmap_getmap(argv, 0);
+    for (i = 1; i < argc; i += 2)
+        map = pmap_put(map, argv[i], argv[i + 1]);
+    return janet_wrap_abstract(map);
+}
+
+static Janet cfun_pmap_remove(int32_t argc, Janet *argv) {
+    int32_t i;
+    janet_arity(argc, 1, -1);
+    JanetPMap *map = pmap_getmap(argv, 0);
+    for (i = 1; i < argc; i++)
+        map = pmap_put(map, argv[i], janet_wrap_nil());
+    return janet_wrap_abstract(map);
+}
+
+static void pmap_put_each(void *map, Janet key, Janet value) {
+    *((JanetPMap **) map) = pmap_put(*((JanetPMap **) map), key, value);
+}
+
+static Janet cfun_pmap_merge(int32_t argc, Janet *argv) {
+    int32_t i;
+    janet_arity(argc, 1, -1);
+    JanetPMap *map = pmap_getmap(argv, 0);
+    for (i = 1; i < argc; i++) {
+        if (janet_checktype(argv[i], JANET_ABSTRACT)) {
+            JanetPMap *other = pmap_getmap(argv, i);
+            if (other->count)
+                pmap_each(janet_unwrap_tuple(other->root), pmap_put_each, &map);
+        } else {
+            int32_t j = 0;
+            Janet key, value;
+            if (!janet_checktypes(argv[i], JANET_TFLAG_DICTIONARY))
+                janet_panic_type(argv[i], i, JANET_TFLAG_DICTIONARY);
+            while (janet_dictionary_iter(argv[i], &j, &key, &value))
+                map = pmap_put(map, key, value);
+        }
+    }
+    return janet_wrap_abstract(map);
+}
+
+static void pmap_put_table(void *t, Janet key, Janet value) {
+    janet_table_put((JanetTable *) t, key, value);
+}
+
+static Janet cfun_pmap_to_table(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetPMap *map = pmap_getmap(argv, 0);
+    JanetTable *t = janet_table(map->count);
+    if (map->count)
+        pmap_each(janet_unwrap_tuple(map->root), pmap_put_table, t);
+    return janet_wrap_table(t);
+}
+
+static void pmap_put_struct(void *st, Janet key, Janet value) {
+    janet_struct_put((JanetKV *) st, key, value);
+}
+
+static Janet cfun_pmap_to_struct(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetPMap *map = pmap_getmap(argv, 0);
+    JanetKV *st = janet_struct_begin(map->count);
+    if (map->count)
+        pmap_each(janet_unwrap_tuple(map->root), pmap_put_struct, st);
+    return janet_wrap_struct(janet_struct_end(st));
+}
+
+static const JanetReg pmap_cfuns[] = {
+    {
+        "pmap/new", cfun_pmap_new,
+        JDOC("(pmap/new & kvs)\n\n"
+             "Create a new persistent map from a sequence of keys and values. Persistent "
+             "maps are immutable like structs, but adding or removing a key makes a new "
+             "map in O(log n) time that shares most of its memory with the old map. "
+             "Use get, next and length on a persistent map like on a struct.")
+    },
+    {
+        "pmap/put", cfun_pmap_put,
+        JDOC("(pmap/put map key value & kvs)\n\n"
+             "Returns a new persistent map with the given keys set to new values. A "
+             "value of nil removes the key. The original map is not changed.")
+    },
+    {
+        "pmap/remove", cfun_pmap_remove,
+        JDOC("(pmap/remove map & keys)\n\n"
+             "Returns a new persistent map without the given keys. The original map is not changed.")
+    },
+    {
+        "pmap/merge", cfun_pmap_merge,
+        JDOC("(pmap/merge map & colls)\n\n"
+             "Returns a new persistent map with the key value pairs of each table, struct "
+             "or persistent map in colls added to map. Later values replace earlier ones.")
+    },
+    {
+        "pmap/to-table", cfun_pmap_to_table,
+        JDOC("(pmap/to-table map)\n\n"
+             "Convert a persistent map to a new table.")
+    },
+    {
+        "pmap/to-struct", cfun_pmap_to_struct,
+        JDOC("(pmap/to-struct map)\n\n"
+             "Convert a persistent map to a new struct.")
+    },
+    {NULL, NULL, NULL}
+};
+
+/* Load the persistent map module */
+void janet_lib_pmap(JanetTable *env) {
+    janet_core_cfuns(env, NULL, pmap_cfuns);
+    janet_register_abstract_type(&janet_pmap_type);
+}
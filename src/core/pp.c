@@ -255,6 +255,19 @@ void janet_to_string_b(JanetBuffer *buffer, Janet x) {
                                     janet_unwrap_string(x),
                                     janet_string_length(janet_unwrap_string(x)));
             break;
+        case JANET_ABSTRACT: {
+            JanetByteView view;
+            JanetArray *chunks;
+            if (janet_view_bytes(x, &view.bytes, &view.len)) {
+                janet_buffer_push_bytes(buffer, view.bytes, view.len);
+            } else if (NULL != (chunks = janet_rope_chunks(x))) {
+                for (int32_t i = 0; i < chunks->count; i++)
+                    janet_to_string_b(buffer, chunks->data[i]);
+            } else {
+                janet_description_b(buffer, x);
+            }
+            break;
+        }
     }
 }
 
@@ -388,24 +401,24 @@ static void janet_pretty_one(struct pretty *S, Janet x, int is_dict_value) {
             if (S->depth == 0) {
                 janet_buffer_push_cstring(S->buffer, "...");
             } else {
-                int32_t i, len, cap;
+                int32_t i = 0;
                 int first_kv_pair = 1;
-                const JanetKV *kvs;
-                janet_dictionary_view(x, &kvs, &len, &cap);
+                int32_t len = istable
+                              ? janet_unwrap_table(x)->count
+                              : janet_struct_length(janet_unwrap_struct(x));
+                Janet key, value;
                 if (!istable && len >= 4)
                     janet_buffer_push_u8(S->buffer, ' ');
                 if (is_dict_value && len >= 5) print_newline(S, 0);
-                for (i = 0; i < cap; i++) {
-                    if (!janet_checktype(kvs[i].key, JANET_NIL)) {
-                        if (first_kv_pair) {
-                            first_kv_pair = 0;
-                        } else {
-                            print_newline(S, len < 4);
-                        }
-                        janet_pretty_one(S, kvs[i].key, 0);
-                        janet_buffer_push_u8(S->buffer, ' ');
-                        janet_pretty_one(S, kvs[i].value, 1);
+                while (janet_dictionary_iter(x, &i, &key, &value)) {
+                    if (first_kv_pair) {
+                        first_kv_pair = 0;
+                    } else {
+                        print_newline(S, len < 4);
                     }
+                    janet_pretty_one(S, key, 0);
+                    janet_buffer_push_u8(S->buffer, ' ');
+                    janet_pretty_one(S, value, 1);
                 }
             }
             S->indent -= 2;
@@ -0,0 +1,450 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#ifndef JANET_AMALG
+#include <janet.h>
+#include "gc.h"
+#include "util.h"
+#endif
+
+/* Persistent vectors are 32 way tries of tuples. Leaves hold 32 values,
+ * and each level above holds up to 32 children, so a vector of n values
+ * is about log32(n) levels deep. The last, partly filled leaf is kept
+ * out of the trie as the tail, so most pushes only copy the tail.
+ *
+ * A vector is a window [start, end) onto the positions of its trie. A
+ * slice makes a new window onto the same trie, and only copies the
+ * leaf that becomes its tail. Positions before start and after end are
+ * never read. Pushing onto a slice replaces the trie nodes after end,
+ * and drops them from the copied nodes. */
+
+#define PVEC_BITS 5
+#define PVEC_WIDTH 32
+#define PVEC_MASK 31
+
+typedef struct {
+    Janet root;
+    const Janet *tail;
+    int32_t start;
+    int32_t end;
+    int32_t shift;
+} JanetPVec;
+
+static int pvec_gcmark(void *p, size_t size);
+static Janet pvec_get(void *p, Janet key);
+static void pvec_marshal(void *p, JanetMarshalContext *ctx);
+static void pvec_unmarshal(void *p, JanetMarshalContext *ctx);
+static Janet pvec_next(void *p, Janet key);
+static int32_t pvec_length(void *p, size_t size);
+
+const JanetAbstractType janet_pvec_type = {
+    "core/pvec",
+    NULL,
+    pvec_gcmark,
+    pvec_get,
+    NULL,
+    pvec_marshal,
+    pvec_unmarshal,
+    pvec_next,
+    pvec_length,
+    JANET_ABSTRACT_FLAG_BARRIER
+};
+
+#define pvec_count(v) ((v)->end - (v)->start)
+#define pvec_tailoff(v) ((v)->end - janet_tuple_length((v)->tail))
+
+static const Janet *pvec_empty_tuple(void) {
+    return janet_tuple_end(janet_tuple_begin(0));
+}
+
+static void pvec_init(JanetPVec *v) {
+    v->root = janet_wrap_nil();
+    v->tail = pvec_empty_tuple();
+    v->start = 0;
+    v->end = 0;
+    v->shift = PVEC_BITS;
+}
+
+/* Get the leaf of the trie that holds a position before the tail */
+static const Janet *pvec_leaf(const JanetPVec *v, int32_t p) {
+    const Janet *node = janet_unwrap_tuple(v->root);
+    int32_t level;
+    for (level = v->shift; level > 0; level -= PVEC_BITS)
+        node = janet_unwrap_tuple(node[(p >> level) & PVEC_MASK]);
+    return node;
+}
+
+/* Get the value at a position */
+static Janet pvec_ref(const JanetPVec *v, int32_t p) {
+    int32_t tailoff = pvec_tailoff(v);
+    if (p >= tailoff) return v->tail[p - tailoff];
+    return pvec_leaf(v, p)[p & PVEC_MASK];
+}
+
+/* Add a full leaf at position p to a node. Everything in the node after
+ * the leaf is past the end of the vector, so it is left out. */
+static Janet pvec_push_leaf(Janet nodev, int32_t level, int32_t p, const Janet *leaf) {
+    const Janet *node = janet_checktype(nodev, JANET_NIL) ? NULL : janet_unwrap_tuple(nodev);
+    int32_t len = node ? janet_tuple_length(node) : 0;
+    int32_t i, sub = (p >> level) & PVEC_MASK;
+    Janet *newnode = janet_tuple_begin(sub + 1);
+    for (i = 0; i < sub; i++)
+        newnode[i] = i < len ? node[i] : janet_wrap_nil();
+    newnode[sub] = level == PVEC_BITS
+                   ? janet_wrap_tuple(leaf)
+                   : pvec_push_leaf(sub < len ? node[sub] : janet_wrap_nil(), level - PVEC_BITS, p, leaf);
+    return janet_wrap_tuple(janet_tuple_end(newnode));
+}
+
+/* Copy a node, replacing one element */
+static Janet pvec_node_set(const Janet *node, int32_t index, Janet x) {
+    int32_t len = janet_tuple_length(node);
+    Janet *newnode = janet_tuple_begin(len);
+    memcpy(newnode, node, len * sizeof(Janet));
+    newnode[index] = x;
+    return janet_wrap_tuple(janet_tuple_end(newnode));
+}
+
+/* Set the value at a position in the trie, copying the path to it */
+static Janet pvec_set_path(Janet nodev, int32_t level, int32_t p, Janet x) {
+    const Janet *node = janet_unwrap_tuple(nodev);
+    int32_t sub = (p >> level) & PVEC_MASK;
+    Janet child = level ? pvec_set_path(node[sub], level - PVEC_BITS, p, x) : x;
+    return pvec_node_set(node, sub, child);
+}
+
+/* Append n values to a vector in place. Fills the tail a leaf at a time,
+ * so building a vector of n values allocates about n / 32 leaves. */
+static void pvec_append(JanetPVec *v, const Janet *xs, int32_t n) {
+    if (n > INT32_MAX - v->end)
+        janet_panic("persistent vector too large");
+    while (n > 0) {
+        int32_t taillen = janet_tuple_length(v->tail);
+        if (taillen == PVEC_WIDTH) {
+            int32_t tailoff = v->end - PVEC_WIDTH;
+            if ((tailoff >> PVEC_BITS) >> v->shift) {
+                Janet *newroot = janet_tuple_begin(1);
+                newroot[0] = v->root;
+                v->root = janet_wrap_tuple(janet_tuple_end(newroot));
+                v->shift += PVEC_BITS;
+            }
+            v->root = pvec_push_leaf(v->root, v->shift, tailoff, v->tail);
+            taillen = 0;
+        }
+        int32_t k = PVEC_WIDTH - taillen;
+        if (k > n) k = n;
+        Janet *newtail = janet_tuple_begin(taillen + k);
+        memcpy(newtail, v->tail, taillen * sizeof(Janet));
+        memcpy(newtail + taillen, xs, k * sizeof(Janet));
+        v->tail = janet_tuple_end(newtail);
+        v->end += k;
+        xs += k;
+        n -= k;
+    }
+}
+
+/* Narrow a vector in place to the values in [from, to) */
+static void pvec_slice(JanetPVec *v, int32_t from, int32_t to) {
+    int32_t start = v->start + from;
+    int32_t end = v->start + to;
+    if (from >= to) {
+        pvec_init(v);
+        return;
+    }
+    int32_t newoff = (end - 1) & ~PVEC_MASK;
+    const Janet *leaf = newoff >= pvec_tailoff(v) ? v->tail : pvec_leaf(v, newoff);
+    if (end - newoff != janet_tuple_length(leaf))
+        leaf = janet_tuple_n(leaf, end - newoff);
+    /* A vector that fits in its tail does not need the trie */
+    if (newoff <= start) v->root = janet_wrap_nil();
+    v->tail = leaf;
+    v->start = start;
+    v->end = end;
+}
+
+/* Copy the values of a vector to an array of Janets */
+static void pvec_copy(const JanetPVec *v, Janet *dest) {
+    int32_t p = v->start;
+    int32_t tailoff = pvec_tailoff(v);
+    while (p < v->end && p < tailoff) {
+        const Janet *leaf = pvec_leaf(v, p);
+        int32_t n = PVEC_WIDTH - (p & PVEC_MASK);
+        if (n > tailoff - p) n = tailoff - p;
+        memcpy(dest, leaf + (p & PVEC_MASK), n * sizeof(Janet));
+        dest += n;
+        p += n;
+    }
+    if (p < v->end)
+        memcpy(dest, v->tail + (p - tailoff), (v->end - p) * sizeof(Janet));
+}
+
+/* Append the values of other to v in place, a leaf at a time */
+static void pvec_append_vec(JanetPVec *v, const JanetPVec *other) {
+    int32_t p = other->start;
+    int32_t tailoff = pvec_tailoff(other);
+    while (p < other->end && p < tailoff) {
+        const Janet *leaf = pvec_leaf(other, p);
+        int32_t n = PVEC_WIDTH - (p & PVEC_MASK);
+        if (n > tailoff - p) n = tailoff - p;
+        pvec_append(v, leaf + (p & PVEC_MASK), n);
+        p += n;
+    }
+    if (p < other->end)
+        pvec_append(v, other->tail + (p - tailoff), other->end - p);
+}
+
+/* Abstract type methods */
+
+static int pvec_gcmark(void *p, size_t size) {
+    JanetPVec *v = (JanetPVec *) p;
+    (void) size;
+    janet_mark(v->root);
+    janet_mark(janet_wrap_tuple(v->tail));
+    return 0;
+}
+
+static int32_t pvec_index(JanetPVec *v, Janet key) {
+    if (!janet_checkint(key)) return -1;
+    int32_t i = janet_unwrap_integer(key);
+    return (i < 0 || i >= pvec_count(v)) ? -1 : i;
+}
+
+static Janet pvec_get(void *p, Janet key) {
+    JanetPVec *v = (JanetPVec *) p;
+    int32_t i = pvec_index(v, key);
+    return i < 0 ? janet_wrap_nil() : pvec_ref(v, v->start + i);
+}
+
+static Janet pvec_next(void *p, Janet key) {
+    JanetPVec *v = (JanetPVec *) p;
+    if (janet_checktype(key, JANET_NIL))
+        return pvec_count(v) ? janet_wrap_integer(0) : janet_wrap_nil();
+    int32_t i = pvec_index(v, key);
+    return (i < 0 || i + 1 >= pvec_count(v)) ? janet_wrap_nil() : janet_wrap_integer(i + 1);
+}
+
+static int32_t pvec_length(void *p, size_t size) {
+    (void) size;
+    return pvec_count((JanetPVec *) p);
+}
+
+static void pvec_marshal(void *p, JanetMarshalContext *ctx) {
+    JanetPVec *v = (JanetPVec *) p;
+    int32_t i;
+    janet_marshal_int(ctx, pvec_count(v));
+    for (i = v->start; i < v->end; i++)
+        janet_marshal_janet(ctx, pvec_ref(v, i));
+}
+
+static void pvec_unmarshal(void *p, JanetMarshalContext *ctx) {
+    JanetPVec *v = (JanetPVec *) p;
+    Janet chunk[PVEC_WIDTH];
+    int32_t i, count;
+    pvec_init(v);
+    janet_unmarshal_int(ctx, &count);
+    while (count > 0) {
+        int32_t n = count < PVEC_WIDTH ? count : PVEC_WIDTH;
+        for (i = 0; i < n; i++)
+            janet_unmarshal_janet(ctx, chunk + i);
+        pvec_append(v, chunk, n);
+        count -= n;
+    }
+}
+
+/* C API */
+
+static JanetPVec *pvec_wrap(const JanetPVec *v) {
+    JanetPVec *newv = janet_abstract(&janet_pvec_type, sizeof(JanetPVec));
+    *newv = *v;
+    return newv;
+}
+
+static JanetPVec *pvec_unwrap(Janet v) {
+    if (!janet_checktype(v, JANET_ABSTRACT) ||
+            janet_abstract_type(janet_unwrap_abstract(v)) != &janet_pvec_type)
+        janet_panicf("expected persistent vector, got %v", v);
+    return (JanetPVec *) janet_unwrap_abstract(v);
+}
+
+/* Create a persistent vector from n values */
+Janet janet_pvec(const Janet *xs, int32_t n) {
+    JanetPVec v;
+    pvec_init(&v);
+    pvec_append(&v, xs, n);
+    return janet_wrap_abstract(pvec_wrap(&v));
+}
+
+/* Get a value from a persistent vector, or nil if the index is out of range */
+Janet janet_pvec_get(Janet v, int32_t index) {
+    return pvec_get(pvec_unwrap(v), janet_wrap_integer(index));
+}
+
+/* Get a new persistent vector with a value added to the end */
+Janet janet_pvec_push(Janet v, Janet x) {
+    JanetPVec newv = *pvec_unwrap(v);
+    pvec_append(&newv, &x, 1);
+    return janet_wrap_abstract(pvec_wrap(&newv));
+}
+
+/* C functions */
+
+static JanetPVec *pvec_getvec(const Janet *argv, int32_t n) {
+    return (JanetPVec *) janet_getabstract(argv, n, &janet_pvec_type);
+}
+
+static Janet cfun_pvec_new(int32_t argc, Janet *argv) {
+    return janet_pvec(argv, argc);
+}
+
+static Janet cfun_pvec_push(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, -1);
+    JanetPVec v = *pvec_getvec(argv, 0);
+    pvec_append(&v, argv + 1, argc - 1);
+    return janet_wrap_abstract(pvec_wrap(&v));
+}
+
+static Janet cfun_pvec_put(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 3);
+    JanetPVec v = *pvec_getvec(argv, 0);
+    int32_t index = janet_getinteger(argv, 1);
+    if (index < 0 || index > pvec_count(&v))
+        janet_panicf("index %d out of range [0,%d]", index, pvec_count(&v));
+    if (index == pvec_count(&v)) {
+        pvec_append(&v, argv + 2, 1);
+    } else {
+        int32_t p = v.start + index;
+        int32_t tailoff = pvec_tailoff(&v);
+        if (p >= tailoff) {
+            v.tail = janet_unwrap_tuple(pvec_node_set(v.tail, p - tailoff, argv[2]));
+        } else {
+            v.root = pvec_set_path(v.root, v.shift, p, argv[2]);
+        }
+    }
+    return janet_wrap_abstract(pvec_wrap(&v));
+}
+
+static Janet cfun_pvec_pop(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetPVec v = *pvec_getvec(argv, 0);
+    if (0 == pvec_count(&v)) return argv[0];
+    pvec_slice(&v, 0, pvec_count(&v) - 1);
+    return janet_wrap_abstract(pvec_wrap(&v));
+}
+
+static Janet cfun_pvec_slice(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 3);
+    JanetPVec v = *pvec_getvec(argv, 0);
+    JanetRange range = janet_getslice(argc, argv);
+    pvec_slice(&v, range.start, range.end);
+    return janet_wrap_abstract(pvec_wrap(&v));
+}
+
+static Janet cfun_pvec_concat(int32_t argc, Janet *argv) {
+    int32_t i;
+    janet_arity(argc, 1, -1);
+    JanetPVec v = *pvec_getvec(argv, 0);
+    for (i = 1; i < argc; i++) {
+        if (janet_checktype(argv[i], JANET_ABSTRACT)) {
+            pvec_append_vec(&v, pvec_getvec(argv, i));
+        } else {
+            JanetView view = janet_getindexed(argv, i);
+            pvec_append(&v, view.items, view.len);
+        }
+    }
+    return janet_wrap_abstract(pvec_wrap(&v));
+}
+
+static Janet cfun_pvec_to_array(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetPVec *v = pvec_getvec(argv, 0);
+    JanetArray *array = janet_array(pvec_count(v));
+    pvec_copy(v, array->data);
+    array->count = pvec_count(v);
+    return janet_wrap_array(array);
+}
+
+static Janet cfun_pvec_to_tuple(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetPVec *v = pvec_getvec(argv, 0);
+    Janet *tup = janet_tuple_begin(pvec_count(v));
+    pvec_copy(v, tup);
+    return janet_wrap_tuple(janet_tuple_end(tup));
+}
+
+static const JanetReg pvec_cfuns[] = {
+    {
+        "pvec/new", cfun_pvec_new,
+        JDOC("(pvec/new & xs)\n\n"
+             "Create a new persistent vector from a sequence of values. Persistent "
+             "vectors are immutable like tuples, but pushing a value onto one makes a new "
+             "vector in amortized O(1) time, and changing a value or taking a slice takes "
+             "O(log n) time. New vectors share most of their memory with the old vector. "
+             "Use get, length and each on a persistent vector like on a tuple.")
+    },
+    {
+        "pvec/push", cfun_pvec_push,
+        JDOC("(pvec/push vec & xs)\n\n"
+             "Returns a new persistent vector with xs added to the end. The original "
+             "vector is not changed.")
+    },
+    {
+        "pvec/put", cfun_pvec_put,
+        JDOC("(pvec/put vec index value)\n\n"
+             "Returns a new persistent vector with the value at index replaced. An "
+             "index equal to the length of the vector adds the value to the end.")
+    },
+    {
+        "pvec/pop", cfun_pvec_pop,
+        JDOC("(pvec/pop vec)\n\n"
+             "Returns a new persistent vector without the last value of vec.")
+    },
+    {
+        "pvec/slice", cfun_pvec_slice,
+        JDOC("(pvec/slice vec &opt start end)\n\n"
+             "Returns a persistent vector of the values of vec from start to end. "
+             "Indices work like in tuple/slice. The slice shares memory with vec, "
+             "so it keeps all of vec alive until values are pushed onto it.")
+    },
+    {
+        "pvec/concat", cfun_pvec_concat,
+        JDOC("(pvec/concat vec & parts)\n\n"
+             "Returns a new persistent vector with the values of each indexed "
+             "collection or persistent vector in parts added to the end of vec.")
+    },
+    {
+        "pvec/to-array", cfun_pvec_to_array,
+        JDOC("(pvec/to-array vec)\n\n"
+             "Convert a persistent vector to a new array.")
+    },
+    {
+        "pvec/to-tuple", cfun_pvec_to_tuple,
+        JDOC("(pvec/to-tuple vec)\n\n"
+             "Convert a persistent vector to a new tuple.")
+    },
+    {NULL, NULL, NULL}
+};
+
+/* Load the persistent vector module */
+void janet_lib_pvec(JanetTable *env) {
+    janet_core_cfuns(env, NULL, pvec_cfuns);
+    janet_register_abstract_type(&janet_pvec_type);
+}
@@ -0,0 +1,256 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+
+#ifndef JANET_AMALG
+#include <janet.h>
+#include "util.h"
+#endif
+
+/* A rope is a list of buffers that are only appended to. When the last
+ * buffer is full, a new one is added, so bytes are copied into the rope
+ * once and never moved. Each new buffer is twice the size of the one
+ * before it, up to JANET_ROPE_CHUNK_MAX bytes, and a push that does not
+ * fit gets a buffer of its own size. */
+
+#define JANET_ROPE_CHUNK_MIN 0x100
+#define JANET_ROPE_CHUNK_MAX 0x100000
+
+typedef struct {
+    JanetArray *chunks;
+    int64_t count;
+    int32_t chunksize;
+} JanetRope;
+
+static int rope_gcmark(void *p, size_t size);
+static int32_t rope_length(void *p, size_t size);
+
+/* A rope only references its array of chunks, which has its own write
+ * barrier */
+const JanetAbstractType janet_rope_type = {
+    "core/rope",
+    NULL,
+    rope_gcmark,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    rope_length,
+    JANET_ABSTRACT_FLAG_BARRIER
+};
+
+static int rope_gcmark(void *p, size_t size) {
+    (void) size;
+    janet_mark(janet_wrap_array(((JanetRope *) p)->chunks));
+    return 0;
+}
+
+static int32_t rope_length(void *p, size_t size) {
+    int64_t count = ((JanetRope *) p)->count;
+    (void) size;
+    if (count > INT32_MAX) janet_panic("rope too large for length");
+    return (int32_t) count;
+}
+
+static JanetRope *rope_check(Janet x) {
+    if (!janet_checktype(x, JANET_ABSTRACT) ||
+            janet_abstract_type(janet_unwrap_abstract(x)) != &janet_rope_type)
+        return NULL;
+    return (JanetRope *) janet_unwrap_abstract(x);
+}
+
+static JanetRope *rope_unwrap(Janet x) {
+    JanetRope *r = rope_check(x);
+    if (NULL == r) janet_panicf("expected rope, got %v", x);
+    return r;
+}
+
+/* Get the chunks of a rope, or NULL if x is not a rope. The chunks are
+ * the buffers of the rope itself, so callers must only read them. */
+JanetArray *janet_rope_chunks(Janet x) {
+    JanetRope *r = rope_check(x);
+    return NULL == r ? NULL : r->chunks;
+}
+
+static void rope_push_bytes(JanetRope *r, const uint8_t *bytes, int32_t len) {
+    JanetArray *chunks = r->chunks;
+    r->count += len;
+    if (chunks->count) {
+        JanetBuffer *last = janet_unwrap_buffer(chunks->data[chunks->count - 1]);
+        int32_t n = last->capacity - last->count;
+        if (n > len) n = len;
+        memcpy(last->data + last->count, bytes, n);
+        last->count += n;
+        bytes += n;
+        len -= n;
+    }
+    if (len) {
+        int32_t size = len > r->chunksize ? len : r->chunksize;
+        JanetBuffer *chunk = janet_buffer(size);
+        memcpy(chunk->data, bytes, len);
+        chunk->count = len;
+        janet_array_push(chunks, janet_wrap_buffer(chunk));
+        if (r->chunksize < JANET_ROPE_CHUNK_MAX) r->chunksize *= 2;
+    }
+}
+
+/* Copy the contents of a rope into b */
+static void rope_flatten(JanetRope *r, JanetBuffer *b) {
+    int32_t i;
+    if (b->count + r->count > INT32_MAX) janet_panic("rope too large to flatten");
+    janet_buffer_ensure(b, (int32_t)(b->count + r->count), 1);
+    for (i = 0; i < r->chunks->count; i++) {
+        JanetBuffer *chunk = janet_unwrap_buffer(r->chunks->data[i]);
+        janet_buffer_push_bytes(b, chunk->data, chunk->count);
+    }
+}
+
+/* C API */
+
+/* Create a new rope, with a first chunk of at least chunksize bytes */
+Janet janet_rope(int32_t chunksize) {
+    JanetArray *chunks = janet_array(0);
+    JanetRope *r = janet_abstract(&janet_rope_type, sizeof(JanetRope));
+    r->chunks = chunks;
+    r->count = 0;
+    r->chunksize = chunksize < JANET_ROPE_CHUNK_MIN ? JANET_ROPE_CHUNK_MIN : chunksize;
+    return janet_wrap_abstract(r);
+}
+
+/* Push bytes to the end of a rope */
+void janet_rope_push_bytes(Janet rope, const uint8_t *bytes, int32_t len) {
+    rope_push_bytes(rope_unwrap(rope), bytes, len);
+}
+
+/* Copy the contents of a rope into a new buffer */
+JanetBuffer *janet_rope_flatten(Janet rope) {
+    JanetBuffer *b = janet_buffer(0);
+    rope_flatten(rope_unwrap(rope), b);
+    return b;
+}
+
+/* C functions */
+
+static Janet cfun_rope_new(int32_t argc, Janet *argv) {
+    janet_arity(argc, 0, 1);
+    int32_t chunksize = argc > 0 ? janet_getinteger(argv, 0) : JANET_ROPE_CHUNK_MIN;
+    return janet_rope(chunksize);
+}
+
+static Janet cfun_rope_push(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, -1);
+    JanetRope *r = rope_unwrap(argv[0]);
+    int32_t i, j;
+    for (i = 1; i < argc; i++) {
+        JanetRope *other = rope_check(argv[i]);
+        if (NULL != other) {
+            /* Read the byte count first, in case other is r. Pushed bytes
+             * only ever go after it, so the bytes before it stay put. */
+            int64_t left = other->count;
+            for (j = 0; left > 0; j++) {
+                JanetBuffer *chunk = janet_unwrap_buffer(other->chunks->data[j]);
+                int32_t n = chunk->count < left ? chunk->count : (int32_t) left;
+                rope_push_bytes(r, chunk->data, n);
+                left -= n;
+            }
+        } else {
+            JanetByteView view = janet_getbytes(argv, i);
+            rope_push_bytes(r, view.bytes, view.len);
+        }
+    }
+    return argv[0];
+}
+
+static Janet cfun_rope_format(int32_t argc, Janet *argv) {
+    janet_arity(argc, 2, -1);
+    JanetRope *r = rope_unwrap(argv[0]);
+    const char *strfrmt = (const char *) janet_getstring(argv, 1);
+    JanetBuffer *b = janet_buffer(0);
+    janet_buffer_format(b, strfrmt, 1, argc, argv);
+    rope_push_bytes(r, b->data, b->count);
+    return argv[0];
+}
+
+static Janet cfun_rope_chunks(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetRope *r = rope_unwrap(argv[0]);
+    int32_t i, n = r->chunks->count;
+    JanetArray *array = janet_array(n);
+    for (i = 0; i < n; i++) {
+        JanetBuffer *chunk = janet_unwrap_buffer(r->chunks->data[i]);
+        array->data[i] = janet_stringv(chunk->data, chunk->count);
+    }
+    array->count = n;
+    return janet_wrap_array(array);
+}
+
+static Janet cfun_rope_flatten(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 2);
+    JanetRope *r = rope_unwrap(argv[0]);
+    JanetBuffer *b = argc > 1 ? janet_getbuffer(argv, 1) : janet_buffer(0);
+    rope_flatten(r, b);
+    return janet_wrap_buffer(b);
+}
+
+static const JanetReg rope_cfuns[] = {
+    {
+        "rope/new", cfun_rope_new,
+        JDOC("(rope/new &opt chunksize)\n\n"
+             "Creates a new, empty rope. A rope is like a buffer that can only be "
+             "appended to, but it stores its bytes in a list of buffers, so it never "
+             "moves bytes that were already pushed. Use ropes to build large outputs "
+             "piece by piece. chunksize is the size of the first buffer, which "
+             "defaults to 256 bytes.")
+    },
+    {
+        "rope/push", cfun_rope_push,
+        JDOC("(rope/push rope & xs)\n\n"
+             "Push the bytes of each string, buffer or rope in xs to the end of rope. "
+             "Returns the modified rope.")
+    },
+    {
+        "rope/format", cfun_rope_format,
+        JDOC("(rope/format rope format & args)\n\n"
+             "Like buffer/format, but pushes the formatted text to the end of a rope. "
+             "Returns the modified rope.")
+    },
+    {
+        "rope/chunks", cfun_rope_chunks,
+        JDOC("(rope/chunks rope)\n\n"
+             "Returns a new array of strings with the bytes of rope, one for each "
+             "buffer that holds part of the rope, in order.")
+    },
+    {
+        "rope/flatten", cfun_rope_flatten,
+        JDOC("(rope/flatten rope &opt buffer)\n\n"
+             "Copy the bytes of rope to the end of buffer, or of a new buffer. "
+             "Returns the buffer.")
+    },
+    {NULL, NULL, NULL}
+};
+
+/* Load the rope module */
+void janet_lib_rope(JanetTable *env) {
+    janet_core_cfuns(env, NULL, rope_cfuns);
+    janet_register_abstract_type(&janet_rope_type);
+}
@@ -0,0 +1,411 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+
+#ifndef JANET_AMALG
+#include <janet.h>
+#include "gc.h"
+#include "util.h"
+#endif
+
+#include <math.h>
+
+/* Sets are open addressed hash tables of keys, probed linearly. Each
+ * slot has a control byte after the keys, in the same allocation, that
+ * is empty, deleted, or holds the top 7 bits of the hash of the key in
+ * the slot, so most probes compare a byte instead of a key. */
+
+#define SET_EMPTY 0
+#define SET_DELETED 1
+#define set_ctrl(s) ((uint8_t *)((s)->keys + (s)->capacity))
+#define set_tag(hash) ((uint8_t)(0x80 | ((hash) >> 25)))
+#define set_full(s, i) (set_ctrl(s)[i] & 0x80)
+
+typedef struct {
+    Janet *keys;
+    int32_t count;
+    int32_t deleted;
+    int32_t capacity;
+} JanetSet;
+
+static int set_gc(void *p, size_t size);
+static int set_gcmark(void *p, size_t size);
+static Janet set_get(void *p, Janet key);
+static void set_put(void *p, Janet key, Janet value);
+static void set_marshal(void *p, JanetMarshalContext *ctx);
+static void set_unmarshal(void *p, JanetMarshalContext *ctx);
+static Janet set_next(void *p, Janet key);
+static int32_t set_length(void *p, size_t size);
+
+const JanetAbstractType janet_set_type = {
+    "core/set",
+    set_gc,
+    set_gcmark,
+    set_get,
+    set_put,
+    set_marshal,
+    set_unmarshal,
+    set_next,
+    set_length,
+    JANET_ABSTRACT_FLAG_BARRIER
+};
+
+static void set_init(JanetSet *s, int32_t capacity) {
+    s->count = 0;
+    s->deleted = 0;
+    s->capacity = 0;
+    s->keys = NULL;
+    capacity = janet_tablen(capacity);
+    if (capacity) {
+        s->keys = malloc(capacity * (sizeof(Janet) + 1));
+        if (NULL == s->keys) {
+            JANET_OUT_OF_MEMORY;
+        }
+        s->capacity = capacity;
+        memset(set_ctrl(s), SET_EMPTY, capacity);
+    }
+}
+
+/* Find the slot of a key, or -1 - the slot to insert it into */
+static int32_t set_probe(const JanetSet *s, Janet key, uint32_t hash) {
+    const uint8_t *ctrl = set_ctrl(s);
+    uint32_t mask = (uint32_t) s->capacity - 1;
+    uint32_t i = hash & mask;
+    uint8_t tag = set_tag(hash);
+    int32_t first = -1;
+    for (;;) {
+        uint8_t c = ctrl[i];
+        if (c == SET_EMPTY) return -1 - (first < 0 ? (int32_t) i : first);
+        if (c == tag && janet_equals(s->keys[i], key)) return (int32_t) i;
+        if (c == SET_DELETED && first < 0) first = (int32_t) i;
+        i = (i + 1) & mask;
+    }
+}
+
+static int32_t set_find(const JanetSet *s, Janet key) {
+    if (!s->count) return -1;
+    int32_t i = set_probe(s, key, (uint32_t) janet_hash(key));
+    return i < 0 ? -1 : i;
+}
+
+static void set_insert(JanetSet *s, Janet key);
+
+/* Resize the set to hold at least size keys */
+static void set_rehash(JanetSet *s, int32_t size) {
+    JanetSet old = *s;
+    int32_t i;
+    set_init(s, size * 2);
+    for (i = 0; i < old.capacity; i++)
+        if (set_full(&old, i))
+            set_insert(s, old.keys[i]);
+    free(old.keys);
+}
+
+/* Add a key to the set. Keeps the load below 3/4. */
+static void set_insert(JanetSet *s, Janet key) {
+    uint32_t hash;
+    int32_t i;
+    if (4 * (s->count + s->deleted + 1) > 3 * s->capacity)
+        set_rehash(s, s->count + 1);
+    hash = (uint32_t) janet_hash(key);
+    i = set_probe(s, key, hash);
+    if (i >= 0) return;
+    i = -1 - i;
+    if (set_ctrl(s)[i] == SET_DELETED) s->deleted--;
+    set_ctrl(s)[i] = set_tag(hash);
+    s->keys[i] = key;
+    s->count++;
+}
+
+static void set_remove(JanetSet *s, Janet key) {
+    int32_t i = set_find(s, key);
+    if (i < 0) return;
+    set_ctrl(s)[i] = SET_DELETED;
+    s->keys[i] = janet_wrap_nil();
+    s->count--;
+    s->deleted++;
+}
+
+static void set_checkkey(Janet key) {
+    if (janet_checktype(key, JANET_NIL)) janet_panic("cannot have nil key");
+    if (janet_checktype(key, JANET_NUMBER) && isnan(janet_unwrap_number(key)))
+        janet_panic("cannot have NaN key");
+}
+
+/* Add a key to a set that is a gc object */
+static void set_add(JanetSet *s, Janet key) {
+    set_checkkey(key);
+    janet_gc_barrier(janet_abstract_header(s));
+    set_insert(s, key);
+}
+
+/* Abstract type methods */
+
+static int set_gc(void *p, size_t size) {
+    (void) size;
+    free(((JanetSet *) p)->keys);
+    return 0;
+}
+
+static int set_gcmark(void *p, size_t size) {
+    JanetSet *s = (JanetSet *) p;
+    int32_t i;
+    (void) size;
+    for (i = 0; i < s->capacity; i++)
+        if (set_full(s, i))
+            janet_mark(s->keys[i]);
+    return 0;
+}
+
+static Janet set_get(void *p, Janet key) {
+    return janet_wrap_boolean(set_find((JanetSet *) p, key) >= 0);
+}
+
+static void set_put(void *p, Janet key, Janet value) {
+    if (janet_truthy(value)) {
+        set_add((JanetSet *) p, key);
+    } else {
+        set_remove((JanetSet *) p, key);
+    }
+}
+
+static Janet set_next(void *p, Janet key) {
+    JanetSet *s = (JanetSet *) p;
+    int32_t i = 0;
+    if (!janet_checktype(key, JANET_NIL)) {
+        i = set_find(s, key);
+        if (i < 0) return janet_wrap_nil();
+        i++;
+    }
+    for (; i < s->capacity; i++)
+        if (set_full(s, i))
+            return s->keys[i];
+    return janet_wrap_nil();
+}
+
+static int32_t set_length(void *p, size_t size) {
+    (void) size;
+    return ((JanetSet *) p)->count;
+}
+
+static void set_marshal(void *p, JanetMarshalContext *ctx) {
+    JanetSet *s = (JanetSet *) p;
+    int32_t i;
+    janet_marshal_int(ctx, s->count);
+    for (i = 0; i < s->capacity; i++)
+        if (set_full(s, i))
+            janet_marshal_janet(ctx, s->keys[i]);
+}
+
+static void set_unmarshal(void *p, JanetMarshalContext *ctx) {
+    JanetSet *s = (JanetSet *) p;
+    int32_t i, count;
+    set_init(s, 0);
+    janet_unmarshal_int(ctx, &count);
+    for (i = 0; i < count; i++) {
+        Janet key;
+        janet_unmarshal_janet(ctx, &key);
+        set_insert(s, key);
+    }
+}
+
+/* C API */
+
+Janet janet_set(int32_t capacity) {
+    JanetSet *s = janet_abstract(&janet_set_type, sizeof(JanetSet));
+    set_init(s, capacity);
+    return janet_wrap_abstract(s);
+}
+
+/* C functions */
+
+static JanetSet *set_getset(const Janet *argv, int32_t n) {
+    return (JanetSet *) janet_getabstract(argv, n, &janet_set_type);
+}
+
+static JanetSet *set_check(Janet x) {
+    if (!janet_checktype(x, JANET_ABSTRACT) ||
+            janet_abstract_type(janet_unwrap_abstract(x)) != &janet_set_type)
+        return NULL;
+    return (JanetSet *) janet_unwrap_abstract(x);
+}
+
+/* Get the arguments as a tuple of sets. Indexed collections are made
+ * into new sets. */
+static const Janet *set_getargs(int32_t argc, const Janet *argv) {
+    Janet *sets = janet_tuple_begin(argc);
+    int32_t i, j;
+    for (i = 0; i < argc; i++) {
+        if (NULL != set_check(argv[i])) {
+            sets[i] = argv[i];
+        } else {
+            JanetView view = janet_getindexed(argv, i);
+            sets[i] = janet_set(view.len);
+            for (j = 0; j < view.len; j++)
+                set_add(janet_unwrap_abstract(sets[i]), view.items[j]);
+        }
+    }
+    return janet_tuple_end(sets);
+}
+
+#define set_at(sets, i) ((JanetSet *) janet_unwrap_abstract((sets)[i]))
+static Janet cfun_set_new(int32_t argc, Janet *argv) {
+    Janet s = janet_set(argc);
+    int32_t i;
+    for (i = 0; i < argc; i++)
+        set_add(janet_unwrap_abstract(s), argv[i]);
+    return s;
+}
+
+static Janet cfun_set_add(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, -1);
+    JanetSet *s = set_getset(argv, 0);
+    int32_t i;
+    for (i = 1; i < argc; i++)
+        set_add(s, argv[i]);
+    return argv[0];
+}
+
+static Janet cfun_set_remove(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, -1);
+    JanetSet *s = set_getset(argv, 0);
+    int32_t i;
+    for (i = 1; i < argc; i++)
+        set_remove(s, argv[i]);
+    return argv[0];
+}
+
+static Janet cfun_set_union(int32_t argc, Janet *argv) {
+    const Janet *sets = set_getargs(argc, argv);
+    int32_t i, j, size = 0;
+    for (i = 0; i < argc; i++)
+        size += set_at(sets, i)->count;
+    Janet ret = janet_set(size);
+    JanetSet *r = janet_unwrap_abstract(ret);
+    for (i = 0; i < argc; i++) {
+        JanetSet *s = set_at(sets, i);
+        for (j = 0; j < s->capacity; j++)
+            if (set_full(s, j))
+                set_insert(r, s->keys[j]);
+    }
+    return ret;
+}
+
+static Janet cfun_set_intersection(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, -1);
+    const Janet *sets = set_getargs(argc, argv);
+    int32_t i, j;
+    JanetSet *smallest = set_at(sets, 0);
+    for (i = 1; i < argc; i++)
+        if (set_at(sets, i)->count < smallest->count)
+            smallest = set_at(sets, i);
+    Janet ret = janet_set(0);
+    JanetSet *r = janet_unwrap_abstract(ret);
+    for (j = 0; j < smallest->capacity; j++) {
+        if (!set_full(smallest, j)) continue;
+        Janet key = smallest->keys[j];
+        for (i = 0; i < argc; i++)
+            if (set_find(set_at(sets, i), key) < 0) break;
+        if (i == argc) set_insert(r, key);
+    }
+    return ret;
+}
+
+static Janet cfun_set_difference(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, -1);
+    const Janet *sets = set_getargs(argc, argv);
+    int32_t i, j;
+    JanetSet *first = set_at(sets, 0);
+    Janet ret = janet_set(first->count);
+    JanetSet *r = janet_unwrap_abstract(ret);
+    for (j = 0; j < first->capacity; j++) {
+        if (!set_full(first, j)) continue;
+        Janet key = first->keys[j];
+        for (i = 1; i < argc; i++)
+            if (set_find(set_at(sets, i), key) >= 0) break;
+        if (i == argc) set_insert(r, key);
+    }
+    return ret;
+}
+
+static Janet cfun_set_to_array(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetSet *s = set_getset(argv, 0);
+    JanetArray *array = janet_array(s->count);
+    int32_t i;
+    for (i = 0; i < s->capacity; i++)
+        if (set_full(s, i))
+            array->data[array->count++] = s->keys[i];
+    return janet_wrap_array(array);
+}
+
+static const JanetReg set_cfuns[] = {
+    {
+        "set/new", cfun_set_new,
+        JDOC("(set/new & xs)\n\n"
+             "Create a new set of the values xs. A set is like a table that only has "
+             "keys, and takes about half the memory of a table with the same keys. "
+             "(get s x) is true if x is in s, and false otherwise. (put s x true) adds "
+             "x to s, and (put s x nil) removes it. Iterate over the values in a set "
+             "with each or keys.")
+    },
+    {
+        "set/add", cfun_set_add,
+        JDOC("(set/add set & xs)\n\n"
+             "Add values to a set. Returns the set.")
+    },
+    {
+        "set/remove", cfun_set_remove,
+        JDOC("(set/remove set & xs)\n\n"
+             "Remove values from a set. Returns the set.")
+    },
+    {
+        "set/union", cfun_set_union,
+        JDOC("(set/union & sets)\n\n"
+             "Returns a new set of the values that are in any of sets. Arrays and "
+             "tuples can be used in place of sets.")
+    },
+    {
+        "set/intersection", cfun_set_intersection,
+        JDOC("(set/intersection set & sets)\n\n"
+             "Returns a new set of the values that are in set and in all of sets. "
+             "Arrays and tuples can be used in place of sets.")
+    },
+    {
+        "set/difference", cfun_set_difference,
+        JDOC("(set/difference set & sets)\n\n"
+             "Returns a new set of the values in set that are in none of sets. "
+             "Arrays and tuples can be used in place of sets.")
+    },
+    {
+        "set/to-array", cfun_set_to_array,
+        JDOC("(set/to-array set)\n\n"
+             "Returns a new array of the values in a set, in no particular order.")
+    },
+    {NULL, NULL, NULL}
+};
+
+/* Load the set module */
+void janet_lib_set(JanetTable *env) {
+    janet_core_cfuns(env, NULL, set_cfuns);
+    janet_register_abstract_type(&janet_set_type);
+}
@@ -0,0 +1,538 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+
+#ifndef JANET_AMALG
+#include <janet.h>
+#include "gc.h"
+#include "util.h"
+#endif
+
+#include <math.h>
+
+/* Sorted maps are B-trees ordered by janet_compare. Every node but the
+ * root holds between SORTED_MIN and SORTED_MAX entries, so the tree is
+ * about log16(n) levels deep. Inner nodes have one more child than they
+ * have entries. Nodes are allocated with malloc and freed with the map. */
+
+#define SORTED_T 16
+#define SORTED_MIN (SORTED_T - 1)
+#define SORTED_MAX (2 * SORTED_T - 1)
+
+typedef struct SortedNode SortedNode;
+struct SortedNode {
+    int32_t count;
+    int32_t leaf;
+    JanetKV kvs[SORTED_MAX];
+    SortedNode *children[SORTED_MAX + 1];
+};
+
+typedef struct {
+    SortedNode *root;
+    int32_t count;
+} JanetSorted;
+
+static int sorted_gc(void *p, size_t size);
+static int sorted_gcmark(void *p, size_t size);
+static Janet sorted_get(void *p, Janet key);
+static void sorted_put(void *p, Janet key, Janet value);
+static void sorted_marshal(void *p, JanetMarshalContext *ctx);
+static void sorted_unmarshal(void *p, JanetMarshalContext *ctx);
+static Janet sorted_next(void *p, Janet key);
+static int32_t sorted_length(void *p, size_t size);
+
+const JanetAbstractType janet_sorted_type = {
+    "core/sorted",
+    sorted_gc,
+    sorted_gcmark,
+    sorted_get,
+    sorted_put,
+    sorted_marshal,
+    sorted_unmarshal,
+    sorted_next,
+    sorted_length,
+    JANET_ABSTRACT_FLAG_BARRIER
+};
+
+static SortedNode *sorted_node(int leaf) {
+    SortedNode *node = malloc(sizeof(SortedNode));
+    if (NULL == node) {
+        JANET_OUT_OF_MEMORY;
+    }
+    node->count = 0;
+    node->leaf = leaf;
+    return node;
+}
+
+static void sorted_free(SortedNode *node) {
+    int32_t i;
+    if (!node->leaf)
+        for (i = 0; i <= node->count; i++)
+            sorted_free(node->children[i]);
+    free(node);
+}
+
+/* Index of the first entry in node with a key not less than key, or
+ * greater than key if after is set. */
+static int32_t sorted_search(const SortedNode *node, Janet key, int after) {
+    int32_t lo = 0, hi = node->count;
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        int c = janet_compare(node->kvs[mid].key, key);
+        if (c < 0 || (after && c == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static JanetKV *sorted_find(const JanetSorted *s, Janet key) {
+    SortedNode *node = s->root;
+    while (NULL != node) {
+        int32_t i = sorted_search(node, key, 0);
+        if (i < node->count && !janet_compare(node->kvs[i].key, key))
+            return node->kvs + i;
+        if (node->leaf) break;
+        node = node->children[i];
+    }
+    return NULL;
+}
+
+/* Find the entry with the smallest key that is greater than key, or
+ * not less than key if inclusive is set. */
+static JanetKV *sorted_above(const JanetSorted *s, Janet key, int inclusive) {
+    JanetKV *best = NULL;
+    SortedNode *node = s->root;
+    while (NULL != node) {
+        int32_t i = sorted_search(node, key, !inclusive);
+        if (i < node->count) best = node->kvs + i;
+        if (node->leaf) break;
+        node = node->children[i];
+    }
+    return best;
+}
+
+/* Find the entry with the greatest key that is not greater than key */
+static JanetKV *sorted_floor(const JanetSorted *s, Janet key) {
+    JanetKV *best = NULL;
+    SortedNode *node = s->root;
+    while (NULL != node) {
+        int32_t i = sorted_search(node, key, 1);
+        if (i > 0) best = node->kvs + i - 1;
+        if (node->leaf) break;
+        node = node->children[i];
+    }
+    return best;
+}
+
+static JanetKV *sorted_end(const JanetSorted *s, int last) {
+    SortedNode *node = s->root;
+    if (NULL == node) return NULL;
+    while (!node->leaf)
+        node = node->children[last ? node->count : 0];
+    return node->kvs + (last ? node->count - 1 : 0);
+}
+
+/* Insertion */
+
+/* Split the full child i of node in two around its middle entry */
+static void sorted_split(SortedNode *node, int32_t i) {
+    SortedNode *left = node->children[i];
+    SortedNode *right = sorted_node(left->leaf);
+    right->count = SORTED_T - 1;
+    memcpy(right->kvs, left->kvs + SORTED_T, (SORTED_T - 1) * sizeof(JanetKV));
+    if (!left->leaf)
+        memcpy(right->children, left->children + SORTED_T, SORTED_T * sizeof(SortedNode *));
+    left->count = SORTED_T - 1;
+    memmove(node->kvs + i + 1, node->kvs + i, (node->count - i) * sizeof(JanetKV));
+    memmove(node->children + i + 2, node->children + i + 1,
+            (node->count - i) * sizeof(SortedNode *));
+    node->kvs[i] = left->kvs[SORTED_T - 1];
+    node->children[i + 1] = right;
+    node->count++;
+}
+
+/* Insert or replace an entry. Full nodes are split on the way down, so
+ * there is always room in the leaf. */
+static void sorted_insert(JanetSorted *s, Janet key, Janet value) {
+    SortedNode *node = s->root;
+    if (NULL == node) {
+        node = s->root = sorted_node(1);
+    } else if (node->count == SORTED_MAX) {
+        SortedNode *root = sorted_node(0);
+        root->children[0] = node;
+        sorted_split(root, 0);
+        node = s->root = root;
+    }
+    for (;;) {
+        int32_t i = sorted_search(node, key, 0);
+        if (i < node->count && !janet_compare(node->kvs[i].key, key)) {
+            node->kvs[i].value = value;
+            return;
+        }
+        if (node->leaf) {
+            memmove(node->kvs + i + 1, node->kvs + i, (node->count - i) * sizeof(JanetKV));
+            node->kvs[i].key = key;
+            node->kvs[i].value = value;
+            node->count++;
+            s->count++;
+            return;
+        }
+        if (node->children[i]->count == SORTED_MAX) {
+            int c;
+            sorted_split(node, i);
+            c = janet_compare(key, node->kvs[i].key);
+            if (c == 0) {
+                node->kvs[i].value = value;
+                return;
+            }
+            if (c > 0) i++;
+        }
+        node = node->children[i];
+    }
+}
+
+/* Deletion */
+
+/* Merge child i + 1 of node and the entry between them into child i */
+static void sorted_merge(SortedNode *node, int32_t i) {
+    SortedNode *left = node->children[i];
+    SortedNode *right = node->children[i + 1];
+    left->kvs[left->count] = node->kvs[i];
+    memcpy(left->kvs + left->count + 1, right->kvs, right->count * sizeof(JanetKV));
+    if (!left->leaf)
+        memcpy(left->children + left->count + 1, right->children,
+               (right->count + 1) * sizeof(SortedNode *));
+    left->count += right->count + 1;
+    free(right);
+    memmove(node->kvs + i, node->kvs + i + 1, (node->count - i - 1) * sizeof(JanetKV));
+    memmove(node->children + i + 1, node->children + i + 2,
+            (node->count - i - 1) * sizeof(SortedNode *));
+    node->count--;
+}
+
+/* Make sure child i of node has more than SORTED_MIN entries, by taking
+ * an entry from a sibling or merging with one. Returns the index of the
+ * child that now covers the keys of child i. */
+static int32_t sorted_fill(SortedNode *node, int32_t i) {
+    SortedNode *child = node->children[i];
+    if (i > 0 && node->children[i - 1]->count > SORTED_MIN) {
+        SortedNode *left = node->children[i - 1];
+        memmove(child->kvs + 1, child->kvs, child->count * sizeof(JanetKV));
+        if (!child->leaf)
+            memmove(child->children + 1, child->children,
+                    (child->count + 1) * sizeof(SortedNode *));
+        child->kvs[0] = node->kvs[i - 1];
+        if (!child->leaf)
+            child->children[0] = left->children[left->count];
+        node->kvs[i - 1] = left->kvs[left->count - 1];
+        left->count--;
+        child->count++;
+    } else if (i < node->count && node->children[i + 1]->count > SORTED_MIN) {
+        SortedNode *right = node->children[i + 1];
+        child->kvs[child->count] = node->kvs[i];
+        if (!child->leaf)
+            child->children[child->count + 1] = right->children[0];
+        node->kvs[i] = right->kvs[0];
+        memmove(right->kvs, right->kvs + 1, (right->count - 1) * sizeof(JanetKV));
+        if (!right->leaf)
+            memmove(right->children, right->children + 1, right->count * sizeof(SortedNode *));
+        right->count--;
+        child->count++;
+    } else if (i < node->count) {
+        sorted_merge(node, i);
+    } else {
+        sorted_merge(node, --i);
+    }
+    return i;
+}
+
+/* Remove key from the subtree at node, which has more than SORTED_MIN
+ * entries unless it is the root. Returns 1 if the key was found. */
+static int sorted_delete(SortedNode *node, Janet key) {
+    for (;;) {
+        int32_t i = sorted_search(node, key, 0);
+        if (i < node->count && !janet_compare(node->kvs[i].key, key)) {
+            if (node->leaf) {
+                memmove(node->kvs + i, node->kvs + i + 1, (node->count - i - 1) * sizeof(JanetKV));
+                node->count--;
+                return 1;
+            }
+            if (node->children[i]->count > SORTED_MIN) {
+                /* Replace with the greatest entry before it */
+                SortedNode *pred = node->children[i];
+                while (!pred->leaf) pred = pred->children[pred->count];
+                node->kvs[i] = pred->kvs[pred->count - 1];
+                key = node->kvs[i].key;
+                node = node->children[i];
+            } else if (node->children[i + 1]->count > SORTED_MIN) {
+                /* Replace with the least entry after it */
+                SortedNode *succ = node->children[i + 1];
+                while (!succ->leaf) succ = succ->children[0];
+                node->kvs[i] = succ->kvs[0];
+                key = node->kvs[i].key;
+                node = node->children[i + 1];
+            } else {
+                sorted_merge(node, i);
+                node = node->children[i];
+            }
+            continue;
+        }
+        if (node->leaf) return 0;
+        if (node->children[i]->count == SORTED_MIN)
+            i = sorted_fill(node, i);
+        node = node->children[i];
+    }
+}
+
+static int sorted_remove(JanetSorted *s, Janet key) {
+    SortedNode *root = s->root;
+    int found;
+    if (NULL == root) return 0;
+    found = sorted_delete(root, key);
+    if (found) s->count--;
+    /* Merges on the way down can empty the root */
+    if (root->count == 0) {
+        s->root = root->leaf ? NULL : root->children[0];
+        free(root);
+    }
+    return found;
+}
+
+/* Push the keys in [lo, hi) of the subtree at node onto keys. A nil
+ * bound is unbounded. Returns 1 once a key not less than hi is seen. */
+static int sorted_range(const SortedNode *node, Janet lo, Janet hi, JanetArray *keys) {
+    int32_t i = janet_checktype(lo, JANET_NIL) ? 0 : sorted_search(node, lo, 0);
+    for (; i <= node->count; i++) {
+        if (!node->leaf && sorted_range(node->children[i], lo, hi, keys)) return 1;
+        if (i == node->count) break;
+        if (!janet_checktype(hi, JANET_NIL) && janet_compare(node->kvs[i].key, hi) >= 0) return 1;
+        janet_array_push(keys, node->kvs[i].key);
+    }
+    return 0;
+}
+
+/* Abstract type methods */
+
+static int sorted_gc(void *p, size_t size) {
+    JanetSorted *s = (JanetSorted *) p;
+    (void) size;
+    if (NULL != s->root) sorted_free(s->root);
+    s->root = NULL;
+    return 0;
+}
+
+static void sorted_mark_node(const SortedNode *node) {
+    int32_t i;
+    for (i = 0; i < node->count; i++) {
+        janet_mark(node->kvs[i].key);
+        janet_mark(node->kvs[i].value);
+    }
+    if (!node->leaf)
+        for (i = 0; i <= node->count; i++)
+            sorted_mark_node(node->children[i]);
+}
+
+static int sorted_gcmark(void *p, size_t size) {
+    JanetSorted *s = (JanetSorted *) p;
+    (void) size;
+    if (NULL != s->root) sorted_mark_node(s->root);
+    return 0;
+}
+
+static Janet sorted_get(void *p, Janet key) {
+    JanetKV *kv = sorted_find((JanetSorted *) p, key);
+    return NULL == kv ? janet_wrap_nil() : kv->value;
+}
+
+static void sorted_put(void *p, Janet key, Janet value) {
+    JanetSorted *s = (JanetSorted *) p;
+    if (janet_checktype(key, JANET_NIL)) janet_panic("cannot have nil key");
+    if (janet_checktype(key, JANET_NUMBER) && isnan(janet_unwrap_number(key)))
+        janet_panic("cannot have NaN key");
+    if (janet_checktype(value, JANET_NIL)) {
+        sorted_remove(s, key);
+    } else {
+        janet_gc_barrier(janet_abstract_header(p));
+        sorted_insert(s, key, value);
+    }
+}
+
+static Janet sorted_next(void *p, Janet key) {
+    JanetSorted *s = (JanetSorted *) p;
+    JanetKV *kv = janet_checktype(key, JANET_NIL)
+                  ? sorted_end(s, 0)
+                  : sorted_above(s, key, 0);
+    return NULL == kv ? janet_wrap_nil() : kv->key;
+}
+
+static int32_t sorted_length(void *p, size_t size) {
+    (void) size;
+    return ((JanetSorted *) p)->count;
+}
+
+static void sorted_marshal_node(const SortedNode *node, JanetMarshalContext *ctx) {
+    int32_t i;
+    for (i = 0; i <= node->count; i++) {
+        if (!node->leaf) sorted_marshal_node(node->children[i], ctx);
+        if (i == node->count) break;
+        janet_marshal_janet(ctx, node->kvs[i].key);
+        janet_marshal_janet(ctx, node->kvs[i].value);
+    }
+}
+
+static void sorted_marshal(void *p, JanetMarshalContext *ctx) {
+    JanetSorted *s = (JanetSorted *) p;
+    janet_marshal_int(ctx, s->count);
+    if (NULL != s->root) sorted_marshal_node(s->root, ctx);
+}
+
+static void sorted_unmarshal(void *p, JanetMarshalContext *ctx) {
+    JanetSorted *s = (JanetSorted *) p;
+    int32_t i, count;
+    s->root = NULL;
+    s->count = 0;
+    janet_unmarshal_int(ctx, &count);
+    for (i = 0; i < count; i++) {
+        Janet key, value;
+        janet_unmarshal_janet(ctx, &key);
+        janet_unmarshal_janet(ctx, &value);
+        sorted_insert(s, key, value);
+    }
+}
+
+/* C API */
+
+Janet janet_sorted(void) {
+    JanetSorted *s = janet_abstract(&janet_sorted_type, sizeof(JanetSorted));
+    s->root = NULL;
+    s->count = 0;
+    return janet_wrap_abstract(s);
+}
+
+/* C functions */
+
+static JanetSorted *sorted_getmap(const Janet *argv, int32_t n) {
+    return (JanetSorted *) janet_getabstract(argv, n, &janet_sorted_type);
+}
+
+static Janet sorted_wrapkey(const JanetKV *kv) {
+    return NULL == kv ? janet_wrap_nil() : kv->key;
+}
+
+static Janet cfun_sorted_new(int32_t argc, Janet *argv) {
+    int32_t i;
+    if (argc & 1)
+        janet_panic("expected even number of arguments");
+    Janet s = janet_sorted();
+    for (i = 0; i < argc; i += 2)
+        sorted_put(janet_unwrap_abstract(s), argv[i], argv[i + 1]);
+    return s;
+}
+
+static Janet cfun_sorted_remove(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    sorted_remove(sorted_getmap(argv, 0), argv[1]);
+    return argv[0];
+}
+
+static Janet cfun_sorted_floor(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    return sorted_wrapkey(sorted_floor(sorted_getmap(argv, 0), argv[1]));
+}
+
+static Janet cfun_sorted_ceil(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    return sorted_wrapkey(sorted_above(sorted_getmap(argv, 0), argv[1], 1));
+}
+
+static Janet cfun_sorted_first(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    return sorted_wrapkey(sorted_end(sorted_getmap(argv, 0), 0));
+}
+
+static Janet cfun_sorted_last(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    return sorted_wrapkey(sorted_end(sorted_getmap(argv, 0), 1));
+}
+
+static Janet cfun_sorted_range(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 3);
+    JanetSorted *s = sorted_getmap(argv, 0);
+    Janet lo = argc > 1 ? argv[1] : janet_wrap_nil();
+    Janet hi = argc > 2 ? argv[2] : janet_wrap_nil();
+    JanetArray *keys = janet_array(0);
+    if (NULL != s->root) sorted_range(s->root, lo, hi, keys);
+    return janet_wrap_array(keys);
+}
+
+static const JanetReg sorted_cfuns[] = {
+    {
+        "sorted/new", cfun_sorted_new,
+        JDOC("(sorted/new & kvs)\n\n"
+             "Create a new sorted map from a sequence of keys and values. A sorted "
+             "map is like a table, but keeps its keys in order, so next, keys and each "
+             "visit them from least to greatest. Keys are ordered like with compare. "
+             "Getting, putting and removing a key take O(log n) time. Use put with a "
+             "value of true to use a sorted map as a sorted set.")
+    },
+    {
+        "sorted/remove", cfun_sorted_remove,
+        JDOC("(sorted/remove map key)\n\n"
+             "Remove a key from a sorted map. Returns the map.")
+    },
+    {
+        "sorted/floor", cfun_sorted_floor,
+        JDOC("(sorted/floor map key)\n\n"
+             "Returns the greatest key in map that is not greater than key, or nil.")
+    },
+    {
+        "sorted/ceil", cfun_sorted_ceil,
+        JDOC("(sorted/ceil map key)\n\n"
+             "Returns the least key in map that is not less than key, or nil.")
+    },
+    {
+        "sorted/first", cfun_sorted_first,
+        JDOC("(sorted/first map)\n\n"
+             "Returns the least key in map, or nil if map is empty.")
+    },
+    {
+        "sorted/last", cfun_sorted_last,
+        JDOC("(sorted/last map)\n\n"
+             "Returns the greatest key in map, or nil if map is empty.")
+    },
+    {
+        "sorted/range", cfun_sorted_range,
+        JDOC("(sorted/range map &opt lo hi)\n\n"
+             "Returns an array of the keys in map that are not less than lo and less "
+             "than hi, in order. A nil bound includes all keys on that side.")
+    },
+    {NULL, NULL, NULL}
+};
+
+/* Load the sorted map module */
+void janet_lib_sorted(JanetTable *env) {
+    janet_core_cfuns(env, NULL, sorted_cfuns);
+    janet_register_abstract_type(&janet_sorted_type);
+}
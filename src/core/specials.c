@@ -82,12 +82,11 @@ static JanetSlot quasiquote(JanetFopts opts, Janet x) {
         }
         case JANET_TABLE:
         case JANET_STRUCT: {
-            const JanetKV *kv = NULL, *kvs = NULL;
-            int32_t len, cap;
-            janet_dictionary_view(x, &kvs, &len, &cap);
-            while ((kv = janet_dictionary_next(kvs, cap, kv))) {
-                JanetSlot key = quasiquote(opts, kv->key);
-                JanetSlot value =  quasiquote(opts, kv->value);
+            int32_t i = 0;
+            Janet k, v;
+            while (janet_dictionary_iter(x, &i, &k, &v)) {
+                JanetSlot key = quasiquote(opts, k);
+                JanetSlot value =  quasiquote(opts, v);
                 key.flags &= ~JANET_SLOT_SPLICED;
                 value.flags &= ~JANET_SLOT_SPLICED;
                 janet_v_push(slots, key);
@@ -153,15 +152,13 @@ static int destructure(JanetCompiler *c,
         return 1;
         case JANET_TABLE:
         case JANET_STRUCT: {
-            const JanetKV *kvs = NULL;
-            int32_t i, cap, len;
-            janet_dictionary_view(left, &kvs, &len, &cap);
-            for (i = 0; i < cap; i++) {
-                if (janet_checktype(kvs[i].key, JANET_NIL)) continue;
+            int32_t i = 0;
+            Janet key, value;
+            while (janet_dictionary_iter(left, &i, &key, &value)) {
                 JanetSlot nextright = janetc_farslot(c);
-                JanetSlot k = janetc_value(janetc_fopts_default(c), kvs[i].key);
+                JanetSlot k = janetc_value(janetc_fopts_default(c), key);
                 janetc_emit_sss(c, JOP_GET, nextright, right, k, 1);
-                if (destructure(c, kvs[i].value, nextright, leaf, attr))
+                if (destructure(c, value, nextright, leaf, attr))
                     janetc_freeslot(c, nextright);
             }
         }
@@ -196,6 +193,11 @@ static JanetSlot janetc_varset(JanetFopts opts, int32_t argn, const Janet *argv)
         subopts.hint = dest;
         JanetSlot ret = janetc_value(subopts, argv[1]);
         janetc_copy(opts.compiler, dest, ret);
+        if (janetc_isnumber(ret)) {
+            janetc_knownumber(opts.compiler, dest);
+        } else {
+            janetc_forgetnumber(opts.compiler, dest);
+        }
         return ret;
     } else if (janet_checktype(argv[0], JANET_TUPLE)) {
         /* Set a field (setf behavior) - (set (tab :key) 2) */
@@ -261,6 +263,7 @@ static int namelocal(JanetCompiler *c, const uint8_t *head, int32_t flags, Janet
     int isUnnamedRegister = !(ret.flags & JANET_SLOT_NAMED) &&
                             ret.index > 0 &&
                             ret.envindex >= 0;
+    int isnumber = janetc_isnumber(ret);
     if (!isUnnamedRegister) {
         /* Slot is not able to be named */
         JanetSlot localslot = janetc_farslot(c);
@@ -268,6 +271,13 @@ static int namelocal(JanetCompiler *c, const uint8_t *head, int32_t flags, Janet
         ret = localslot;
     }
     ret.flags |= flags;
+    if (isnumber && !(flags & JANET_SLOT_MUTABLE)) {
+        ret.flags = (ret.flags & ~JANET_SLOTTYPE_ANY) | JANET_TFLAG_NUMBER;
+    } else if (isnumber) {
+        /* Vars may be set to other types later */
+        ret.flags |= JANET_SLOT_NAMED;
+        janetc_knownumber(c, ret);
+    }
     janetc_nameslot(c, head, ret);
     return !isUnnamedRegister;
 }
@@ -495,7 +505,7 @@ static JanetSlot janetc_while(JanetFopts opts, int32_t argn, const Janet *argv)
 
     labelwt = janet_v_count(c->buffer);
 
-    janetc_scope(&tempscope, c, 0, "while");
+    janetc_scope(&tempscope, c, JANET_SCOPE_WHILE, "while");
 
     /* Compile condition */
     cond = janetc_value(subopts, argv[0]);
@@ -530,7 +540,7 @@ static JanetSlot janetc_while(JanetFopts opts, int32_t argn, const Janet *argv)
         janet_v__cnt(c->buffer) = labelwt;
         janet_v__cnt(c->mapbuffer) = labelwt;
 
-        janetc_scope(&tempscope, c, JANET_SCOPE_FUNCTION, "while-iife");
+        janetc_scope(&tempscope, c, JANET_SCOPE_FUNCTION | JANET_SCOPE_NOESCAPE, "while-iife");
 
         /* Recompile in the function scope */
         cond = janetc_value(subopts, argv[0]);
@@ -556,7 +566,6 @@ static JanetSlot janetc_while(JanetFopts opts, int32_t argn, const Janet *argv)
         janetc_emit(c, JOP_CLOSURE | (cloreg << 8) | (defindex << 16));
         janetc_emit(c, JOP_CALL | (cloreg << 8) | (cloreg << 16));
         janetc_regalloc_free(&c->scope->ra, cloreg);
-        c->scope->flags |= JANET_SCOPE_CLOSURE;
         return janetc_cslot(janet_wrap_nil());
     }
 
@@ -593,7 +602,6 @@ static JanetSlot janetc_fn(JanetFopts opts, int32_t argn, const Janet *argv) {
     int seenamp = 0;
 
     /* Begin function */
-    c->scope->flags |= JANET_SCOPE_CLOSURE;
     janetc_scope(&fnscope, c, JANET_SCOPE_FUNCTION, "function");
 
     if (argn < 2) {
@@ -608,6 +616,10 @@ static JanetSlot janetc_fn(JanetFopts opts, int32_t argn, const Janet *argv) {
         selfref = 1;
         parami = 1;
     }
+
+    /* A function that can refer to itself may return itself */
+    if ((opts.flags & JANET_FOPTS_NOESCAPE) && !selfref)
+        fnscope.flags |= JANET_SCOPE_NOESCAPE;
     if (parami >= argn || !janet_checktype(argv[parami], JANET_TUPLE)) {
         errmsg = "expected function parameters";
         goto error;
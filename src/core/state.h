@@ -48,6 +48,12 @@ extern JANET_THREAD_LOCAL Janet *janet_vm_return_reg;
  * along with otherwise bare c function pointers. */
 extern JANET_THREAD_LOCAL JanetTable *janet_vm_registry;
 
+/* Bumped to invalidate the vm's inline caches for table lookups */
+extern JANET_THREAD_LOCAL uint32_t janet_vm_table_epoch;
+
+/* Interned key tuples shared by shaped tables */
+extern JANET_THREAD_LOCAL JanetTable *janet_vm_shapes;
+
 /* Immutable value cache */
 extern JANET_THREAD_LOCAL const uint8_t **janet_vm_cache;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_cache_capacity;
@@ -56,10 +62,15 @@ extern JANET_THREAD_LOCAL uint32_t janet_vm_cache_deleted;
 
 /* Garbage collection */
 extern JANET_THREAD_LOCAL void *janet_vm_blocks;
+extern JANET_THREAD_LOCAL void *janet_vm_young_blocks;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_gc_interval;
+extern JANET_THREAD_LOCAL uint32_t janet_vm_gc_step;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_next_collection;
 extern JANET_THREAD_LOCAL int janet_vm_gc_suspend;
 
+/* Allocation profiler. Every nth allocation is recorded, 0 is off. */
+extern JANET_THREAD_LOCAL uint32_t janet_vm_alloc_sample;
+
 /* GC roots */
 extern JANET_THREAD_LOCAL Janet *janet_vm_roots;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_root_count;
@@ -24,33 +24,153 @@
 #include <janet.h>
 #include "gc.h"
 #include "util.h"
+#include "state.h"
 #include <math.h>
+#include <string.h>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define JANET_TABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+JANET_THREAD_LOCAL uint32_t janet_vm_table_epoch = 0;
+JANET_THREAD_LOCAL JanetTable *janet_vm_shapes = NULL;
+
+/* Call before changing the set of keys or the prototype of a table. If
+ * an inline cache depends on the table, invalidate all inline caches. */
+#define janet_table_touch(t) do { \
+    if ((t)->gc.flags & JANET_MEM_CACHED) janet_vm_table_epoch++; \
+} while (0)
+
+/* Buckets are probed in groups of JANET_TABLE_GROUP. After the buckets,
+ * in the same allocation, each table keeps one control byte per bucket.
+ * A control byte holds the top 7 bits of the hash of the key in the
+ * bucket, or marks the bucket as empty or deleted, so a whole group can
+ * be checked for a key with a few instructions before comparing any
+ * keys. Tables smaller than a group still get a full group of control
+ * bytes, and the extra bytes are always empty. */
+#define JANET_TABLE_GROUP 16
+#define JANET_CTRL_EMPTY 0x80
+#define JANET_CTRL_DELETED 0xFE
+#define janet_table_ctrl(t) ((uint8_t *)((t)->data + (t)->capacity))
+#define janet_ctrl_size(cap) ((cap) < JANET_TABLE_GROUP ? JANET_TABLE_GROUP : (cap))
+
+/* Get a bitmask of the bytes in a group equal to c */
+static uint32_t janet_group_match(const uint8_t *group, uint8_t c) {
+#ifdef JANET_TABLE_SSE2
+    __m128i g = _mm_loadu_si128((const __m128i *) group);
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char) c)));
+#else
+    uint32_t mask = 0;
+    int i;
+    for (i = 0; i < JANET_TABLE_GROUP; i++)
+        if (group[i] == c) mask |= 1u << i;
+    return mask;
+#endif
+}
+
+/* Get a bitmask of the empty or deleted bytes in a group */
+static uint32_t janet_group_free(const uint8_t *group) {
+#ifdef JANET_TABLE_SSE2
+    return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) group));
+#else
+    uint32_t mask = 0;
+    int i;
+    for (i = 0; i < JANET_TABLE_GROUP; i++)
+        if (group[i] & 0x80) mask |= 1u << i;
+    return mask;
+#endif
+}
+
+/* Index of the lowest set bit of a non-zero mask */
+static int janet_group_first(uint32_t mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int i = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+
+/* Hash a key. The top 7 bits go to the control byte, and the low bits
+ * select the first group to probe. */
+static uint32_t janet_table_hash(Janet key) {
+    return (uint32_t) janet_hash(key);
+}
+
+/* Allocate buckets and control bytes for a table, all empty */
+static JanetKV *janet_table_alloc(int32_t capacity) {
+    JanetKV *data = malloc(capacity * sizeof(JanetKV) + janet_ctrl_size(capacity));
+    if (NULL == data) {
+        JANET_OUT_OF_MEMORY;
+    }
+    janet_memempty(data, capacity);
+    memset(data + capacity, JANET_CTRL_EMPTY, janet_ctrl_size(capacity));
+    return data;
+}
+
+/* Find the bucket that contains a key, or the first free bucket on the
+ * probe sequence for the key. Groups are probed in triangular order,
+ * which visits every group once. The probe stops at the first group with
+ * an empty bucket, as the key could not have been placed after it. */
+static JanetKV *janet_table_probe(JanetTable *t, Janet key, uint32_t hash) {
+    uint8_t *ctrl = janet_table_ctrl(t);
+    uint8_t h2 = (uint8_t)(hash >> 25);
+    uint32_t ngroups = (t->capacity + JANET_TABLE_GROUP - 1) / JANET_TABLE_GROUP;
+    uint32_t valid = t->capacity < JANET_TABLE_GROUP ? (1u << t->capacity) - 1 : 0xFFFF;
+    uint32_t g = hash & (ngroups - 1);
+    uint32_t step;
+    JanetKV *first = NULL;
+    for (step = 1; step <= ngroups; step++) {
+        const uint8_t *group = ctrl + g * JANET_TABLE_GROUP;
+        JanetKV *buckets = t->data + g * JANET_TABLE_GROUP;
+        uint32_t mask = janet_group_match(group, h2);
+        while (mask) {
+            JanetKV *kv = buckets + janet_group_first(mask);
+            if (janet_equals(kv->key, key)) return kv;
+            mask &= mask - 1;
+        }
+        if (NULL == first) {
+            mask = janet_group_free(group) & valid;
+            if (mask) first = buckets + janet_group_first(mask);
+        }
+        if (janet_group_match(group, JANET_CTRL_EMPTY)) break;
+        g = (g + step) & (ngroups - 1);
+    }
+    return first;
+}
+
 /* Initialize a table */
 JanetTable *janet_table_init(JanetTable *table, int32_t capacity) {
-    JanetKV *data;
     capacity = janet_tablen(capacity);
     if (capacity) {
-        data = (JanetKV *) janet_memalloc_empty(capacity);
-        if (NULL == data) {
-            JANET_OUT_OF_MEMORY;
-        }
-        table->data = data;
+        table->data = janet_table_alloc(capacity);
         table->capacity = capacity;
     } else {
         table->data = NULL;
         table->capacity = 0;
     }
+    table->gc.flags &= ~(JANET_MEM_OLD | JANET_MEM_REMEMBERED);
     table->count = 0;
     table->deleted = 0;
     table->proto = NULL;
+    table->shape = NULL;
+    table->array = NULL;
+    table->acapacity = 0;
+    table->acount = 0;
     return table;
 }
 
 /* Deinitialize a table */
 void janet_table_deinit(JanetTable *table) {
+    janet_table_touch(table);
     free(table->data);
+    free(table->array);
 }
 
 /* Create a new table */
@@ -59,29 +179,218 @@ JanetTable *janet_table(int32_t capacity) {
     return janet_table_init(table, capacity);
 }
 
+/* Array part
+ *
+ * Integer keys from 0 to acapacity - 1 are kept in a plain array of
+ * values, with nil for missing keys, instead of in the buckets, so
+ * tables used as arrays or as maps of small ids do not hash their keys.
+ * When an integer key just past the array part is put, the array part
+ * grows to the next power of two above the key, if it would be at
+ * least half full, and integer keys in the new range move out of the
+ * buckets. A key is never in both the array part and the buckets. */
+
+#define JANET_TABLE_AMIN 4
+#define JANET_TABLE_AMAX 0x40000000
+
+/* Get the index of a key in the array part, or -1 */
+static int32_t janet_table_aindex(const JanetTable *t, Janet key) {
+    if (!janet_checktype(key, JANET_NUMBER)) return -1;
+    double d = janet_unwrap_number(key);
+    if (!(d >= 0 && d < t->acapacity)) return -1;
+    int32_t index = (int32_t) d;
+    return (double) index == d ? index : -1;
+}
+
+/* Empty a bucket */
+static void janet_table_clear_bucket(JanetTable *t, JanetKV *bucket) {
+    int32_t index = (int32_t)(bucket - t->data);
+    uint8_t *group = janet_table_ctrl(t) + (index & ~(JANET_TABLE_GROUP - 1));
+    t->count--;
+    bucket->key = janet_wrap_nil();
+    /* A group that still has an empty bucket never made a probe move
+     * on to the next group, so the bucket can become empty again. */
+    if (janet_group_match(group, JANET_CTRL_EMPTY)) {
+        janet_table_ctrl(t)[index] = JANET_CTRL_EMPTY;
+        bucket->value = janet_wrap_nil();
+    } else {
+        janet_table_ctrl(t)[index] = JANET_CTRL_DELETED;
+        bucket->value = janet_wrap_false();
+        t->deleted++;
+    }
+}
+
+/* Grow the array part to hold an integer key if it would be at least
+ * half full. Returns 1 if the key now belongs in the array part. */
+static int janet_table_agrow(JanetTable *t, Janet key) {
+    int32_t i, index, capacity, oldcapacity = t->acapacity;
+    if (!janet_checktype(key, JANET_NUMBER)) return 0;
+    double d = janet_unwrap_number(key);
+    if (!(d >= oldcapacity && d < JANET_TABLE_AMAX)) return 0;
+    index = (int32_t) d;
+    if ((double) index != d) return 0;
+    capacity = janet_tablen(index);
+    if (capacity < JANET_TABLE_AMIN) capacity = JANET_TABLE_AMIN;
+    if (capacity > JANET_TABLE_AMIN && 2 * (t->acount + 1) < capacity) return 0;
+    janet_table_unshape(t);
+    Janet *array = realloc(t->array, capacity * sizeof(Janet));
+    if (NULL == array) {
+        JANET_OUT_OF_MEMORY;
+    }
+    for (i = oldcapacity; i < capacity; i++)
+        array[i] = janet_wrap_nil();
+    t->array = array;
+    t->acapacity = capacity;
+    /* Move integer keys in the new range out of the buckets */
+    if (t->count > t->acount && t->capacity) {
+        for (i = oldcapacity; i < capacity; i++) {
+            Janet k = janet_wrap_integer(i);
+            JanetKV *bucket = janet_table_probe(t, k, janet_table_hash(k));
+            if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+                array[i] = bucket->value;
+                janet_table_clear_bucket(t, bucket);
+                t->count++;
+                t->acount++;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Shapes
+ *
+ * Most tables built from literals are records with the same few keyword
+ * keys. Such a table shares the tuple of its keys, its shape, with all
+ * other tables built with the same keys in the same order, and keeps
+ * only its values, in a dense array right after the table header. A key
+ * is found by scanning the shape, and the vm caches the slot of a key
+ * per shape. When the set of keys changes, or code needs the buckets of
+ * the table, the table moves its pairs into buckets and drops its shape.
+ * A shaped table has no buckets, and a value for every key in its shape. */
+
+#define JANET_SHAPE_MAX 16
+#define JANET_SHAPE_LIMIT 4096
+
+/* Get the interned shape for the keys of a literal table, or NULL if the
+ * table should not be shaped */
+const Janet *janet_table_shape(const Janet *kvs, int32_t count) {
+    int32_t i, j, n = count / 2;
+    if ((count & 1) || n < 1 || n > JANET_SHAPE_MAX) return NULL;
+    for (i = 0; i < n; i++) {
+        if (!janet_checktype(kvs[2 * i], JANET_KEYWORD) ||
+                janet_checktype(kvs[2 * i + 1], JANET_NIL))
+            return NULL;
+        for (j = 0; j < i; j++)
+            if (janet_equals(kvs[2 * j], kvs[2 * i])) return NULL;
+    }
+    Janet *keys = janet_tuple_begin(n);
+    for (i = 0; i < n; i++)
+        keys[i] = kvs[2 * i];
+    Janet shape = janet_wrap_tuple(janet_tuple_end(keys));
+    Janet interned = janet_table_get(janet_vm_shapes, shape);
+    if (!janet_checktype(interned, JANET_NIL)) return janet_unwrap_tuple(interned);
+    if (janet_vm_shapes->count >= JANET_SHAPE_LIMIT) return NULL;
+    janet_table_put(janet_vm_shapes, shape, shape);
+    return janet_unwrap_tuple(shape);
+}
+
+/* Check if the keys and values of a literal table fit a shape */
+int janet_shape_fits(const Janet *shape, const Janet *kvs, int32_t count) {
+    int32_t i, n = janet_tuple_length(shape);
+    if (count != 2 * n) return 0;
+    for (i = 0; i < n; i++) {
+        if (!janet_equals(shape[i], kvs[2 * i]) ||
+                janet_checktype(kvs[2 * i + 1], JANET_NIL))
+            return 0;
+    }
+    return 1;
+}
+
+/* Get the slot of a key in a shape, or -1. Shapes only hold keywords,
+ * which are interned, so keys are compared by pointer. */
+int32_t janet_shape_slot(const Janet *shape, Janet key) {
+    int32_t i, n = janet_tuple_length(shape);
+    if (!janet_checktype(key, JANET_KEYWORD)) return -1;
+    const uint8_t *kw = janet_unwrap_keyword(key);
+    for (i = 0; i < n; i++)
+        if (janet_unwrap_keyword(shape[i]) == kw) return i;
+    return -1;
+}
+
+/* Create a table with a shape from the keys and values of a literal */
+JanetTable *janet_table_shaped(const Janet *shape, const Janet *kvs) {
+    int32_t i, n = janet_tuple_length(shape);
+    JanetTable *table = janet_gcalloc(JANET_MEMORY_TABLE, sizeof(JanetTable) + n * sizeof(Janet));
+    /* Like the buckets of other tables, the slots do not count towards
+     * the next collection */
+    janet_vm_next_collection -= n * sizeof(Janet);
+    janet_table_init(table, 0);
+    Janet *slots = janet_table_slots(table);
+    for (i = 0; i < n; i++)
+        slots[i] = kvs[2 * i + 1];
+    table->shape = shape;
+    table->count = n;
+    return table;
+}
+
+/* Move the pairs of a shaped table into buckets */
+void janet_table_unshape(JanetTable *t) {
+    const Janet *shape = t->shape;
+    if (NULL == shape) return;
+    int32_t i, n = t->count;
+    Janet *slots = janet_table_slots(t);
+    t->shape = NULL;
+    t->count = 0;
+    t->capacity = janet_tablen(2 * n);
+    t->data = janet_table_alloc(t->capacity);
+    for (i = 0; i < n; i++)
+        janet_table_put(t, shape[i], slots[i]);
+}
+
 /* Find the bucket that contains the given key. Will also return
- * bucket where key should go if not in the table. */
+ * bucket where key should go if not in the table. Keys in the array
+ * part and the shape slots are never in a bucket. */
 JanetKV *janet_table_find(JanetTable *t, Janet key) {
-    return (JanetKV *) janet_dict_find(t->data, t->capacity, key);
+    if (0 == t->capacity) return NULL;
+    return janet_table_probe(t, key, janet_table_hash(key));
 }
 
-/* Resize the dictionary table. */
+/* Get a pointer to the value of a key in a table, or NULL if the key is
+ * not in the table. Does not check prototypes. */
+Janet *janet_table_slot(JanetTable *t, Janet key) {
+    int32_t index = janet_table_aindex(t, key);
+    if (index >= 0)
+        return janet_checktype(t->array[index], JANET_NIL) ? NULL : t->array + index;
+    if (NULL != t->shape) {
+        int32_t slot = janet_shape_slot(t->shape, key);
+        return slot < 0 ? NULL : janet_table_slots(t) + slot;
+    }
+    if (0 == t->capacity) return NULL;
+    JanetKV *bucket = janet_table_probe(t, key, janet_table_hash(key));
+    return (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) ? &bucket->value : NULL;
+}
+
+/* Resize the dictionary table. Keys are known to be distinct, so each
+ * one goes in the first free bucket of its probe sequence. */
 static void janet_table_rehash(JanetTable *t, int32_t size) {
     JanetKV *olddata = t->data;
-    JanetKV *newdata = (JanetKV *) janet_memalloc_empty(size);
-    if (NULL == newdata) {
-        JANET_OUT_OF_MEMORY;
-    }
-    int32_t i, oldcapacity;
-    oldcapacity = t->capacity;
-    t->data = newdata;
+    int32_t i, oldcapacity = t->capacity;
+    t->data = janet_table_alloc(size);
     t->capacity = size;
     t->deleted = 0;
+    uint8_t *ctrl = janet_table_ctrl(t);
+    uint32_t ngroups = (size + JANET_TABLE_GROUP - 1) / JANET_TABLE_GROUP;
+    uint32_t valid = size < JANET_TABLE_GROUP ? (1u << size) - 1 : 0xFFFF;
     for (i = 0; i < oldcapacity; i++) {
         JanetKV *kv = olddata + i;
         if (!janet_checktype(kv->key, JANET_NIL)) {
-            JanetKV *newkv = janet_table_find(t, kv->key);
-            *newkv = *kv;
+            uint32_t hash = janet_table_hash(kv->key);
+            uint32_t g = hash & (ngroups - 1);
+            uint32_t step = 1, mask;
+            while (!(mask = janet_group_free(ctrl + g * JANET_TABLE_GROUP) & valid))
+                g = (g + step++) & (ngroups - 1);
+            int32_t index = g * JANET_TABLE_GROUP + janet_group_first(mask);
+            ctrl[index] = (uint8_t)(hash >> 25);
+            t->data[index] = *kv;
         }
     }
     free(olddata);
@@ -89,16 +398,16 @@ static void janet_table_rehash(JanetTable *t, int32_t size) {
 
 /* Get a value out of the table */
 Janet janet_table_get(JanetTable *t, Janet key) {
-    JanetKV *bucket = janet_table_find(t, key);
-    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL))
-        return bucket->value;
+    Janet *slot = janet_table_slot(t, key);
+    if (NULL != slot)
+        return *slot;
     /* Check prototypes */
     {
         int i;
         for (i = JANET_MAX_PROTO_DEPTH, t = t->proto; t && i; t = t->proto, --i) {
-            bucket = janet_table_find(t, key);
-            if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL))
-                return bucket->value;
+            slot = janet_table_slot(t, key);
+            if (NULL != slot)
+                return *slot;
         }
     }
     return janet_wrap_nil();
@@ -106,29 +415,62 @@ Janet janet_table_get(JanetTable *t, Janet key) {
 
 /* Get a value out of the table. Don't check prototype tables. */
 Janet janet_table_rawget(JanetTable *t, Janet key) {
-    JanetKV *bucket = janet_table_find(t, key);
-    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL))
-        return bucket->value;
-    else
-        return janet_wrap_nil();
+    Janet *slot = janet_table_slot(t, key);
+    return NULL != slot ? *slot : janet_wrap_nil();
 }
 
 /* Remove an entry from the dictionary. Return the value that
  * was removed. */
 Janet janet_table_remove(JanetTable *t, Janet key) {
+    int32_t index = janet_table_aindex(t, key);
+    if (index >= 0) {
+        if (janet_checktype(t->array[index], JANET_NIL))
+            return janet_wrap_nil();
+        janet_table_touch(t);
+        t->array[index] = janet_wrap_nil();
+        t->count--;
+        t->acount--;
+        return key;
+    }
+    if (NULL != t->shape) {
+        if (janet_shape_slot(t->shape, key) < 0)
+            return janet_wrap_nil();
+        janet_table_unshape(t);
+    }
     JanetKV *bucket = janet_table_find(t, key);
     if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
         Janet ret = bucket->key;
-        t->count--;
-        t->deleted++;
-        bucket->key = janet_wrap_nil();
-        bucket->value = janet_wrap_false();
+        janet_table_touch(t);
+        janet_table_clear_bucket(t, bucket);
         return ret;
     } else {
         return janet_wrap_nil();
     }
 }
 
+/* Put a value into the buckets of a table */
+static void janet_table_put_bucket(JanetTable *t, Janet key, Janet value) {
+    uint32_t hash = janet_table_hash(key);
+    JanetKV *bucket = t->capacity ? janet_table_probe(t, key, hash) : NULL;
+    int32_t count = t->count - t->acount;
+    janet_gc_barrier(t);
+    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+        bucket->value = value;
+    } else {
+        janet_table_touch(t);
+        if (NULL == bucket || 8 * (count + t->deleted + 1) > 7 * t->capacity) {
+            janet_table_rehash(t, janet_tablen(2 * count + 2));
+            bucket = janet_table_probe(t, key, hash);
+        }
+        if (janet_checktype(bucket->value, JANET_FALSE))
+            --t->deleted;
+        janet_table_ctrl(t)[bucket - t->data] = (uint8_t)(hash >> 25);
+        bucket->key = key;
+        bucket->value = value;
+        ++t->count;
+    }
+}
+
 /* Put a value into the object */
 void janet_table_put(JanetTable *t, Janet key, Janet value) {
     if (janet_checktype(key, JANET_NIL)) return;
@@ -136,35 +478,131 @@ void janet_table_put(JanetTable *t, Janet key, Janet value) {
     if (janet_checktype(value, JANET_NIL)) {
         janet_table_remove(t, key);
     } else {
-        JanetKV *bucket = janet_table_find(t, key);
-        if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
-            bucket->value = value;
-        } else {
-            if (NULL == bucket || 2 * (t->count + t->deleted + 1) > t->capacity) {
-                janet_table_rehash(t, janet_tablen(2 * t->count + 2));
+        int32_t index = janet_table_aindex(t, key);
+        if (index >= 0 || janet_table_agrow(t, key)) {
+            if (index < 0) index = janet_table_aindex(t, key);
+            janet_gc_barrier(t);
+            if (janet_checktype(t->array[index], JANET_NIL)) {
+                janet_table_touch(t);
+                t->count++;
+                t->acount++;
             }
-            bucket = janet_table_find(t, key);
-            if (janet_checktype(bucket->value, JANET_FALSE))
-                --t->deleted;
-            bucket->key = key;
-            bucket->value = value;
-            ++t->count;
+            t->array[index] = value;
+            return;
+        }
+        if (NULL != t->shape) {
+            int32_t slot = janet_shape_slot(t->shape, key);
+            if (slot >= 0) {
+                janet_gc_barrier(t);
+                janet_table_slots(t)[slot] = value;
+                return;
+            }
+            janet_table_unshape(t);
+        }
+        janet_table_put_bucket(t, key, value);
+    }
+}
+
+/* Get the key after key in a table, or the first key if key is nil.
+ * Keys in the array part come first and in order. Returns nil after
+ * the last key. */
+Janet janet_table_next(JanetTable *t, Janet key) {
+    int32_t i = 0;
+    const JanetKV *kv, *end;
+    if (!janet_checktype(key, JANET_NIL)) {
+        i = janet_table_aindex(t, key);
+        if (i >= 0) i++;
+    }
+    if (i >= 0) {
+        for (; i < t->acapacity; i++)
+            if (!janet_checktype(t->array[i], JANET_NIL))
+                return janet_wrap_integer(i);
+        key = janet_wrap_nil();
+    }
+    if (NULL != t->shape) {
+        int32_t slot = 0;
+        if (!janet_checktype(key, JANET_NIL)) {
+            slot = janet_shape_slot(t->shape, key);
+            if (slot < 0) return janet_wrap_nil();
+            slot++;
+        }
+        return slot < janet_tuple_length(t->shape) ? t->shape[slot] : janet_wrap_nil();
+    }
+    if (0 == t->capacity) return janet_wrap_nil();
+    if (janet_checktype(key, JANET_NIL)) {
+        kv = t->data;
+    } else {
+        kv = janet_table_probe(t, key, janet_table_hash(key));
+        if (NULL == kv || janet_checktype(kv->key, JANET_NIL)) return janet_wrap_nil();
+        kv++;
+    }
+    for (end = t->data + t->capacity; kv < end; kv++)
+        if (!janet_checktype(kv->key, JANET_NIL))
+            return kv->key;
+    return janet_wrap_nil();
+}
+
+/* Get the pair at or after position *index in a table, walking the array
+ * part, the shape slots and then the buckets in place. Start from 0.
+ * Returns 0 after the last pair. */
+int janet_table_iter(JanetTable *t, int32_t *index, Janet *key, Janet *value) {
+    int32_t i = *index;
+    int32_t nslots = NULL == t->shape ? 0 : janet_tuple_length(t->shape);
+    for (; i < t->acapacity; i++) {
+        if (!janet_checktype(t->array[i], JANET_NIL)) {
+            *key = janet_wrap_integer(i);
+            *value = t->array[i];
+            *index = i + 1;
+            return 1;
         }
     }
+    if (i < t->acapacity + nslots) {
+        *key = t->shape[i - t->acapacity];
+        *value = janet_table_slots(t)[i - t->acapacity];
+        *index = i + 1;
+        return 1;
+    }
+    for (; i < t->acapacity + nslots + t->capacity; i++) {
+        const JanetKV *kv = t->data + (i - t->acapacity - nslots);
+        if (!janet_checktype(kv->key, JANET_NIL)) {
+            *key = kv->key;
+            *value = kv->value;
+            *index = i + 1;
+            return 1;
+        }
+    }
+    *index = i;
+    return 0;
 }
 
 /* Clear a table */
 void janet_table_clear(JanetTable *t) {
     int32_t capacity = t->capacity;
     JanetKV *data = t->data;
+    int32_t i;
+    janet_table_touch(t);
+    t->shape = NULL;
+    for (i = 0; i < t->acapacity; i++)
+        t->array[i] = janet_wrap_nil();
+    t->acount = 0;
     janet_memempty(data, capacity);
+    if (capacity) memset(janet_table_ctrl(t), JANET_CTRL_EMPTY, janet_ctrl_size(capacity));
     t->count = 0;
     t->deleted = 0;
 }
 
 /* Convert table to struct */
 const JanetKV *janet_table_to_struct(JanetTable *t) {
+    int32_t i;
     JanetKV *st = janet_struct_begin(t->count);
+    for (i = 0; i < t->acapacity; i++)
+        if (!janet_checktype(t->array[i], JANET_NIL))
+            janet_struct_put(st, janet_wrap_integer(i), t->array[i]);
+    if (NULL != t->shape) {
+        for (i = 0; i < t->count; i++)
+            janet_struct_put(st, t->shape[i], janet_table_slots(t)[i]);
+        return janet_struct_end(st);
+    }
     JanetKV *kv = t->data;
     JanetKV *end = t->data + t->capacity;
     while (kv < end) {
@@ -188,6 +626,15 @@ static void janet_table_mergekv(JanetTable *table, const JanetKV *kvs, int32_t c
 
 /* Merge a table other into another table */
 void janet_table_merge_table(JanetTable *table, JanetTable *other) {
+    int32_t i;
+    for (i = 0; i < other->acapacity; i++)
+        if (!janet_checktype(other->array[i], JANET_NIL))
+            janet_table_put(table, janet_wrap_integer(i), other->array[i]);
+    if (NULL != other->shape) {
+        for (i = 0; i < other->count; i++)
+            janet_table_put(table, other->shape[i], janet_table_slots(other)[i]);
+        return;
+    }
     janet_table_mergekv(table, other->data, other->capacity);
 }
 
@@ -219,6 +666,8 @@ static Janet cfun_table_setproto(int32_t argc, Janet *argv) {
     if (!janet_checktype(argv[1], JANET_NIL)) {
         proto = janet_gettable(argv, 1);
     }
+    janet_table_touch(table);
+    janet_gc_barrier(table);
     table->proto = proto;
     return argv[0];
 }
@@ -129,6 +129,9 @@ static const JanetAbstractType ta_buffer_type = {
     NULL,
     ta_buffer_marshal,
     ta_buffer_unmarshal,
+    NULL,
+    NULL,
+    0
 };
 
 static int ta_mark(void *p, size_t s) {
@@ -260,7 +263,10 @@ BUILD_TYPE(float64)
   ta_get_##type, \
   ta_put_##type, \
   ta_view_marshal, \
-  ta_view_unmarshal \
+  ta_view_unmarshal, \
+  NULL, \
+  NULL, \
+  0 \
 }
 
 static const JanetAbstractType ta_array_types[] = {
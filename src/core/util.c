@@ -93,14 +93,34 @@ const char *const janet_status_names[16] = {
     "alive"
 };
 
-/* Calculate hash for string */
+/* Mix the bits of a 64 bit word into a 32 bit hash. Every input bit
+ * affects every output bit, so keys that differ only in a few high or
+ * low bits, like small integers as doubles or aligned pointers, still
+ * spread over all buckets of a table. */
+int32_t janet_hash_mix(uint64_t x) {
+    x ^= x >> 32;
+    x *= UINT64_C(0xD6E8FEB86659FD93);
+    x ^= x >> 32;
+    x *= UINT64_C(0xD6E8FEB86659FD93);
+    x ^= x >> 32;
+    return (int32_t) x;
+}
 
+/* Calculate hash for string. Reads 8 bytes at a time. */
 int32_t janet_string_calchash(const uint8_t *str, int32_t len) {
-    const uint8_t *end = str + len;
-    uint32_t hash = 5381;
-    while (str < end)
-        hash = (hash << 5) + hash + *str++;
-    return (int32_t) hash;
+    uint64_t hash = UINT64_C(0x9E3779B97F4A7C15) ^ (uint64_t) len;
+    uint64_t word;
+    while (len >= 8) {
+        memcpy(&word, str, sizeof(word));
+        hash = (hash ^ word) * UINT64_C(0xBF58476D1CE4E5B9);
+        hash ^= hash >> 29;
+        str += 8;
+        len -= 8;
+    }
+    word = 0;
+    while (len > 0)
+        word = (word << 8) | str[--len];
+    return janet_hash_mix(hash ^ word);
 }
 
 /* Computes hash of an array of values */
@@ -191,6 +211,28 @@ const JanetKV *janet_dictionary_next(const JanetKV *kvs, int32_t cap, const Jane
     return NULL;
 }
 
+/* Get the pair at or after position *index in a struct or table,
+ * starting from 0. Tables are walked in place, so their layout does not
+ * change. Returns 0 after the last pair. */
+int janet_dictionary_iter(Janet ds, int32_t *index, Janet *key, Janet *value) {
+    if (janet_checktype(ds, JANET_TABLE))
+        return janet_table_iter(janet_unwrap_table(ds), index, key, value);
+    if (janet_checktype(ds, JANET_STRUCT)) {
+        const JanetKV *st = janet_unwrap_struct(ds);
+        int32_t i, cap = janet_struct_capacity(st);
+        for (i = *index; i < cap; i++) {
+            if (!janet_checktype(st[i].key, JANET_NIL)) {
+                *key = st[i].key;
+                *value = st[i].value;
+                *index = i + 1;
+                return 1;
+            }
+        }
+        *index = cap;
+    }
+    return 0;
+}
+
 /* Compare a janet string with a cstring. More efficient than loading
  * c string as a janet string. */
 int janet_cstrcmp(const uint8_t *str, const char *other) {
@@ -286,7 +328,7 @@ void janet_cfuns(JanetTable *env, const char *regprefix, const JanetReg *cfuns)
 
 /* Abstract type introspection */
 
-static const JanetAbstractType type_wrap = {"core/type_info", NULL, NULL, NULL, NULL, NULL, NULL};
+static const JanetAbstractType type_wrap = {"core/type_info", NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0};
 
 typedef struct {
     const JanetAbstractType *at;
@@ -357,8 +399,8 @@ JanetBindingType janet_resolve(JanetTable *env, const uint8_t *sym, Janet *out)
     return JANET_BINDING_DEF;
 }
 
-/* Read both tuples and arrays as c pointers + int32_t length. Return 1 if the
- * view can be constructed, 0 if an invalid type. */
+/* Read both tuples and arrays, or views of them, as c pointers + int32_t length.
+ * Return 1 if the view can be constructed, 0 if an invalid type. */
 int janet_indexed_view(Janet seq, const Janet **data, int32_t *len) {
     if (janet_checktype(seq, JANET_ARRAY)) {
         *data = janet_unwrap_array(seq)->data;
@@ -368,11 +410,13 @@ int janet_indexed_view(Janet seq, const Janet **data, int32_t *len) {
         *data = janet_unwrap_tuple(seq);
         *len = janet_tuple_length(janet_unwrap_tuple(seq));
         return 1;
+    } else if (janet_checktype(seq, JANET_ABSTRACT)) {
+        return janet_view_indexed(seq, data, len);
     }
     return 0;
 }
 
-/* Read both strings and buffer as unsigned character array + int32_t len.
+/* Read both strings and buffer, or views of them, as unsigned character array + int32_t len.
  * Returns 1 if the view can be constructed and 0 if the type is invalid. */
 int janet_bytes_view(Janet str, const uint8_t **data, int32_t *len) {
     if (janet_checktype(str, JANET_STRING) || janet_checktype(str, JANET_SYMBOL) ||
@@ -384,18 +428,24 @@ int janet_bytes_view(Janet str, const uint8_t **data, int32_t *len) {
         *data = janet_unwrap_buffer(str)->data;
         *len = janet_unwrap_buffer(str)->count;
         return 1;
+    } else if (janet_checktype(str, JANET_ABSTRACT)) {
+        return janet_view_bytes(str, data, len);
     }
     return 0;
 }
 
 /* Read both structs and tables as the entries of a hashtable with
  * identical structure. Returns 1 if the view can be constructed and
- * 0 if the type is invalid. */
+ * 0 if the type is invalid. A table with a shape or an array part does
+ * not keep all of its pairs in buckets, so it cannot be viewed and 0 is
+ * returned. Use janet_dictionary_iter to walk any table. */
 int janet_dictionary_view(Janet tab, const JanetKV **data, int32_t *len, int32_t *cap) {
     if (janet_checktype(tab, JANET_TABLE)) {
-        *data = janet_unwrap_table(tab)->data;
-        *cap = janet_unwrap_table(tab)->capacity;
-        *len = janet_unwrap_table(tab)->count;
+        JanetTable *t = janet_unwrap_table(tab);
+        if (NULL != t->shape || NULL != t->array) return 0;
+        *data = t->data;
+        *cap = t->capacity;
+        *len = t->count;
         return 1;
     } else if (janet_checktype(tab, JANET_STRUCT)) {
         *data = janet_unwrap_struct(tab);
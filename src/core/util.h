@@ -41,6 +41,7 @@ extern const char janet_base64[65];
 int32_t janet_array_calchash(const Janet *array, int32_t len);
 int32_t janet_kv_calchash(const JanetKV *kvs, int32_t len);
 int32_t janet_string_calchash(const uint8_t *str, int32_t len);
+int32_t janet_hash_mix(uint64_t x);
 int32_t janet_tablen(int32_t n);
 void janet_buffer_push_types(JanetBuffer *buffer, int types);
 const JanetKV *janet_dict_find(const JanetKV *buckets, int32_t cap, Janet key);
@@ -52,6 +53,21 @@ const void *janet_strbinsearch(
     size_t tabcount,
     size_t itemsize,
     const uint8_t *key);
+/* Shaped tables keep their values after the table header, in the
+ * order of the keys in their shape */
+#define janet_table_slots(t) ((Janet *)((t) + 1))
+const Janet *janet_table_shape(const Janet *kvs, int32_t count);
+int janet_shape_fits(const Janet *shape, const Janet *kvs, int32_t count);
+int32_t janet_shape_slot(const Janet *shape, Janet key);
+JanetTable *janet_table_shaped(const Janet *shape, const Janet *kvs);
+void janet_table_unshape(JanetTable *t);
+Janet janet_table_next(JanetTable *t, Janet key);
+int janet_table_iter(JanetTable *t, int32_t *index, Janet *key, Janet *value);
+Janet *janet_table_slot(JanetTable *t, Janet key);
+int janet_view_bytes(Janet x, const uint8_t **data, int32_t *len);
+int janet_view_indexed(Janet x, const Janet **data, int32_t *len);
+JanetArray *janet_rope_chunks(Janet x);
+
 void janet_buffer_format(
     JanetBuffer *b,
     const char *strfrmt,
@@ -89,6 +105,12 @@ void janet_lib_debug(JanetTable *env);
 #ifdef JANET_PEG
 void janet_lib_peg(JanetTable *env);
 #endif
+void janet_lib_pmap(JanetTable *env);
+void janet_lib_pvec(JanetTable *env);
+void janet_lib_rope(JanetTable *env);
+void janet_lib_set(JanetTable *env);
+void janet_lib_sorted(JanetTable *env);
+void janet_lib_view(JanetTable *env);
 #ifdef JANET_TYPED_ARRAY
 void janet_lib_typed_array(JanetTable *env);
 #endif
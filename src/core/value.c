@@ -22,6 +22,9 @@
 
 #ifndef JANET_AMALG
 #include <janet.h>
+#include "gc.h"
+#include "util.h"
+#include <string.h>
 #endif
 
 /*
@@ -85,20 +88,17 @@ int32_t janet_hash(Janet x) {
         case JANET_STRUCT:
             hash = janet_struct_hash(janet_unwrap_struct(x));
             break;
+        case JANET_NUMBER: {
+            /* 0 and -0 are equal, so they must hash the same */
+            double num = janet_unwrap_number(x);
+            uint64_t bits;
+            if (num == 0) num = 0;
+            memcpy(&bits, &num, sizeof(bits));
+            hash = janet_hash_mix(bits);
+            break;
+        }
         default:
-            /* TODO - test performance with different hash functions */
-            if (sizeof(double) == sizeof(void *)) {
-                /* Assuming 8 byte pointer */
-                uint64_t i = janet_u64(x);
-                hash = (int32_t)(i & 0xFFFFFFFF);
-                /* Get a bit more entropy by shifting the low bits out */
-                hash >>= 3;
-                hash ^= (int32_t)(i >> 32);
-            } else {
-                /* Assuming 4 byte pointer (or smaller) */
-                hash = (int32_t)((char *)janet_unwrap_pointer(x) - (char *)0);
-                hash >>= 2;
-            }
+            hash = janet_hash_mix((uint64_t)(uintptr_t) janet_unwrap_pointer(x));
             break;
     }
     return hash;
@@ -306,6 +306,13 @@ int32_t janet_length(Janet x) {
             return janet_struct_length(janet_unwrap_struct(x));
         case JANET_TABLE:
             return janet_unwrap_table(x)->count;
+        case JANET_ABSTRACT: {
+            void *abst = janet_unwrap_abstract(x);
+            const JanetAbstractType *type = janet_abstract_type(abst);
+            if (NULL == type->length)
+                janet_panicf("expected %T, got %v", JANET_TFLAG_LENGTHABLE, x);
+            return type->length(abst, janet_abstract_size(abst));
+        }
     }
 }
 
@@ -317,6 +324,7 @@ void janet_putindex(Janet ds, int32_t index, Janet value) {
             break;
         case JANET_ARRAY: {
             JanetArray *array = janet_unwrap_array(ds);
+            janet_gc_barrier(array);
             if (index >= array->count) {
                 janet_array_ensure(array, index + 1, 2);
                 array->count = index + 1;
@@ -367,6 +375,7 @@ void janet_put(Janet ds, Janet key, Janet value) {
             if (index >= array->count) {
                 janet_array_setcount(array, index + 1);
             }
+            janet_gc_barrier(array);
             array->data[index] = value;
             break;
         }
@@ -0,0 +1,277 @@
+/*
+* Copyright (c) 2019 Calvin Rose
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to
+* deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+
+#ifndef JANET_AMALG
+#include <janet.h>
+#include "util.h"
+#endif
+
+/* A view is a slice of a string, symbol, keyword, buffer, tuple or array
+ * that does not copy its contents. It keeps its parent alive, and reads
+ * the parent each time it is used, so a view of a buffer or array sees
+ * changes to it. If the parent shrinks, the view is cut short at the end
+ * of the parent. Views of views refer to the original parent. */
+
+typedef struct {
+    Janet parent;
+    int32_t offset;
+    int32_t length;
+} JanetSliceView;
+
+static int view_gcmark(void *p, size_t size);
+static Janet view_get(void *p, Janet key);
+static void view_marshal(void *p, JanetMarshalContext *ctx);
+static void view_unmarshal(void *p, JanetMarshalContext *ctx);
+static Janet view_next(void *p, Janet key);
+static int32_t view_length(void *p, size_t size);
+
+const JanetAbstractType janet_view_type = {
+    "core/view",
+    NULL,
+    view_gcmark,
+    view_get,
+    NULL,
+    view_marshal,
+    view_unmarshal,
+    view_next,
+    view_length,
+    JANET_ABSTRACT_FLAG_BARRIER
+};
+
+/* Get the part of a parent in a view, as bytes or as values */
+static int view_parent_bytes(const JanetSliceView *v, const uint8_t **data, int32_t *len) {
+    const uint8_t *bytes;
+    int32_t count;
+    if (!janet_bytes_view(v->parent, &bytes, &count)) return 0;
+    if (v->offset >= count) {
+        *data = bytes;
+        *len = 0;
+    } else {
+        *data = bytes + v->offset;
+        *len = count - v->offset < v->length ? count - v->offset : v->length;
+    }
+    return 1;
+}
+
+static int view_parent_indexed(const JanetSliceView *v, const Janet **data, int32_t *len) {
+    const Janet *values;
+    int32_t count;
+    if (!janet_indexed_view(v->parent, &values, &count)) return 0;
+    if (v->offset >= count) {
+        *data = values;
+        *len = 0;
+    } else {
+        *data = values + v->offset;
+        *len = count - v->offset < v->length ? count - v->offset : v->length;
+    }
+    return 1;
+}
+
+static JanetSliceView *view_check(Janet x) {
+    if (!janet_checktype(x, JANET_ABSTRACT) ||
+            janet_abstract_type(janet_unwrap_abstract(x)) != &janet_view_type)
+        return NULL;
+    return (JanetSliceView *) janet_unwrap_abstract(x);
+}
+
+/* Read a view of bytes as a pointer and length, for janet_bytes_view */
+int janet_view_bytes(Janet x, const uint8_t **data, int32_t *len) {
+    JanetSliceView *v = view_check(x);
+    return NULL != v && view_parent_bytes(v, data, len);
+}
+
+/* Read a view of values as a pointer and length, for janet_indexed_view */
+int janet_view_indexed(Janet x, const Janet **data, int32_t *len) {
+    JanetSliceView *v = view_check(x);
+    return NULL != v && view_parent_indexed(v, data, len);
+}
+
+/* Abstract type methods */
+
+static int view_gcmark(void *p, size_t size) {
+    (void) size;
+    janet_mark(((JanetSliceView *) p)->parent);
+    return 0;
+}
+
+static int32_t view_count(const JanetSliceView *v) {
+    const uint8_t *bytes;
+    const Janet *values;
+    int32_t len = 0;
+    if (!view_parent_bytes(v, &bytes, &len))
+        view_parent_indexed(v, &values, &len);
+    return len;
+}
+
+static Janet view_get(void *p, Janet key) {
+    JanetSliceView *v = (JanetSliceView *) p;
+    const uint8_t *bytes;
+    const Janet *values;
+    int32_t len, i;
+    if (!janet_checkint(key)) return janet_wrap_nil();
+    i = janet_unwrap_integer(key);
+    if (view_parent_bytes(v, &bytes, &len))
+        return (i < 0 || i >= len) ? janet_wrap_nil() : janet_wrap_integer(bytes[i]);
+    if (view_parent_indexed(v, &values, &len))
+        return (i < 0 || i >= len) ? janet_wrap_nil() : values[i];
+    return janet_wrap_nil();
+}
+
+static Janet view_next(void *p, Janet key) {
+    int32_t len = view_count((JanetSliceView *) p);
+    if (janet_checktype(key, JANET_NIL))
+        return len ? janet_wrap_integer(0) : janet_wrap_nil();
+    if (!janet_checkint(key)) return janet_wrap_nil();
+    int32_t i = janet_unwrap_integer(key);
+    return (i < 0 || i + 1 >= len) ? janet_wrap_nil() : janet_wrap_integer(i + 1);
+}
+
+static int32_t view_length(void *p, size_t size) {
+    (void) size;
+    return view_count((JanetSliceView *) p);
+}
+
+/* Only the part of the parent in the view is marshalled, as a string or
+ * a tuple. */
+static void view_marshal(void *p, JanetMarshalContext *ctx) {
+    JanetSliceView *v = (JanetSliceView *) p;
+    const uint8_t *bytes;
+    const Janet *values;
+    int32_t len;
+    if (view_parent_bytes(v, &bytes, &len)) {
+        janet_marshal_janet(ctx, janet_stringv(bytes, len));
+    } else if (view_parent_indexed(v, &values, &len)) {
+        janet_marshal_janet(ctx, janet_wrap_tuple(janet_tuple_n(values, len)));
+    } else {
+        janet_marshal_janet(ctx, janet_wrap_tuple(janet_tuple_n(NULL, 0)));
+    }
+}
+
+static void view_unmarshal(void *p, JanetMarshalContext *ctx) {
+    JanetSliceView *v = (JanetSliceView *) p;
+    v->parent = janet_wrap_nil();
+    v->offset = 0;
+    v->length = 0;
+    janet_unmarshal_janet(ctx, &v->parent);
+    v->length = janet_length(v->parent);
+}
+
+/* C API */
+
+/* Make a view of length values of parent starting at offset. The range
+ * must be inside the parent. */
+Janet janet_view(Janet parent, int32_t offset, int32_t length) {
+    JanetSliceView *v;
+    JanetSliceView *pv = view_check(parent);
+    if (NULL != pv) {
+        parent = pv->parent;
+        offset += pv->offset;
+    }
+    v = janet_abstract(&janet_view_type, sizeof(JanetSliceView));
+    v->parent = parent;
+    v->offset = offset;
+    v->length = length;
+    return janet_wrap_abstract(v);
+}
+
+/* C functions */
+
+static Janet cfun_view_slice(int32_t argc, Janet *argv) {
+    const uint8_t *bytes;
+    const Janet *values;
+    int32_t len;
+    JanetRange range = janet_getslice(argc, argv);
+    if (!janet_bytes_view(argv[0], &bytes, &len) &&
+            !janet_indexed_view(argv[0], &values, &len))
+        janet_panic_type(argv[0], 0, JANET_TFLAG_BYTES | JANET_TFLAG_INDEXED);
+    return janet_view(argv[0], range.start, range.end - range.start);
+}
+
+/* Find the next delim in text from start, looking for its first byte
+ * with memchr. */
+static int32_t view_find(JanetByteView text, JanetByteView delim, int32_t start) {
+    while (start + delim.len <= text.len) {
+        const uint8_t *hit = memchr(text.bytes + start, delim.bytes[0],
+                                    text.len - delim.len - start + 1);
+        if (NULL == hit) return -1;
+        start = (int32_t)(hit - text.bytes);
+        if (!memcmp(hit, delim.bytes, delim.len)) return start;
+        start++;
+    }
+    return -1;
+}
+
+static Janet cfun_view_split(int32_t argc, Janet *argv) {
+    janet_arity(argc, 2, 4);
+    JanetByteView delim = janet_getbytes(argv, 0);
+    JanetByteView text = janet_getbytes(argv, 1);
+    int32_t start = argc > 2 ? janet_getinteger(argv, 2) : 0;
+    int32_t limit = argc > 3 ? janet_getinteger(argv, 3) : -1;
+    int32_t result, lastindex = 0;
+    JanetArray *array = janet_array(0);
+    if (delim.len == 0) janet_panic("expected non-empty delimiter");
+    if (start < 0) janet_panic("expected non-negative start index");
+    while (limit-- && (result = view_find(text, delim, start)) >= 0) {
+        janet_array_push(array, janet_view(argv[1], lastindex, result - lastindex));
+        lastindex = start = result + delim.len;
+    }
+    janet_array_push(array, janet_view(argv[1], lastindex, text.len - lastindex));
+    return janet_wrap_array(array);
+}
+
+static Janet cfun_view_parent(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetSliceView *v = (JanetSliceView *) janet_getabstract(argv, 0, &janet_view_type);
+    return v->parent;
+}
+
+static const JanetReg view_cfuns[] = {
+    {
+        "view/slice", cfun_view_slice,
+        JDOC("(view/slice x &opt start end)\n\n"
+             "Returns a view of x from start to end without copying. x can be a string, "
+             "symbol, keyword, buffer, tuple, array or view. Indices work like in "
+             "string/slice. Views can be used in place of strings and buffers or of "
+             "tuples and arrays in most core functions. A view keeps all of x alive, "
+             "and sees changes to x if x is a buffer or array. Use string or tuple/slice "
+             "to copy a view, for example to use it as a table key.")
+    },
+    {
+        "view/split", cfun_view_split,
+        JDOC("(view/split delim str &opt start limit)\n\n"
+             "Like string/split, but returns an array of views of str instead of new "
+             "strings. The search begins at start, and splits str at most limit times.")
+    },
+    {
+        "view/parent", cfun_view_parent,
+        JDOC("(view/parent view)\n\n"
+             "Returns the value that a view refers to.")
+    },
+    {NULL, NULL, NULL}
+};
+
+/* Load the view module */
+void janet_lib_view(JanetTable *env) {
+    janet_core_cfuns(env, NULL, view_cfuns);
+    janet_register_abstract_type(&janet_view_type);
+}
@@ -57,82 +57,12 @@ JANET_THREAD_LOCAL jmp_buf *janet_vm_jmp_buf = NULL;
 /* How we dispatch instructions. By default, we use
  * a switch inside an infinite loop. For GCC/clang, we use
  * computed gotos. */
-#ifdef ____GNUC__
+#ifdef JANET_COMPUTED_GOTO
 #define VM_START() { goto *op_lookup[first_opcode];
 #define VM_END() }
 #define VM_OP(op) label_##op :
 #define VM_DEFAULT() label_unknown_op:
 #define vm_next() goto *op_lookup[*pc & 0xFF]
-static void *op_lookup[255] = {
-    &&label_JOP_NOOP,
-    &&label_JOP_ERROR,
-    &&label_JOP_TYPECHECK,
-    &&label_JOP_RETURN,
-    &&label_JOP_RETURN_NIL,
-    &&label_JOP_ADD_IMMEDIATE,
-    &&label_JOP_ADD,
-    &&label_JOP_SUBTRACT,
-    &&label_JOP_MULTIPLY_IMMEDIATE,
-    &&label_JOP_MULTIPLY,
-    &&label_JOP_DIVIDE_IMMEDIATE,
-    &&label_JOP_DIVIDE,
-    &&label_JOP_BAND,
-    &&label_JOP_BOR,
-    &&label_JOP_BXOR,
-    &&label_JOP_BNOT,
-    &&label_JOP_SHIFT_LEFT,
-    &&label_JOP_SHIFT_LEFT_IMMEDIATE,
-    &&label_JOP_SHIFT_RIGHT,
-    &&label_JOP_SHIFT_RIGHT_IMMEDIATE,
-    &&label_JOP_SHIFT_RIGHT_UNSIGNED,
-    &&label_JOP_SHIFT_RIGHT_UNSIGNED_IMMEDIATE,
-    &&label_JOP_MOVE_FAR,
-    &&label_JOP_MOVE_NEAR,
-    &&label_JOP_JUMP,
-    &&label_JOP_JUMP_IF,
-    &&label_JOP_JUMP_IF_NOT,
-    &&label_JOP_GREATER_THAN,
-    &&label_JOP_GREATER_THAN_IMMEDIATE,
-    &&label_JOP_LESS_THAN,
-    &&label_JOP_LESS_THAN_IMMEDIATE,
-    &&label_JOP_EQUALS,
-    &&label_JOP_EQUALS_IMMEDIATE,
-    &&label_JOP_COMPARE,
-    &&label_JOP_LOAD_NIL,
-    &&label_JOP_LOAD_TRUE,
-    &&label_JOP_LOAD_FALSE,
-    &&label_JOP_LOAD_INTEGER,
-    &&label_JOP_LOAD_CONSTANT,
-    &&label_JOP_LOAD_UPVALUE,
-    &&label_JOP_LOAD_SELF,
-    &&label_JOP_SET_UPVALUE,
-    &&label_JOP_CLOSURE,
-    &&label_JOP_PUSH,
-    &&label_JOP_PUSH_2,
-    &&label_JOP_PUSH_3,
-    &&label_JOP_PUSH_ARRAY,
-    &&label_JOP_CALL,
-    &&label_JOP_TAILCALL,
-    &&label_JOP_RESUME,
-    &&label_JOP_SIGNAL,
-    &&label_JOP_GET,
-    &&label_JOP_PUT,
-    &&label_JOP_GET_INDEX,
-    &&label_JOP_PUT_INDEX,
-    &&label_JOP_LENGTH,
-    &&label_JOP_MAKE_ARRAY,
-    &&label_JOP_MAKE_BUFFER,
-    &&label_JOP_MAKE_STRING,
-    &&label_JOP_MAKE_STRUCT,
-    &&label_JOP_MAKE_TABLE,
-    &&label_JOP_MAKE_TUPLE,
-    &&label_JOP_NUMERIC_LESS_THAN,
-    &&label_JOP_NUMERIC_LESS_THAN_EQUAL,
-    &&label_JOP_NUMERIC_GREATER_THAN,
-    &&label_JOP_NUMERIC_GREATER_THAN_EQUAL,
-    &&label_JOP_NUMERIC_EQUAL,
-    &&label_unknown_op
-};
 #else
 #define VM_START() uint8_t opcode = first_opcode; for (;;) {switch(opcode) {
 #define VM_END() }}
@@ -156,7 +86,7 @@ static void *op_lookup[255] = {
 
 /* Next instruction variations */
 #define maybe_collect() do {\
-    if (janet_vm_next_collection >= janet_vm_gc_interval) janet_collect(); } while (0)
+    if (janet_vm_next_collection >= janet_vm_gc_interval) janet_collect_young(); } while (0)
 #define vm_checkgc_next() maybe_collect(); vm_next()
 #define vm_pcnext() pc++; vm_next()
 #define vm_checkgc_pcnext() maybe_collect(); vm_pcnext()
@@ -177,6 +107,28 @@ static void *op_lookup[255] = {
     } \
 } while (0)
 
+/* Compare and branch superinstruction. Comparisons are almost always
+ * followed by a conditional jump on the register they just wrote, so
+ * take that branch directly instead of dispatching the jump. There is
+ * no room in one instruction word for two registers and a 16 bit jump
+ * offset, so the pair is fused here rather than by the compiler. A
+ * breakpoint on the jump sets its high bit and disables the fusion. */
+#define vm_compare_next(cond) { \
+    int _cond = (cond); \
+    uint32_t _next = pc[1]; \
+    stack[A] = janet_wrap_boolean(_cond); \
+    if (((_next >> 8) & 0xFF) == A) { \
+        if ((_next & 0xFF) == JOP_JUMP_IF) { \
+            pc += _cond ? (1 + (((int32_t)_next) >> 16)) : 2; \
+            vm_next(); \
+        } else if ((_next & 0xFF) == JOP_JUMP_IF_NOT) { \
+            pc += _cond ? 2 : (1 + (((int32_t)_next) >> 16)); \
+            vm_next(); \
+        } \
+    } \
+    vm_pcnext(); \
+}
+
 /* Templates for certain patterns in opcodes */
 #define vm_binop_immediate(op)\
     {\
@@ -208,7 +160,14 @@ static void *op_lookup[255] = {
         vm_pcnext();\
     }
 #define vm_binop(op) _vm_binop(op, janet_wrap_number)
-#define vm_numcomp(op) _vm_binop(op, janet_wrap_boolean)
+#define vm_numcomp(op)\
+    {\
+        Janet op1 = stack[B];\
+        Janet op2 = stack[C];\
+        vm_assert_type(op1, JANET_NUMBER);\
+        vm_assert_type(op2, JANET_NUMBER);\
+        vm_compare_next(janet_unwrap_number(op1) op janet_unwrap_number(op2));\
+    }
 #define _vm_bitop(op, type1)\
     {\
         Janet op1 = stack[B];\
@@ -220,6 +179,14 @@ static void *op_lookup[255] = {
         stack[A] = janet_wrap_integer(x1 op x2);\
         vm_pcnext();\
     }
+/* Operands are known to be numbers by the compiler */
+#define vm_binop_unchecked(op)\
+    {\
+        stack[A] = janet_wrap_number(janet_unwrap_number(stack[B]) op janet_unwrap_number(stack[C]));\
+        vm_pcnext();\
+    }
+#define vm_numcomp_unchecked(op)\
+    vm_compare_next(janet_unwrap_number(stack[B]) op janet_unwrap_number(stack[C]))
 #define vm_bitop(op) _vm_bitop(op, int32_t)
 #define vm_bitopu(op) _vm_bitop(op, uint32_t)
 
@@ -240,13 +207,377 @@ static Janet call_nonfn(JanetFiber *fiber, Janet callee) {
     return janet_get(ds, key);
 }
 
+/* Inline caches
+ *
+ * Instructions that look up keyword keys in tables and structs (get, put,
+ * and calls with a keyword callee) each get a small polymorphic cache
+ * of where the key was last found. A cache way either refers to a
+ * bucket in the receiver itself, or to a bucket in one of its
+ * prototypes. Own buckets are checked against the identity, data and
+ * capacity of the receiver and the key in the bucket, so they never need
+ * to be invalidated. Prototype buckets are checked against the receiver's
+ * prototype and janet_vm_table_epoch, which is bumped whenever a table
+ * that a cache depends on gains or loses keys, changes prototype, or is
+ * freed. Caches hold no references, so they are ignored by the gc.
+ *
+ * For shaped tables, a way refers to a slot of a shape instead of a
+ * bucket, and matches every table with that shape. The table
+ * constructor keeps the last shape it built in its first way. */
+
+#define JANET_IC_WAYS 2
+
+typedef struct {
+    const void *holder;
+    const JanetKV *data;
+    const Janet *shape;
+    JanetTable *proto;
+    int32_t capacity;
+    int32_t index;
+    uint32_t epoch;
+} JanetICWay;
+
+typedef struct {
+    JanetICWay ways[JANET_IC_WAYS];
+} JanetICEntry;
+
+struct JanetInlineCache {
+    int32_t *index;
+    JanetICEntry entries[];
+};
+
+/* Check if an instruction can use an inline cache */
+static int vm_icache_op(uint32_t instr) {
+    switch (instr & 0x7F) {
+        default:
+            return 0;
+        case JOP_GET:
+        case JOP_PUT:
+        case JOP_CALL:
+        case JOP_CALL_CONSTANT:
+        case JOP_PUSH_CALL:
+        case JOP_TAILCALL:
+        case JOP_MAKE_TABLE:
+            return 1;
+    }
+}
+
+/* Get the cache entry for an instruction, creating the caches for
+ * the whole funcdef on first use. */
+static JanetICEntry *vm_icache(JanetFuncDef *def, const uint32_t *pc) {
+    JanetInlineCache *ic = def->icache;
+    if (NULL == ic) {
+        int32_t i, count = 0;
+        int32_t len = def->bytecode_length;
+        for (i = 0; i < len; i++)
+            if (vm_icache_op(def->bytecode[i])) count++;
+        ic = malloc(sizeof(JanetInlineCache) +
+                    count * sizeof(JanetICEntry) +
+                    len * sizeof(int32_t));
+        if (NULL == ic) {
+            JANET_OUT_OF_MEMORY;
+        }
+        ic->index = (int32_t *)(ic->entries + count);
+        memset(ic->entries, 0, count * sizeof(JanetICEntry));
+        count = 0;
+        for (i = 0; i < len; i++)
+            ic->index[i] = vm_icache_op(def->bytecode[i]) ? count++ : -1;
+        def->icache = ic;
+    }
+    int32_t index = ic->index[pc - def->bytecode];
+    return index < 0 ? NULL : ic->entries + index;
+}
+
+/* Insert a way as the most recently used way of an entry */
+static void vm_icache_insert(JanetICEntry *entry, JanetICWay way) {
+    int i;
+    for (i = JANET_IC_WAYS - 1; i > 0; i--)
+        entry->ways[i] = entry->ways[i - 1];
+    entry->ways[0] = way;
+}
+
+/* Get the value a cache way refers to in a table, or NULL if the way
+ * does not hold the key for the table */
+static Janet *vm_icache_way_slot(const JanetICWay *way, JanetTable *t, Janet key) {
+    if (NULL != way->shape) {
+        if (way->shape == t->shape && janet_equals(t->shape[way->index], key))
+            return janet_table_slots(t) + way->index;
+    } else if (way->data == t->data &&
+               way->capacity == t->capacity &&
+               janet_equals(t->data[way->index].key, key)) {
+        return &t->data[way->index].value;
+    }
+    return NULL;
+}
+
+/* Make a cache way for the value of a key in a table */
+static void vm_icache_fill(JanetICEntry *entry, JanetTable *holder, JanetTable *proto, Janet *slot) {
+    JanetICWay way;
+    way.proto = proto;
+    way.epoch = proto ? janet_vm_table_epoch : 0;
+    if (NULL != holder->shape) {
+        way.holder = proto ? holder : NULL;
+        way.data = NULL;
+        way.shape = holder->shape;
+        way.capacity = 0;
+        way.index = (int32_t)(slot - janet_table_slots(holder));
+    } else {
+        way.holder = holder;
+        way.data = holder->data;
+        way.shape = NULL;
+        way.capacity = holder->capacity;
+        way.index = (int32_t)(((char *) slot - (char *) holder->data) / sizeof(JanetKV));
+    }
+    vm_icache_insert(entry, way);
+}
+
+/* Find the value of a key in a table or its prototypes, using and
+ * filling the inline cache. Returns NULL if the key is not found. */
+static Janet *vm_icache_table_find(JanetICEntry *entry, JanetTable *t, Janet key) {
+    int i;
+    Janet *slot;
+    for (i = 0; i < JANET_IC_WAYS; i++) {
+        JanetICWay *way = entry->ways + i;
+        if (NULL == way->proto) {
+            /* Own bucket, or slot of any table with the same shape */
+            if ((NULL != way->shape || way->holder == t) &&
+                    NULL != (slot = vm_icache_way_slot(way, t, key)))
+                return slot;
+        } else if (way->proto == t->proto && way->epoch == janet_vm_table_epoch) {
+            /* Prototype bucket */
+            slot = vm_icache_way_slot(way, (JanetTable *) way->holder, key);
+            if (NULL != slot) {
+                if (t->count == 0 || NULL == janet_table_slot(t, key)) return slot;
+                break;
+            }
+        }
+    }
+    /* Miss - do a normal lookup and fill the cache */
+    slot = janet_table_slot(t, key);
+    if (NULL != slot) {
+        vm_icache_fill(entry, t, NULL, slot);
+        return slot;
+    }
+    JanetTable *holder = t->proto;
+    for (i = JANET_MAX_PROTO_DEPTH; holder && i; holder = holder->proto, --i) {
+        slot = janet_table_slot(holder, key);
+        if (NULL != slot) {
+            JanetTable *p;
+            for (p = t->proto; p != holder; p = p->proto)
+                p->gc.flags |= JANET_MEM_CACHED;
+            holder->gc.flags |= JANET_MEM_CACHED;
+            vm_icache_fill(entry, holder, t->proto, slot);
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+/* Find the bucket holding a key in a struct, using and filling the
+ * inline cache. Returns NULL if the key is not found. */
+static const JanetKV *vm_icache_struct_find(JanetICEntry *entry, const JanetKV *st, Janet key) {
+    int i;
+    int32_t cap = janet_struct_capacity(st);
+    for (i = 0; i < JANET_IC_WAYS; i++) {
+        JanetICWay *way = entry->ways + i;
+        if (way->holder == st &&
+                way->capacity == cap &&
+                janet_equals(st[way->index].key, key))
+            return st + way->index;
+    }
+    const JanetKV *bucket = janet_struct_find(st, key);
+    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+        JanetICWay way;
+        way.holder = st;
+        way.data = st;
+        way.shape = NULL;
+        way.proto = NULL;
+        way.capacity = cap;
+        way.index = (int32_t)(bucket - st);
+        way.epoch = 0;
+        vm_icache_insert(entry, way);
+        return bucket;
+    }
+    return NULL;
+}
+
+/* Cached version of janet_get for the current instruction */
+static Janet vm_cached_get(JanetFunction *func, const uint32_t *pc, Janet ds, Janet key) {
+    if (janet_checktype(key, JANET_KEYWORD)) {
+        if (janet_checktype(ds, JANET_TABLE)) {
+            JanetICEntry *entry = vm_icache(func->def, pc);
+            if (NULL != entry) {
+                Janet *slot = vm_icache_table_find(entry, janet_unwrap_table(ds), key);
+                return slot ? *slot : janet_wrap_nil();
+            }
+        } else if (janet_checktype(ds, JANET_STRUCT)) {
+            JanetICEntry *entry = vm_icache(func->def, pc);
+            if (NULL != entry) {
+                const JanetKV *bucket = vm_icache_struct_find(entry, janet_unwrap_struct(ds), key);
+                return bucket ? bucket->value : janet_wrap_nil();
+            }
+        }
+    }
+    return janet_get(ds, key);
+}
+
+/* Cached version of janet_put for the current instruction. Only
+ * overwriting an existing key in the table itself uses the cache. */
+static void vm_cached_put(JanetFunction *func, const uint32_t *pc, Janet ds, Janet key, Janet value) {
+    if (janet_checktype(ds, JANET_TABLE) &&
+            janet_checktype(key, JANET_KEYWORD) &&
+            !janet_checktype(value, JANET_NIL)) {
+        JanetTable *t = janet_unwrap_table(ds);
+        JanetICEntry *entry = vm_icache(func->def, pc);
+        if (NULL != entry) {
+            int i;
+            Janet *slot;
+            for (i = 0; i < JANET_IC_WAYS; i++) {
+                JanetICWay *way = entry->ways + i;
+                if (NULL == way->proto &&
+                        (NULL != way->shape || way->holder == t) &&
+                        NULL != (slot = vm_icache_way_slot(way, t, key))) {
+                    janet_gc_barrier(t);
+                    *slot = value;
+                    return;
+                }
+            }
+            janet_table_put(t, key, value);
+            slot = janet_table_slot(t, key);
+            if (NULL != slot)
+                vm_icache_fill(entry, t, NULL, slot);
+            return;
+        }
+    }
+    janet_put(ds, key, value);
+}
+
+/* Build a table from the arguments of a table constructor. The cache
+ * entry of the instruction holds the last shape built, and counts the
+ * times a new shape was needed, so constructors with changing keys stop
+ * trying to use shapes. */
+static JanetTable *vm_make_table(JanetFunction *func, const uint32_t *pc, const Janet *kvs, int32_t count) {
+    JanetICEntry *entry = vm_icache(func->def, pc);
+    if (NULL != entry) {
+        JanetICWay *way = entry->ways;
+        if (NULL != way->shape && janet_shape_fits(way->shape, kvs, count))
+            return janet_table_shaped(way->shape, kvs);
+        if (way->index < 8) {
+            const Janet *shape = janet_table_shape(kvs, count);
+            if (NULL != shape) {
+                way->shape = shape;
+                way->index++;
+                return janet_table_shaped(shape, kvs);
+            }
+        }
+    }
+    JanetTable *table = janet_table(count / 2);
+    for (int32_t i = 0; i < count; i += 2)
+        janet_table_put(table, kvs[i], kvs[i + 1]);
+    return table;
+}
+
 /* Interpreter main loop */
 static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status) {
 
+#ifdef JANET_COMPUTED_GOTO
+    /* Jump table for computed goto dispatch. Must be inside of run_vm
+     * as labels are local to a function. Every entry defaults to the
+     * unknown op label, which also catches opcodes with the breakpoint
+     * bit set, and is then overridden for each opcode. */
+#define VM_LABEL(op) [op] = &&label_##op
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Woverride-init"
+    static void *op_lookup[256] = {
+        [0 ... 255] = &&label_unknown_op,
+        VM_LABEL(JOP_NOOP),
+        VM_LABEL(JOP_ERROR),
+        VM_LABEL(JOP_TYPECHECK),
+        VM_LABEL(JOP_RETURN),
+        VM_LABEL(JOP_RETURN_NIL),
+        VM_LABEL(JOP_ADD_IMMEDIATE),
+        VM_LABEL(JOP_ADD),
+        VM_LABEL(JOP_SUBTRACT),
+        VM_LABEL(JOP_MULTIPLY_IMMEDIATE),
+        VM_LABEL(JOP_MULTIPLY),
+        VM_LABEL(JOP_DIVIDE_IMMEDIATE),
+        VM_LABEL(JOP_DIVIDE),
+        VM_LABEL(JOP_BAND),
+        VM_LABEL(JOP_BOR),
+        VM_LABEL(JOP_BXOR),
+        VM_LABEL(JOP_BNOT),
+        VM_LABEL(JOP_SHIFT_LEFT),
+        VM_LABEL(JOP_SHIFT_LEFT_IMMEDIATE),
+        VM_LABEL(JOP_SHIFT_RIGHT),
+        VM_LABEL(JOP_SHIFT_RIGHT_IMMEDIATE),
+        VM_LABEL(JOP_SHIFT_RIGHT_UNSIGNED),
+        VM_LABEL(JOP_SHIFT_RIGHT_UNSIGNED_IMMEDIATE),
+        VM_LABEL(JOP_MOVE_FAR),
+        VM_LABEL(JOP_MOVE_NEAR),
+        VM_LABEL(JOP_JUMP),
+        VM_LABEL(JOP_JUMP_IF),
+        VM_LABEL(JOP_JUMP_IF_NOT),
+        VM_LABEL(JOP_GREATER_THAN),
+        VM_LABEL(JOP_GREATER_THAN_IMMEDIATE),
+        VM_LABEL(JOP_LESS_THAN),
+        VM_LABEL(JOP_LESS_THAN_IMMEDIATE),
+        VM_LABEL(JOP_EQUALS),
+        VM_LABEL(JOP_EQUALS_IMMEDIATE),
+        VM_LABEL(JOP_COMPARE),
+        VM_LABEL(JOP_LOAD_NIL),
+        VM_LABEL(JOP_LOAD_TRUE),
+        VM_LABEL(JOP_LOAD_FALSE),
+        VM_LABEL(JOP_LOAD_INTEGER),
+        VM_LABEL(JOP_LOAD_CONSTANT),
+        VM_LABEL(JOP_LOAD_UPVALUE),
+        VM_LABEL(JOP_LOAD_SELF),
+        VM_LABEL(JOP_SET_UPVALUE),
+        VM_LABEL(JOP_CLOSURE),
+        VM_LABEL(JOP_PUSH),
+        VM_LABEL(JOP_PUSH_2),
+        VM_LABEL(JOP_PUSH_3),
+        VM_LABEL(JOP_PUSH_ARRAY),
+        VM_LABEL(JOP_CALL),
+        VM_LABEL(JOP_TAILCALL),
+        VM_LABEL(JOP_RESUME),
+        VM_LABEL(JOP_SIGNAL),
+        VM_LABEL(JOP_GET),
+        VM_LABEL(JOP_PUT),
+        VM_LABEL(JOP_GET_INDEX),
+        VM_LABEL(JOP_PUT_INDEX),
+        VM_LABEL(JOP_LENGTH),
+        VM_LABEL(JOP_MAKE_ARRAY),
+        VM_LABEL(JOP_MAKE_BUFFER),
+        VM_LABEL(JOP_MAKE_STRING),
+        VM_LABEL(JOP_MAKE_STRUCT),
+        VM_LABEL(JOP_MAKE_TABLE),
+        VM_LABEL(JOP_MAKE_TUPLE),
+        VM_LABEL(JOP_NUMERIC_LESS_THAN),
+        VM_LABEL(JOP_NUMERIC_LESS_THAN_EQUAL),
+        VM_LABEL(JOP_NUMERIC_GREATER_THAN),
+        VM_LABEL(JOP_NUMERIC_GREATER_THAN_EQUAL),
+        VM_LABEL(JOP_NUMERIC_EQUAL),
+        VM_LABEL(JOP_CALL_CONSTANT),
+        VM_LABEL(JOP_PUSH_CALL),
+        VM_LABEL(JOP_ADD_UNCHECKED),
+        VM_LABEL(JOP_SUBTRACT_UNCHECKED),
+        VM_LABEL(JOP_MULTIPLY_UNCHECKED),
+        VM_LABEL(JOP_DIVIDE_UNCHECKED),
+        VM_LABEL(JOP_NUMERIC_LESS_THAN_UNCHECKED),
+        VM_LABEL(JOP_NUMERIC_LESS_THAN_EQUAL_UNCHECKED),
+        VM_LABEL(JOP_NUMERIC_GREATER_THAN_UNCHECKED),
+        VM_LABEL(JOP_NUMERIC_GREATER_THAN_EQUAL_UNCHECKED),
+        VM_LABEL(JOP_NUMERIC_EQUAL_UNCHECKED),
+        VM_LABEL(JOP_PROPAGATE)
+    };
+#pragma GCC diagnostic pop
+#undef VM_LABEL
+#endif
+
     /* Interpreter state */
     register Janet *stack;
     register uint32_t *pc;
     register JanetFunction *func;
+    Janet callee;
     vm_restore();
 
     /* Only should be hit if the fiber is either waiting for a child, or
@@ -254,7 +585,9 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
      * DO NOT use input when resuming a fiber that has been interrupted at a
      * breakpoint. */
     if (status != JANET_STATUS_NEW &&
-            ((*pc & 0xFF) == JOP_SIGNAL || (*pc & 0xFF) == JOP_RESUME)) {
+            ((*pc & 0xFF) == JOP_SIGNAL ||
+             (*pc & 0xFF) == JOP_RESUME ||
+             (*pc & 0xFF) == JOP_PROPAGATE)) {
         stack[A] = in;
         pc++;
     }
@@ -333,6 +666,33 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     VM_OP(JOP_NUMERIC_EQUAL)
     vm_numcomp( ==);
 
+    VM_OP(JOP_ADD_UNCHECKED)
+    vm_binop_unchecked(+);
+
+    VM_OP(JOP_SUBTRACT_UNCHECKED)
+    vm_binop_unchecked(-);
+
+    VM_OP(JOP_MULTIPLY_UNCHECKED)
+    vm_binop_unchecked(*);
+
+    VM_OP(JOP_DIVIDE_UNCHECKED)
+    vm_binop_unchecked( /);
+
+    VM_OP(JOP_NUMERIC_LESS_THAN_UNCHECKED)
+    vm_numcomp_unchecked( <);
+
+    VM_OP(JOP_NUMERIC_LESS_THAN_EQUAL_UNCHECKED)
+    vm_numcomp_unchecked( <=);
+
+    VM_OP(JOP_NUMERIC_GREATER_THAN_UNCHECKED)
+    vm_numcomp_unchecked( >);
+
+    VM_OP(JOP_NUMERIC_GREATER_THAN_EQUAL_UNCHECKED)
+    vm_numcomp_unchecked( >=);
+
+    VM_OP(JOP_NUMERIC_EQUAL_UNCHECKED)
+    vm_numcomp_unchecked( ==);
+
     VM_OP(JOP_DIVIDE_IMMEDIATE)
     vm_binop_immediate( /);
 
@@ -402,28 +762,22 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     vm_next();
 
     VM_OP(JOP_LESS_THAN)
-    stack[A] = janet_wrap_boolean(janet_compare(stack[B], stack[C]) < 0);
-    vm_pcnext();
+    vm_compare_next(janet_compare(stack[B], stack[C]) < 0);
 
     VM_OP(JOP_LESS_THAN_IMMEDIATE)
-    stack[A] = janet_wrap_boolean(janet_unwrap_integer(stack[B]) < CS);
-    vm_pcnext();
+    vm_compare_next(janet_unwrap_integer(stack[B]) < CS);
 
     VM_OP(JOP_GREATER_THAN)
-    stack[A] = janet_wrap_boolean(janet_compare(stack[B], stack[C]) > 0);
-    vm_pcnext();
+    vm_compare_next(janet_compare(stack[B], stack[C]) > 0);
 
     VM_OP(JOP_GREATER_THAN_IMMEDIATE)
-    stack[A] = janet_wrap_boolean(janet_unwrap_integer(stack[B]) > CS);
-    vm_pcnext();
+    vm_compare_next(janet_unwrap_integer(stack[B]) > CS);
 
     VM_OP(JOP_EQUALS)
-    stack[A] = janet_wrap_boolean(janet_equals(stack[B], stack[C]));
-    vm_pcnext();
+    vm_compare_next(janet_equals(stack[B], stack[C]));
 
     VM_OP(JOP_EQUALS_IMMEDIATE)
-    stack[A] = janet_wrap_boolean(janet_unwrap_integer(stack[B]) == CS);
-    vm_pcnext();
+    vm_compare_next(janet_unwrap_integer(stack[B]) == CS);
 
     VM_OP(JOP_COMPARE)
     stack[A] = janet_wrap_integer(janet_compare(stack[B], stack[C]));
@@ -481,8 +835,10 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         env = func->envs[eindex];
         vm_assert(env->length > vindex, "invalid upvalue index");
         if (env->offset) {
+            janet_gc_barrier(env->as.fiber);
             env->as.fiber->data[env->offset + vindex] = stack[A];
         } else {
+            janet_gc_barrier(env);
             env->as.values[vindex] = stack[A];
         }
         vm_pcnext();
@@ -493,6 +849,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         JanetFunction *fn;
         int32_t elen;
         int32_t defindex = (int32_t)E;
+        vm_commit();
         vm_assert(defindex < func->def->defs_length, "invalid funcdef");
         fd = func->def->defs[defindex];
         elen = fd->environments_length;
@@ -549,8 +906,22 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     stack = fiber->data + fiber->frame;
     vm_checkgc_pcnext();
 
-    VM_OP(JOP_CALL) {
-        Janet callee = stack[E];
+    VM_OP(JOP_PUSH_CALL)
+    janet_fiber_push(fiber, stack[B]);
+    stack = fiber->data + fiber->frame;
+    callee = stack[C];
+    goto vm_call;
+
+    VM_OP(JOP_CALL_CONSTANT) {
+        int32_t cindex = (int32_t)E;
+        vm_assert(cindex < func->def->constants_length, "invalid constant");
+        callee = func->def->constants[cindex];
+        goto vm_call;
+    }
+
+    VM_OP(JOP_CALL)
+    callee = stack[E];
+vm_call: {
         if (fiber->stacktop > fiber->maxstack) {
             vm_throw("stack overflow");
         }
@@ -558,7 +929,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
             vm_commit();
             int32_t argc = fiber->stacktop - fiber->stackstart;
             if (argc < 1) janet_panicf("method call takes at least 1 argument, got %d", argc);
-            callee = janet_get(fiber->data[fiber->stackstart], callee);
+            callee = vm_cached_get(func, pc, fiber->data[fiber->stackstart], callee);
         }
         if (janet_checktype(callee, JANET_FUNCTION)) {
             func = janet_unwrap_function(callee);
@@ -589,12 +960,12 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     }
 
     VM_OP(JOP_TAILCALL) {
-        Janet callee = stack[D];
+        callee = stack[D];
         if (janet_checktype(callee, JANET_KEYWORD)) {
             vm_commit();
             int32_t argc = fiber->stacktop - fiber->stackstart;
             if (argc < 1) janet_panicf("method call takes at least 1 argument, got %d", argc);
-            callee = janet_get(fiber->data[fiber->stackstart], callee);
+            callee = vm_cached_get(func, pc, fiber->data[fiber->stackstart], callee);
         }
         if (janet_checktype(callee, JANET_FUNCTION)) {
             func = janet_unwrap_function(callee);
@@ -648,9 +1019,26 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         vm_return(s, stack[B]);
     }
 
+    /* Raise the last signal of another fiber from this one, keeping the
+     * other fiber as the child so stack traces go through it */
+    VM_OP(JOP_PROPAGATE) {
+        JanetFiber *child;
+        JanetFiberStatus sub_status;
+        vm_assert_type(stack[C], JANET_FIBER);
+        child = janet_unwrap_fiber(stack[C]);
+        sub_status = janet_fiber_status(child);
+        if (sub_status == JANET_STATUS_DEAD || sub_status > JANET_STATUS_USER9) {
+            vm_commit();
+            janet_panicf("cannot propagate from fiber with status :%s",
+                         janet_status_names[sub_status]);
+        }
+        fiber->child = child;
+        vm_return((int) sub_status, stack[B]);
+    }
+
     VM_OP(JOP_PUT)
     vm_commit();
-    janet_put(stack[A], stack[B], stack[C]);
+    vm_cached_put(func, pc, stack[A], stack[B], stack[C]);
     vm_checkgc_pcnext();
 
     VM_OP(JOP_PUT_INDEX)
@@ -660,7 +1048,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
 
     VM_OP(JOP_GET)
     vm_commit();
-    stack[A] = janet_get(stack[B], stack[C]);
+    stack[A] = vm_cached_get(func, pc, stack[B], stack[C]);
     vm_pcnext();
 
     VM_OP(JOP_GET_INDEX)
@@ -674,6 +1062,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     vm_pcnext();
 
     VM_OP(JOP_MAKE_ARRAY) {
+        vm_commit();
         int32_t count = fiber->stacktop - fiber->stackstart;
         Janet *mem = fiber->data + fiber->stackstart;
         stack[D] = janet_wrap_array(janet_array_n(mem, count));
@@ -682,6 +1071,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     }
 
     VM_OP(JOP_MAKE_TUPLE) {
+        vm_commit();
         int32_t count = fiber->stacktop - fiber->stackstart;
         Janet *mem = fiber->data + fiber->stackstart;
         stack[D] = janet_wrap_tuple(janet_tuple_n(mem, count));
@@ -690,19 +1080,18 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     }
 
     VM_OP(JOP_MAKE_TABLE) {
+        vm_commit();
         int32_t count = fiber->stacktop - fiber->stackstart;
         Janet *mem = fiber->data + fiber->stackstart;
         if (count & 1)
             vm_throw("expected even number of arguments to table constructor");
-        JanetTable *table = janet_table(count / 2);
-        for (int32_t i = 0; i < count; i += 2)
-            janet_table_put(table, mem[i], mem[i + 1]);
-        stack[D] = janet_wrap_table(table);
+        stack[D] = janet_wrap_table(vm_make_table(func, pc, mem, count));
         fiber->stacktop = fiber->stackstart;
         vm_checkgc_pcnext();
     }
 
     VM_OP(JOP_MAKE_STRUCT) {
+        vm_commit();
         int32_t count = fiber->stacktop - fiber->stackstart;
         Janet *mem = fiber->data + fiber->stackstart;
         if (count & 1)
@@ -716,6 +1105,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     }
 
     VM_OP(JOP_MAKE_STRING) {
+        vm_commit();
         int32_t count = fiber->stacktop - fiber->stackstart;
         Janet *mem = fiber->data + fiber->stackstart;
         JanetBuffer buffer;
@@ -729,6 +1119,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     }
 
     VM_OP(JOP_MAKE_BUFFER) {
+        vm_commit();
         int32_t count = fiber->stacktop - fiber->stackstart;
         Janet *mem = fiber->data + fiber->stackstart;
         JanetBuffer *buffer = janet_buffer(10 * count);
@@ -817,7 +1208,8 @@ JanetSignal janet_continue(JanetFiber *fiber, Janet in, Janet *out) {
     jmp_buf *old_vm_jmp_buf = janet_vm_jmp_buf;
     Janet *old_vm_return_reg = janet_vm_return_reg;
 
-    /* Setup fiber */
+    /* Setup fiber. A fiber's stack changes while it runs. */
+    janet_gc_barrier(fiber);
     janet_vm_fiber = fiber;
     janet_gcroot(janet_wrap_fiber(fiber));
     janet_fiber_set_status(fiber, JANET_STATUS_ALIVE);
@@ -833,6 +1225,7 @@ JanetSignal janet_continue(JanetFiber *fiber, Janet in, Janet *out) {
     }
 
     /* Tear down fiber */
+    janet_gc_barrier(fiber);
     janet_fiber_set_status(fiber, signal);
     janet_gcunroot(janet_wrap_fiber(fiber));
 
@@ -870,12 +1263,16 @@ JanetSignal janet_pcall(
 int janet_init(void) {
     /* Garbage collection */
     janet_vm_blocks = NULL;
+    janet_vm_young_blocks = NULL;
     janet_vm_next_collection = 0;
     /* Setting memoryInterval to zero forces
      * a collection pretty much every cycle, which is
      * incredibly horrible for performance, but can help ensure
      * there are no memory bugs during development */
     janet_vm_gc_interval = 0x10000;
+    /* Amount of work done by each step of an incremental
+     * collection. Zero runs full collections all at once. */
+    janet_vm_gc_step = 0x4000;
     janet_symcache_init();
     /* Initialize gc roots */
     janet_vm_roots = NULL;
@@ -884,16 +1281,20 @@ int janet_init(void) {
     /* Initialize registry */
     janet_vm_registry = janet_table(0);
     janet_gcroot(janet_wrap_table(janet_vm_registry));
+    janet_vm_shapes = janet_table(0);
+    janet_gcroot(janet_wrap_table(janet_vm_shapes));
     return 0;
 }
 
 /* Clear all memory associated with the VM */
 void janet_deinit(void) {
     janet_clear_memory();
+    janet_debug_alloc_clear();
     janet_symcache_deinit();
     free(janet_vm_roots);
     janet_vm_roots = NULL;
     janet_vm_root_count = 0;
     janet_vm_root_capacity = 0;
     janet_vm_registry = NULL;
+    janet_vm_shapes = NULL;
 }
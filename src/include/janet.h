@@ -133,6 +133,24 @@ extern "C" {
 #define JANET_TYPED_ARRAY
 #endif
 
+/* Enable or disable computed goto dispatch in the interpreter. Enabled
+ * by default on compilers that support labels as values (GCC and clang). */
+#if defined(__GNUC__) && !defined(JANET_NO_COMPUTED_GOTO)
+#define JANET_COMPUTED_GOTO
+#endif
+
+/* Enable or disable slab allocation of small gc objects. Disabling slabs
+ * is useful when running under a memory debugger. */
+#ifndef JANET_NO_SLABS
+#define JANET_SLABS
+#endif
+
+/* Enable or disable support for sweeping on a background thread. Sweeping
+ * on a background thread still needs to be turned on at runtime. */
+#if defined(JANET_UNIX) && !defined(JANET_NO_SWEEP_THREAD) && !defined(JANET_SINGLE_THREADED)
+#define JANET_SWEEP_THREAD
+#endif
+
 
 /* How to export symbols */
 #ifndef JANET_API
@@ -175,6 +193,12 @@ extern "C" {
 /* Maximum depth to follow table prototypes before giving up and returning nil. */
 #define JANET_MAX_MACRO_EXPAND 200
 
+/* Largest function, in instructions and in registers, that the compiler
+ * will inline into its callers. Define JANET_NO_INLINE to never inline. */
+#ifndef JANET_INLINE_MAX
+#define JANET_INLINE_MAX 16
+#endif
+
 /* Define max stack size for stacks before raising a stack overflow error.
  * If this is not defined, fiber stacks can grow without limit (until memory
  * runs out) */
@@ -281,6 +305,7 @@ typedef struct JanetAbstractHead JanetAbstractHead;
 
 /* Other structs */
 typedef struct JanetFuncDef JanetFuncDef;
+typedef struct JanetInlineCache JanetInlineCache;
 typedef struct JanetFuncEnv JanetFuncEnv;
 typedef struct JanetKV JanetKV;
 typedef struct JanetStackFrame JanetStackFrame;
@@ -677,6 +702,10 @@ struct JanetTable {
     int32_t deleted;
     JanetKV *data;
     JanetTable *proto;
+    const Janet *shape;
+    Janet *array;
+    int32_t acapacity;
+    int32_t acount;
 };
 
 /* A key value pair in a struct or table */
@@ -750,6 +779,9 @@ struct JanetFuncDef {
     const uint8_t *source;
     const uint8_t *name;
 
+    /* Lookup caches for table access instructions, created lazily by the vm. */
+    JanetInlineCache *icache;
+
     int32_t flags;
     int32_t slotcount; /* The amount of stack space required for the function */
     int32_t arity; /* Not including varargs */
@@ -822,8 +854,18 @@ struct JanetAbstractType {
     void (*put)(void *data, Janet key, Janet value);
     void (*marshal)(void *p, JanetMarshalContext *ctx);
     void (*unmarshal)(void *p, JanetMarshalContext *ctx);
+    Janet(*next)(void *data, Janet key);
+    int32_t (*length)(void *data, size_t len);
+    int flags;
 };
 
+/* Flags for abstract types. Set JANET_ABSTRACT_FLAG_BARRIER on a type
+ * whose values never reference new values after they are created, or
+ * that calls janet_abstract_barrier before each such change. Otherwise,
+ * once a value of the type is old, the collector checks it in every
+ * minor collection. */
+#define JANET_ABSTRACT_FLAG_BARRIER 0x1
+
 struct JanetReg {
     const char *name;
     JanetCFunction cfun;
@@ -959,6 +1001,18 @@ enum JanetOpCode {
     JOP_NUMERIC_GREATER_THAN,
     JOP_NUMERIC_GREATER_THAN_EQUAL,
     JOP_NUMERIC_EQUAL,
+    JOP_CALL_CONSTANT,
+    JOP_PUSH_CALL,
+    JOP_ADD_UNCHECKED,
+    JOP_SUBTRACT_UNCHECKED,
+    JOP_MULTIPLY_UNCHECKED,
+    JOP_DIVIDE_UNCHECKED,
+    JOP_NUMERIC_LESS_THAN_UNCHECKED,
+    JOP_NUMERIC_LESS_THAN_EQUAL_UNCHECKED,
+    JOP_NUMERIC_GREATER_THAN_UNCHECKED,
+    JOP_NUMERIC_GREATER_THAN_EQUAL_UNCHECKED,
+    JOP_NUMERIC_EQUAL_UNCHECKED,
+    JOP_PROPAGATE,
     JOP_INSTRUCTION_COUNT
 };
 
@@ -1140,12 +1194,14 @@ JANET_API int janet_bytes_view(Janet str, const uint8_t **data, int32_t *len);
 JANET_API int janet_dictionary_view(Janet tab, const JanetKV **data, int32_t *len, int32_t *cap);
 JANET_API Janet janet_dictionary_get(const JanetKV *data, int32_t cap, Janet key);
 JANET_API const JanetKV *janet_dictionary_next(const JanetKV *kvs, int32_t cap, const JanetKV *kv);
+JANET_API int janet_dictionary_iter(Janet ds, int32_t *index, Janet *key, Janet *value);
 
 /* Abstract */
 #define janet_abstract_header(u) ((JanetAbstractHead *)((char *)u - offsetof(JanetAbstractHead, data)))
 #define janet_abstract_type(u) (janet_abstract_header(u)->type)
 #define janet_abstract_size(u) (janet_abstract_header(u)->size)
 JANET_API void *janet_abstract(const JanetAbstractType *type, size_t size);
+JANET_API void janet_abstract_barrier(void *abstract);
 
 /* Native */
 typedef void (*JanetModule)(JanetTable *);
@@ -1166,6 +1222,31 @@ JANET_API Janet janet_unmarshal(
 JANET_API JanetTable *janet_env_lookup(JanetTable *env);
 
 /* GC */
+
+/* Statistics about the garbage collector, filled in by janet_gcstats. The
+ * live counts are indexed by memory type: none, string, symbol, array,
+ * tuple, table, struct, fiber, buffer, function, abstract, funcenv, and
+ * funcdef. Times are in seconds. */
+#define JANET_GC_TYPE_COUNT 13
+typedef struct {
+    uint64_t live_objects[JANET_GC_TYPE_COUNT];
+    uint64_t live_bytes[JANET_GC_TYPE_COUNT];
+    uint64_t allocated;
+    uint64_t collections;
+    uint64_t full_collections;
+    double pause_time;
+    double last_pause;
+    double mark_time;
+    double sweep_time;
+    uint32_t roots;
+} JanetGCStats;
+
+/* Called with JANET_GC_BEGIN and JANET_GC_END around every collection. The
+ * hook must not allocate garbage collected memory or call into janet. */
+#define JANET_GC_BEGIN 0
+#define JANET_GC_END 1
+typedef void (*JanetGCHook)(int event, void *data);
+
 JANET_API void janet_mark(Janet x);
 JANET_API void janet_sweep(void);
 JANET_API void janet_collect(void);
@@ -1175,6 +1256,11 @@ JANET_API int janet_gcunroot(Janet root);
 JANET_API int janet_gcunrootall(Janet root);
 JANET_API int janet_gclock(void);
 JANET_API void janet_gcunlock(int handle);
+JANET_API void janet_gcstats(JanetGCStats *stats);
+JANET_API void janet_gchook(JanetGCHook hook, void *data);
+JANET_API int janet_arena_begin(uint32_t limit);
+JANET_API void janet_arena_promote(Janet x);
+JANET_API void janet_arena_end(int handle);
 
 /* Functions */
 JANET_API JanetFuncDef *janet_funcdef_alloc(void);
@@ -1269,6 +1355,36 @@ JANET_API void janet_unmarshal_janet(JanetMarshalContext *ctx, Janet *out);
 JANET_API void janet_register_abstract_type(const JanetAbstractType *at);
 JANET_API const JanetAbstractType *janet_get_abstract_type(Janet key);
 
+/* Persistent maps */
+extern JANET_API const JanetAbstractType janet_pmap_type;
+JANET_API Janet janet_pmap(void);
+JANET_API Janet janet_pmap_get(Janet map, Janet key);
+JANET_API Janet janet_pmap_put(Janet map, Janet key, Janet value);
+
+/* Persistent vectors */
+extern JANET_API const JanetAbstractType janet_pvec_type;
+JANET_API Janet janet_pvec(const Janet *xs, int32_t n);
+JANET_API Janet janet_pvec_get(Janet vec, int32_t index);
+JANET_API Janet janet_pvec_push(Janet vec, Janet x);
+
+/* Views */
+extern JANET_API const JanetAbstractType janet_view_type;
+JANET_API Janet janet_view(Janet parent, int32_t offset, int32_t length);
+
+/* Ropes */
+extern JANET_API const JanetAbstractType janet_rope_type;
+JANET_API Janet janet_rope(int32_t chunksize);
+JANET_API void janet_rope_push_bytes(Janet rope, const uint8_t *bytes, int32_t len);
+JANET_API JanetBuffer *janet_rope_flatten(Janet rope);
+
+/* Sorted maps */
+extern JANET_API const JanetAbstractType janet_sorted_type;
+JANET_API Janet janet_sorted(void);
+
+/* Sets */
+extern JANET_API const JanetAbstractType janet_set_type;
+JANET_API Janet janet_set(int32_t capacity);
+
 #ifdef JANET_TYPED_ARRAY
 
 typedef enum {